@@ -180,6 +180,19 @@ standard names. */
 
 /* USER CODE BEGIN Defines */
 /* Section where parameter definitions can be added (for instance, to override default ones in FreeRTOS.h) */
+/* Tickless idle: vPortSuppressTicksAndSleep() is provided by tickless_lptim.c (LPTIM1 wake-up) */
+#define configUSE_TICKLESS_IDLE                  2
+/* FP/MVE context saving follows the compiler flags: with a hard-float or a
+   Helium build the port saves s16-s31 (and the extended frame) only for the
+   tasks whose frame holds FP/MVE state (EXC_RETURN bit 4), lazily (LSPEN) */
+#if defined(__ARM_FP)
+#undef configENABLE_FPU
+#define configENABLE_FPU                         1
+#endif
+#if defined(__ARM_FEATURE_MVE)
+#undef configENABLE_MVE
+#define configENABLE_MVE                         1
+#endif
 /* USER CODE END Defines */
 
 #endif /* __FREERTOS_CONFIG_H */
@@ -0,0 +1,69 @@
+/**
+  ******************************************************************************
+  * @file    ctxsw_bench.h
+  * @brief   Context switch cost benchmark.
+  *
+  *          Two tasks of the same priority ping-pong with task notifications,
+  *          first without any FP/MVE use (basic exception frame), then with
+  *          FP/MVE use on both sides (extended frame, s16-s31 saved by the
+  *          port). The average cost of one switch, notification included,
+  *          is measured with the DWT cycle counter for both task types.
+  *
+  *          Build with CTXSW_BENCH = 1 and read the result with the debugger
+  *          or CTXSW_BENCH_GetResult() once Done is set.
+  ******************************************************************************
+  */
+
+#ifndef CTXSW_BENCH_H
+#define CTXSW_BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+#include "FreeRTOS.h"
+#include "cmsis_os2.h"
+
+/* 1: the benchmark tasks are started by MX_FREERTOS_Init() */
+#ifndef CTXSW_BENCH
+#define CTXSW_BENCH               0
+#endif
+
+/* Round trips (2 switches each) per task type */
+#ifndef CTXSW_BENCH_ROUNDS
+#define CTXSW_BENCH_ROUNDS        1000U
+#endif
+
+/* Benchmark tasks priority (above the other tasks) and stack size in bytes */
+#ifndef CTXSW_BENCH_PRIORITY
+#define CTXSW_BENCH_PRIORITY      osPriorityRealtime
+#endif
+#ifndef CTXSW_BENCH_STACK_SIZE
+#define CTXSW_BENCH_STACK_SIZE    (256U * 4U)
+#endif
+
+typedef struct
+{
+  uint32_t Rounds;         /* Round trips per task type                        */
+  uint32_t IntegerCycles;  /* Cycles per switch, no FP/MVE context             */
+  uint32_t VectorCycles;   /* Cycles per switch, FP/MVE context saved/restored */
+  uint32_t Done;           /* 1 once both measures are available               */
+} CTXSW_BENCH_ResultTypeDef;
+
+/**
+  * @brief  Creates the benchmark tasks, which run once then delete themselves.
+  * @retval 0 if started, -1 if a task could not be created
+  */
+int32_t CTXSW_BENCH_Start(void);
+
+/**
+  * @brief  Copies the benchmark result.
+  */
+void CTXSW_BENCH_GetResult(CTXSW_BENCH_ResultTypeDef *Result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CTXSW_BENCH_H */
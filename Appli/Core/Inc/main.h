@@ -71,6 +71,8 @@ typedef funcptr funcptr_NS;
 void Error_Handler(void);
 
 /* USER CODE BEGIN EFP */
+void SECURE_NSC_Init(void);
+uint32_t SECURE_NSC_NotifyCallback(uint32_t CallbackId);
 
 /* USER CODE END EFP */
 
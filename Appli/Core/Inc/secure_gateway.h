@@ -0,0 +1,74 @@
+/**
+  ******************************************************************************
+  * @file    secure_gateway.h
+  * @brief   Secure side dispatcher of the batched non-secure callable gateway.
+  *
+  *          SECURE_Gateway() (secure_nsc.c) is the single entry point; it
+  *          hands the batch buffer to SECURE_GATEWAY_Process() which checks
+  *          the whole buffer once, then runs every request through the
+  *          service registered for its type.
+  *
+  *          The address check is done through SECURE_GATEWAY_CHECK_RANGE(),
+  *          which can be redefined to build the dispatcher without CMSE.
+  ******************************************************************************
+  */
+
+#ifndef SECURE_GATEWAY_H
+#define SECURE_GATEWAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "secure_nsc.h"
+
+/* Non-secure read/write check of the batch buffer, returns NULL if refused */
+#ifndef SECURE_GATEWAY_CHECK_RANGE
+#include <arm_cmse.h>
+#define SECURE_GATEWAY_CHECK_RANGE(__ADDR__, __SIZE__) \
+  cmse_check_address_range((__ADDR__), (__SIZE__), CMSE_NONSECURE | CMSE_MPU_READWRITE)
+#endif
+
+/* Largest batch buffer accepted */
+#ifndef SECURE_GATEWAY_MAX_BATCH_SIZE
+#define SECURE_GATEWAY_MAX_BATCH_SIZE  0x10000U
+#endif
+
+/**
+  * @brief  Secure service processing one request.
+  *         In and Out point into the non-secure batch buffer: they are in
+  *         range but their content may change while the service runs.
+  * @param  Param   Request parameters (2 words)
+  * @param  In      Input data, NULL if InSize is 0
+  * @param  InSize  Input data size in bytes
+  * @param  Out     Output data, NULL if the capacity is 0
+  * @param  OutSize In: output capacity, out: bytes produced
+  * @retval SECURE_StatusTypeDef
+  */
+typedef int32_t (*SECURE_ServiceTypeDef)(const uint32_t *Param, const uint8_t *In, uint32_t InSize,
+                                         uint8_t *Out, uint32_t *OutSize);
+
+/**
+  * @brief  Installs the service of a request type (NULL removes it).
+  * @param  Type    SECURE_RequestTypeTypeDef
+  * @param  Service Service function
+  * @retval SECURE_OK or SECURE_ERROR_PARAM
+  */
+int32_t SECURE_GATEWAY_RegisterService(uint32_t Type, SECURE_ServiceTypeDef Service);
+
+/**
+  * @brief  Runs a batch of requests.
+  * @param  Batch Non-secure batch buffer (SECURE_BatchTypeDef, requests, data)
+  * @param  Size  Batch buffer size in bytes
+  * @retval SECURE_OK once the batch is processed (per request status in the
+  *         requests), SECURE_ERROR_ACCESS or SECURE_ERROR_PARAM if the buffer
+  *         is refused, nothing being processed
+  */
+int32_t SECURE_GATEWAY_Process(void *Batch, uint32_t Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SECURE_GATEWAY_H */
@@ -0,0 +1,147 @@
+/**
+  ******************************************************************************
+  * @file    tickless_lptim.h
+  * @brief   FreeRTOS tickless idle based on LPTIM1 clocked by LSE.
+  *
+  *          Provides vPortSuppressTicksAndSleep() when configUSE_TICKLESS_IDLE
+  *          is 2. SysTick keeps generating the RTOS tick while tasks run; when
+  *          the idle task expects at least configEXPECTED_IDLE_TIME_BEFORE_SLEEP
+  *          ticks, SysTick is stopped and LPTIM1 wakes the core up instead.
+  *
+  *          The conversion and compensation helpers below only do integer
+  *          arithmetic on their arguments so they can be built on a host.
+  ******************************************************************************
+  */
+
+#ifndef TICKLESS_LPTIM_H
+#define TICKLESS_LPTIM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* LPTIM1 kernel clock: 1 for the 32.768 kHz LSE crystal, 0 for LSI.
+   The time slept is stepped into the tick count, so the error of this clock
+   adds up over every idle period. LSE keeps it within the crystal tolerance
+   (tens of ppm); LSI is only trimmed to a few percent over voltage and
+   temperature (see the datasheet), which the RTOS time then inherits while
+   idle. LSI only suits boards without an LSE crystal. */
+#ifndef TICKLESS_LPTIM_USE_LSE
+#define TICKLESS_LPTIM_USE_LSE    1
+#endif
+
+/* LPTIM1 counter clock (no prescaler) */
+#ifndef TICKLESS_LPTIM_CLOCK_HZ
+#if (TICKLESS_LPTIM_USE_LSE == 1)
+#define TICKLESS_LPTIM_CLOCK_HZ   32768UL
+#else
+#define TICKLESS_LPTIM_CLOCK_HZ   32000UL
+#endif
+#endif
+
+/* Longest sleep in LPTIM1 counts: the 16-bit counter runs freely and the
+   sleep is measured modulo 2^16, the margin absorbs a late wake-up */
+#define TICKLESS_LPTIM_MAX_COUNTS 0xF000UL
+
+/* Shortest sleep in LPTIM1 counts: the compare register is written through
+   the LPTIM1 kernel clock domain and only matches a few counts later */
+#define TICKLESS_LPTIM_MIN_COUNTS 8UL
+
+/**
+  * @brief  Number of LPTIM counts to program for an idle period.
+  *         The period starts now, with Remaining core cycles left before the
+  *         pending tick, and ends on the ExpectedIdleTicks-th tick boundary.
+  *         Rounded down so the core never wakes up after the deadline.
+  * @param  ExpectedIdleTicks Idle time given by the kernel
+  * @param  Reload            Core cycles per tick
+  * @param  Remaining         Core cycles left in the current tick (SysTick VAL)
+  * @param  CycleHz           Core clock frequency
+  * @param  CountHz           LPTIM counter frequency
+  * @retval Counts, saturated to TICKLESS_LPTIM_MAX_COUNTS, 0 if no tick is expected
+  */
+static inline uint32_t TICKLESS_IdleCounts(uint32_t ExpectedIdleTicks, uint32_t Reload, uint32_t Remaining,
+                                           uint32_t CycleHz, uint32_t CountHz)
+{
+  uint64_t cycles;
+  uint64_t counts;
+
+  if (ExpectedIdleTicks == 0U)
+  {
+    return 0U;
+  }
+
+  cycles = (uint64_t)Remaining + ((uint64_t)(ExpectedIdleTicks - 1U) * Reload);
+  counts = (cycles * CountHz) / CycleHz;
+
+  return (counts > TICKLESS_LPTIM_MAX_COUNTS) ? TICKLESS_LPTIM_MAX_COUNTS : (uint32_t)counts;
+}
+
+/**
+  * @brief  LPTIM counts elapsed between two readings of the 16-bit counter.
+  *         Valid across one counter wrap, which TICKLESS_LPTIM_MAX_COUNTS
+  *         keeps a sleep within.
+  * @param  Start Counter read before the sleep
+  * @param  End   Counter read after the sleep
+  * @retval Elapsed counts (0..0xFFFF)
+  */
+static inline uint32_t TICKLESS_Elapsed(uint32_t Start, uint32_t End)
+{
+  return (End - Start) & 0xFFFFU;
+}
+
+/**
+  * @brief  Converts the measured sleep into whole ticks and SysTick phase.
+  *         SleptCounts is the difference of two readings of the free-running
+  *         counter, so its truncation error is not biased and does not add up
+  *         over many sleeps. The result never exceeds ExpectedIdleTicks, the
+  *         most vTaskStepTick() accepts; the SysTick phase is kept in any case.
+  * @param  SleptCounts       LPTIM counts elapsed during the sleep
+  * @param  ExpectedIdleTicks Idle time given by the kernel (>= 1)
+  * @param  Reload            Core cycles per tick
+  * @param  Remaining         Core cycles left in the current tick before the sleep
+  * @param  CycleHz           Core clock frequency
+  * @param  CountHz           LPTIM counter frequency
+  * @param  NextRemaining     Returns the core cycles left before the next tick (1..Reload)
+  * @retval Number of complete ticks to step the kernel by
+  */
+static inline uint32_t TICKLESS_Compensate(uint32_t SleptCounts, uint32_t ExpectedIdleTicks, uint32_t Reload,
+                                           uint32_t Remaining, uint32_t CycleHz, uint32_t CountHz,
+                                           uint32_t *NextRemaining)
+{
+  uint64_t slept = ((uint64_t)SleptCounts * CycleHz) / CountHz;
+  uint64_t beyond;
+  uint64_t ticks;
+
+  if (slept < Remaining)
+  {
+    /* Woken up before the pending tick */
+    *NextRemaining = Remaining - (uint32_t)slept;
+    return 0U;
+  }
+
+  /* The pending tick, then one per full period */
+  beyond = slept - Remaining;
+  ticks = (beyond / Reload) + 1U;
+  *NextRemaining = Reload - (uint32_t)(beyond % Reload);
+
+  return (ticks > ExpectedIdleTicks) ? ExpectedIdleTicks : (uint32_t)ticks;
+}
+
+/**
+  * @brief  Starts LSE (or LSI) and configures LPTIM1 as the tickless wake-up source.
+  *         Called once before the scheduler starts.
+  */
+void TICKLESS_Init(void);
+
+/**
+  * @brief  LPTIM1 interrupt processing, called from LPTIM1_IRQHandler().
+  */
+void TICKLESS_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TICKLESS_LPTIM_H */
@@ -0,0 +1,123 @@
+/**
+  ******************************************************************************
+  * @file    workqueue.h
+  * @brief   Deferred interrupt work queue.
+  *
+  *          Interrupt handlers post small work items instead of running the
+  *          work in interrupt context; a worker task runs them in batches.
+  *
+  *          There is one SPSC ring per NVIC priority allowed to call the
+  *          FreeRTOS API (configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY to
+  *          configLIBRARY_LOWEST_INTERRUPT_PRIORITY): handlers sharing a
+  *          priority cannot preempt each other, so each ring has a single
+  *          producer. Posts from tasks go to one more ring, guarded by a
+  *          critical section. The worker drains the rings from the most
+  *          urgent priority, WQ_BATCH_SIZE items per ring and per pass.
+  ******************************************************************************
+  */
+
+#ifndef WORKQUEUE_H
+#define WORKQUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+#include "FreeRTOS.h"
+#include "cmsis_os2.h"
+#include "workqueue_ring.h"
+
+/* Largest number of items run from one ring before moving to the next */
+#ifndef WQ_BATCH_SIZE
+#define WQ_BATCH_SIZE         8U
+#endif
+
+/* Worker task priority and stack size in bytes */
+#ifndef WQ_WORKER_PRIORITY
+#define WQ_WORKER_PRIORITY    osPriorityHigh
+#endif
+#ifndef WQ_WORKER_STACK_SIZE
+#define WQ_WORKER_STACK_SIZE  (256U * 4U)
+#endif
+
+/* One ring per interrupt priority able to post, plus the task ring (last) */
+#define WQ_ISR_RING_COUNT     (configLIBRARY_LOWEST_INTERRUPT_PRIORITY - \
+                               configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY + 1U)
+#define WQ_RING_COUNT         (WQ_ISR_RING_COUNT + 1U)
+
+/**
+  * @brief  Work queue status
+  */
+typedef enum
+{
+  WQ_OK              =  0, /*!< Item posted                                              */
+  WQ_ERROR_FULL      = -1, /*!< Ring of the caller priority full, item dropped           */
+  WQ_ERROR_PRIORITY  = -2, /*!< Caller interrupt priority above the syscall priority     */
+  WQ_ERROR_PARAM     = -3, /*!< Null handler                                             */
+  WQ_ERROR_INIT      = -4, /*!< Worker task not created                                  */
+} WQ_StatusTypeDef;
+
+/**
+  * @brief  Statistics of one ring, written by its producer
+  */
+typedef struct
+{
+  uint32_t Posted;       /*!< Items pushed                          */
+  uint32_t Dropped;      /*!< Items rejected, ring full             */
+  uint32_t MaxDepth;     /*!< Highest number of items in the ring   */
+} WQ_RingStatsTypeDef;
+
+/**
+  * @brief  Work queue statistics, latencies in core cycles.
+  *         Every update is made either under taskENTER_CRITICAL() or by an
+  *         interrupt that the critical section masks (only priorities allowed
+  *         to call the FreeRTOS API post), so WQ_GetStats() and
+  *         WQ_ResetStats() see and clear whole updates only.
+  */
+typedef struct
+{
+  WQ_RingStatsTypeDef Ring[WQ_RING_COUNT]; /*!< Index 0 is the most urgent interrupt priority, last is the task ring */
+  uint32_t Executed;                       /*!< Items run by the worker                                      */
+  uint32_t Batches;                        /*!< Worker wake-ups with at least one item                       */
+  uint32_t MaxBatch;                       /*!< Most items run in one wake-up                                */
+  uint32_t MaxLatency;                     /*!< Longest time between post and start of the handler           */
+  uint64_t TotalLatency;                   /*!< Sum of the latencies, average is TotalLatency / Executed     */
+} WQ_StatsTypeDef;
+
+/**
+  * @brief  Creates the worker task and starts the cycle counter.
+  *         Called once, before any post.
+  * @retval WQ_OK or WQ_ERROR_INIT
+  */
+WQ_StatusTypeDef WQ_Init(void);
+
+/**
+  * @brief  Posts a work item from an interrupt handler or a task.
+  *         The ring is selected from the caller context.
+  * @param  Handler Function called by the worker task
+  * @param  Context First handler argument
+  * @param  Arg     Second handler argument
+  * @retval WQ_StatusTypeDef
+  */
+WQ_StatusTypeDef WQ_Post(WQ_HandlerTypeDef Handler, void *Context, uint32_t Arg);
+
+/**
+  * @brief  Copies the statistics, consistent with each other. The worker
+  *         adds its counters (Executed, Batches, latencies) once the rings
+  *         are empty, so an ongoing wake-up is not counted yet.
+  * @param  Stats Returns the statistics
+  */
+void WQ_GetStats(WQ_StatsTypeDef *Stats);
+
+/**
+  * @brief  Clears the statistics. Items of an ongoing worker wake-up are
+  *         counted after the reset.
+  */
+void WQ_ResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WORKQUEUE_H */
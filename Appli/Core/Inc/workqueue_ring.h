@@ -0,0 +1,120 @@
+/**
+  ******************************************************************************
+  * @file    workqueue_ring.h
+  * @brief   Lock-free single-producer single-consumer ring of work items.
+  *
+  *          The producer only writes Head, the consumer only writes Tail;
+  *          both are free-running and the slot index is taken modulo the
+  *          depth. An item is published by the Head update that follows
+  *          its copy, and released by the Tail update that follows its read.
+  *
+  *          Only depends on stdint: WQ_RING_BARRIER() can be redefined to
+  *          build the ring on a host.
+  ******************************************************************************
+  */
+
+#ifndef WORKQUEUE_RING_H
+#define WORKQUEUE_RING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* Number of items per ring (power of 2) */
+#ifndef WQ_RING_DEPTH
+#define WQ_RING_DEPTH       16U
+#endif
+
+#if (WQ_RING_DEPTH & (WQ_RING_DEPTH - 1U)) != 0U
+#error "WQ_RING_DEPTH must be a power of 2"
+#endif
+
+/* Memory barrier ordering the item copy and the index update */
+#ifndef WQ_RING_BARRIER
+#define WQ_RING_BARRIER()   __DMB()
+#endif
+
+/**
+  * @brief  Work handler, runs in the worker task context
+  */
+typedef void (*WQ_HandlerTypeDef)(uint32_t Arg, void *Context);
+
+/**
+  * @brief  Work item (16 bytes)
+  */
+typedef struct
+{
+  WQ_HandlerTypeDef Handler;   /*!< Function called by the worker task          */
+  void             *Context;   /*!< First handler argument (object, handle ...) */
+  uint32_t          Arg;       /*!< Second handler argument (event, flags ...)  */
+  uint32_t          Timestamp; /*!< Cycle counter when the item was posted      */
+} WQ_ItemTypeDef;
+
+/**
+  * @brief  Ring of work items
+  */
+typedef struct
+{
+  volatile uint32_t Head;                 /*!< Items pushed, written by the producer only */
+  volatile uint32_t Tail;                 /*!< Items popped, written by the consumer only */
+  WQ_ItemTypeDef    Item[WQ_RING_DEPTH];  /*!< Items, index is Head/Tail modulo the depth */
+} WQ_RingTypeDef;
+
+/**
+  * @brief  Pushes an item, producer side.
+  * @param  Ring Ring
+  * @param  Item Item to copy
+  * @retval Number of items in the ring once pushed, 0 if the ring is full
+  */
+static inline uint32_t WQ_RingPush(WQ_RingTypeDef *Ring, const WQ_ItemTypeDef *Item)
+{
+  const uint32_t head = Ring->Head;
+  const uint32_t depth = head - Ring->Tail;
+
+  if (depth >= WQ_RING_DEPTH)
+  {
+    return 0U;
+  }
+
+  Ring->Item[head & (WQ_RING_DEPTH - 1U)] = *Item;
+
+  /* Publish the item */
+  WQ_RING_BARRIER();
+  Ring->Head = head + 1U;
+
+  return depth + 1U;
+}
+
+/**
+  * @brief  Pops an item, consumer side.
+  * @param  Ring Ring
+  * @param  Item Returns the item
+  * @retval 1 if an item was popped, 0 if the ring is empty
+  */
+static inline uint32_t WQ_RingPop(WQ_RingTypeDef *Ring, WQ_ItemTypeDef *Item)
+{
+  const uint32_t tail = Ring->Tail;
+
+  if (Ring->Head == tail)
+  {
+    return 0U;
+  }
+
+  /* Read the item published before the Head update */
+  WQ_RING_BARRIER();
+  *Item = Ring->Item[tail & (WQ_RING_DEPTH - 1U)];
+
+  /* Release the slot */
+  WQ_RING_BARRIER();
+  Ring->Tail = tail + 1U;
+
+  return 1U;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WORKQUEUE_RING_H */
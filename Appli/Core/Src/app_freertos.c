@@ -23,6 +23,9 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "psram_shutdown.h"
+#include "tickless_lptim.h"
+#include "workqueue.h"
+#include "ctxsw_bench.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -64,6 +67,9 @@ const osThreadAttr_t defaultTask_attributes = {
   */
 void MX_FREERTOS_Init(void) {
   /* USER CODE BEGIN Init */
+#if (configUSE_TICKLESS_IDLE == 2)
+  TICKLESS_Init();
+#endif
 
   /* USER CODE END Init */
 
@@ -87,6 +93,16 @@ void MX_FREERTOS_Init(void) {
 
   /* USER CODE BEGIN RTOS_THREADS */
   /* add threads, ... */
+  if (WQ_Init() != WQ_OK)
+  {
+    Error_Handler();
+  }
+#if (CTXSW_BENCH == 1)
+  if (CTXSW_BENCH_Start() != 0)
+  {
+    Error_Handler();
+  }
+#endif
   /* USER CODE END RTOS_THREADS */
 
   /* USER CODE BEGIN RTOS_EVENTS */
@@ -115,11 +131,15 @@ void StartDefaultTask(void *argument)
   osDelay(2000);
   
   /* Shutdown PSRAM and reset */
+#if (PSRAM_WARM_RETENTION == 1)
+  PSRAM_RetainAndReset();
+#else
   PSRAM_ShutdownAndReset();
+#endif
   /* Infinite loop */
   for(;;)
   {
-    osDelay(1);
+    osDelay(osWaitForever);
   }
   /* USER CODE END defaultTask */
 }
@@ -0,0 +1,170 @@
+/**
+  ******************************************************************************
+  * @file    ctxsw_bench.c
+  * @brief   Context switch cost benchmark.
+  *
+  *          The integer pass runs first: a task keeps its FP/MVE context
+  *          (CONTROL.FPCA) once it has executed an FP or MVE instruction, so
+  *          both tasks only enter the vector pass afterwards. In the Helium
+  *          build the vector work is a CMSIS-DSP MVE kernel, otherwise a
+  *          scalar FP operation.
+  ******************************************************************************
+  */
+
+#include "ctxsw_bench.h"
+#include "task.h"
+#include <string.h>
+#if defined(ARM_MATH_HELIUM)
+#include "arm_math.h"
+#endif
+
+/* Vector length of the FP/MVE work done between two switches */
+#define CTXSW_BENCH_VECTOR_SIZE   8U
+
+static CTXSW_BENCH_ResultTypeDef ctxsw_result;
+static TaskHandle_t      ctxsw_main;
+static TaskHandle_t      ctxsw_peer;
+static volatile uint32_t ctxsw_vector;
+
+static float            ctxsw_a[CTXSW_BENCH_VECTOR_SIZE] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f };
+static float            ctxsw_b[CTXSW_BENCH_VECTOR_SIZE] = { 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f };
+static volatile float   ctxsw_sink;
+
+static StaticTask_t     ctxsw_main_cb;
+static StaticTask_t     ctxsw_peer_cb;
+static uint32_t         ctxsw_main_stack[CTXSW_BENCH_STACK_SIZE / sizeof(uint32_t)];
+static uint32_t         ctxsw_peer_stack[CTXSW_BENCH_STACK_SIZE / sizeof(uint32_t)];
+
+static const osThreadAttr_t ctxsw_main_attributes = {
+  .name = "ctxswMain",
+  .priority = (osPriority_t) CTXSW_BENCH_PRIORITY,
+  .cb_mem = &ctxsw_main_cb,
+  .cb_size = sizeof(ctxsw_main_cb),
+  .stack_mem = ctxsw_main_stack,
+  .stack_size = sizeof(ctxsw_main_stack)
+};
+
+static const osThreadAttr_t ctxsw_peer_attributes = {
+  .name = "ctxswPeer",
+  .priority = (osPriority_t) CTXSW_BENCH_PRIORITY,
+  .cb_mem = &ctxsw_peer_cb,
+  .cb_size = sizeof(ctxsw_peer_cb),
+  .stack_mem = ctxsw_peer_stack,
+  .stack_size = sizeof(ctxsw_peer_stack)
+};
+
+static void CTXSW_BENCH_Main(void *argument);
+static void CTXSW_BENCH_Peer(void *argument);
+
+int32_t CTXSW_BENCH_Start(void)
+{
+  DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+  DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+
+  ctxsw_peer = (TaskHandle_t)osThreadNew(CTXSW_BENCH_Peer, NULL, &ctxsw_peer_attributes);
+  if (ctxsw_peer == NULL)
+  {
+    return -1;
+  }
+
+  ctxsw_main = (TaskHandle_t)osThreadNew(CTXSW_BENCH_Main, NULL, &ctxsw_main_attributes);
+  if (ctxsw_main == NULL)
+  {
+    vTaskDelete(ctxsw_peer);
+    return -1;
+  }
+
+  return 0;
+}
+
+void CTXSW_BENCH_GetResult(CTXSW_BENCH_ResultTypeDef *Result)
+{
+  taskENTER_CRITICAL();
+  (void)memcpy(Result, &ctxsw_result, sizeof(ctxsw_result));
+  taskEXIT_CRITICAL();
+}
+
+/**
+  * @brief  FP/MVE work, leaves live FP/MVE state in the calling task.
+  */
+static void CTXSW_BENCH_UseVector(void)
+{
+#if defined(ARM_MATH_HELIUM)
+  float32_t dot;
+
+  arm_dot_prod_f32(ctxsw_a, ctxsw_b, CTXSW_BENCH_VECTOR_SIZE, &dot);
+  ctxsw_sink = dot;
+#else
+  ctxsw_sink = (ctxsw_sink * ctxsw_a[0]) + ctxsw_b[0];
+#endif
+}
+
+/**
+  * @brief  Runs CTXSW_BENCH_ROUNDS round trips with the peer task.
+  * @param  Vector 1 to do FP/MVE work on both sides between the switches
+  * @retval Average cycles per context switch
+  */
+static uint32_t CTXSW_BENCH_Measure(uint32_t Vector)
+{
+  uint32_t start;
+  uint32_t round;
+
+  ctxsw_vector = Vector;
+
+  start = DWT->CYCCNT;
+  for (round = 0U; round < CTXSW_BENCH_ROUNDS; round++)
+  {
+    if (Vector != 0U)
+    {
+      CTXSW_BENCH_UseVector();
+    }
+    (void)xTaskNotifyGive(ctxsw_peer);
+    (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  }
+
+  return (DWT->CYCCNT - start) / (2U * CTXSW_BENCH_ROUNDS);
+}
+
+/**
+  * @brief  Benchmark task: integer pass then vector pass.
+  * @param  argument Not used
+  */
+static void CTXSW_BENCH_Main(void *argument)
+{
+  uint32_t integer_cycles;
+  uint32_t vector_cycles;
+
+  (void)argument;
+
+  integer_cycles = CTXSW_BENCH_Measure(0U);
+  vector_cycles  = CTXSW_BENCH_Measure(1U);
+
+  taskENTER_CRITICAL();
+  ctxsw_result.Rounds        = CTXSW_BENCH_ROUNDS;
+  ctxsw_result.IntegerCycles = integer_cycles;
+  ctxsw_result.VectorCycles  = vector_cycles;
+  ctxsw_result.Done          = 1U;
+  taskEXIT_CRITICAL();
+
+  vTaskDelete(ctxsw_peer);
+  vTaskDelete(NULL);
+}
+
+/**
+  * @brief  Peer task: answers every notification.
+  * @param  argument Not used
+  */
+static void CTXSW_BENCH_Peer(void *argument)
+{
+  (void)argument;
+
+  for (;;)
+  {
+    (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    if (ctxsw_vector != 0U)
+    {
+      CTXSW_BENCH_UseVector();
+    }
+    (void)xTaskNotifyGive(ctxsw_main);
+  }
+}
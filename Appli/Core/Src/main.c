@@ -85,6 +85,7 @@ int main(void)
   SystemIsolation_Config();
   MX_GPIO_Init();
   /* USER CODE BEGIN 2 */
+  SECURE_NSC_Init();
   /* USER CODE END 2 */
 
   /* Init scheduler */
@@ -130,6 +131,8 @@ int main(void)
   HAL_GPIO_ConfigPinAttributes(GPIOO,GPIO_PIN_1,GPIO_PIN_SEC|GPIO_PIN_NPRIV);
 
   /* USER CODE BEGIN RIF_Init 1 */
+  /* LPTIM1 drives the FreeRTOS tickless idle */
+  HAL_RIF_RISC_SetSlaveSecureAttributes(RIF_RISC_PERIPH_INDEX_LPTIM1, RIF_ATTRIBUTE_SEC | RIF_ATTRIBUTE_PRIV);
 
   /* USER CODE END RIF_Init 1 */
   /* USER CODE BEGIN RIF_Init 2 */
@@ -0,0 +1,143 @@
+/**
+  ******************************************************************************
+  * @file    secure_gateway.c
+  * @brief   Secure side dispatcher of the batched non-secure callable gateway.
+  *
+  *          One secure state transition serves a whole batch: the buffer is
+  *          range checked once, then every request descriptor is copied to
+  *          the secure stack before its data offsets are validated, so the
+  *          non-secure side cannot change a descriptor between its check and
+  *          its use. The data of a request must lie after the descriptors
+  *          and its output must not overlap its input, so that a service
+  *          never overwrites a descriptor or the input it is still reading.
+  ******************************************************************************
+  */
+
+#include "secure_gateway.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Services indexed by request type */
+static SECURE_ServiceTypeDef secure_services[SECURE_REQ_COUNT];
+
+/**
+  * @brief  Checks that [Offset, Offset + Length) lies in a buffer of Size bytes.
+  */
+static int32_t SECURE_GATEWAY_InBuffer(uint32_t Offset, uint32_t Length, uint32_t Size)
+{
+  return ((Length <= Size) && (Offset <= (Size - Length))) ? 1 : 0;
+}
+
+/**
+  * @brief  Checks that the data of a request lies in the data area of the
+  *         buffer, after the descriptors, and that its output does not
+  *         overlap its input. Empty regions are not checked.
+  */
+static int32_t SECURE_GATEWAY_CheckData(const SECURE_RequestTypeDef *Request, uint32_t DataOffset, uint32_t Size)
+{
+  if ((SECURE_GATEWAY_InBuffer(Request->InOffset, Request->InSize, Size) == 0) ||
+      (SECURE_GATEWAY_InBuffer(Request->OutOffset, Request->OutSize, Size) == 0))
+  {
+    return 0;
+  }
+  if (((Request->InSize != 0U) && (Request->InOffset < DataOffset)) ||
+      ((Request->OutSize != 0U) && (Request->OutOffset < DataOffset)))
+  {
+    return 0;
+  }
+  /* Both ends are in the buffer (no wrap): the regions overlap if each starts before the other ends */
+  if ((Request->InSize != 0U) && (Request->OutSize != 0U) &&
+      (Request->InOffset < (Request->OutOffset + Request->OutSize)) &&
+      (Request->OutOffset < (Request->InOffset + Request->InSize)))
+  {
+    return 0;
+  }
+  return 1;
+}
+
+int32_t SECURE_GATEWAY_RegisterService(uint32_t Type, SECURE_ServiceTypeDef Service)
+{
+  if ((Type == (uint32_t)SECURE_REQ_NONE) || (Type >= (uint32_t)SECURE_REQ_COUNT))
+  {
+    return SECURE_ERROR_PARAM;
+  }
+
+  secure_services[Type] = Service;
+  return SECURE_OK;
+}
+
+int32_t SECURE_GATEWAY_Process(void *Batch, uint32_t Size)
+{
+  SECURE_BatchTypeDef *batch = (SECURE_BatchTypeDef *)Batch;
+  SECURE_RequestTypeDef *requests;
+  SECURE_RequestTypeDef request;
+  SECURE_ServiceTypeDef service;
+  uint32_t capacity;
+  uint32_t count;
+  uint32_t data;
+  uint32_t index;
+  uint8_t *base = (uint8_t *)Batch;
+  int32_t status;
+
+  if ((Batch == NULL) || (Size < sizeof(SECURE_BatchTypeDef)) || (Size > SECURE_GATEWAY_MAX_BATCH_SIZE) ||
+      (((uintptr_t)Batch & (sizeof(uint32_t) - 1U)) != 0U))
+  {
+    return SECURE_ERROR_PARAM;
+  }
+
+  /* Single check for the whole batch: header, requests and data */
+  if (SECURE_GATEWAY_CHECK_RANGE(Batch, Size) == NULL)
+  {
+    return SECURE_ERROR_ACCESS;
+  }
+
+  count = batch->Count;
+  if (count > ((Size - sizeof(SECURE_BatchTypeDef)) / sizeof(SECURE_RequestTypeDef)))
+  {
+    return SECURE_ERROR_PARAM;
+  }
+
+  requests = SECURE_BATCH_REQUESTS(batch);
+  data = SECURE_BATCH_DATA_OFFSET(count);
+  batch->Processed = 0U;
+
+  for (index = 0U; index < count; index++)
+  {
+    /* Work on a secure copy of the descriptor */
+    (void)memcpy(&request, &requests[index], sizeof(request));
+
+    if (request.Type == (uint32_t)SECURE_REQ_NONE)
+    {
+      status = SECURE_OK;
+      request.OutSize = 0U;
+    }
+    else if ((request.Type >= (uint32_t)SECURE_REQ_COUNT) || (secure_services[request.Type] == NULL))
+    {
+      status = SECURE_ERROR_UNSUPPORTED;
+      request.OutSize = 0U;
+    }
+    else if (SECURE_GATEWAY_CheckData(&request, data, Size) == 0)
+    {
+      status = SECURE_ERROR_PARAM;
+      request.OutSize = 0U;
+    }
+    else
+    {
+      service = secure_services[request.Type];
+      capacity = request.OutSize;
+      status = service(request.Param,
+                       (request.InSize != 0U) ? &base[request.InOffset] : NULL, request.InSize,
+                       (capacity != 0U) ? &base[request.OutOffset] : NULL, &request.OutSize);
+      if (request.OutSize > capacity)
+      {
+        request.OutSize = capacity;
+      }
+    }
+
+    requests[index].Status  = status;
+    requests[index].OutSize = request.OutSize;
+    batch->Processed = index + 1U;
+  }
+
+  return SECURE_OK;
+}
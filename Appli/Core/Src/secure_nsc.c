@@ -22,6 +22,8 @@
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 #include "secure_nsc.h"
+#include "secure_gateway.h"
+#include <arm_cmse.h>
 /** @addtogroup STM32N6xx_HAL_Examples
 
   * @{
@@ -40,8 +42,122 @@ void *pSecureErrorCallback = NULL;   /* Pointer to secure error callback in Non-
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+static int32_t SECURE_SetCallback(SECURE_CallbackIDTypeDef CallbackId, void *func);
+static int32_t SECURE_RegisterCallbackService(const uint32_t *Param, const uint8_t *In, uint32_t InSize,
+                                              uint8_t *Out, uint32_t *OutSize);
+
 /* Private functions ---------------------------------------------------------*/
 
+/**
+  * @brief  Stores a non-secure callback.
+  *         The address is tagged as a non-secure function pointer and must
+  *         lie in non-secure memory, so that a later call cannot branch
+  *         into the secure image.
+  * @param  CallbackId  callback identifier
+  * @param  func        pointer to non-secure function
+  * @retval SECURE_OK or SECURE_ERROR_PARAM
+  */
+static int32_t SECURE_SetCallback(SECURE_CallbackIDTypeDef CallbackId, void *func)
+{
+  int32_t status = SECURE_OK;
+
+  if (func == NULL)
+  {
+    return SECURE_ERROR_PARAM;
+  }
+
+  func = cmse_nsfptr_create(func);
+  if ((cmse_is_nsfptr(func) == 0) ||
+      (cmse_check_address_range(func, sizeof(uint16_t), CMSE_NONSECURE) == NULL))
+  {
+    return SECURE_ERROR_PARAM;
+  }
+
+  switch (CallbackId)
+  {
+    case SECURE_FAULT_CB_ID:           /* SecureFault Interrupt occurred */
+      pSecureFaultCallback = func;
+      break;
+    case IAC_ERROR_CB_ID:             /* Illegal Access Interrupt occurred */
+      pSecureErrorCallback = func;
+      break;
+    default:
+      /* unknown */
+      status = SECURE_ERROR_PARAM;
+      break;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Gateway service of SECURE_REQ_REGISTER_CALLBACK.
+  * @param  Param   Param[0]: callback identifier, Param[1]: non-secure function address
+  * @param  In      Not used
+  * @param  InSize  Not used
+  * @param  Out     Not used
+  * @param  OutSize Set to 0
+  * @retval SECURE_OK or SECURE_ERROR_PARAM
+  */
+static int32_t SECURE_RegisterCallbackService(const uint32_t *Param, const uint8_t *In, uint32_t InSize,
+                                              uint8_t *Out, uint32_t *OutSize)
+{
+  (void)In;
+  (void)InSize;
+  (void)Out;
+
+  *OutSize = 0U;
+  return SECURE_SetCallback((SECURE_CallbackIDTypeDef)Param[0], (void *)Param[1]);
+}
+
+/**
+  * @brief  Installs the secure services of the gateway provided by this file.
+  * @retval None
+  */
+void SECURE_NSC_Init(void)
+{
+  (void)SECURE_GATEWAY_RegisterService(SECURE_REQ_REGISTER_CALLBACK, SECURE_RegisterCallbackService);
+}
+
+/**
+  * @brief  Calls a registered non-secure callback, if any.
+  *         The stored pointer is tagged again before the non-secure call.
+  * @param  CallbackId  SECURE_CallbackIDTypeDef
+  * @retval 1 if the callback was called, 0 if none is registered
+  */
+uint32_t SECURE_NSC_NotifyCallback(uint32_t CallbackId)
+{
+  funcptr_NS callback_NS;
+  void *func;
+
+  switch (CallbackId)
+  {
+    case SECURE_FAULT_CB_ID:
+      func = pSecureFaultCallback;
+      break;
+    case IAC_ERROR_CB_ID:
+      func = pSecureErrorCallback;
+      break;
+    default:
+      func = NULL;
+      break;
+  }
+
+  if (func == NULL)
+  {
+    return 0U;
+  }
+
+  callback_NS = (funcptr_NS)cmse_nsfptr_create(func);
+  if (cmse_is_nsfptr(callback_NS) == 0)
+  {
+    return 0U;
+  }
+  callback_NS();
+
+  return 1U;
+}
+
 /**
   * @brief  Secure registration of non-secure callback.
   * @param  CallbackId  callback identifier
@@ -50,21 +166,20 @@ void *pSecureErrorCallback = NULL;   /* Pointer to secure error callback in Non-
   */
   CMSE_NS_ENTRY void SECURE_RegisterCallback(SECURE_CallbackIDTypeDef CallbackId, void *func)
   {
-      if(func != NULL)
-      {
-        switch(CallbackId)
-        {
-          case SECURE_FAULT_CB_ID:           /* SecureFault Interrupt occurred */
-          pSecureFaultCallback = func;
-          break;
-          case IAC_ERROR_CB_ID:             /* Illegal Access Interrupt occurred */
-          pSecureErrorCallback = func;
-          break;
-          default:
-          /* unknown */
-          break;
-        }
-      }
+      (void)SECURE_SetCallback(CallbackId, func);
+  }
+
+/**
+  * @brief  Secure gateway: runs a batch of typed requests in one call.
+  *         The batch buffer is checked once for non-secure read/write
+  *         access; each request gets its own status and output size.
+  * @param  Batch  non-secure batch buffer (SECURE_BatchTypeDef, requests, data)
+  * @param  Size   batch buffer size in bytes
+  * @retval SECURE_StatusTypeDef of the batch
+  */
+  CMSE_NS_ENTRY int32_t SECURE_Gateway(void *Batch, uint32_t Size)
+  {
+      return SECURE_GATEWAY_Process(Batch, Size);
   }
 
 /**
@@ -22,6 +22,9 @@
 #include "stm32n6xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "FreeRTOS.h"
+#include "tickless_lptim.h"
+#include "secure_nsc.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -144,7 +147,9 @@ void UsageFault_Handler(void)
 void SecureFault_Handler(void)
 {
   /* USER CODE BEGIN SecureFault_IRQn 0 */
-
+  /* Tell the non-secure side, if it registered a callback, then halt:
+     returning would run the faulting instruction and fault again */
+  (void)SECURE_NSC_NotifyCallback(SECURE_FAULT_CB_ID);
   /* USER CODE END SecureFault_IRQn 0 */
   while (1)
   {
@@ -174,5 +179,14 @@ void DebugMon_Handler(void)
 /******************************************************************************/
 
 /* USER CODE BEGIN 1 */
+#if (configUSE_TICKLESS_IDLE == 2)
+/**
+  * @brief This function handles LPTIM1 global interrupt.
+  */
+void LPTIM1_IRQHandler(void)
+{
+  TICKLESS_IRQHandler();
+}
+#endif
 
 /* USER CODE END 1 */
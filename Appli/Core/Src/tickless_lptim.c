@@ -0,0 +1,188 @@
+/**
+  ******************************************************************************
+  * @file    tickless_lptim.c
+  * @brief   FreeRTOS tickless idle based on LPTIM1 clocked by LSE.
+  *
+  *          LPTIM1 runs freely from LSE (LSI with TICKLESS_LPTIM_USE_LSE = 0)
+  *          and is never stopped, its channel 1
+  *          compare is the wake-up event. When the kernel suppresses the tick:
+  *            - SysTick is frozen, the cycles left in the current tick and
+  *              the LPTIM1 counter are sampled
+  *            - the compare is set on the tick boundary ending the idle time
+  *            - the core sleeps until LPTIM1 or any other interrupt fires
+  *            - the LPTIM1 counter difference gives the slept time, which is
+  *              stepped into the kernel tick count, and SysTick restarts with
+  *              the phase of the elapsed time so later ticks stay aligned
+  *
+  *          SysTick alone would limit the sleep to 2^24 core cycles, LPTIM1
+  *          allows close to two seconds.
+  ******************************************************************************
+  */
+
+#include "tickless_lptim.h"
+#include "main.h"
+#include "stm32n6xx_ll_lptim.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+#if (configUSE_TICKLESS_IDLE == 2)
+
+/* Core cycles per RTOS tick (SysTick is clocked by the core) */
+#define TICKLESS_CYCLES_PER_TICK  (configCPU_CLOCK_HZ / configTICK_RATE_HZ)
+
+/* Longest idle time handled in one sleep, one tick is kept for the
+   remaining part of the current tick */
+#define TICKLESS_MAX_IDLE_TICKS   ((TickType_t)(((TICKLESS_LPTIM_MAX_COUNTS * configTICK_RATE_HZ) / \
+                                                 TICKLESS_LPTIM_CLOCK_HZ) - 1UL))
+
+/**
+  * @brief  Reads the LPTIM1 counter.
+  *         The counter runs in the LSE/LSI clock domain: two consecutive equal
+  *         readings are required for a reliable value.
+  */
+static uint32_t TICKLESS_GetCounter(void)
+{
+  uint32_t previous;
+  uint32_t counter = LL_LPTIM_GetCounter(LPTIM1);
+
+  do
+  {
+    previous = counter;
+    counter = LL_LPTIM_GetCounter(LPTIM1);
+  } while (counter != previous);
+
+  return counter;
+}
+
+void TICKLESS_Init(void)
+{
+  /* LSE (or LSI) as LPTIM1 kernel clock, LPTIM1 kept clocked in Sleep mode */
+#if (TICKLESS_LPTIM_USE_LSE == 1)
+  /* LSE is in the backup domain, it may already run from a previous boot */
+  if (LL_RCC_LSE_IsReady() == 0U)
+  {
+    HAL_PWR_EnableBkUpAccess();
+    LL_RCC_LSE_Enable();
+    while (LL_RCC_LSE_IsReady() == 0U) {}
+  }
+
+  __HAL_RCC_LPTIM1_CONFIG(RCC_LPTIM1CLKSOURCE_LSE);
+#else
+  LL_RCC_LSI_Enable();
+  while (LL_RCC_LSI_IsReady() == 0U) {}
+
+  __HAL_RCC_LPTIM1_CONFIG(RCC_LPTIM1CLKSOURCE_LSI);
+#endif
+  __HAL_RCC_LPTIM1_CLK_ENABLE();
+  __HAL_RCC_LPTIM1_CLK_SLEEP_ENABLE();
+
+  /* Configuration register, written while LPTIM1 is disabled */
+  LL_LPTIM_SetClockSource(LPTIM1, LL_LPTIM_CLK_SOURCE_INTERNAL);
+  LL_LPTIM_SetPrescaler(LPTIM1, LL_LPTIM_PRESCALER_DIV1);
+
+  /* Interrupt enable and auto-reload, written while LPTIM1 is enabled */
+  LL_LPTIM_Enable(LPTIM1);
+
+  LL_LPTIM_EnableIT_CC1(LPTIM1);
+  while (LL_LPTIM_IsActiveFlag_DIEROK(LPTIM1) == 0U) {}
+  LL_LPTIM_ClearFlag_DIEROK(LPTIM1);
+
+  LL_LPTIM_SetAutoReload(LPTIM1, 0xFFFFU);
+  while (LL_LPTIM_IsActiveFlag_ARROK(LPTIM1) == 0U) {}
+  LL_LPTIM_ClearFlag_ARROK(LPTIM1);
+
+  LL_LPTIM_StartCounter(LPTIM1, LL_LPTIM_OPERATING_MODE_CONTINUOUS);
+
+  HAL_NVIC_SetPriority(LPTIM1_IRQn, configLIBRARY_LOWEST_INTERRUPT_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(LPTIM1_IRQn);
+}
+
+void TICKLESS_IRQHandler(void)
+{
+  /* Only wakes the core up, the elapsed time is read by the idle task */
+  if (LL_LPTIM_IsActiveFlag_CC1(LPTIM1) != 0U)
+  {
+    LL_LPTIM_ClearFlag_CC1(LPTIM1);
+  }
+}
+
+/**
+  * @brief  Replaces the SysTick based implementation of the port.
+  *         Called by the idle task with the scheduler suspended.
+  * @param  xExpectedIdleTime Ticks until the next task unblocks
+  */
+void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime)
+{
+  const uint32_t reload = TICKLESS_CYCLES_PER_TICK;
+  TickType_t xModifiableIdleTime;
+  uint32_t remaining;
+  uint32_t counts;
+  uint32_t start;
+  uint32_t slept;
+  uint32_t next;
+  uint32_t ticks;
+
+  if (xExpectedIdleTime > TICKLESS_MAX_IDLE_TICKS)
+  {
+    xExpectedIdleTime = TICKLESS_MAX_IDLE_TICKS;
+  }
+
+  __disable_irq();
+  __DSB();
+  __ISB();
+
+  /* Freeze the tick, from here the time is measured by LPTIM1 */
+  SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+  start = TICKLESS_GetCounter();
+  remaining = SysTick->VAL;
+  counts = TICKLESS_IdleCounts(xExpectedIdleTime, reload, remaining, configCPU_CLOCK_HZ, TICKLESS_LPTIM_CLOCK_HZ);
+
+  if ((eTaskConfirmSleepModeStatus() == eAbortSleep) || (remaining == 0U) ||
+      (counts < TICKLESS_LPTIM_MIN_COUNTS) || ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0U))
+  {
+    /* A task became ready or a tick is due: resume the tick where it stopped */
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    __enable_irq();
+    return;
+  }
+
+  /* Wake-up on the tick boundary ending the idle time */
+  LL_LPTIM_ClearFlag_CMP1OK(LPTIM1);
+  LL_LPTIM_OC_SetCompareCH1(LPTIM1, (start + counts) & 0xFFFFU);
+  while (LL_LPTIM_IsActiveFlag_CMP1OK(LPTIM1) == 0U) {}
+  LL_LPTIM_ClearFlag_CC1(LPTIM1);
+  NVIC_ClearPendingIRQ(LPTIM1_IRQn);
+
+  xModifiableIdleTime = xExpectedIdleTime;
+  configPRE_SLEEP_PROCESSING(xModifiableIdleTime);
+  if (xModifiableIdleTime > 0U)
+  {
+    __DSB();
+    __WFI();
+    __ISB();
+  }
+  configPOST_SLEEP_PROCESSING(xExpectedIdleTime);
+
+  slept = TICKLESS_Elapsed(start, TICKLESS_GetCounter());
+  ticks = TICKLESS_Compensate(slept, xExpectedIdleTime, reload, remaining, configCPU_CLOCK_HZ,
+                              TICKLESS_LPTIM_CLOCK_HZ, &next);
+
+  /* Restart SysTick so the next tick lands on the boundary that was crossed
+     (or not) during the sleep, then back to the normal period */
+  if (next <= 1U)
+  {
+    SCB->ICSR = SCB_ICSR_PENDSTSET_Msk;
+    next = reload;
+  }
+  SysTick->LOAD = next - 1U;
+  SysTick->VAL = 0U;
+  SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+  SysTick->LOAD = reload - 1U;
+
+  vTaskStepTick(ticks);
+
+  /* The pending interrupt that woke the core up runs here */
+  __enable_irq();
+}
+
+#endif /* configUSE_TICKLESS_IDLE == 2 */
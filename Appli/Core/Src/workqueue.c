@@ -0,0 +1,217 @@
+/**
+  ******************************************************************************
+  * @file    workqueue.c
+  * @brief   Deferred interrupt work queue.
+  *
+  *          Post path (interrupt): ring selected from the active exception
+  *          priority, item copied, worker notified. No lock, no allocation.
+  *
+  *          Worker: sleeps on its task notification, then drains the rings
+  *          until all of them are empty and records the latency of every
+  *          item (DWT cycle counter at post vs. at run).
+  ******************************************************************************
+  */
+
+#include "workqueue.h"
+#include "task.h"
+#include <string.h>
+
+/* Ring of the posts from tasks */
+#define WQ_TASK_RING          (WQ_RING_COUNT - 1U)
+
+static WQ_RingTypeDef  wq_ring[WQ_RING_COUNT];
+static WQ_StatsTypeDef wq_stats;
+static TaskHandle_t    wq_worker;
+
+static StaticTask_t    wq_worker_cb;
+static uint32_t        wq_worker_stack[WQ_WORKER_STACK_SIZE / sizeof(uint32_t)];
+
+static const osThreadAttr_t wq_worker_attributes = {
+  .name = "workQueue",
+  .priority = (osPriority_t) WQ_WORKER_PRIORITY,
+  .cb_mem = &wq_worker_cb,
+  .cb_size = sizeof(wq_worker_cb),
+  .stack_mem = wq_worker_stack,
+  .stack_size = sizeof(wq_worker_stack)
+};
+
+/* Latencies of the items run in one worker wake-up */
+typedef struct
+{
+  uint64_t Total;
+  uint32_t Max;
+} WQ_LatencyTypeDef;
+
+static void WQ_Worker(void *argument);
+static uint32_t WQ_Drain(WQ_RingTypeDef *Ring, WQ_LatencyTypeDef *Latency);
+
+WQ_StatusTypeDef WQ_Init(void)
+{
+  /* Start the cycle counter used for the latencies */
+  DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+  DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+
+  wq_worker = (TaskHandle_t)osThreadNew(WQ_Worker, NULL, &wq_worker_attributes);
+
+  return (wq_worker != NULL) ? WQ_OK : WQ_ERROR_INIT;
+}
+
+WQ_StatusTypeDef WQ_Post(WQ_HandlerTypeDef Handler, void *Context, uint32_t Arg)
+{
+  const uint32_t exception = __get_IPSR();
+  WQ_ItemTypeDef item;
+  WQ_RingStatsTypeDef *stats;
+  uint32_t index;
+  uint32_t depth;
+
+  if (Handler == NULL)
+  {
+    return WQ_ERROR_PARAM;
+  }
+  if (wq_worker == NULL)
+  {
+    return WQ_ERROR_INIT;
+  }
+
+  item.Handler   = Handler;
+  item.Context   = Context;
+  item.Arg       = Arg;
+  item.Timestamp = DWT->CYCCNT;
+
+  if (exception == 0U)
+  {
+    /* Task: several producers, serialized by the critical section */
+    stats = &wq_stats.Ring[WQ_TASK_RING];
+    taskENTER_CRITICAL();
+    depth = WQ_RingPush(&wq_ring[WQ_TASK_RING], &item);
+    if (depth == 0U)
+    {
+      stats->Dropped++;
+    }
+    else
+    {
+      stats->Posted++;
+      stats->MaxDepth = (depth > stats->MaxDepth) ? depth : stats->MaxDepth;
+    }
+    taskEXIT_CRITICAL();
+
+    if (depth == 0U)
+    {
+      return WQ_ERROR_FULL;
+    }
+    (void)xTaskNotifyGive(wq_worker);
+  }
+  else
+  {
+    /* Interrupt: the only producer of the ring of its priority */
+    const uint32_t priority = NVIC_GetPriority((IRQn_Type)((int32_t)exception - 16));
+    BaseType_t woken = pdFALSE;
+
+    if (priority < configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY)
+    {
+      return WQ_ERROR_PRIORITY;
+    }
+    index = priority - configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY;
+    stats = &wq_stats.Ring[index];
+
+    depth = WQ_RingPush(&wq_ring[index], &item);
+    if (depth == 0U)
+    {
+      stats->Dropped++;
+      return WQ_ERROR_FULL;
+    }
+    stats->Posted++;
+    stats->MaxDepth = (depth > stats->MaxDepth) ? depth : stats->MaxDepth;
+
+    vTaskNotifyGiveFromISR(wq_worker, &woken);
+    portYIELD_FROM_ISR(woken);
+  }
+
+  return WQ_OK;
+}
+
+void WQ_GetStats(WQ_StatsTypeDef *Stats)
+{
+  taskENTER_CRITICAL();
+  (void)memcpy(Stats, &wq_stats, sizeof(wq_stats));
+  taskEXIT_CRITICAL();
+}
+
+void WQ_ResetStats(void)
+{
+  taskENTER_CRITICAL();
+  (void)memset(&wq_stats, 0, sizeof(wq_stats));
+  taskEXIT_CRITICAL();
+}
+
+/**
+  * @brief  Runs up to WQ_BATCH_SIZE items of a ring.
+  * @param  Ring    Ring to drain
+  * @param  Latency Accumulates the latencies of the items run
+  * @retval Number of items run
+  */
+static uint32_t WQ_Drain(WQ_RingTypeDef *Ring, WQ_LatencyTypeDef *Latency)
+{
+  WQ_ItemTypeDef item;
+  uint32_t latency;
+  uint32_t count = 0U;
+
+  while ((count < WQ_BATCH_SIZE) && (WQ_RingPop(Ring, &item) != 0U))
+  {
+    latency = DWT->CYCCNT - item.Timestamp;
+    Latency->Total += latency;
+    Latency->Max = (latency > Latency->Max) ? latency : Latency->Max;
+
+    item.Handler(item.Arg, item.Context);
+    count++;
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Worker task, runs the posted items.
+  * @param  argument Not used
+  */
+static void WQ_Worker(void *argument)
+{
+  WQ_LatencyTypeDef latency;
+  uint32_t batch;
+  uint32_t count;
+  uint32_t index;
+
+  (void)argument;
+
+  for (;;)
+  {
+    (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    /* Drain from the most urgent ring, a pass runs at most WQ_BATCH_SIZE
+       items per ring so a busy ring cannot starve the others */
+    batch = 0U;
+    latency.Total = 0U;
+    latency.Max = 0U;
+    do
+    {
+      count = 0U;
+      for (index = 0U; index < WQ_RING_COUNT; index++)
+      {
+        count += WQ_Drain(&wq_ring[index], &latency);
+      }
+      batch += count;
+    } while (count != 0U);
+
+    /* Committed with the other worker statistics, so that WQ_GetStats()
+       and WQ_ResetStats() never see or lose a partial update */
+    if (batch != 0U)
+    {
+      taskENTER_CRITICAL();
+      wq_stats.TotalLatency += latency.Total;
+      wq_stats.MaxLatency = (latency.Max > wq_stats.MaxLatency) ? latency.Max : wq_stats.MaxLatency;
+      wq_stats.Executed += batch;
+      wq_stats.Batches++;
+      wq_stats.MaxBatch = (batch > wq_stats.MaxBatch) ? batch : wq_stats.MaxBatch;
+      taskEXIT_CRITICAL();
+    }
+  }
+}
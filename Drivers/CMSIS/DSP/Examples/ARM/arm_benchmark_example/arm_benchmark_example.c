@@ -0,0 +1,917 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_benchmark_example.c
+ * Description:  Host benchmark and regression check of the kernel families
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup BenchmarkExample Benchmark Example
+ *
+ * \par Description:
+ * \par
+ * Runs kernels of the filtering, transform, matrix, statistics, distance and
+ * SVM families over a sweep of sizes. For every kernel and size, the result of
+ * a first call is checked against a double precision reference computed by the
+ * example, then the time of a call is measured with warm caches (the same call
+ * repeated) and with cold caches (a buffer larger than the caches read before
+ * every call).
+ *
+ * \par
+ * The results are printed as comma separated values, one line per kernel, size
+ * and cache state:
+ * <pre>
+ *   family,kernel,size,unit,cache,ns_per_unit,bytes_per_cycle,snr_db,check
+ * </pre>
+ * where <code>size</code> is the number of units (samples, points or matrix
+ * elements) processed per call, <code>bytes_per_cycle</code> counts the input,
+ * output and coefficient arrays once per call at <code>BENCH_CPU_MHZ</code>,
+ * and <code>snr_db</code> is the signal to noise ratio of the checked result
+ * (300 for an exact result). Two runs, for example before and after a library
+ * update, can be compared with diff; the columns other than the timings do not
+ * depend on the run.
+ *
+ * \par
+ * The transforms are timed as a forward and inverse pair, which runs in place
+ * on bounded data. The time is measured with clock_gettime() on POSIX hosts and
+ * with the C library clock() otherwise.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_fir_f32(), arm_fir_q15(), arm_biquad_cascade_df2T_f32()
+ * - arm_cfft_f32(), arm_rfft_fast_f32()
+ * - arm_mat_mult_f32(), arm_mat_vec_mult_f32()
+ * - arm_mean_f32(), arm_var_f32(), arm_max_f32()
+ * - arm_euclidean_distance_f32(), arm_cosine_distance_f32()
+ * - arm_svm_linear_predict_f32(), arm_svm_rbf_predict_f32()
+ * - and their initialization functions
+ *
+ * @} */
+
+#if defined(__unix__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "arm_math.h"
+#include <stdio.h>
+#include <time.h>
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define MAX_SIZE          4096
+#define FIR_TAPS          32
+#define BIQUAD_STAGES     4
+#define SVM_DIM           16
+#define BENCH_MIN_NS      2000000.0
+#define BENCH_TRIALS      5
+#define BENCH_COLD_REPS   15
+
+/* Clock used to convert the time to cycles */
+#ifndef BENCH_CPU_MHZ
+#define BENCH_CPU_MHZ     1000
+#endif
+
+/* Buffer read before every call of the cold cache measurements */
+#ifndef BENCH_EVICT_BYTES
+#define BENCH_EVICT_BYTES (32U * 1024U * 1024U)
+#endif
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+static float32_t srcA[2 * MAX_SIZE];
+static float32_t srcB[2 * MAX_SIZE];
+static float32_t work[2 * MAX_SIZE];
+static float32_t dst[2 * MAX_SIZE];
+static float64_t ref64[2 * MAX_SIZE];
+static float64_t cosTable[MAX_SIZE];
+static float64_t sinTable[MAX_SIZE];
+static float32_t coeffs[FIR_TAPS];
+static float32_t stateF32[FIR_TAPS + MAX_SIZE - 1];
+static q15_t srcQ15[MAX_SIZE];
+static q15_t dstQ15[MAX_SIZE];
+static q15_t coeffsQ15[FIR_TAPS];
+static q15_t stateQ15[FIR_TAPS + MAX_SIZE - 1];
+static float32_t biquadCoeffs[5 * BIQUAD_STAGES];
+static float32_t biquadState[2 * BIQUAD_STAGES];
+static uint32_t evictBuffer[BENCH_EVICT_BYTES / sizeof(uint32_t)];
+static volatile uint32_t evictSink;
+
+static const int32_t svmClasses[2] = { 0, 1 };
+
+/* Instances and results of the kernel under test */
+static uint32_t benchSize;
+static uint32_t benchDim;
+static arm_fir_instance_f32 firF32;
+static arm_fir_instance_q15 firQ15;
+static arm_biquad_cascade_df2T_instance_f32 biquadF32;
+static arm_cfft_instance_f32 cfftF32;
+static arm_rfft_fast_instance_f32 rfftF32;
+static arm_matrix_instance_f32 matA;
+static arm_matrix_instance_f32 matB;
+static arm_matrix_instance_f32 matC;
+static arm_svm_linear_instance_f32 svmLinear;
+static arm_svm_rbf_instance_f32 svmRbf;
+static float32_t resultF32;
+static uint32_t resultIndex;
+static int32_t resultClass;
+static uint32_t refIndex;
+static int32_t refClass;
+
+/* ----------------------------------------------------------------------
+* Kernel under test
+*   setup: prepares the inputs and the reference for a size, returns the
+*          bytes of the input, output and coefficient arrays of a call
+*   test:  first call, returns the SNR in dB of its result
+*   run:   call timed
+* ------------------------------------------------------------------- */
+typedef struct
+{
+  const char *family;
+  const char *name;
+  const char *unit;
+  float32_t minSnr;
+  uint32_t (*setup)(uint32_t size);
+  float32_t (*test)(void);
+  void (*run)(void);
+} bench_kernel;
+
+/* ----------------------------------------------------------------------
+* Pseudo random values in [-0.5, 0.5)
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345U;
+
+static float32_t random_f32(void)
+{
+  seed = (seed * 1664525U) + 1013904223U;
+  return ((float32_t)(seed >> 8) / 16777216.0f) - 0.5f;
+}
+
+static void random_fill(float32_t *pDst, uint32_t length)
+{
+  uint32_t i;
+
+  for (i = 0U; i < length; i++)
+  {
+    pDst[i] = random_f32();
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Signal to noise ratio in dB against a double precision reference
+* ------------------------------------------------------------------- */
+static float32_t snr_f64(const float64_t *pRef, const float32_t *pTest, uint32_t length)
+{
+  float64_t signal = 0.0;
+  float64_t noise = 0.0;
+  uint32_t i;
+
+  for (i = 0U; i < length; i++)
+  {
+    signal += pRef[i] * pRef[i];
+    noise += (pRef[i] - pTest[i]) * (pRef[i] - pTest[i]);
+  }
+
+  return (noise == 0.0) ? 300.0f : (float32_t)(10.0 * log10(signal / noise));
+}
+
+/* Direct form FIR filter from zero state, coefficients time reversed */
+static void ref_fir(const float32_t *pSrc, const float32_t *pCoeffs, uint32_t numTaps, uint32_t length)
+{
+  uint32_t n;
+  uint32_t k;
+
+  for (n = 0U; n < length; n++)
+  {
+    ref64[n] = 0.0;
+    for (k = 0U; (k < numTaps) && (k <= n); k++)
+    {
+      ref64[n] += (float64_t)pCoeffs[numTaps - 1U - k] * pSrc[n - k];
+    }
+  }
+}
+
+/* First numBins bins of the DFT of a real (stride 1) or complex (stride 2) input */
+static void ref_dft(const float32_t *pSrc, uint32_t length, uint32_t stride, uint32_t numBins)
+{
+  uint32_t k;
+  uint32_t n;
+  uint32_t idx;
+  float64_t re;
+  float64_t im;
+
+  for (n = 0U; n < length; n++)
+  {
+    cosTable[n] = cos((2.0 * PI * n) / length);
+    sinTable[n] = sin((2.0 * PI * n) / length);
+  }
+
+  for (k = 0U; k < numBins; k++)
+  {
+    re = 0.0;
+    im = 0.0;
+    idx = 0U;
+    for (n = 0U; n < length; n++)
+    {
+      if (stride == 2U)
+      {
+        re += (pSrc[2U * n] * cosTable[idx]) + (pSrc[(2U * n) + 1U] * sinTable[idx]);
+        im += (pSrc[(2U * n) + 1U] * cosTable[idx]) - (pSrc[2U * n] * sinTable[idx]);
+      }
+      else
+      {
+        re += pSrc[n] * cosTable[idx];
+        im -= pSrc[n] * sinTable[idx];
+      }
+      idx = (idx + k) % length;
+    }
+    ref64[2U * k] = re;
+    ref64[(2U * k) + 1U] = im;
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Filtering
+* ------------------------------------------------------------------- */
+static uint32_t fir_f32_setup(uint32_t size)
+{
+  random_fill(coeffs, FIR_TAPS);
+  random_fill(srcA, size);
+  ref_fir(srcA, coeffs, FIR_TAPS, size);
+  arm_fir_init_f32(&firF32, FIR_TAPS, coeffs, stateF32, size);
+
+  return ((2U * size) + FIR_TAPS) * sizeof(float32_t);
+}
+
+static float32_t fir_f32_test(void)
+{
+  arm_fir_f32(&firF32, srcA, dst, benchSize);
+  return snr_f64(ref64, dst, benchSize);
+}
+
+static void fir_f32_run(void)
+{
+  arm_fir_f32(&firF32, srcA, dst, benchSize);
+}
+
+static uint32_t fir_q15_setup(uint32_t size)
+{
+  /* Coefficients small enough for outputs in [-1, 1) */
+  random_fill(coeffs, FIR_TAPS);
+  arm_scale_f32(coeffs, 0.1f, coeffs, FIR_TAPS);
+  random_fill(srcA, size);
+  arm_float_to_q15(coeffs, coeffsQ15, FIR_TAPS);
+  arm_float_to_q15(srcA, srcQ15, size);
+  arm_q15_to_float(coeffsQ15, coeffs, FIR_TAPS);
+  arm_q15_to_float(srcQ15, srcA, size);
+  ref_fir(srcA, coeffs, FIR_TAPS, size);
+  (void)arm_fir_init_q15(&firQ15, FIR_TAPS, coeffsQ15, stateQ15, size);
+
+  return ((2U * size) + FIR_TAPS) * sizeof(q15_t);
+}
+
+static float32_t fir_q15_test(void)
+{
+  arm_fir_q15(&firQ15, srcQ15, dstQ15, benchSize);
+  arm_q15_to_float(dstQ15, dst, benchSize);
+  return snr_f64(ref64, dst, benchSize);
+}
+
+static void fir_q15_run(void)
+{
+  arm_fir_q15(&firQ15, srcQ15, dstQ15, benchSize);
+}
+
+static uint32_t biquad_f32_setup(uint32_t size)
+{
+  float64_t state[2 * BIQUAD_STAGES] = { 0.0 };
+  float64_t x;
+  float64_t y;
+  const float32_t *pC;
+  uint32_t stage;
+  uint32_t n;
+
+  /* Stable low pass sections {b0, b1, b2, a1, a2} */
+  for (stage = 0U; stage < BIQUAD_STAGES; stage++)
+  {
+    biquadCoeffs[(5U * stage) + 0U] = 0.2f;
+    biquadCoeffs[(5U * stage) + 1U] = 0.4f;
+    biquadCoeffs[(5U * stage) + 2U] = 0.2f;
+    biquadCoeffs[(5U * stage) + 3U] = 0.5f + (0.1f * (float32_t)stage);
+    biquadCoeffs[(5U * stage) + 4U] = -0.3f;
+  }
+  random_fill(srcA, size);
+
+  /* Transposed direct form II in double precision */
+  for (n = 0U; n < size; n++)
+  {
+    x = srcA[n];
+    for (stage = 0U; stage < BIQUAD_STAGES; stage++)
+    {
+      pC = &biquadCoeffs[5U * stage];
+      y = (pC[0] * x) + state[2U * stage];
+      state[2U * stage] = (pC[1] * x) + (pC[3] * y) + state[(2U * stage) + 1U];
+      state[(2U * stage) + 1U] = (pC[2] * x) + (pC[4] * y);
+      x = y;
+    }
+    ref64[n] = x;
+  }
+  arm_biquad_cascade_df2T_init_f32(&biquadF32, BIQUAD_STAGES, biquadCoeffs, biquadState);
+
+  return ((2U * size) + (5U * BIQUAD_STAGES)) * sizeof(float32_t);
+}
+
+static float32_t biquad_f32_test(void)
+{
+  arm_biquad_cascade_df2T_f32(&biquadF32, srcA, dst, benchSize);
+  return snr_f64(ref64, dst, benchSize);
+}
+
+static void biquad_f32_run(void)
+{
+  arm_biquad_cascade_df2T_f32(&biquadF32, srcA, dst, benchSize);
+}
+
+/* ----------------------------------------------------------------------
+* Transforms
+* ------------------------------------------------------------------- */
+static uint32_t cfft_f32_setup(uint32_t size)
+{
+  random_fill(srcA, 2U * size);
+  ref_dft(srcA, size, 2U, size);
+  (void)arm_cfft_init_f32(&cfftF32, (uint16_t)size);
+  arm_copy_f32(srcA, work, 2U * size);
+
+  /* Forward and inverse transform */
+  return 2U * (4U * size) * sizeof(float32_t);
+}
+
+static float32_t cfft_f32_test(void)
+{
+  arm_copy_f32(srcA, dst, 2U * benchSize);
+  arm_cfft_f32(&cfftF32, dst, 0U, 1U);
+  return snr_f64(ref64, dst, 2U * benchSize);
+}
+
+static void cfft_f32_run(void)
+{
+  arm_cfft_f32(&cfftF32, work, 0U, 1U);
+  arm_cfft_f32(&cfftF32, work, 1U, 1U);
+}
+
+static uint32_t rfft_f32_setup(uint32_t size)
+{
+  uint32_t n;
+
+  random_fill(srcA, size);
+  ref_dft(srcA, size, 1U, size / 2U);
+
+  /* Packed format: real parts of bins 0 and size / 2 first */
+  ref64[1] = 0.0;
+  for (n = 0U; n < size; n++)
+  {
+    ref64[1] += ((n & 1U) != 0U) ? -(float64_t)srcA[n] : (float64_t)srcA[n];
+  }
+  (void)arm_rfft_fast_init_f32(&rfftF32, (uint16_t)size);
+  arm_copy_f32(srcA, work, size);
+
+  /* Forward and inverse transform */
+  return 2U * (2U * size) * sizeof(float32_t);
+}
+
+static float32_t rfft_f32_test(void)
+{
+  /* The input is modified */
+  arm_copy_f32(srcA, srcB, benchSize);
+  arm_rfft_fast_f32(&rfftF32, srcB, dst, 0U);
+  return snr_f64(ref64, dst, benchSize);
+}
+
+static void rfft_f32_run(void)
+{
+  arm_rfft_fast_f32(&rfftF32, work, dst, 0U);
+  arm_rfft_fast_f32(&rfftF32, dst, work, 1U);
+}
+
+/* ----------------------------------------------------------------------
+* Matrix, square matrices of size elements
+* ------------------------------------------------------------------- */
+static uint32_t mat_setup(uint32_t size)
+{
+  benchDim = 1U;
+  while ((benchDim * benchDim) < size)
+  {
+    benchDim++;
+  }
+  random_fill(srcA, size);
+  random_fill(srcB, size);
+  arm_mat_init_f32(&matA, (uint16_t)benchDim, (uint16_t)benchDim, srcA);
+  arm_mat_init_f32(&matB, (uint16_t)benchDim, (uint16_t)benchDim, srcB);
+  arm_mat_init_f32(&matC, (uint16_t)benchDim, (uint16_t)benchDim, dst);
+
+  return size;
+}
+
+static uint32_t mat_mult_f32_setup(uint32_t size)
+{
+  uint32_t i;
+  uint32_t j;
+  uint32_t k;
+
+  (void)mat_setup(size);
+  for (i = 0U; i < benchDim; i++)
+  {
+    for (j = 0U; j < benchDim; j++)
+    {
+      ref64[(i * benchDim) + j] = 0.0;
+      for (k = 0U; k < benchDim; k++)
+      {
+        ref64[(i * benchDim) + j] += (float64_t)srcA[(i * benchDim) + k] * srcB[(k * benchDim) + j];
+      }
+    }
+  }
+
+  return 3U * size * sizeof(float32_t);
+}
+
+static float32_t mat_mult_f32_test(void)
+{
+  if (arm_mat_mult_f32(&matA, &matB, &matC) != ARM_MATH_SUCCESS)
+  {
+    return 0.0f;
+  }
+  return snr_f64(ref64, dst, benchSize);
+}
+
+static void mat_mult_f32_run(void)
+{
+  (void)arm_mat_mult_f32(&matA, &matB, &matC);
+}
+
+static uint32_t mat_vec_mult_f32_setup(uint32_t size)
+{
+  uint32_t i;
+  uint32_t k;
+
+  (void)mat_setup(size);
+  for (i = 0U; i < benchDim; i++)
+  {
+    ref64[i] = 0.0;
+    for (k = 0U; k < benchDim; k++)
+    {
+      ref64[i] += (float64_t)srcA[(i * benchDim) + k] * srcB[k];
+    }
+  }
+
+  return (size + (2U * benchDim)) * sizeof(float32_t);
+}
+
+static float32_t mat_vec_mult_f32_test(void)
+{
+  arm_mat_vec_mult_f32(&matA, srcB, dst);
+  return snr_f64(ref64, dst, benchDim);
+}
+
+static void mat_vec_mult_f32_run(void)
+{
+  arm_mat_vec_mult_f32(&matA, srcB, dst);
+}
+
+/* ----------------------------------------------------------------------
+* Statistics
+* ------------------------------------------------------------------- */
+static uint32_t mean_f32_setup(uint32_t size)
+{
+  uint32_t i;
+
+  random_fill(srcA, size);
+  ref64[0] = 0.0;
+  for (i = 0U; i < size; i++)
+  {
+    ref64[0] += srcA[i];
+  }
+  ref64[0] /= size;
+
+  return size * sizeof(float32_t);
+}
+
+static float32_t mean_f32_test(void)
+{
+  arm_mean_f32(srcA, benchSize, &resultF32);
+  return snr_f64(ref64, &resultF32, 1U);
+}
+
+static void mean_f32_run(void)
+{
+  arm_mean_f32(srcA, benchSize, &resultF32);
+}
+
+static uint32_t var_f32_setup(uint32_t size)
+{
+  float64_t mean = 0.0;
+  uint32_t i;
+
+  random_fill(srcA, size);
+  for (i = 0U; i < size; i++)
+  {
+    mean += srcA[i];
+  }
+  mean /= size;
+  ref64[0] = 0.0;
+  for (i = 0U; i < size; i++)
+  {
+    ref64[0] += (srcA[i] - mean) * (srcA[i] - mean);
+  }
+  ref64[0] /= (size - 1U);
+
+  return size * sizeof(float32_t);
+}
+
+static float32_t var_f32_test(void)
+{
+  arm_var_f32(srcA, benchSize, &resultF32);
+  return snr_f64(ref64, &resultF32, 1U);
+}
+
+static void var_f32_run(void)
+{
+  arm_var_f32(srcA, benchSize, &resultF32);
+}
+
+static uint32_t max_f32_setup(uint32_t size)
+{
+  uint32_t i;
+
+  random_fill(srcA, size);
+  refIndex = 0U;
+  for (i = 1U; i < size; i++)
+  {
+    if (srcA[i] > srcA[refIndex])
+    {
+      refIndex = i;
+    }
+  }
+  ref64[0] = srcA[refIndex];
+
+  return size * sizeof(float32_t);
+}
+
+static float32_t max_f32_test(void)
+{
+  arm_max_f32(srcA, benchSize, &resultF32, &resultIndex);
+  return (resultIndex == refIndex) ? snr_f64(ref64, &resultF32, 1U) : 0.0f;
+}
+
+static void max_f32_run(void)
+{
+  arm_max_f32(srcA, benchSize, &resultF32, &resultIndex);
+}
+
+/* ----------------------------------------------------------------------
+* Distances between two vectors of size elements
+* ------------------------------------------------------------------- */
+static uint32_t euclidean_f32_setup(uint32_t size)
+{
+  uint32_t i;
+
+  random_fill(srcA, size);
+  random_fill(srcB, size);
+  ref64[0] = 0.0;
+  for (i = 0U; i < size; i++)
+  {
+    ref64[0] += ((float64_t)srcA[i] - srcB[i]) * ((float64_t)srcA[i] - srcB[i]);
+  }
+  ref64[0] = sqrt(ref64[0]);
+
+  return 2U * size * sizeof(float32_t);
+}
+
+static float32_t euclidean_f32_test(void)
+{
+  resultF32 = arm_euclidean_distance_f32(srcA, srcB, benchSize);
+  return snr_f64(ref64, &resultF32, 1U);
+}
+
+static void euclidean_f32_run(void)
+{
+  resultF32 = arm_euclidean_distance_f32(srcA, srcB, benchSize);
+}
+
+static uint32_t cosine_f32_setup(uint32_t size)
+{
+  float64_t dot = 0.0;
+  float64_t normA = 0.0;
+  float64_t normB = 0.0;
+  uint32_t i;
+
+  random_fill(srcA, size);
+  random_fill(srcB, size);
+  for (i = 0U; i < size; i++)
+  {
+    dot += (float64_t)srcA[i] * srcB[i];
+    normA += (float64_t)srcA[i] * srcA[i];
+    normB += (float64_t)srcB[i] * srcB[i];
+  }
+  ref64[0] = 1.0 - (dot / sqrt(normA * normB));
+
+  return 2U * size * sizeof(float32_t);
+}
+
+static float32_t cosine_f32_test(void)
+{
+  resultF32 = arm_cosine_distance_f32(srcA, srcB, benchSize);
+  return snr_f64(ref64, &resultF32, 1U);
+}
+
+static void cosine_f32_run(void)
+{
+  resultF32 = arm_cosine_distance_f32(srcA, srcB, benchSize);
+}
+
+/* ----------------------------------------------------------------------
+* SVM, size / SVM_DIM support vectors of SVM_DIM elements
+* ------------------------------------------------------------------- */
+static uint32_t svm_setup(uint32_t size)
+{
+  benchDim = size / SVM_DIM;
+  random_fill(srcA, size);
+  random_fill(srcB, benchDim);
+  random_fill(work, SVM_DIM);
+
+  return (size + benchDim + SVM_DIM) * sizeof(float32_t);
+}
+
+static uint32_t svm_linear_f32_setup(uint32_t size)
+{
+  uint32_t bytes = svm_setup(size);
+  float64_t sum = 0.1;
+  float64_t dot;
+  uint32_t i;
+  uint32_t k;
+
+  for (i = 0U; i < benchDim; i++)
+  {
+    dot = 0.0;
+    for (k = 0U; k < SVM_DIM; k++)
+    {
+      dot += (float64_t)srcA[(i * SVM_DIM) + k] * work[k];
+    }
+    sum += srcB[i] * dot;
+  }
+  refClass = svmClasses[(sum <= 0.0) ? 0 : 1];
+  arm_svm_linear_init_f32(&svmLinear, benchDim, SVM_DIM, 0.1f, srcB, srcA, svmClasses);
+
+  return bytes;
+}
+
+static float32_t svm_linear_f32_test(void)
+{
+  arm_svm_linear_predict_f32(&svmLinear, work, &resultClass);
+  return (resultClass == refClass) ? 300.0f : 0.0f;
+}
+
+static void svm_linear_f32_run(void)
+{
+  arm_svm_linear_predict_f32(&svmLinear, work, &resultClass);
+}
+
+static uint32_t svm_rbf_f32_setup(uint32_t size)
+{
+  uint32_t bytes = svm_setup(size);
+  float64_t sum = 0.1;
+  float64_t dist;
+  uint32_t i;
+  uint32_t k;
+
+  for (i = 0U; i < benchDim; i++)
+  {
+    dist = 0.0;
+    for (k = 0U; k < SVM_DIM; k++)
+    {
+      dist += ((float64_t)srcA[(i * SVM_DIM) + k] - work[k]) * ((float64_t)srcA[(i * SVM_DIM) + k] - work[k]);
+    }
+    sum += srcB[i] * exp(-0.5 * dist);
+  }
+  refClass = svmClasses[(sum <= 0.0) ? 0 : 1];
+  arm_svm_rbf_init_f32(&svmRbf, benchDim, SVM_DIM, 0.1f, srcB, srcA, svmClasses, 0.5f);
+
+  return bytes;
+}
+
+static float32_t svm_rbf_f32_test(void)
+{
+  arm_svm_rbf_predict_f32(&svmRbf, work, &resultClass);
+  return (resultClass == refClass) ? 300.0f : 0.0f;
+}
+
+static void svm_rbf_f32_run(void)
+{
+  arm_svm_rbf_predict_f32(&svmRbf, work, &resultClass);
+}
+
+static const bench_kernel kernels[] =
+{
+  { "filtering",  "arm_fir_f32",                 "sample",  120.0f, fir_f32_setup,        fir_f32_test,        fir_f32_run        },
+  { "filtering",  "arm_fir_q15",                 "sample",   60.0f, fir_q15_setup,        fir_q15_test,        fir_q15_run        },
+  { "filtering",  "arm_biquad_cascade_df2T_f32", "sample",  120.0f, biquad_f32_setup,     biquad_f32_test,     biquad_f32_run     },
+  { "transform",  "arm_cfft_f32",                "point",   110.0f, cfft_f32_setup,       cfft_f32_test,       cfft_f32_run       },
+  { "transform",  "arm_rfft_fast_f32",           "sample",  110.0f, rfft_f32_setup,       rfft_f32_test,       rfft_f32_run       },
+  { "matrix",     "arm_mat_mult_f32",            "element", 120.0f, mat_mult_f32_setup,   mat_mult_f32_test,   mat_mult_f32_run   },
+  { "matrix",     "arm_mat_vec_mult_f32",        "element", 120.0f, mat_vec_mult_f32_setup, mat_vec_mult_f32_test, mat_vec_mult_f32_run },
+  { "statistics", "arm_mean_f32",                "sample",   90.0f, mean_f32_setup,       mean_f32_test,       mean_f32_run       },
+  { "statistics", "arm_var_f32",                 "sample",   90.0f, var_f32_setup,        var_f32_test,        var_f32_run        },
+  { "statistics", "arm_max_f32",                 "sample",  300.0f, max_f32_setup,        max_f32_test,        max_f32_run        },
+  { "distance",   "arm_euclidean_distance_f32",  "element", 100.0f, euclidean_f32_setup,  euclidean_f32_test,  euclidean_f32_run  },
+  { "distance",   "arm_cosine_distance_f32",     "element", 100.0f, cosine_f32_setup,     cosine_f32_test,     cosine_f32_run     },
+  { "svm",        "arm_svm_linear_predict_f32",  "element", 300.0f, svm_linear_f32_setup, svm_linear_f32_test, svm_linear_f32_run },
+  { "svm",        "arm_svm_rbf_predict_f32",     "element", 300.0f, svm_rbf_f32_setup,    svm_rbf_f32_test,    svm_rbf_f32_run    }
+};
+
+/* ----------------------------------------------------------------------
+* Timing
+* ------------------------------------------------------------------- */
+static float64_t time_ns(void)
+{
+#if defined(CLOCK_MONOTONIC)
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((float64_t)now.tv_sec * 1e9) + (float64_t)now.tv_nsec;
+#else
+  return ((float64_t)clock() * 1e9) / (float64_t)CLOCKS_PER_SEC;
+#endif
+}
+
+/* Replaces the cached data with the evict buffer */
+static void evict_caches(void)
+{
+  uint32_t sum = 0U;
+  uint32_t i;
+
+  for (i = 0U; i < (BENCH_EVICT_BYTES / sizeof(uint32_t)); i += 8U)
+  {
+    sum += evictBuffer[i];
+  }
+  evictSink = sum;
+}
+
+/* Best time in ns of a call repeated on the same data */
+static float64_t time_warm(void (*run)(void))
+{
+  uint32_t reps = 1U;
+  uint32_t trial;
+  uint32_t i;
+  float64_t start;
+  float64_t elapsed;
+  float64_t best = 0.0;
+
+  run();
+
+  /* Enough calls for BENCH_MIN_NS */
+  for (;;)
+  {
+    start = time_ns();
+    for (i = 0U; i < reps; i++)
+    {
+      run();
+    }
+    elapsed = time_ns() - start;
+    if ((elapsed >= BENCH_MIN_NS) || (reps >= 0x40000000U))
+    {
+      break;
+    }
+    reps <<= 1U;
+  }
+  best = elapsed;
+
+  for (trial = 1U; trial < BENCH_TRIALS; trial++)
+  {
+    start = time_ns();
+    for (i = 0U; i < reps; i++)
+    {
+      run();
+    }
+    elapsed = time_ns() - start;
+    best = (elapsed < best) ? elapsed : best;
+  }
+
+  return best / reps;
+}
+
+/* Median time in ns of a call after the caches were evicted */
+static float64_t time_cold(void (*run)(void))
+{
+  float64_t times[BENCH_COLD_REPS];
+  float64_t overhead;
+  float64_t start;
+  float64_t t;
+  uint32_t i;
+  uint32_t j;
+
+  /* Cost of reading the timer */
+  overhead = 0.0;
+  for (i = 0U; i < 16U; i++)
+  {
+    start = time_ns();
+    t = time_ns() - start;
+    overhead = ((i == 0U) || (t < overhead)) ? t : overhead;
+  }
+
+  for (i = 0U; i < BENCH_COLD_REPS; i++)
+  {
+    evict_caches();
+    start = time_ns();
+    run();
+    t = time_ns() - start - overhead;
+    t = (t > 0.0) ? t : 0.0;
+
+    /* Insertion in sorted order */
+    for (j = i; (j > 0U) && (times[j - 1U] > t); j--)
+    {
+      times[j] = times[j - 1U];
+    }
+    times[j] = t;
+  }
+
+  return times[BENCH_COLD_REPS / 2];
+}
+
+static void print_result(const bench_kernel *pKernel, const char *pCache, uint32_t bytes, float64_t ns, float32_t snr, int32_t passed)
+{
+  float64_t cycles = (ns * BENCH_CPU_MHZ) / 1000.0;
+
+  printf("%s,%s,%u,%s,%s,%.4f,%.4f,%.1f,%s\n",
+         pKernel->family, pKernel->name, (unsigned)benchSize, pKernel->unit, pCache,
+         ns / benchSize, (cycles > 0.0) ? (bytes / cycles) : 0.0,
+         snr, passed ? "pass" : "fail");
+}
+
+int32_t main(void)
+{
+  static const uint32_t sizes[] = { 64U, 256U, 1024U, 4096U };
+  int32_t status = 1;
+  int32_t passed;
+  uint32_t bytes;
+  uint32_t i;
+  uint32_t k;
+  float32_t snr;
+  float64_t warm;
+  float64_t cold;
+
+  printf("START\n");
+  printf("# cpu_mhz=%u evict_bytes=%u\n", (unsigned)BENCH_CPU_MHZ, (unsigned)BENCH_EVICT_BYTES);
+  printf("family,kernel,size,unit,cache,ns_per_unit,bytes_per_cycle,snr_db,check\n");
+
+  for (i = 0U; i < (BENCH_EVICT_BYTES / sizeof(uint32_t)); i++)
+  {
+    evictBuffer[i] = i;
+  }
+
+  for (k = 0U; k < (sizeof(kernels) / sizeof(kernels[0])); k++)
+  {
+    for (i = 0U; i < (sizeof(sizes) / sizeof(sizes[0])); i++)
+    {
+      benchSize = sizes[i];
+      bytes = kernels[k].setup(benchSize);
+      snr = kernels[k].test();
+      passed = (snr >= kernels[k].minSnr);
+      status &= passed;
+
+      warm = time_warm(kernels[k].run);
+      cold = time_cold(kernels[k].run);
+      print_result(&kernels[k], "warm", bytes, warm, snr, passed);
+      print_result(&kernels[k], "cold", bytes, cold, snr, passed);
+    }
+  }
+
+  printf((status != 0) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (status != 0) ? 0 : 1;
+}
+
+ /** \endlink */
@@ -0,0 +1,343 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dtw_sequence_example_f32.c
+ * Description:  Memory-bounded DTW check against the matrix DTW, early abandon and LB_Keogh
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup DTWSequenceExample Memory-bounded DTW Example
+ *
+ * \par Description:
+ * \par
+ * Over random query and template pairs (lengths 1 to 48, dimensions 1 to 3,
+ * no window, Sakoe-Chiba and slanted band windows of random sizes, the three
+ * local distances), checks that:
+ * - arm_dtw_sequence_distance_f32() returns the same status and the same
+ *   distance, bit for bit, as arm_dtw_distance_f32() on the matrix of local
+ *   distances and the window built by arm_dtw_init_window_q7();
+ * - with a threshold just above the distance the result is unchanged, and
+ *   with a threshold just below it the computation is abandoned (F32_MAX);
+ * - for univariate sequences, the LB_Keogh bound never exceeds the distance,
+ *   and stops accumulating once it reaches its threshold.
+ *
+ * \par
+ * Then runs a nearest template search twice, once with the DTW of every
+ * template and once pruned by LB_Keogh and early abandon: both must find the
+ * same template and distance. Prints the number of full DTW computations
+ * avoided and the times.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_dtw_init_f32(), arm_dtw_sequence_distance_f32()
+ * - arm_dtw_envelope_f32(), arm_dtw_lb_keogh_f32()
+ * - arm_dtw_init_window_q7(), arm_dtw_distance_f32()
+ *
+ * @} */
+
+#include "arm_math.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define MAX_LENGTH      48U
+#define MAX_DIMENSION   3U
+#define NB_CASES        5000U
+/* Abandon thresholds just above and below the distance */
+#define ABANDON_MARGIN  1e-4f
+/* LB_Keogh and the DTW sum the same local distances in another order */
+#define LB_REL_MARGIN   1e-5f
+#define NB_TEMPLATES    200U
+#define SEARCH_LENGTH   128U
+#define SEARCH_WINDOW   8
+
+/* ----------------------------------------------------------------------
+* Declare the buffers
+* ------------------------------------------------------------------- */
+static float32_t query[MAX_LENGTH * MAX_DIMENSION];
+static float32_t templ[MAX_LENGTH * MAX_DIMENSION];
+static float32_t distances[MAX_LENGTH * MAX_LENGTH];
+static float32_t costs[MAX_LENGTH * MAX_LENGTH];
+static q7_t windowMatrix[MAX_LENGTH * MAX_LENGTH];
+static float32_t rows[2U * SEARCH_LENGTH];
+static float32_t upper[SEARCH_LENGTH];
+static float32_t lower[SEARCH_LENGTH];
+
+static float32_t searchQuery[SEARCH_LENGTH];
+static float32_t searchTemplates[NB_TEMPLATES][SEARCH_LENGTH];
+static float32_t searchUpper[NB_TEMPLATES][SEARCH_LENGTH];
+static float32_t searchLower[NB_TEMPLATES][SEARCH_LENGTH];
+
+/* ----------------------------------------------------------------------
+* Pseudo random values in [-0.5, 0.5) and in [0, n)
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345U;
+
+static float32_t random_f32(void)
+{
+  seed = (seed * 1664525U) + 1013904223U;
+  return ((float32_t)(seed >> 8) / 16777216.0f) - 0.5f;
+}
+
+static uint32_t random_u32(uint32_t n)
+{
+  seed = (seed * 1664525U) + 1013904223U;
+  return (seed >> 8) % n;
+}
+
+/* ----------------------------------------------------------------------
+* Matrix of the local distances, as expected by arm_dtw_distance_f32()
+* ------------------------------------------------------------------- */
+static void local_distances(arm_dtw_local_distance localDistance, uint32_t dimension,
+                            uint32_t queryLength, uint32_t templateLength)
+{
+  float32_t acc, diff;
+  uint32_t q, t, k;
+
+  for (q = 0U; q < queryLength; q++)
+  {
+    for (t = 0U; t < templateLength; t++)
+    {
+      acc = 0.0f;
+      for (k = 0U; k < dimension; k++)
+      {
+        diff = query[(q * dimension) + k] - templ[(t * dimension) + k];
+        acc += (localDistance == ARM_DTW_CITYBLOCK) ? fabsf(diff) : (diff * diff);
+      }
+      distances[(q * templateLength) + t] = (localDistance == ARM_DTW_EUCLIDEAN) ? sqrtf(acc) : acc;
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Random cases against the matrix DTW
+* ------------------------------------------------------------------- */
+static arm_status check_cases(void)
+{
+  static const arm_dtw_window windows[] = { ARM_DTW_NO_WINDOW, ARM_DTW_SAKOE_CHIBA_WINDOW, ARM_DTW_SLANTED_BAND_WINDOW };
+  arm_dtw_instance_f32 S;
+  arm_matrix_instance_f32 distanceMatrix;
+  arm_matrix_instance_f32 costMatrix;
+  arm_matrix_instance_q7 window;
+  arm_dtw_local_distance localDistance;
+  arm_dtw_window windowType;
+  arm_status refStatus, status;
+  float32_t ref, dist, bound;
+  uint32_t queryLength, templateLength, dimension;
+  int32_t windowSize;
+  uint32_t mismatches = 0U;
+  uint32_t noPath = 0U;
+  uint32_t abandonErrors = 0U;
+  uint32_t lbChecks = 0U;
+  uint32_t lbErrors = 0U;
+  uint32_t i, n;
+
+  for (n = 0U; n < NB_CASES; n++)
+  {
+    queryLength = 1U + random_u32(MAX_LENGTH);
+    templateLength = 1U + random_u32(MAX_LENGTH);
+    /* Half of the cases univariate, for LB_Keogh */
+    dimension = ((n % 2U) == 0U) ? 1U : (1U + random_u32(MAX_DIMENSION));
+    localDistance = (arm_dtw_local_distance)random_u32(3U);
+    windowType = windows[random_u32(3U)];
+    windowSize = (int32_t)random_u32(12U);
+
+    for (i = 0U; i < (queryLength * dimension); i++)
+    {
+      query[i] = random_f32();
+    }
+    for (i = 0U; i < (templateLength * dimension); i++)
+    {
+      templ[i] = random_f32();
+    }
+
+    /* Reference: matrix DTW */
+    local_distances(localDistance, dimension, queryLength, templateLength);
+    arm_mat_init_f32(&distanceMatrix, (uint16_t)queryLength, (uint16_t)templateLength, distances);
+    arm_mat_init_f32(&costMatrix, (uint16_t)queryLength, (uint16_t)templateLength, costs);
+    if (windowType == ARM_DTW_NO_WINDOW)
+    {
+      refStatus = arm_dtw_distance_f32(&distanceMatrix, NULL, &costMatrix, &ref);
+    }
+    else
+    {
+      window.numRows = (uint16_t)queryLength;
+      window.numCols = (uint16_t)templateLength;
+      window.pData = windowMatrix;
+      (void)arm_dtw_init_window_q7(windowType, windowSize, &window);
+      refStatus = arm_dtw_distance_f32(&distanceMatrix, &window, &costMatrix, &ref);
+    }
+
+    (void)arm_dtw_init_f32(&S, dimension, localDistance, windowType, windowSize, rows, MAX_LENGTH);
+    status = arm_dtw_sequence_distance_f32(&S, query, queryLength, templ, templateLength, F32_MAX, &dist);
+
+    /* Same status, same bits */
+    if (status != refStatus)
+    {
+      mismatches++;
+      continue;
+    }
+    if (status != ARM_MATH_SUCCESS)
+    {
+      noPath++;
+      continue;
+    }
+    if (memcmp(&dist, &ref, sizeof(dist)) != 0)
+    {
+      mismatches++;
+    }
+
+    /* Early abandon on each side of the distance */
+    status = arm_dtw_sequence_distance_f32(&S, query, queryLength, templ, templateLength,
+                                           ref * (1.0f + ABANDON_MARGIN), &dist);
+    abandonErrors += ((status != ARM_MATH_SUCCESS) || (dist != ref)) ? 1U : 0U;
+    status = arm_dtw_sequence_distance_f32(&S, query, queryLength, templ, templateLength,
+                                           ref * (1.0f - ABANDON_MARGIN), &dist);
+    abandonErrors += ((status != ARM_MATH_SUCCESS) || ((ref > 0.0f) && (dist != F32_MAX))) ? 1U : 0U;
+
+    /* Lower bound */
+    if ((dimension == 1U) &&
+        (arm_dtw_envelope_f32(&S, templ, templateLength, queryLength, upper, lower) == ARM_MATH_SUCCESS))
+    {
+      lbChecks++;
+      bound = arm_dtw_lb_keogh_f32(&S, query, queryLength, templateLength, upper, lower, F32_MAX);
+      lbErrors += (bound > (ref * (1.0f + LB_REL_MARGIN))) ? 1U : 0U;
+
+      /* Stopped once the threshold is reached: still at least the threshold */
+      if (bound > 0.0f)
+      {
+        dist = arm_dtw_lb_keogh_f32(&S, query, queryLength, templateLength, upper, lower, bound * 0.5f);
+        lbErrors += ((dist < (bound * 0.5f)) || (dist > bound)) ? 1U : 0U;
+      }
+    }
+  }
+
+  printf("%u cases (%u without path): mismatches %u  abandon errors %u  LB_Keogh checks %u errors %u\n",
+         (unsigned)NB_CASES, (unsigned)noPath, (unsigned)mismatches, (unsigned)abandonErrors,
+         (unsigned)lbChecks, (unsigned)lbErrors);
+
+  return ((mismatches != 0U) || (abandonErrors != 0U) || (lbErrors != 0U)) ? ARM_MATH_TEST_FAILURE : ARM_MATH_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------
+* Nearest template: every DTW against LB_Keogh pruning and early abandon
+* ------------------------------------------------------------------- */
+static arm_status check_search(void)
+{
+  arm_dtw_instance_f32 S;
+  float32_t best, bestPruned, dist;
+  uint32_t nearest = 0U;
+  uint32_t nearestPruned = 0U;
+  uint32_t computed = 0U;
+  float64_t tFull, tPruned;
+  clock_t start;
+  uint32_t k, i;
+  float32_t phase;
+
+  (void)arm_dtw_init_f32(&S, 1U, ARM_DTW_SQEUCLIDEAN, ARM_DTW_SAKOE_CHIBA_WINDOW, SEARCH_WINDOW, rows, SEARCH_LENGTH);
+
+  /* Templates: shifted and scaled sines with noise; query close to one of them */
+  for (k = 0U; k < NB_TEMPLATES; k++)
+  {
+    phase = 6.2831853f * (float32_t)k / (float32_t)NB_TEMPLATES;
+    for (i = 0U; i < SEARCH_LENGTH; i++)
+    {
+      searchTemplates[k][i] = (arm_sin_f32((0.1f * (float32_t)i) + phase) * (1.0f + (0.002f * (float32_t)k))) +
+                              (0.05f * random_f32());
+    }
+    (void)arm_dtw_envelope_f32(&S, searchTemplates[k], SEARCH_LENGTH, SEARCH_LENGTH, searchUpper[k], searchLower[k]);
+  }
+  for (i = 0U; i < SEARCH_LENGTH; i++)
+  {
+    searchQuery[i] = searchTemplates[NB_TEMPLATES / 3U][(i + 2U) % SEARCH_LENGTH] + (0.05f * random_f32());
+  }
+
+  start = clock();
+  best = F32_MAX;
+  for (k = 0U; k < NB_TEMPLATES; k++)
+  {
+    (void)arm_dtw_sequence_distance_f32(&S, searchQuery, SEARCH_LENGTH, searchTemplates[k], SEARCH_LENGTH,
+                                        F32_MAX, &dist);
+    if (dist < best)
+    {
+      best = dist;
+      nearest = k;
+    }
+  }
+  tFull = (float64_t)(clock() - start);
+
+  start = clock();
+  bestPruned = F32_MAX;
+  for (k = 0U; k < NB_TEMPLATES; k++)
+  {
+    if (arm_dtw_lb_keogh_f32(&S, searchQuery, SEARCH_LENGTH, SEARCH_LENGTH, searchUpper[k], searchLower[k],
+                             bestPruned) < bestPruned)
+    {
+      computed++;
+      (void)arm_dtw_sequence_distance_f32(&S, searchQuery, SEARCH_LENGTH, searchTemplates[k], SEARCH_LENGTH,
+                                          bestPruned, &dist);
+      if (dist < bestPruned)
+      {
+        bestPruned = dist;
+        nearestPruned = k;
+      }
+    }
+  }
+  tPruned = (float64_t)(clock() - start);
+
+  printf("\nnearest of %u templates of %u samples: %u (%g), pruned search %u (%g)\n",
+         NB_TEMPLATES, SEARCH_LENGTH, (unsigned)nearest, best, (unsigned)nearestPruned, bestPruned);
+  printf("  full DTW run on %u templates, time per search: all %.3f ms  pruned %.3f ms\n",
+         (unsigned)computed, (tFull * 1e3) / (float64_t)CLOCKS_PER_SEC, (tPruned * 1e3) / (float64_t)CLOCKS_PER_SEC);
+
+  return ((nearest != nearestPruned) || (best != bestPruned)) ? ARM_MATH_TEST_FAILURE : ARM_MATH_SUCCESS;
+}
+
+int32_t main(void)
+{
+  arm_status status = ARM_MATH_SUCCESS;
+
+  printf("START\n");
+
+  if (check_cases() != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+  if (check_search() != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  printf((status == ARM_MATH_SUCCESS) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (status == ARM_MATH_SUCCESS) ? 0 : 1;
+}
+
+ /** \endlink */
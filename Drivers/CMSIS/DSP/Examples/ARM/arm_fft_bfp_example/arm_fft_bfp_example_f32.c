@@ -0,0 +1,363 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fft_bfp_example_f32.c
+ * Description:  Block floating-point Q15 and Q31 FFT accuracy and throughput
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup FftBfpExample Block Floating-Point FFT Example
+ *
+ * \par Description:
+ * \par
+ * Computes the complex FFT of random signals of amplitudes from 1/2 down to
+ * 1/8192 of full scale with arm_cfft_bfp_q15(), arm_cfft_q15(),
+ * arm_cfft_bfp_q31() and arm_cfft_q31(), and the real FFT with
+ * arm_rfft_bfp_q15() and arm_rfft_q15(). Prints the signal to noise ratio of
+ * every result against arm_cfft_f32() or arm_rfft_fast_f32() of the same
+ * samples: the fixed scaling of arm_cfft_q15() loses 6 dB per halving of the
+ * amplitude, the block floating-point variants do not.
+ *
+ * \par
+ * Then prints the time per transform of the fixed scaling, block floating-point
+ * and floating-point FFTs. The time is measured with the C library clock():
+ * run on the host or with semihosting.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_cfft_init_q15()
+ * - arm_cfft_q15()
+ * - arm_cfft_bfp_q15()
+ * - arm_cfft_init_q31()
+ * - arm_cfft_q31()
+ * - arm_cfft_bfp_q31()
+ * - arm_cfft_init_f32()
+ * - arm_cfft_f32()
+ * - arm_rfft_init_q15()
+ * - arm_rfft_q15()
+ * - arm_rfft_bfp_q15()
+ * - arm_rfft_fast_init_f32()
+ * - arm_rfft_fast_f32()
+ *
+ * @} */
+
+#include "arm_math.h"
+#include <stdio.h>
+#include <time.h>
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define MAX_FFT_LEN       4096
+#define NUM_AMPLITUDES    5
+#define BENCH_VALUES      (1UL << 22)
+#define SNR_BFP_Q15       50.0f
+#define SNR_BFP_Q31       120.0f
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+static q15_t signalQ15[2 * MAX_FFT_LEN];
+static q15_t bufferQ15[2 * MAX_FFT_LEN + 2];
+static q15_t outputQ15[2 * MAX_FFT_LEN + 2];
+static q31_t bufferQ31[2 * MAX_FFT_LEN];
+static q31_t outputQ31[2 * MAX_FFT_LEN];
+static float32_t bufferF32[2 * MAX_FFT_LEN];
+static float32_t refF32[2 * MAX_FFT_LEN];
+
+/* ----------------------------------------------------------------------
+* Pseudo random test signal in [-amplitude, amplitude)
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345U;
+
+static q15_t random_q15(float32_t amplitude)
+{
+  seed = (seed * 1664525U) + 1013904223U;
+  return (q15_t)((((float32_t)(seed >> 8) / 8388608.0f) - 1.0f) * amplitude * 32768.0f);
+}
+
+/* ----------------------------------------------------------------------
+* Signal to noise ratio in dB of a result scaled by 2^exponent
+* ------------------------------------------------------------------- */
+static float32_t snr_q15(const float32_t *pRef, const q15_t *pTest, int32_t exponent, uint32_t length)
+{
+  const float64_t scale = ldexp(1.0, exponent - 15);
+  float64_t signal = 0.0;
+  float64_t noise = 0.0;
+  float64_t diff;
+  uint32_t i;
+
+  for (i = 0U; i < length; i++)
+  {
+    diff = ((float64_t)pTest[i] * scale) - pRef[i];
+    signal += (float64_t)pRef[i] * pRef[i];
+    noise += diff * diff;
+  }
+
+  return (noise == 0.0) ? 300.0f : (float32_t)(10.0 * log10(signal / noise));
+}
+
+static float32_t snr_q31(const float32_t *pRef, const q31_t *pTest, int32_t exponent, uint32_t length)
+{
+  const float64_t scale = ldexp(1.0, exponent - 31);
+  float64_t signal = 0.0;
+  float64_t noise = 0.0;
+  float64_t diff;
+  uint32_t i;
+
+  for (i = 0U; i < length; i++)
+  {
+    diff = ((float64_t)pTest[i] * scale) - pRef[i];
+    signal += (float64_t)pRef[i] * pRef[i];
+    noise += diff * diff;
+  }
+
+  return (noise == 0.0) ? 300.0f : (float32_t)(10.0 * log10(signal / noise));
+}
+
+/* ----------------------------------------------------------------------
+* Accuracy of the complex FFTs of one length
+* ------------------------------------------------------------------- */
+static arm_status check_cfft(uint32_t fftLen)
+{
+  arm_cfft_instance_q15 cfftQ15;
+  arm_cfft_instance_q31 cfftQ31;
+  arm_cfft_instance_f32 cfftF32;
+  arm_status status = ARM_MATH_SUCCESS;
+  const uint32_t log2Len = 31U - __CLZ(fftLen);
+  float32_t amplitude = 0.5f;
+  float32_t snrBfpQ15, snrQ15, snrBfpQ31, snrQ31;
+  int16_t exponent;
+  uint32_t amp;
+  uint32_t i;
+
+  (void)arm_cfft_init_q15(&cfftQ15, (uint16_t)fftLen);
+  (void)arm_cfft_init_q31(&cfftQ31, (uint16_t)fftLen);
+  (void)arm_cfft_init_f32(&cfftF32, (uint16_t)fftLen);
+
+  for (amp = 0U; amp < NUM_AMPLITUDES; amp++)
+  {
+    for (i = 0U; i < (2U * fftLen); i++)
+    {
+      signalQ15[i] = random_q15(amplitude);
+      refF32[i] = (float32_t)signalQ15[i] / 32768.0f;
+    }
+    arm_cfft_f32(&cfftF32, refF32, 0U, 1U);
+
+    arm_copy_q15(signalQ15, bufferQ15, 2U * fftLen);
+    arm_cfft_bfp_q15(&cfftQ15, bufferQ15, 0U, 1U, &exponent);
+    snrBfpQ15 = snr_q15(refF32, bufferQ15, exponent, 2U * fftLen);
+
+    arm_copy_q15(signalQ15, bufferQ15, 2U * fftLen);
+    arm_cfft_q15(&cfftQ15, bufferQ15, 0U, 1U);
+    snrQ15 = snr_q15(refF32, bufferQ15, (int32_t)log2Len, 2U * fftLen);
+
+    arm_q15_to_q31(signalQ15, bufferQ31, 2U * fftLen);
+    arm_cfft_bfp_q31(&cfftQ31, bufferQ31, 0U, 1U, &exponent);
+    snrBfpQ31 = snr_q31(refF32, bufferQ31, exponent, 2U * fftLen);
+
+    arm_q15_to_q31(signalQ15, bufferQ31, 2U * fftLen);
+    arm_cfft_q31(&cfftQ31, bufferQ31, 0U, 1U);
+    snrQ31 = snr_q31(refF32, bufferQ31, (int32_t)log2Len, 2U * fftLen);
+
+    printf("cfft %4u  amplitude 2^-%-2u  q15 %6.1f  bfp q15 %6.1f  q31 %6.1f  bfp q31 %6.1f dB\n",
+           (unsigned)fftLen, (unsigned)(1U + (3U * amp)), snrQ15, snrBfpQ15, snrQ31, snrBfpQ31);
+
+    if ((snrBfpQ15 < SNR_BFP_Q15) || (snrBfpQ31 < SNR_BFP_Q31))
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+    amplitude *= 0.125f;
+  }
+
+  return status;
+}
+
+/* ----------------------------------------------------------------------
+* Accuracy of the real FFTs of one length
+* ------------------------------------------------------------------- */
+static arm_status check_rfft(uint32_t fftLen)
+{
+  arm_rfft_instance_q15 rfftQ15;
+  arm_rfft_fast_instance_f32 rfftF32;
+  arm_status status = ARM_MATH_SUCCESS;
+  const uint32_t log2Len = 31U - __CLZ(fftLen);
+  float32_t amplitude = 0.5f;
+  float32_t snrBfpQ15, snrQ15;
+  int16_t exponent;
+  uint32_t amp;
+  uint32_t i;
+
+  (void)arm_rfft_init_q15(&rfftQ15, fftLen, 0U, 1U);
+  (void)arm_rfft_fast_init_f32(&rfftF32, (uint16_t)fftLen);
+
+  for (amp = 0U; amp < NUM_AMPLITUDES; amp++)
+  {
+    for (i = 0U; i < fftLen; i++)
+    {
+      signalQ15[i] = random_q15(amplitude);
+      bufferF32[i] = (float32_t)signalQ15[i] / 32768.0f;
+    }
+    arm_rfft_fast_f32(&rfftF32, bufferF32, refF32, 0U);
+
+    /* Packed Nyquist value of arm_rfft_fast_f32() compared as the imaginary part of the DC bin */
+    arm_copy_q15(signalQ15, bufferQ15, fftLen);
+    arm_rfft_bfp_q15(&rfftQ15, bufferQ15, outputQ15, &exponent);
+    outputQ15[1] = outputQ15[fftLen];
+    snrBfpQ15 = snr_q15(refF32, outputQ15, exponent, fftLen);
+
+    arm_copy_q15(signalQ15, bufferQ15, fftLen);
+    arm_rfft_q15(&rfftQ15, bufferQ15, outputQ15);
+    outputQ15[1] = outputQ15[fftLen];
+    snrQ15 = snr_q15(refF32, outputQ15, (int32_t)log2Len, fftLen);
+
+    printf("rfft %4u  amplitude 2^-%-2u  q15 %6.1f  bfp q15 %6.1f dB\n",
+           (unsigned)fftLen, (unsigned)(1U + (3U * amp)), snrQ15, snrBfpQ15);
+
+    if (snrBfpQ15 < SNR_BFP_Q15)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+    amplitude *= 0.125f;
+  }
+
+  return status;
+}
+
+/* ----------------------------------------------------------------------
+* Time per complex FFT in us, input copy included
+* ------------------------------------------------------------------- */
+static void bench_cfft(uint32_t fftLen)
+{
+  arm_cfft_instance_q15 cfftQ15;
+  arm_cfft_instance_q31 cfftQ31;
+  arm_cfft_instance_f32 cfftF32;
+  const uint32_t numRuns = BENCH_VALUES / fftLen;
+  float64_t timeQ15, timeBfpQ15, timeQ31, timeBfpQ31, timeF32;
+  clock_t start;
+  int16_t exponent;
+  uint32_t run;
+  uint32_t i;
+
+  (void)arm_cfft_init_q15(&cfftQ15, (uint16_t)fftLen);
+  (void)arm_cfft_init_q31(&cfftQ31, (uint16_t)fftLen);
+  (void)arm_cfft_init_f32(&cfftF32, (uint16_t)fftLen);
+
+  for (i = 0U; i < (2U * fftLen); i++)
+  {
+    signalQ15[i] = random_q15(0.5f);
+  }
+  arm_q15_to_q31(signalQ15, outputQ31, 2U * fftLen);
+  arm_q15_to_float(signalQ15, refF32, 2U * fftLen);
+
+  start = clock();
+  for (run = 0U; run < numRuns; run++)
+  {
+    arm_copy_q15(signalQ15, bufferQ15, 2U * fftLen);
+    arm_cfft_q15(&cfftQ15, bufferQ15, 0U, 1U);
+  }
+  timeQ15 = ((float64_t)(clock() - start) * 1e6) / ((float64_t)CLOCKS_PER_SEC * numRuns);
+
+  start = clock();
+  for (run = 0U; run < numRuns; run++)
+  {
+    arm_copy_q15(signalQ15, bufferQ15, 2U * fftLen);
+    arm_cfft_bfp_q15(&cfftQ15, bufferQ15, 0U, 1U, &exponent);
+  }
+  timeBfpQ15 = ((float64_t)(clock() - start) * 1e6) / ((float64_t)CLOCKS_PER_SEC * numRuns);
+
+  start = clock();
+  for (run = 0U; run < numRuns; run++)
+  {
+    arm_copy_q31(outputQ31, bufferQ31, 2U * fftLen);
+    arm_cfft_q31(&cfftQ31, bufferQ31, 0U, 1U);
+  }
+  timeQ31 = ((float64_t)(clock() - start) * 1e6) / ((float64_t)CLOCKS_PER_SEC * numRuns);
+
+  start = clock();
+  for (run = 0U; run < numRuns; run++)
+  {
+    arm_copy_q31(outputQ31, bufferQ31, 2U * fftLen);
+    arm_cfft_bfp_q31(&cfftQ31, bufferQ31, 0U, 1U, &exponent);
+  }
+  timeBfpQ31 = ((float64_t)(clock() - start) * 1e6) / ((float64_t)CLOCKS_PER_SEC * numRuns);
+
+  start = clock();
+  for (run = 0U; run < numRuns; run++)
+  {
+    arm_copy_f32(refF32, bufferF32, 2U * fftLen);
+    arm_cfft_f32(&cfftF32, bufferF32, 0U, 1U);
+  }
+  timeF32 = ((float64_t)(clock() - start) * 1e6) / ((float64_t)CLOCKS_PER_SEC * numRuns);
+
+  printf("%5u %9.2f %9.2f %9.2f %9.2f %9.2f\n", (unsigned)fftLen,
+         timeQ15, timeBfpQ15, timeQ31, timeBfpQ31, timeF32);
+}
+
+int32_t main(void)
+{
+  arm_status status = ARM_MATH_SUCCESS;
+  uint32_t fftLen;
+
+  printf("START\n");
+
+  for (fftLen = 16U; fftLen <= MAX_FFT_LEN; fftLen <<= 2U)
+  {
+    if (check_cfft(fftLen) != ARM_MATH_SUCCESS)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+  for (fftLen = 32U; fftLen <= MAX_FFT_LEN; fftLen <<= 2U)
+  {
+    if (check_cfft(fftLen) != ARM_MATH_SUCCESS)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+  for (fftLen = 64U; fftLen <= MAX_FFT_LEN; fftLen <<= 2U)
+  {
+    if (check_rfft(fftLen) != ARM_MATH_SUCCESS)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  printf("\ncfft, us per transform\n");
+  printf("  len       q15   bfp q15       q31   bfp q31       f32\n");
+  for (fftLen = 16U; fftLen <= MAX_FFT_LEN; fftLen <<= 1U)
+  {
+    bench_cfft(fftLen);
+  }
+
+  printf((status == ARM_MATH_SUCCESS) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (status == ARM_MATH_SUCCESS) ? 0 : 1;
+}
+
+ /** \endlink */
@@ -0,0 +1,490 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fft_dynamic_tables_example_f32.c
+ * Description:  FFT tables generated at run time: bit identity check and initialization time
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup FftDynamicTablesExample FFT Tables Generated at Run Time Example
+ *
+ * \par Description:
+ * \par
+ * For every complex FFT length from 16 to 4096 and every real FFT length from
+ * 32 to 4096, initializes one instance with the constant tables and one with
+ * the tables generated at run time, then checks that the twiddle factors are
+ * bit identical, that both bit reversal tables have the same length and give
+ * the same permutation, and that the forward and inverse transforms of a
+ * random signal are bit identical.
+ *
+ * \par
+ * The generated tables are also checked without the constant tables: the
+ * twiddle factors against golden values of arm_common_tables.c for a few
+ * lengths, and the forward transforms against a double precision DFT, which
+ * fails for any wrong twiddle factor or bit reversal.
+ *
+ * \par
+ * Prints the buffer size and the initialization time of every length. The
+ * time is measured with the C library clock(): run on the host or with
+ * semihosting. The code sizes with the constant and the generated tables are
+ * in Abstract.txt.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_cfft_init_f32()
+ * - arm_cfft_dynamic_buffer_size_f32()
+ * - arm_cfft_init_dynamic_f32()
+ * - arm_cfft_f32()
+ * - arm_rfft_fast_init_f32()
+ * - arm_rfft_fast_dynamic_buffer_size_f32()
+ * - arm_rfft_fast_init_dynamic_f32()
+ * - arm_rfft_fast_f32()
+ *
+ * @} */
+
+#include "arm_math.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define MAX_FFT_LEN   4096
+#define BUFFER_SIZE   (4 * MAX_FFT_LEN)
+#define BENCH_VALUES  (1UL << 20)
+#define DFT_MAX_ERROR 1e-5
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+static float32_t tableBuffer[BUFFER_SIZE];
+static float32_t signal[2 * MAX_FFT_LEN];
+static float32_t refData[2 * MAX_FFT_LEN];
+static float32_t testData[2 * MAX_FFT_LEN];
+static float32_t refOutput[MAX_FFT_LEN];
+static float32_t testOutput[MAX_FFT_LEN];
+static uint32_t refPerm[MAX_FFT_LEN];
+static uint32_t testPerm[MAX_FFT_LEN];
+static float64_t dftCos[MAX_FFT_LEN];
+static float64_t dftSin[MAX_FFT_LEN];
+
+/* ----------------------------------------------------------------------
+* Golden values of arm_common_tables.c
+* ------------------------------------------------------------------- */
+static const float32_t goldenTwiddle16[32] = {
+   1.000000000f,  0.000000000f,  0.923879533f,  0.382683432f,
+   0.707106781f,  0.707106781f,  0.382683432f,  0.923879533f,
+   0.000000000f,  1.000000000f, -0.382683432f,  0.923879533f,
+  -0.707106781f,  0.707106781f, -0.923879533f,  0.382683432f,
+  -1.000000000f,  0.000000000f, -0.923879533f, -0.382683432f,
+  -0.707106781f, -0.707106781f, -0.382683432f, -0.923879533f,
+  -0.000000000f, -1.000000000f,  0.382683432f, -0.923879533f,
+   0.707106781f, -0.707106781f,  0.923879533f, -0.382683432f
+};
+
+static const float32_t goldenTwiddleRfft32[32] = {
+   0.000000000f,  1.000000000f,  0.195090322f,  0.980785280f,
+   0.382683432f,  0.923879533f,  0.555570233f,  0.831469612f,
+   0.707106781f,  0.707106781f,  0.831469612f,  0.555570233f,
+   0.923879533f,  0.382683432f,  0.980785280f,  0.195090322f,
+   1.000000000f,  0.000000000f,  0.980785280f, -0.195090322f,
+   0.923879533f, -0.382683432f,  0.831469612f, -0.555570233f,
+   0.707106781f, -0.707106781f,  0.555570233f, -0.831469612f,
+   0.382683432f, -0.923879533f,  0.195090322f, -0.980785280f
+};
+
+/* Index and value of a few twiddle factors of twiddleCoef_4096 */
+static const struct
+{
+  uint32_t index;
+  float32_t cos;
+  float32_t sin;
+} goldenTwiddle4096[] = {
+  {    1U, 0.999998823f,  0.001533980f },
+  {  683U, 0.499557113f,  0.866280954f },
+  { 1536U, -0.707106781f, 0.707106781f }
+};
+
+/* ----------------------------------------------------------------------
+* Pseudo random test signal in [-0.5, 0.5)
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345U;
+
+static float32_t random_f32(void)
+{
+  seed = (seed * 1664525U) + 1013904223U;
+  return ((float32_t)(seed >> 8) / 16777216.0f) - 0.5f;
+}
+
+/* ----------------------------------------------------------------------
+* Permutation of the complex values applied by a bit reversal table
+* ------------------------------------------------------------------- */
+static void bitrev_permutation(const arm_cfft_instance_f32 *S, uint32_t *pPerm)
+{
+  uint32_t a;
+  uint32_t b;
+  uint32_t tmp;
+  uint32_t i;
+
+  for (i = 0U; i < S->fftLen; i++)
+  {
+    pPerm[i] = i;
+  }
+
+  for (i = 0U; i < S->bitRevLength; i += 2U)
+  {
+    a = S->pBitRevTable[i] / 8U;
+    b = S->pBitRevTable[i + 1U] / 8U;
+    tmp = pPerm[a];
+    pPerm[a] = pPerm[b];
+    pPerm[b] = tmp;
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Golden values compared by value: the sign of the zeros is not checked
+* ------------------------------------------------------------------- */
+static arm_status check_golden(const float32_t *pTable, const float32_t *pGolden, uint32_t numValues)
+{
+  uint32_t i;
+
+  for (i = 0U; i < numValues; i++)
+  {
+    if (pTable[i] != pGolden[i])
+    {
+      return ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------
+* Relative rms error of an FFT of the signal against a double precision DFT.
+* pOut is fftLen complex values, or the packed output of the real FFT when
+* real is set (X[0], X[fftLen/2] then X[1] to X[fftLen/2-1]).
+* ------------------------------------------------------------------- */
+static float64_t dft_error(const float32_t *pOut, uint32_t fftLen, uint32_t real)
+{
+  const uint32_t numBins = (real != 0U) ? ((fftLen / 2U) + 1U) : fftLen;
+  float64_t re;
+  float64_t im;
+  float64_t outRe;
+  float64_t outIm;
+  float64_t error = 0.0;
+  float64_t norm = 0.0;
+  uint32_t k;
+  uint32_t n;
+
+  for (n = 0U; n < fftLen; n++)
+  {
+    dftCos[n] = cos((2.0 * PI * n) / fftLen);
+    dftSin[n] = sin((2.0 * PI * n) / fftLen);
+  }
+
+  for (k = 0U; k < numBins; k++)
+  {
+    re = 0.0;
+    im = 0.0;
+    for (n = 0U; n < fftLen; n++)
+    {
+      const uint32_t phase = (k * n) % fftLen;
+
+      if (real != 0U)
+      {
+        re += signal[n] * dftCos[phase];
+        im -= signal[n] * dftSin[phase];
+      }
+      else
+      {
+        re += (signal[2U * n] * dftCos[phase]) + (signal[(2U * n) + 1U] * dftSin[phase]);
+        im += (signal[(2U * n) + 1U] * dftCos[phase]) - (signal[2U * n] * dftSin[phase]);
+      }
+    }
+
+    if (real == 0U)
+    {
+      outRe = pOut[2U * k];
+      outIm = pOut[(2U * k) + 1U];
+    }
+    else if (k == 0U)
+    {
+      outRe = pOut[0];
+      outIm = 0.0;
+    }
+    else if (k == (fftLen / 2U))
+    {
+      outRe = pOut[1];
+      outIm = 0.0;
+    }
+    else
+    {
+      outRe = pOut[2U * k];
+      outIm = pOut[(2U * k) + 1U];
+    }
+
+    error += ((outRe - re) * (outRe - re)) + ((outIm - im) * (outIm - im));
+    norm += (re * re) + (im * im);
+  }
+
+  return sqrt(error / norm);
+}
+
+/* ----------------------------------------------------------------------
+* Tables and transforms of the complex FFT instances
+* ------------------------------------------------------------------- */
+static arm_status check_cfft(const arm_cfft_instance_f32 *pRef, const arm_cfft_instance_f32 *pTest)
+{
+  const uint32_t fftLen = pRef->fftLen;
+  uint8_t ifftFlag;
+  uint32_t i;
+
+  if (memcmp(pRef->pTwiddle, pTest->pTwiddle, 2U * fftLen * sizeof(float32_t)) != 0)
+  {
+    printf("cfft %4u: twiddle factors differ\n", (unsigned)fftLen);
+    return ARM_MATH_TEST_FAILURE;
+  }
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+  {
+    uint32_t numValues = 0U;
+    uint32_t stageLen = ((fftLen & 0x55555555U) != 0U) ? fftLen : (fftLen / 2U);
+
+    for (; stageLen >= 16U; stageLen >>= 2U)
+    {
+      numValues += stageLen / 2U;
+    }
+    if ((memcmp(pRef->rearranged_twiddle_stride1, pTest->rearranged_twiddle_stride1, numValues * sizeof(float32_t)) != 0) ||
+        (memcmp(pRef->rearranged_twiddle_stride2, pTest->rearranged_twiddle_stride2, numValues * sizeof(float32_t)) != 0) ||
+        (memcmp(pRef->rearranged_twiddle_stride3, pTest->rearranged_twiddle_stride3, numValues * sizeof(float32_t)) != 0))
+    {
+      printf("cfft %4u: reordered twiddle factors differ\n", (unsigned)fftLen);
+      return ARM_MATH_TEST_FAILURE;
+    }
+  }
+#endif
+
+  bitrev_permutation(pRef, refPerm);
+  bitrev_permutation(pTest, testPerm);
+  if ((pRef->bitRevLength != pTest->bitRevLength) ||
+      (memcmp(refPerm, testPerm, fftLen * sizeof(uint32_t)) != 0))
+  {
+    printf("cfft %4u: bit reversal differs (length %u and %u)\n", (unsigned)fftLen,
+           (unsigned)pRef->bitRevLength, (unsigned)pTest->bitRevLength);
+    return ARM_MATH_TEST_FAILURE;
+  }
+
+  for (ifftFlag = 0U; ifftFlag <= 1U; ifftFlag++)
+  {
+    for (i = 0U; i < (2U * fftLen); i++)
+    {
+      refData[i] = signal[i];
+      testData[i] = signal[i];
+    }
+    arm_cfft_f32(pRef, refData, ifftFlag, 1U);
+    arm_cfft_f32(pTest, testData, ifftFlag, 1U);
+    if (memcmp(refData, testData, 2U * fftLen * sizeof(float32_t)) != 0)
+    {
+      printf("cfft %4u: %s transforms differ\n", (unsigned)fftLen, (ifftFlag == 0U) ? "forward" : "inverse");
+      return ARM_MATH_TEST_FAILURE;
+    }
+    if ((ifftFlag == 0U) && (dft_error(testData, fftLen, 0U) > DFT_MAX_ERROR))
+    {
+      printf("cfft %4u: forward transform differs from the DFT\n", (unsigned)fftLen);
+      return ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------
+* Tables and transforms of the real FFT instances
+* ------------------------------------------------------------------- */
+static arm_status check_rfft(const arm_rfft_fast_instance_f32 *pRef, const arm_rfft_fast_instance_f32 *pTest)
+{
+  const uint32_t fftLen = pRef->fftLenRFFT;
+  uint8_t ifftFlag;
+  uint32_t i;
+
+  if (memcmp(pRef->pTwiddleRFFT, pTest->pTwiddleRFFT, fftLen * sizeof(float32_t)) != 0)
+  {
+    printf("rfft %4u: twiddle factors differ\n", (unsigned)fftLen);
+    return ARM_MATH_TEST_FAILURE;
+  }
+
+  if (check_cfft(&pRef->Sint, &pTest->Sint) != ARM_MATH_SUCCESS)
+  {
+    return ARM_MATH_TEST_FAILURE;
+  }
+
+  for (ifftFlag = 0U; ifftFlag <= 1U; ifftFlag++)
+  {
+    for (i = 0U; i < fftLen; i++)
+    {
+      refData[i] = signal[i];
+      testData[i] = signal[i];
+    }
+    arm_rfft_fast_f32(pRef, refData, refOutput, ifftFlag);
+    arm_rfft_fast_f32(pTest, testData, testOutput, ifftFlag);
+    if (memcmp(refOutput, testOutput, fftLen * sizeof(float32_t)) != 0)
+    {
+      printf("rfft %4u: %s transforms differ\n", (unsigned)fftLen, (ifftFlag == 0U) ? "forward" : "inverse");
+      return ARM_MATH_TEST_FAILURE;
+    }
+    if ((ifftFlag == 0U) && (dft_error(testOutput, fftLen, 1U) > DFT_MAX_ERROR))
+    {
+      printf("rfft %4u: forward transform differs from the DFT\n", (unsigned)fftLen);
+      return ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+int32_t main(void)
+{
+  arm_status status = ARM_MATH_SUCCESS;
+  arm_cfft_instance_f32 cfftRef;
+  arm_cfft_instance_f32 cfftTest;
+  arm_rfft_fast_instance_f32 rfftRef;
+  arm_rfft_fast_instance_f32 rfftTest;
+  uint32_t bufferSize;
+  uint32_t numRuns;
+  uint32_t fftLen;
+  uint32_t run;
+  uint32_t i;
+  clock_t start;
+  float64_t initTime;
+
+  printf("START\n");
+
+  for (i = 0U; i < (2U * MAX_FFT_LEN); i++)
+  {
+    signal[i] = random_f32();
+  }
+
+  printf(" cfft   buffer bytes   init us\n");
+  for (fftLen = 16U; fftLen <= MAX_FFT_LEN; fftLen <<= 1U)
+  {
+    bufferSize = arm_cfft_dynamic_buffer_size_f32((uint16_t)fftLen);
+    if ((bufferSize == 0U) || (bufferSize > BUFFER_SIZE) ||
+        (arm_cfft_init_f32(&cfftRef, (uint16_t)fftLen) != ARM_MATH_SUCCESS))
+    {
+      status = ARM_MATH_TEST_FAILURE;
+      continue;
+    }
+
+    numRuns = BENCH_VALUES / bufferSize;
+    start = clock();
+    for (run = 0U; run < numRuns; run++)
+    {
+      (void)arm_cfft_init_dynamic_f32(&cfftTest, (uint16_t)fftLen, tableBuffer);
+    }
+    initTime = ((float64_t)(clock() - start) * 1e6) / ((float64_t)CLOCKS_PER_SEC * numRuns);
+
+    printf("%5u %14u %9.2f\n", (unsigned)fftLen, (unsigned)(bufferSize * sizeof(float32_t)), initTime);
+
+    if (check_cfft(&cfftRef, &cfftTest) != ARM_MATH_SUCCESS)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  printf("\n rfft   buffer bytes   init us\n");
+  for (fftLen = 32U; fftLen <= MAX_FFT_LEN; fftLen <<= 1U)
+  {
+    bufferSize = arm_rfft_fast_dynamic_buffer_size_f32((uint16_t)fftLen);
+    if ((bufferSize == 0U) || (bufferSize > BUFFER_SIZE) ||
+        (arm_rfft_fast_init_f32(&rfftRef, (uint16_t)fftLen) != ARM_MATH_SUCCESS))
+    {
+      status = ARM_MATH_TEST_FAILURE;
+      continue;
+    }
+
+    numRuns = BENCH_VALUES / bufferSize;
+    start = clock();
+    for (run = 0U; run < numRuns; run++)
+    {
+      (void)arm_rfft_fast_init_dynamic_f32(&rfftTest, (uint16_t)fftLen, tableBuffer);
+    }
+    initTime = ((float64_t)(clock() - start) * 1e6) / ((float64_t)CLOCKS_PER_SEC * numRuns);
+
+    printf("%5u %14u %9.2f\n", (unsigned)fftLen, (unsigned)(bufferSize * sizeof(float32_t)), initTime);
+
+    if (check_rfft(&rfftRef, &rfftTest) != ARM_MATH_SUCCESS)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  if ((arm_cfft_init_dynamic_f32(&cfftTest, 24U, tableBuffer) != ARM_MATH_ARGUMENT_ERROR) ||
+      (arm_cfft_init_dynamic_f32(&cfftTest, 8192U, tableBuffer) != ARM_MATH_ARGUMENT_ERROR) ||
+      (arm_rfft_fast_init_dynamic_f32(&rfftTest, 16U, tableBuffer) != ARM_MATH_ARGUMENT_ERROR))
+  {
+    printf("unsupported length accepted\n");
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  /* Golden values, independent of the constant tables linked in */
+  if ((arm_cfft_init_dynamic_f32(&cfftTest, 16U, tableBuffer) != ARM_MATH_SUCCESS) ||
+      (check_golden(cfftTest.pTwiddle, goldenTwiddle16, 32U) != ARM_MATH_SUCCESS))
+  {
+    printf("cfft   16: twiddle factors differ from the golden values\n");
+    status = ARM_MATH_TEST_FAILURE;
+  }
+  if ((arm_rfft_fast_init_dynamic_f32(&rfftTest, 32U, tableBuffer) != ARM_MATH_SUCCESS) ||
+      (check_golden(rfftTest.pTwiddleRFFT, goldenTwiddleRfft32, 32U) != ARM_MATH_SUCCESS))
+  {
+    printf("rfft   32: twiddle factors differ from the golden values\n");
+    status = ARM_MATH_TEST_FAILURE;
+  }
+  if (arm_cfft_init_dynamic_f32(&cfftTest, 4096U, tableBuffer) != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+  else
+  {
+    for (i = 0U; i < (sizeof(goldenTwiddle4096) / sizeof(goldenTwiddle4096[0])); i++)
+    {
+      if ((cfftTest.pTwiddle[2U * goldenTwiddle4096[i].index] != goldenTwiddle4096[i].cos) ||
+          (cfftTest.pTwiddle[(2U * goldenTwiddle4096[i].index) + 1U] != goldenTwiddle4096[i].sin))
+      {
+        printf("cfft 4096: twiddle factor %u differs from the golden value\n", (unsigned)goldenTwiddle4096[i].index);
+        status = ARM_MATH_TEST_FAILURE;
+      }
+    }
+  }
+
+  printf((status == ARM_MATH_SUCCESS) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (status == ARM_MATH_SUCCESS) ? 0 : 1;
+}
+
+ /** \endlink */
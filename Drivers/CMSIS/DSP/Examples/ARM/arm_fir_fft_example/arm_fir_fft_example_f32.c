@@ -0,0 +1,250 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_example_f32.c
+ * Description:  FFT based FIR filter accuracy check and direct form crossover benchmark
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup FirFftExample FFT based FIR Filter Example
+ *
+ * \par Description:
+ * \par
+ * Checks arm_fir_fft_f32() against arm_fir_f32() and arm_conv_fft_f32() against
+ * arm_conv_f32() for several filter lengths and block sizes, then measures the
+ * time per output sample of both FIR implementations for filter lengths from
+ * 16 to 8192 taps and reports the crossover: the shortest filter for which the
+ * FFT based filter is faster than the direct form.
+ *
+ * \par
+ * The time is measured with the C library clock(): run on the host or with
+ * semihosting, and use a long enough <code>BENCH_SAMPLES</code> for the clock
+ * resolution.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_fir_init_f32()
+ * - arm_fir_f32()
+ * - arm_conv_f32()
+ * - arm_fir_fft_init_f32()
+ * - arm_fir_fft_buffer_size_f32()
+ * - arm_fir_fft_f32()
+ * - arm_conv_fft_f32()
+ *
+ * @} */
+
+#include "arm_math.h"
+#include <stdio.h>
+#include <time.h>
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define MAX_TAPS        8192
+#define MAX_BLOCKSIZE   1024
+#define TEST_SAMPLES    8192
+#define BENCH_SAMPLES   65536
+#define BENCH_BLOCKSIZE 256
+#define SNR_THRESHOLD   100.0f
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+static float32_t coeffs[MAX_TAPS];
+static float32_t naturalCoeffs[MAX_TAPS];
+static float32_t firState[MAX_TAPS + MAX_BLOCKSIZE - 1];
+static float32_t fftBuffer[20 * MAX_TAPS];
+static float32_t input[BENCH_SAMPLES];
+static float32_t refOutput[TEST_SAMPLES + MAX_TAPS];
+static float32_t testOutput[TEST_SAMPLES + MAX_TAPS];
+static float32_t benchOutput[BENCH_SAMPLES];
+
+/* ----------------------------------------------------------------------
+* Pseudo random test signal in [-0.5, 0.5)
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345U;
+
+static float32_t random_f32(void)
+{
+  seed = (seed * 1664525U) + 1013904223U;
+  return ((float32_t)(seed >> 8) / 16777216.0f) - 0.5f;
+}
+
+/* ----------------------------------------------------------------------
+* Signal to noise ratio in dB
+* ------------------------------------------------------------------- */
+static float32_t snr_f32(const float32_t *pRef, const float32_t *pTest, uint32_t length)
+{
+  float64_t signal = 0.0;
+  float64_t noise = 0.0;
+  uint32_t i;
+
+  for (i = 0U; i < length; i++)
+  {
+    signal += (float64_t)pRef[i] * pRef[i];
+    noise += ((float64_t)pRef[i] - pTest[i]) * ((float64_t)pRef[i] - pTest[i]);
+  }
+
+  return (noise == 0.0) ? 300.0f : (float32_t)(10.0 * log10(signal / noise));
+}
+
+/* ----------------------------------------------------------------------
+* Accuracy of one filter length and block size
+* ------------------------------------------------------------------- */
+static arm_status check_filter(uint16_t numTaps, uint32_t blockSize)
+{
+  arm_fir_instance_f32 fir;
+  arm_fir_fft_instance_f32 firFft;
+  uint32_t pos;
+  uint32_t blkCnt;
+  uint32_t i;
+  float32_t snrFir;
+  float32_t snrConv;
+
+  for (i = 0U; i < numTaps; i++)
+  {
+    coeffs[i] = random_f32();
+    naturalCoeffs[numTaps - 1U - i] = coeffs[i];
+  }
+
+  if (arm_fir_fft_buffer_size_f32(numTaps, blockSize) > (sizeof(fftBuffer) / sizeof(fftBuffer[0])))
+  {
+    return ARM_MATH_TEST_FAILURE;
+  }
+
+  arm_fir_init_f32(&fir, numTaps, coeffs, firState, blockSize);
+  if (arm_fir_fft_init_f32(&firFft, numTaps, coeffs, fftBuffer, blockSize) != ARM_MATH_SUCCESS)
+  {
+    return ARM_MATH_TEST_FAILURE;
+  }
+
+  for (pos = 0U; pos < TEST_SAMPLES; pos += blkCnt)
+  {
+    blkCnt = ((TEST_SAMPLES - pos) < blockSize) ? (TEST_SAMPLES - pos) : blockSize;
+    arm_fir_f32(&fir, &input[pos], &refOutput[pos], blkCnt);
+    arm_fir_fft_f32(&firFft, &input[pos], &testOutput[pos], blkCnt);
+  }
+  snrFir = snr_f32(refOutput, testOutput, TEST_SAMPLES);
+
+  arm_conv_f32(input, TEST_SAMPLES, naturalCoeffs, numTaps, refOutput);
+  arm_conv_fft_f32(&firFft, input, TEST_SAMPLES, testOutput);
+  snrConv = snr_f32(refOutput, testOutput, TEST_SAMPLES + numTaps - 1U);
+
+  printf("taps %5u block %4u partition %4u  fir SNR %6.1f dB  conv SNR %6.1f dB\n",
+         numTaps, (unsigned)blockSize, (unsigned)firFft.partLen, snrFir, snrConv);
+
+  return ((snrFir < SNR_THRESHOLD) || (snrConv < SNR_THRESHOLD)) ? ARM_MATH_TEST_FAILURE : ARM_MATH_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------
+* Time per output sample in ns of both implementations
+* ------------------------------------------------------------------- */
+static void bench_filter(uint16_t numTaps, float64_t *pDirect, float64_t *pFft)
+{
+  arm_fir_instance_f32 fir;
+  arm_fir_fft_instance_f32 firFft;
+  clock_t start;
+  uint32_t pos;
+
+  for (pos = 0U; pos < numTaps; pos++)
+  {
+    coeffs[pos] = random_f32();
+  }
+  arm_fir_init_f32(&fir, numTaps, coeffs, firState, BENCH_BLOCKSIZE);
+  (void)arm_fir_fft_init_f32(&firFft, numTaps, coeffs, fftBuffer, BENCH_BLOCKSIZE);
+
+  start = clock();
+  for (pos = 0U; pos < BENCH_SAMPLES; pos += BENCH_BLOCKSIZE)
+  {
+    arm_fir_f32(&fir, &input[pos], &benchOutput[pos], BENCH_BLOCKSIZE);
+  }
+  *pDirect = ((float64_t)(clock() - start) * 1e9) / ((float64_t)CLOCKS_PER_SEC * BENCH_SAMPLES);
+
+  start = clock();
+  for (pos = 0U; pos < BENCH_SAMPLES; pos += BENCH_BLOCKSIZE)
+  {
+    arm_fir_fft_f32(&firFft, &input[pos], &benchOutput[pos], BENCH_BLOCKSIZE);
+  }
+  *pFft = ((float64_t)(clock() - start) * 1e9) / ((float64_t)CLOCKS_PER_SEC * BENCH_SAMPLES);
+}
+
+int32_t main(void)
+{
+  static const uint16_t testTaps[] = { 1U, 15U, 16U, 17U, 255U, 1000U, 2048U, 4097U, 8192U };
+  static const uint32_t testBlocks[] = { 1U, 13U, 64U, 256U, 1024U };
+  arm_status status = ARM_MATH_SUCCESS;
+  float64_t direct;
+  float64_t fft;
+  uint32_t crossover = 0U;
+  uint32_t numTaps;
+  uint32_t i;
+  uint32_t j;
+
+  printf("START\n");
+
+  for (i = 0U; i < BENCH_SAMPLES; i++)
+  {
+    input[i] = random_f32();
+  }
+
+  for (i = 0U; i < (sizeof(testTaps) / sizeof(testTaps[0])); i++)
+  {
+    for (j = 0U; j < (sizeof(testBlocks) / sizeof(testBlocks[0])); j++)
+    {
+      if (check_filter(testTaps[i], testBlocks[j]) != ARM_MATH_SUCCESS)
+      {
+        status = ARM_MATH_TEST_FAILURE;
+      }
+    }
+  }
+
+  printf("\nblock %u, ns per output sample\n", BENCH_BLOCKSIZE);
+  printf(" taps    direct       fft\n");
+  for (numTaps = 16U; numTaps <= MAX_TAPS; numTaps <<= 1U)
+  {
+    bench_filter((uint16_t)numTaps, &direct, &fft);
+    printf("%5u %9.2f %9.2f\n", (unsigned)numTaps, direct, fft);
+    if ((crossover == 0U) && (fft < direct))
+    {
+      crossover = numTaps;
+    }
+  }
+  if (crossover != 0U)
+  {
+    printf("crossover: FFT based filter faster from %u taps\n", (unsigned)crossover);
+  }
+  else
+  {
+    printf("crossover: direct form faster up to %u taps\n", MAX_TAPS);
+  }
+
+  printf((status == ARM_MATH_SUCCESS) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (status == ARM_MATH_SUCCESS) ? 0 : 1;
+}
+
+ /** \endlink */
@@ -0,0 +1,420 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_example_f32.c
+ * Description:  Rational FIR resampler accuracy check and benchmark against the interpolator and decimator cascade
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup FirResampleExample Rational FIR Resampler Example
+ *
+ * \par Description:
+ * \par
+ * Converts a two tone signal between 44.1 kHz, 48 kHz and 16 kHz with
+ * arm_fir_resample_f32() and checks the signal to noise ratio of the output
+ * against the exact resampled tones. The output is also checked against the
+ * cascade of arm_fir_interpolate_f32() and arm_fir_decimate_f32() with the same
+ * filter, and the same stream cut in blocks of random sizes must give the same
+ * output. Then the ratio is split in stages by arm_fir_resample_plan_f32(), each
+ * one with its own filter, and the same checks are done on the multi-stage output.
+ * Prints the SNR, the number of coefficients and the time per output sample of
+ * the single stage resampler, the cascade and the multi-stage resampler.
+ *
+ * \par
+ * Every filter keeps the band up to <code>PASSBAND</code> times the lower Nyquist
+ * frequency and is designed by arm_fir_resample_design_f32(), with its length
+ * set by the allowed transition band.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_fir_resample_design_f32()
+ * - arm_fir_resample_plan_f32()
+ * - arm_fir_resample_init_f32()
+ * - arm_fir_resample_f32()
+ * - arm_fir_interpolate_init_f32()
+ * - arm_fir_interpolate_f32()
+ * - arm_fir_decimate_init_f32()
+ * - arm_fir_decimate_f32()
+ *
+ * @} */
+
+#include "arm_math.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define INPUT_LENGTH    32768U
+#define OUTPUT_LENGTH   (3U * INPUT_LENGTH + 16U)
+#define BLOCK_SIZE      256U
+#define MAX_TAPS        20000U
+#define MAX_STAGES      6U
+#define MAX_FACTOR      8U
+#define STAGE_POOL      (MAX_STAGES * (16384U + 4U * BLOCK_SIZE * MAX_FACTOR))
+#define PASSBAND        0.8f
+#define SNR_THRESHOLD   70.0f
+#define CASCADE_SNR     110.0f
+#define BENCH_REPEAT    8U
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+static float32_t input[INPUT_LENGTH];
+static float32_t output[OUTPUT_LENGTH];
+static float32_t refOutput[OUTPUT_LENGTH];
+static float32_t coeffs[MAX_TAPS];
+static float32_t state[MAX_TAPS + BLOCK_SIZE];
+static float32_t upsampled[BLOCK_SIZE * 255U + 255U];
+static float32_t interpState[MAX_TAPS + BLOCK_SIZE];
+static float32_t decimState[BLOCK_SIZE * 255U + 255U];
+static float32_t stagePool[STAGE_POOL];
+
+typedef struct
+{
+  uint32_t numStages;
+  arm_fir_resample_instance_f32 stage[MAX_STAGES];
+  float32_t *pBuffer[MAX_STAGES];
+  uint32_t numTaps;
+  float64_t delay;
+} multistage_t;
+
+static multistage_t multi;
+
+/* ----------------------------------------------------------------------
+* Test signal, t in input samples: two tones in the passband
+* ------------------------------------------------------------------- */
+static float64_t tone1;
+static float64_t tone2;
+
+static float64_t signal_f64(float64_t t)
+{
+  return (0.5 * sin(2.0 * PI * tone1 * t)) + (0.3 * sin(2.0 * PI * tone2 * t));
+}
+
+/* ----------------------------------------------------------------------
+* SNR in dB of outputs at rate (relative to the input rate) with delay
+* (in input samples), skipping the filter start
+* ------------------------------------------------------------------- */
+static float32_t snr_tones(const float32_t *pOut, uint32_t count, float64_t rate, float64_t delay)
+{
+  float64_t sig = 0.0;
+  float64_t noise = 0.0;
+  float64_t ref;
+  uint32_t first = (uint32_t)(2.0 * delay * rate) + 1U;
+  uint32_t last = count - (uint32_t)(delay * rate) - 1U;
+  uint32_t k;
+
+  for (k = first; k < last; k++)
+  {
+    ref = signal_f64(((float64_t)k / rate) - delay);
+    sig += ref * ref;
+    noise += (ref - pOut[k]) * (ref - pOut[k]);
+  }
+
+  return (noise == 0.0) ? 300.0f : (float32_t)(10.0 * log10(sig / noise));
+}
+
+static float32_t snr_f32(const float32_t *pRef, const float32_t *pTest, uint32_t length)
+{
+  float64_t sig = 0.0;
+  float64_t noise = 0.0;
+  uint32_t k;
+
+  for (k = 0U; k < length; k++)
+  {
+    sig += (float64_t)pRef[k] * pRef[k];
+    noise += ((float64_t)pRef[k] - pTest[k]) * ((float64_t)pRef[k] - pTest[k]);
+  }
+
+  return (noise == 0.0) ? 300.0f : (float32_t)(10.0 * log10(sig / noise));
+}
+
+/* ----------------------------------------------------------------------
+* Filter of a stage from rateIn to rateIn * L / M (rates relative to the
+* input rate), keeping the band up to band. Returns the number of taps.
+* ------------------------------------------------------------------- */
+static uint32_t design_stage(uint16_t L, uint16_t M, float64_t rateIn, float64_t band, float32_t *pCoeffs, uint32_t maxTaps)
+{
+  float64_t rateOut = (rateIn * L) / M;
+  float64_t lowRate = (rateOut < rateIn) ? rateOut : rateIn;
+  float64_t transition = (lowRate - (2.0 * band)) / rateIn;
+  uint32_t phaseLength = (uint32_t)ceil(8.0 / transition);
+  uint32_t numTaps = phaseLength * L;
+
+  if (numTaps > maxTaps)
+  {
+    return 0U;
+  }
+
+  arm_fir_resample_design_f32(L, (uint16_t)numTaps, (float32_t)((0.5 * lowRate) / rateIn), pCoeffs);
+
+  return numTaps;
+}
+
+/* ----------------------------------------------------------------------
+* Single stage over the whole input, by blocks of blockSize, or of random
+* sizes if blockSize is 0
+* ------------------------------------------------------------------- */
+static uint32_t run_single(arm_fir_resample_instance_f32 *S, float32_t *pDst, uint32_t blockSize)
+{
+  uint32_t pos = 0U;
+  uint32_t outCnt = 0U;
+  uint32_t blkCnt;
+
+  while (pos < INPUT_LENGTH)
+  {
+    blkCnt = (blockSize != 0U) ? blockSize : (1U + ((uint32_t)rand() % BLOCK_SIZE));
+    blkCnt = ((INPUT_LENGTH - pos) < blkCnt) ? (INPUT_LENGTH - pos) : blkCnt;
+    outCnt += arm_fir_resample_f32(S, &input[pos], &pDst[outCnt], blkCnt);
+    pos += blkCnt;
+  }
+
+  return outCnt;
+}
+
+/* ----------------------------------------------------------------------
+* Interpolator then decimator with a 1 tap filter, which keeps u[k * M]
+* as the resampler computes it
+* ------------------------------------------------------------------- */
+static uint32_t run_cascade(uint16_t L, uint16_t M, uint32_t numTaps, float32_t *pDst)
+{
+  static const float32_t one = 1.0f;
+  arm_fir_interpolate_instance_f32 interp;
+  arm_fir_decimate_instance_f32 decim;
+  uint32_t decimBlock = (((BLOCK_SIZE * L) / M) + 1U) * M;
+  uint32_t avail = 0U;
+  uint32_t pos;
+  uint32_t outCnt = 0U;
+  uint32_t used;
+
+  (void)arm_fir_interpolate_init_f32(&interp, (uint8_t)L, (uint16_t)numTaps, coeffs, interpState, BLOCK_SIZE);
+  (void)arm_fir_decimate_init_f32(&decim, 1U, (uint8_t)M, &one, decimState, decimBlock);
+
+  for (pos = 0U; pos < INPUT_LENGTH; pos += BLOCK_SIZE)
+  {
+    arm_fir_interpolate_f32(&interp, &input[pos], &upsampled[avail], BLOCK_SIZE);
+    avail += BLOCK_SIZE * L;
+
+    used = (avail / M) * M;
+    arm_fir_decimate_f32(&decim, upsampled, &pDst[outCnt], used);
+    outCnt += used / M;
+
+    avail -= used;
+    memmove(upsampled, &upsampled[used], avail * sizeof(float32_t));
+  }
+
+  return outCnt;
+}
+
+/* ----------------------------------------------------------------------
+* Multi-stage resampler from the plan of arm_fir_resample_plan_f32()
+* ------------------------------------------------------------------- */
+static arm_status init_multi(uint16_t L, uint16_t M, float64_t band)
+{
+  uint16_t stageL[MAX_STAGES];
+  uint16_t stageM[MAX_STAGES];
+  float32_t *pPool = stagePool;
+  float64_t rate = 1.0;
+  uint32_t blockSize = BLOCK_SIZE;
+  uint32_t numTaps;
+  uint32_t i;
+
+  multi.numStages = arm_fir_resample_plan_f32(L, M, MAX_FACTOR, stageL, stageM, MAX_STAGES);
+  multi.numTaps = 0U;
+  multi.delay = 0.0;
+
+  for (i = 0U; i < multi.numStages; i++)
+  {
+    numTaps = design_stage(stageL[i], stageM[i], rate, band, pPool, 16384U);
+    if (numTaps == 0U)
+    {
+      return ARM_MATH_LENGTH_ERROR;
+    }
+    (void)arm_fir_resample_init_f32(&multi.stage[i], stageL[i], stageM[i], (uint16_t)numTaps,
+                                    pPool, &pPool[numTaps], blockSize);
+    pPool += numTaps + (numTaps / stageL[i]) + blockSize;
+
+    /* Delay of the symmetric filter, in input samples of the whole resampler */
+    multi.delay += ((float64_t)(numTaps - 1U) / (2.0 * stageL[i])) / rate;
+    multi.numTaps += numTaps;
+
+    blockSize = ((blockSize * stageL[i]) / stageM[i]) + 1U;
+    multi.pBuffer[i] = pPool;
+    pPool += blockSize;
+    rate = (rate * stageL[i]) / stageM[i];
+  }
+
+  return ((multi.numStages == 0U) || (pPool > &stagePool[STAGE_POOL])) ? ARM_MATH_LENGTH_ERROR : ARM_MATH_SUCCESS;
+}
+
+static uint32_t run_multi(float32_t *pDst)
+{
+  uint32_t pos;
+  uint32_t outCnt = 0U;
+  uint32_t blkCnt;
+  uint32_t i;
+  const float32_t *pIn;
+
+  for (pos = 0U; pos < INPUT_LENGTH; pos += BLOCK_SIZE)
+  {
+    pIn = &input[pos];
+    blkCnt = BLOCK_SIZE;
+    for (i = 0U; i < multi.numStages; i++)
+    {
+      float32_t *pOut = (i == (multi.numStages - 1U)) ? &pDst[outCnt] : multi.pBuffer[i];
+      blkCnt = arm_fir_resample_f32(&multi.stage[i], pIn, pOut, blkCnt);
+      pIn = pOut;
+    }
+    outCnt += blkCnt;
+  }
+
+  return outCnt;
+}
+
+/* ----------------------------------------------------------------------
+* Time per output in ns
+* ------------------------------------------------------------------- */
+#define BENCH(ns, call)                                                       \
+do {                                                                          \
+  uint32_t r_;                                                                \
+  uint32_t n_ = 0U;                                                           \
+  clock_t start_ = clock();                                                   \
+  for (r_ = 0U; r_ < BENCH_REPEAT; r_++)                                      \
+  {                                                                           \
+    n_ += (call);                                                             \
+  }                                                                           \
+  (ns) = ((float64_t)(clock() - start_) * 1e9) / ((float64_t)CLOCKS_PER_SEC * n_); \
+} while (0)
+
+static arm_status check_conversion(uint32_t rateIn, uint16_t L, uint16_t M)
+{
+  arm_fir_resample_instance_f32 S;
+  arm_status status = ARM_MATH_SUCCESS;
+  float64_t ratio = (float64_t)L / M;
+  float64_t lowRate = (ratio < 1.0) ? ratio : 1.0;
+  float64_t band = 0.5 * PASSBAND * lowRate;
+  float64_t tSingle;
+  float64_t tCascade = 0.0;
+  float64_t tMulti = 0.0;
+  float32_t snr;
+  float32_t snrCascade = 0.0f;
+  float32_t snrMulti = 0.0f;
+  uint32_t numTaps;
+  uint32_t count;
+  uint32_t i;
+
+  tone1 = 0.13 * lowRate;
+  tone2 = 0.37 * lowRate;
+  for (i = 0U; i < INPUT_LENGTH; i++)
+  {
+    input[i] = (float32_t)signal_f64((float64_t)i);
+  }
+
+  numTaps = design_stage(L, M, 1.0, band, coeffs, MAX_TAPS);
+  if ((numTaps == 0U) ||
+      (arm_fir_resample_init_f32(&S, L, M, (uint16_t)numTaps, coeffs, state, BLOCK_SIZE) != ARM_MATH_SUCCESS))
+  {
+    return ARM_MATH_TEST_FAILURE;
+  }
+
+  count = run_single(&S, refOutput, BLOCK_SIZE);
+  snr = snr_tones(refOutput, count, ratio, (float64_t)(numTaps - 1U) / (2.0 * L));
+
+  /* Same stream by blocks of random sizes */
+  (void)arm_fir_resample_init_f32(&S, L, M, (uint16_t)numTaps, coeffs, state, BLOCK_SIZE);
+  if ((run_single(&S, output, 0U) != count) || (memcmp(output, refOutput, count * sizeof(float32_t)) != 0))
+  {
+    printf("blocks of random sizes: different output\n");
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  BENCH(tSingle, ((void)arm_fir_resample_init_f32(&S, L, M, (uint16_t)numTaps, coeffs, state, BLOCK_SIZE),
+                  run_single(&S, output, BLOCK_SIZE)));
+
+  /* Factors of the interpolator and decimator are 8-bit */
+  if ((L < 256U) && (M < 256U))
+  {
+    i = run_cascade(L, M, numTaps, output);
+    snrCascade = snr_f32(refOutput, output, (i < count) ? i : count);
+    BENCH(tCascade, run_cascade(L, M, numTaps, output));
+  }
+
+  if (init_multi(L, M, band) == ARM_MATH_SUCCESS)
+  {
+    i = run_multi(output);
+    snrMulti = snr_tones(output, i, ratio, multi.delay);
+    BENCH(tMulti, ((void)init_multi(L, M, band), run_multi(output)));
+  }
+
+  printf("%5u -> %5u  %3u/%3u  %5u taps  SNR %5.1f dB  %6.1f ns |", (unsigned)rateIn,
+         (unsigned)(((uint64_t)rateIn * L) / M), L, M, (unsigned)numTaps, snr, tSingle);
+  if (tCascade > 0.0)
+  {
+    printf(" cascade %6.1f ns (%5.1f dB from resampler) |", tCascade, snrCascade);
+  }
+  else
+  {
+    printf(" cascade: factor > 255                        |");
+  }
+  printf(" %u stages %5u taps  SNR %5.1f dB  %6.1f ns\n", (unsigned)multi.numStages,
+         (unsigned)multi.numTaps, snrMulti, tMulti);
+
+  if ((snr < SNR_THRESHOLD) || ((tCascade > 0.0) && (snrCascade < CASCADE_SNR)) ||
+      ((multi.numStages > 0U) && (snrMulti < SNR_THRESHOLD)))
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  return status;
+}
+
+int32_t main(void)
+{
+  static const uint32_t conversions[][3] = {
+    { 44100U, 160U, 147U }, { 48000U, 147U, 160U }, { 48000U, 1U, 3U },
+    { 16000U, 3U, 1U }, { 44100U, 160U, 441U }, { 48000U, 1U, 48U } };
+  arm_status status = ARM_MATH_SUCCESS;
+  uint32_t i;
+
+  printf("START\n");
+
+  for (i = 0U; i < (sizeof(conversions) / sizeof(conversions[0])); i++)
+  {
+    if (check_conversion(conversions[i][0], (uint16_t)conversions[i][1], (uint16_t)conversions[i][2]) != ARM_MATH_SUCCESS)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  printf((status == ARM_MATH_SUCCESS) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (status == ARM_MATH_SUCCESS) ? 0 : 1;
+}
+
+ /** \endlink */
@@ -0,0 +1,503 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_example_f32.c
+ * Description:  Goertzel bank and sliding DFT accuracy check and FFT crossover benchmark
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup GoertzelExample Goertzel Bank and Sliding DFT Example
+ *
+ * \par Description:
+ * \par
+ * Computes 16 bins of random signals with arm_goertzel_f32(), arm_goertzel_q31(),
+ * arm_sliding_dft_f32() and arm_sliding_dft_q31(), and prints their signal to
+ * noise ratio against the same bins of arm_rfft_fast_f32(). The bins include
+ * 0, 1 and the Nyquist frequency, where a plain Goertzel recursion is the least
+ * accurate. Fractional bins of the Goertzel bank are checked against a direct
+ * DFT in double precision.
+ *
+ * \par
+ * The sliding DFTs then run for 2^20 samples in blocks of 100 samples: their
+ * bins are compared with the FFT of the last window to show that they do not
+ * drift.
+ *
+ * \par
+ * Last, prints the time per block of 1024 samples of the Goertzel bank and of
+ * the sliding DFT for 1 to 64 bins, next to the time of a real FFT of the block,
+ * and the crossover: the largest number of bins for which the Goertzel bank is
+ * faster than the FFT. The time is measured with the C library clock(): run on
+ * the host or with semihosting.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_goertzel_init_f32()
+ * - arm_goertzel_f32()
+ * - arm_goertzel_init_q31()
+ * - arm_goertzel_q31()
+ * - arm_sliding_dft_buffer_size_f32()
+ * - arm_sliding_dft_init_f32()
+ * - arm_sliding_dft_f32()
+ * - arm_sliding_dft_buffer_size_q31()
+ * - arm_sliding_dft_init_q31()
+ * - arm_sliding_dft_q31()
+ * - arm_rfft_fast_init_f32()
+ * - arm_rfft_fast_f32()
+ * - arm_float_to_q31()
+ *
+ * @} */
+
+#include "arm_math.h"
+#include <stdio.h>
+#include <time.h>
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define MAX_FFT_LEN      4096
+#define MAX_BINS         64
+#define NUM_BINS         16
+#define DRIFT_LEN        1024
+#define DRIFT_SAMPLES    (1UL << 20)
+#define DRIFT_BLOCKSIZE  100
+#define BENCH_LEN        1024
+#define BENCH_VALUES     (1UL << 24)
+#define SNR_F32          80.0f
+#define SNR_Q31          80.0f
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+static float32_t signalF32[MAX_FFT_LEN];
+static q31_t signalQ31[MAX_FFT_LEN];
+static float32_t fftIn[MAX_FFT_LEN];
+static float32_t fftOut[MAX_FFT_LEN];
+static float32_t refBins[2 * MAX_BINS];
+static float32_t binsF32[2 * MAX_BINS];
+static q31_t binsQ31[2 * MAX_BINS];
+static float32_t freqs[MAX_BINS];
+static uint16_t bins[MAX_BINS];
+static float32_t coeffsF32[6 * MAX_BINS];
+static q31_t coeffsQ31[7 * MAX_BINS];
+static float32_t slidingF32[(3 * MAX_FFT_LEN) + (4 * MAX_BINS)];
+static q31_t slidingQ31[(3 * MAX_FFT_LEN) + (2 * MAX_BINS)];
+
+/* ----------------------------------------------------------------------
+* Pseudo random test signal in [-0.5, 0.5), multiple of 2^-24
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345U;
+
+static float32_t random_f32(void)
+{
+  seed = (seed * 1664525U) + 1013904223U;
+  return ((float32_t)(seed >> 8) / 16777216.0f) - 0.5f;
+}
+
+/* ----------------------------------------------------------------------
+* Signal to noise ratio in dB of a result scaled by 2^exponent
+* ------------------------------------------------------------------- */
+static float32_t snr_f32(const float32_t *pRef, const float32_t *pTest, uint32_t length)
+{
+  float64_t signal = 0.0;
+  float64_t noise = 0.0;
+  float64_t diff;
+  uint32_t i;
+
+  for (i = 0U; i < length; i++)
+  {
+    diff = (float64_t)pTest[i] - pRef[i];
+    signal += (float64_t)pRef[i] * pRef[i];
+    noise += diff * diff;
+  }
+
+  return (noise == 0.0) ? 300.0f : (float32_t)(10.0 * log10(signal / noise));
+}
+
+static float32_t snr_q31(const float32_t *pRef, const q31_t *pTest, int32_t exponent, uint32_t length)
+{
+  const float64_t scale = ldexp(1.0, exponent - 31);
+  float64_t signal = 0.0;
+  float64_t noise = 0.0;
+  float64_t diff;
+  uint32_t i;
+
+  for (i = 0U; i < length; i++)
+  {
+    diff = ((float64_t)pTest[i] * scale) - pRef[i];
+    signal += (float64_t)pRef[i] * pRef[i];
+    noise += diff * diff;
+  }
+
+  return (noise == 0.0) ? 300.0f : (float32_t)(10.0 * log10(signal / noise));
+}
+
+/* ----------------------------------------------------------------------
+* Bins of the real FFT of fftLen samples, from the packed output of
+* arm_rfft_fast_f32()
+* ------------------------------------------------------------------- */
+static void fft_bins(const float32_t *pSrc, uint32_t fftLen, uint32_t numBins, float32_t *pDst)
+{
+  arm_rfft_fast_instance_f32 rfft;
+  uint32_t k;
+  uint32_t i;
+
+  (void)arm_rfft_fast_init_f32(&rfft, (uint16_t)fftLen);
+  arm_copy_f32(pSrc, fftIn, fftLen);
+  arm_rfft_fast_f32(&rfft, fftIn, fftOut, 0U);
+
+  for (i = 0U; i < numBins; i++)
+  {
+    k = bins[i];
+    if (k == 0U)
+    {
+      pDst[2U * i] = fftOut[0];
+      pDst[(2U * i) + 1U] = 0.0f;
+    }
+    else if (k == (fftLen / 2U))
+    {
+      pDst[2U * i] = fftOut[1];
+      pDst[(2U * i) + 1U] = 0.0f;
+    }
+    else if (k < (fftLen / 2U))
+    {
+      pDst[2U * i] = fftOut[2U * k];
+      pDst[(2U * i) + 1U] = fftOut[(2U * k) + 1U];
+    }
+    else
+    {
+      /* Real input: X[N-k] is the conjugate of X[k] */
+      pDst[2U * i] = fftOut[2U * (fftLen - k)];
+      pDst[(2U * i) + 1U] = -fftOut[(2U * (fftLen - k)) + 1U];
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Direct DFT in double precision at fractional frequencies
+* ------------------------------------------------------------------- */
+static void dft_bins(const float32_t *pSrc, uint32_t length, uint32_t numBins, float32_t *pDst)
+{
+  float64_t re;
+  float64_t im;
+  float64_t w;
+  uint32_t n;
+  uint32_t i;
+
+  for (i = 0U; i < numBins; i++)
+  {
+    w = (2.0 * PI_F64 * (float64_t)freqs[i]) / (float64_t)length;
+    re = 0.0;
+    im = 0.0;
+    for (n = 0U; n < length; n++)
+    {
+      re += (float64_t)pSrc[n] * cos(w * (float64_t)n);
+      im -= (float64_t)pSrc[n] * sin(w * (float64_t)n);
+    }
+    pDst[2U * i] = (float32_t)re;
+    pDst[(2U * i) + 1U] = (float32_t)im;
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Integer bins: 0, 1, 2, N/2 - 1, N/2, N - 1 and random ones
+* ------------------------------------------------------------------- */
+static void choose_bins(uint32_t fftLen, uint32_t numBins)
+{
+  static const uint32_t fixedBins = 6U;
+  uint32_t i;
+
+  bins[0] = 0U;
+  bins[1] = 1U;
+  bins[2] = 2U;
+  bins[3] = (uint16_t)((fftLen / 2U) - 1U);
+  bins[4] = (uint16_t)(fftLen / 2U);
+  bins[5] = (uint16_t)(fftLen - 1U);
+  for (i = fixedBins; i < numBins; i++)
+  {
+    seed = (seed * 1664525U) + 1013904223U;
+    bins[i] = (uint16_t)((seed >> 8) % fftLen);
+  }
+  for (i = 0U; i < numBins; i++)
+  {
+    freqs[i] = (float32_t)bins[i];
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Accuracy of the integer bins of one block length
+* ------------------------------------------------------------------- */
+static arm_status check_bins(uint32_t fftLen)
+{
+  arm_goertzel_instance_f32 goertzelF32;
+  arm_goertzel_instance_q31 goertzelQ31;
+  arm_sliding_dft_instance_f32 slidingDftF32;
+  arm_sliding_dft_instance_q31 slidingDftQ31;
+  float32_t snrGoertzelF32, snrGoertzelQ31, snrSlidingF32, snrSlidingQ31;
+  uint32_t i;
+
+  for (i = 0U; i < fftLen; i++)
+  {
+    signalF32[i] = random_f32();
+  }
+  arm_float_to_q31(signalF32, signalQ31, fftLen);
+  choose_bins(fftLen, NUM_BINS);
+  fft_bins(signalF32, fftLen, NUM_BINS, refBins);
+
+  (void)arm_goertzel_init_f32(&goertzelF32, NUM_BINS, freqs, fftLen, coeffsF32);
+  arm_goertzel_f32(&goertzelF32, signalF32, binsF32);
+  snrGoertzelF32 = snr_f32(refBins, binsF32, 2U * NUM_BINS);
+
+  (void)arm_goertzel_init_q31(&goertzelQ31, NUM_BINS, freqs, fftLen, coeffsQ31);
+  arm_goertzel_q31(&goertzelQ31, signalQ31, binsQ31);
+  snrGoertzelQ31 = snr_q31(refBins, binsQ31, goertzelQ31.postShift, 2U * NUM_BINS);
+
+  (void)arm_sliding_dft_init_f32(&slidingDftF32, NUM_BINS, bins, (uint16_t)fftLen, slidingF32);
+  arm_sliding_dft_f32(&slidingDftF32, signalF32, fftLen, binsF32);
+  snrSlidingF32 = snr_f32(refBins, binsF32, 2U * NUM_BINS);
+
+  (void)arm_sliding_dft_init_q31(&slidingDftQ31, NUM_BINS, bins, (uint16_t)fftLen, slidingQ31);
+  arm_sliding_dft_q31(&slidingDftQ31, signalQ31, fftLen, binsQ31);
+  snrSlidingQ31 = snr_q31(refBins, binsQ31, slidingDftQ31.postShift, 2U * NUM_BINS);
+
+  printf("N %4u  goertzel f32 %6.1f  q31 %6.1f   sliding f32 %6.1f  q31 %6.1f dB\n",
+         (unsigned)fftLen, snrGoertzelF32, snrGoertzelQ31, snrSlidingF32, snrSlidingQ31);
+
+  return ((snrGoertzelF32 < SNR_F32) || (snrGoertzelQ31 < SNR_Q31) ||
+          (snrSlidingF32 < SNR_F32) || (snrSlidingQ31 < SNR_Q31)) ? ARM_MATH_TEST_FAILURE : ARM_MATH_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------
+* Accuracy of fractional bins, any block length
+* ------------------------------------------------------------------- */
+static arm_status check_fractional(uint32_t blockSize)
+{
+  static const float32_t fracBins[NUM_BINS] = {
+    0.0f, 0.25f, 0.5f, 1.5f, 3.7f, 10.1f, 100.3f, 200.5f,
+    300.9f, 450.2f, 499.5f, 499.9f, 500.0f, 700.6f, 998.5f, 999.75f };
+  arm_goertzel_instance_f32 goertzelF32;
+  arm_goertzel_instance_q31 goertzelQ31;
+  float32_t snrF32, snrQ31;
+  uint32_t i;
+
+  for (i = 0U; i < blockSize; i++)
+  {
+    signalF32[i] = random_f32();
+  }
+  arm_float_to_q31(signalF32, signalQ31, blockSize);
+  for (i = 0U; i < NUM_BINS; i++)
+  {
+    freqs[i] = (fracBins[i] * (float32_t)blockSize) / 1000.0f;
+  }
+  dft_bins(signalF32, blockSize, NUM_BINS, refBins);
+
+  (void)arm_goertzel_init_f32(&goertzelF32, NUM_BINS, freqs, blockSize, coeffsF32);
+  arm_goertzel_f32(&goertzelF32, signalF32, binsF32);
+  snrF32 = snr_f32(refBins, binsF32, 2U * NUM_BINS);
+
+  (void)arm_goertzel_init_q31(&goertzelQ31, NUM_BINS, freqs, blockSize, coeffsQ31);
+  arm_goertzel_q31(&goertzelQ31, signalQ31, binsQ31);
+  snrQ31 = snr_q31(refBins, binsQ31, goertzelQ31.postShift, 2U * NUM_BINS);
+
+  printf("N %4u  fractional bins, goertzel f32 %6.1f  q31 %6.1f dB\n", (unsigned)blockSize, snrF32, snrQ31);
+
+  return ((snrF32 < SNR_F32) || (snrQ31 < SNR_Q31)) ? ARM_MATH_TEST_FAILURE : ARM_MATH_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------
+* Sliding DFTs on a long stream, checked against the FFT of the last window
+* ------------------------------------------------------------------- */
+static arm_status check_drift(void)
+{
+  arm_sliding_dft_instance_f32 slidingDftF32;
+  arm_sliding_dft_instance_q31 slidingDftQ31;
+  float32_t block[DRIFT_BLOCKSIZE];
+  q31_t blockQ31[DRIFT_BLOCKSIZE];
+  float32_t snrF32, snrQ31;
+  uint32_t pos;
+  uint32_t i;
+
+  choose_bins(DRIFT_LEN, NUM_BINS);
+  (void)arm_sliding_dft_init_f32(&slidingDftF32, NUM_BINS, bins, DRIFT_LEN, slidingF32);
+  (void)arm_sliding_dft_init_q31(&slidingDftQ31, NUM_BINS, bins, DRIFT_LEN, slidingQ31);
+
+  for (pos = 0U; pos < DRIFT_SAMPLES; pos += DRIFT_BLOCKSIZE)
+  {
+    for (i = 0U; i < DRIFT_BLOCKSIZE; i++)
+    {
+      block[i] = random_f32();
+    }
+    arm_float_to_q31(block, blockQ31, DRIFT_BLOCKSIZE);
+    arm_sliding_dft_f32(&slidingDftF32, block, DRIFT_BLOCKSIZE, binsF32);
+    arm_sliding_dft_q31(&slidingDftQ31, blockQ31, DRIFT_BLOCKSIZE, binsQ31);
+
+    /* Last DRIFT_LEN samples */
+    arm_copy_f32(&signalF32[DRIFT_BLOCKSIZE], signalF32, DRIFT_LEN - DRIFT_BLOCKSIZE);
+    arm_copy_f32(block, &signalF32[DRIFT_LEN - DRIFT_BLOCKSIZE], DRIFT_BLOCKSIZE);
+  }
+
+  fft_bins(signalF32, DRIFT_LEN, NUM_BINS, refBins);
+  snrF32 = snr_f32(refBins, binsF32, 2U * NUM_BINS);
+  snrQ31 = snr_q31(refBins, binsQ31, slidingDftQ31.postShift, 2U * NUM_BINS);
+
+  printf("N %4u  after %lu samples, sliding f32 %6.1f  q31 %6.1f dB\n",
+         DRIFT_LEN, (unsigned long)pos, snrF32, snrQ31);
+
+  return ((snrF32 < SNR_F32) || (snrQ31 < SNR_Q31)) ? ARM_MATH_TEST_FAILURE : ARM_MATH_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------
+* Time per block of BENCH_LEN samples in us
+* ------------------------------------------------------------------- */
+static float64_t bench_time(clock_t start, uint32_t runs)
+{
+  return ((float64_t)(clock() - start) * 1e6) / ((float64_t)CLOCKS_PER_SEC * runs);
+}
+
+static void bench_bins(uint32_t numBins, float64_t *pTimes)
+{
+  arm_goertzel_instance_f32 goertzelF32;
+  arm_goertzel_instance_q31 goertzelQ31;
+  arm_sliding_dft_instance_f32 slidingDftF32;
+  arm_sliding_dft_instance_q31 slidingDftQ31;
+  const uint32_t runs = 1U + (uint32_t)(BENCH_VALUES / ((uint64_t)numBins * BENCH_LEN));
+  clock_t start;
+  uint32_t run;
+
+  choose_bins(BENCH_LEN, numBins);
+  (void)arm_goertzel_init_f32(&goertzelF32, (uint16_t)numBins, freqs, BENCH_LEN, coeffsF32);
+  (void)arm_goertzel_init_q31(&goertzelQ31, (uint16_t)numBins, freqs, BENCH_LEN, coeffsQ31);
+  (void)arm_sliding_dft_init_f32(&slidingDftF32, (uint16_t)numBins, bins, BENCH_LEN, slidingF32);
+  (void)arm_sliding_dft_init_q31(&slidingDftQ31, (uint16_t)numBins, bins, BENCH_LEN, slidingQ31);
+
+  start = clock();
+  for (run = 0U; run < runs; run++)
+  {
+    arm_goertzel_f32(&goertzelF32, signalF32, binsF32);
+  }
+  pTimes[0] = bench_time(start, runs);
+
+  start = clock();
+  for (run = 0U; run < runs; run++)
+  {
+    arm_goertzel_q31(&goertzelQ31, signalQ31, binsQ31);
+  }
+  pTimes[1] = bench_time(start, runs);
+
+  start = clock();
+  for (run = 0U; run < runs; run++)
+  {
+    arm_sliding_dft_f32(&slidingDftF32, signalF32, BENCH_LEN, binsF32);
+  }
+  pTimes[2] = bench_time(start, runs);
+
+  start = clock();
+  for (run = 0U; run < runs; run++)
+  {
+    arm_sliding_dft_q31(&slidingDftQ31, signalQ31, BENCH_LEN, binsQ31);
+  }
+  pTimes[3] = bench_time(start, runs);
+}
+
+int32_t main(void)
+{
+  static const uint32_t testLens[] = { 64U, 256U, 1024U, 4096U };
+  static const uint32_t testBlocks[] = { 100U, 1000U, 4000U };
+  arm_rfft_fast_instance_f32 rfft;
+  arm_status status = ARM_MATH_SUCCESS;
+  float64_t times[4];
+  float64_t fftTime;
+  clock_t start;
+  uint32_t runs;
+  uint32_t run;
+  uint32_t crossover = 0U;
+  uint32_t numBins;
+  uint32_t i;
+
+  printf("START\n");
+
+  for (i = 0U; i < (sizeof(testLens) / sizeof(testLens[0])); i++)
+  {
+    if (check_bins(testLens[i]) != ARM_MATH_SUCCESS)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+  for (i = 0U; i < (sizeof(testBlocks) / sizeof(testBlocks[0])); i++)
+  {
+    if (check_fractional(testBlocks[i]) != ARM_MATH_SUCCESS)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+  if (check_drift() != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  for (i = 0U; i < BENCH_LEN; i++)
+  {
+    signalF32[i] = random_f32();
+  }
+  arm_float_to_q31(signalF32, signalQ31, BENCH_LEN);
+
+  (void)arm_rfft_fast_init_f32(&rfft, BENCH_LEN);
+  runs = (uint32_t)(BENCH_VALUES / (8U * BENCH_LEN));
+  start = clock();
+  for (run = 0U; run < runs; run++)
+  {
+    arm_copy_f32(signalF32, fftIn, BENCH_LEN);
+    arm_rfft_fast_f32(&rfft, fftIn, fftOut, 0U);
+  }
+  fftTime = bench_time(start, runs);
+
+  printf("\nblock %u, us per block, rfft_fast_f32 %.2f\n", BENCH_LEN, fftTime);
+  printf("bins  goertzel f32    q31   sliding f32    q31\n");
+  for (numBins = 1U; numBins <= MAX_BINS; numBins <<= 1U)
+  {
+    bench_bins(numBins, times);
+    printf("%4u %13.2f %6.2f %13.2f %6.2f\n", (unsigned)numBins, times[0], times[1], times[2], times[3]);
+    if (times[0] < fftTime)
+    {
+      crossover = numBins;
+    }
+  }
+  if (crossover != 0U)
+  {
+    printf("crossover: Goertzel f32 faster than the FFT up to %u bins\n", (unsigned)crossover);
+  }
+  else
+  {
+    printf("crossover: FFT faster from 1 bin\n");
+  }
+
+  printf((status == ARM_MATH_SUCCESS) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (status == ARM_MATH_SUCCESS) ? 0 : 1;
+}
+
+ /** \endlink */
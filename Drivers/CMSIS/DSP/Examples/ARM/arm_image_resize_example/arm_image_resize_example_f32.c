@@ -0,0 +1,304 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_image_resize_example_f32.c
+ * Description:  Batched bilinear image resize check against the per-point interpolation and benchmark
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup ImageResizeExample Bilinear Image Resize Example
+ *
+ * \par Description:
+ * \par
+ * Resizes regions of synthetic 8-bit frames (interleaved RGB with a padded row
+ * stride, Y planes and 4 channel pixels, up and down scaling) to 8-bit unsigned,
+ * normalized Q7 and normalized floating-point images, and checks every output
+ * value against arm_bilinear_interp_f32() evaluated at the same point of a
+ * floating-point copy of each channel of the region. Then prints the time per
+ * output value of the per-point function and of the batched functions.
+ *
+ * \par
+ * The normalization is the one of a quantized network with ImageNet input:
+ * <code>(p / 255 - mean[c]) / std[c]</code>, quantized with <code>Q7_SCALE</code>
+ * and <code>Q7_ZERO_POINT</code> for the Q7 output.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_image_resize_buffer_size()
+ * - arm_image_resize_init()
+ * - arm_image_resize_u8()
+ * - arm_image_resize_q7()
+ * - arm_image_resize_f32()
+ * - arm_bilinear_interp_f32()
+ *
+ * @} */
+
+#include "arm_math.h"
+#include <stdio.h>
+#include <time.h>
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define MAX_FRAME       (640U * 480U * 3U)
+#define MAX_OUTPUT      (224U * 224U * 4U)
+#define MAX_CROP        (640U * 480U)
+#define MAX_BUFFER      8192U
+#define Q7_SCALE        0.0187f
+#define Q7_ZERO_POINT   (-14.0f)
+#define U8_TOLERANCE    0.52f
+#define F32_TOLERANCE   0.02f
+#define BENCH_REPEAT    4U
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+static uint8_t frame[MAX_FRAME];
+static uint8_t outU8[MAX_OUTPUT];
+static q7_t outQ7[MAX_OUTPUT];
+static float32_t outF32[MAX_OUTPUT];
+static float32_t plane[MAX_CROP];
+static float32_t refPoint[MAX_OUTPUT];
+static uint16_t buffer[MAX_BUFFER];
+
+static const float32_t mean[ARM_IMAGE_RESIZE_MAX_CHANNELS] = { 0.485f, 0.456f, 0.406f, 0.5f };
+static const float32_t stdDev[ARM_IMAGE_RESIZE_MAX_CHANNELS] = { 0.229f, 0.224f, 0.225f, 0.25f };
+
+typedef struct
+{
+  uint16_t numChannels;
+  uint16_t frameCols;
+  uint16_t frameRows;
+  uint16_t padding;
+  uint16_t cropX;
+  uint16_t cropY;
+  uint16_t cropCols;
+  uint16_t cropRows;
+  uint16_t dstCols;
+  uint16_t dstRows;
+} resize_test_t;
+
+/* ----------------------------------------------------------------------
+* Synthetic frame: smooth gradients plus noise
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345U;
+
+static void make_frame(uint32_t numValues)
+{
+  uint32_t i;
+
+  for (i = 0U; i < numValues; i++)
+  {
+    seed = (seed * 1664525U) + 1013904223U;
+    frame[i] = (uint8_t)(((i * 7U) / 13U) + (seed >> 27));
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Source position of an output row or column, clamped inside the last
+* interval as arm_bilinear_interp_f32() returns 0 on the last row and column
+* ------------------------------------------------------------------- */
+static float32_t source_position(uint32_t dst, uint32_t srcLen, uint32_t dstLen)
+{
+  float64_t pos = ((((float64_t)dst + 0.5) * srcLen) / dstLen) - 0.5;
+  float64_t last = (float64_t)srcLen - 1.0 - (1.0 / 65536.0);
+
+  return (float32_t)((pos < 0.0) ? 0.0 : ((pos > last) ? last : pos));
+}
+
+/* ----------------------------------------------------------------------
+* Per-point interpolation of every output value, channel by channel, with
+* the floating-point copy of the region it needs
+* ------------------------------------------------------------------- */
+static uint32_t resize_per_point(const resize_test_t *pTest, uint32_t stride)
+{
+  arm_bilinear_interp_instance_f32 B;
+  const uint32_t numChannels = pTest->numChannels;
+  uint32_t x;
+  uint32_t y;
+  uint32_t c;
+
+  B.numRows = pTest->cropRows;
+  B.numCols = pTest->cropCols;
+  B.pData = plane;
+
+  for (c = 0U; c < numChannels; c++)
+  {
+    for (y = 0U; y < pTest->cropRows; y++)
+    {
+      for (x = 0U; x < pTest->cropCols; x++)
+      {
+        plane[(y * pTest->cropCols) + x] =
+          frame[((pTest->cropY + y) * stride) + ((pTest->cropX + x) * numChannels) + c];
+      }
+    }
+
+    for (y = 0U; y < pTest->dstRows; y++)
+    {
+      for (x = 0U; x < pTest->dstCols; x++)
+      {
+        refPoint[(((y * pTest->dstCols) + x) * numChannels) + c] =
+          arm_bilinear_interp_f32(&B, source_position(x, pTest->cropCols, pTest->dstCols),
+                                  source_position(y, pTest->cropRows, pTest->dstRows));
+      }
+    }
+  }
+
+  return (uint32_t)pTest->dstRows * pTest->dstCols * numChannels;
+}
+
+/* ----------------------------------------------------------------------
+* Time per output value in ns
+* ------------------------------------------------------------------- */
+#define BENCH(ns, count, call)                                                \
+do {                                                                          \
+  uint32_t r_;                                                                \
+  clock_t start_ = clock();                                                   \
+  for (r_ = 0U; r_ < BENCH_REPEAT; r_++)                                      \
+  {                                                                           \
+    call;                                                                     \
+  }                                                                           \
+  (ns) = ((float64_t)(clock() - start_) * 1e9) / ((float64_t)CLOCKS_PER_SEC * BENCH_REPEAT * (count)); \
+} while (0)
+
+static arm_status check_resize(const resize_test_t *pTest)
+{
+  arm_image_resize_instance S;
+  arm_image_resize_instance Sq;
+  arm_status status = ARM_MATH_SUCCESS;
+  const uint32_t numChannels = pTest->numChannels;
+  const uint32_t stride = ((uint32_t)pTest->frameCols * numChannels) + pTest->padding;
+  float32_t scale[ARM_IMAGE_RESIZE_MAX_CHANNELS];
+  float32_t offset[ARM_IMAGE_RESIZE_MAX_CHANNELS];
+  float32_t scaleQ7[ARM_IMAGE_RESIZE_MAX_CHANNELS];
+  float32_t offsetQ7[ARM_IMAGE_RESIZE_MAX_CHANNELS];
+  float32_t errU8 = 0.0f;
+  float32_t errQ7 = 0.0f;
+  float32_t errF32 = 0.0f;
+  float32_t ref;
+  float64_t tPoint;
+  float64_t tU8;
+  float64_t tQ7;
+  float64_t tF32;
+  uint32_t count;
+  uint32_t i;
+  uint32_t c;
+
+  if (arm_image_resize_buffer_size(numChannels, pTest->cropCols, pTest->dstCols, pTest->dstRows) > MAX_BUFFER)
+  {
+    return ARM_MATH_TEST_FAILURE;
+  }
+
+  for (c = 0U; c < numChannels; c++)
+  {
+    scale[c] = 1.0f / (255.0f * stdDev[c]);
+    offset[c] = -mean[c] / stdDev[c];
+    scaleQ7[c] = scale[c] / Q7_SCALE;
+    offsetQ7[c] = (offset[c] / Q7_SCALE) + Q7_ZERO_POINT;
+  }
+
+  make_frame(stride * pTest->frameRows);
+  count = resize_per_point(pTest, stride);
+
+  if (arm_image_resize_init(&S, pTest->numChannels, stride, pTest->cropX, pTest->cropY, pTest->cropCols,
+                            pTest->cropRows, pTest->dstCols, pTest->dstRows, scale, offset, buffer) != ARM_MATH_SUCCESS)
+  {
+    return ARM_MATH_TEST_FAILURE;
+  }
+  arm_image_resize_u8(&S, frame, outU8);
+  arm_image_resize_f32(&S, frame, outF32);
+
+  /* Same positions and line buffer, other normalization */
+  Sq = S;
+  for (i = 0U; i < (ARM_IMAGE_RESIZE_MAX_CHANNELS + 3U); i++)
+  {
+    Sq.scale[i] = scaleQ7[i % numChannels] / 4194304.0f;
+    Sq.offset[i] = offsetQ7[i % numChannels];
+  }
+  arm_image_resize_q7(&Sq, frame, outQ7);
+
+  /* The Q7 line buffer and the clamped reference positions each differ by up
+     to 0.004 pixel level: the floating-point output is checked to 0.02 */
+  for (i = 0U; i < count; i++)
+  {
+    c = i % numChannels;
+
+    errU8 = fmaxf(errU8, fabsf((float32_t)outU8[i] - refPoint[i]));
+    errF32 = fmaxf(errF32, fabsf(outF32[i] - ((refPoint[i] * scale[c]) + offset[c])) / scale[c]);
+
+    ref = (refPoint[i] * scaleQ7[c]) + offsetQ7[c];
+    ref = (ref > 127.0f) ? 127.0f : ((ref < -128.0f) ? -128.0f : ref);
+    errQ7 = fmaxf(errQ7, fabsf((float32_t)outQ7[i] - ref));
+  }
+
+  BENCH(tPoint, count, resize_per_point(pTest, stride));
+  BENCH(tU8, count, arm_image_resize_u8(&S, frame, outU8));
+  BENCH(tQ7, count, arm_image_resize_q7(&Sq, frame, outQ7));
+  BENCH(tF32, count, arm_image_resize_f32(&S, frame, outF32));
+
+  printf("%u ch %3ux%3u -> %3ux%3u  error u8 %.3f q7 %.3f f32 %.4f  ns/value: per-point %6.2f  u8 %5.2f  q7 %5.2f  f32 %5.2f\n",
+         (unsigned)numChannels, pTest->cropCols, pTest->cropRows, pTest->dstCols, pTest->dstRows,
+         errU8, errQ7, errF32, tPoint, tU8, tQ7, tF32);
+
+  if ((errU8 > U8_TOLERANCE) || (errQ7 > U8_TOLERANCE) || (errF32 > F32_TOLERANCE))
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  return status;
+}
+
+int32_t main(void)
+{
+  static const resize_test_t tests[] = {
+    /* ch frame       pad  crop                 output   */
+    { 3U, 320U, 240U, 32U, 40U, 20U, 200U, 180U, 224U, 224U },
+    { 3U, 320U, 240U,  0U,  0U,  0U, 320U, 240U,  96U,  96U },
+    { 1U,  96U,  96U,  0U,  0U,  0U,  96U,  96U, 224U, 160U },
+    { 1U, 640U, 480U,  0U,  0U,  0U, 640U, 480U,  96U,  96U },
+    { 1U, 640U, 480U, 64U, 80U,  0U, 480U, 480U, 224U, 224U },
+    { 4U,  64U,  48U,  4U,  3U,  5U,  57U,  41U,  50U,  37U },
+    { 3U,   8U,   8U,  0U,  1U,  2U,   2U,   2U,   5U,   3U } };
+  arm_status status = ARM_MATH_SUCCESS;
+  uint32_t i;
+
+  printf("START\n");
+
+  for (i = 0U; i < (sizeof(tests) / sizeof(tests[0])); i++)
+  {
+    if (check_resize(&tests[i]) != ARM_MATH_SUCCESS)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  printf((status == ARM_MATH_SUCCESS) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (status == ARM_MATH_SUCCESS) ? 0 : 1;
+}
+
+ /** \endlink */
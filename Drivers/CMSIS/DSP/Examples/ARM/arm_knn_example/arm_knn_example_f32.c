@@ -0,0 +1,261 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_knn_example_f32.c
+ * Description:  Pairwise distance matrix and k nearest neighbours accuracy check and benchmark
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup KnnExample Pairwise Distance and k Nearest Neighbours Example
+ *
+ * \par Description:
+ * \par
+ * Computes the distance matrix between random query and reference vectors
+ * with arm_pairwise_distance_f32() and with one call per pair to the single
+ * pair distance functions, compares them and prints the time of both, then
+ * checks the k nearest neighbours selected by arm_distance_topk_f32() against
+ * a full scan.
+ *
+ * \par
+ * The time is measured with the C library clock(): run on the host or with
+ * semihosting.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_euclidean_distance_f32()
+ * - arm_cityblock_distance_f32()
+ * - arm_chebyshev_distance_f32()
+ * - arm_cosine_distance_f32()
+ * - arm_pairwise_distance_scratch_size_f32()
+ * - arm_pairwise_distance_f32()
+ * - arm_distance_topk_f32()
+ *
+ * @} */
+
+#include "arm_math.h"
+#include <stdio.h>
+#include <time.h>
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define NB_QUERIES      200
+#define NB_REFERENCES   1000
+#define DIMENSION       27
+#define K               5
+#define BENCH_REPEAT    4
+#define REL_THRESHOLD   1e-4f
+#define SCRATCH_SIZE    ((DIMENSION + 1) * ARM_PAIRWISE_TILE)
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+static float32_t queries[NB_QUERIES * DIMENSION];
+static float32_t references[NB_REFERENCES * DIMENSION];
+static float32_t scratch[SCRATCH_SIZE];
+static float32_t refDistances[NB_QUERIES * NB_REFERENCES];
+static float32_t testDistances[NB_QUERIES * NB_REFERENCES];
+static float32_t topDistances[K];
+static uint32_t topIndex[K];
+
+typedef float32_t (*pair_distance)(const float32_t *pA, const float32_t *pB, uint32_t blockSize);
+
+/* ----------------------------------------------------------------------
+* Pseudo random values in [-0.5, 0.5)
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345U;
+
+static float32_t random_f32(void)
+{
+  seed = (seed * 1664525U) + 1013904223U;
+  return ((float32_t)(seed >> 8) / 16777216.0f) - 0.5f;
+}
+
+/* ----------------------------------------------------------------------
+* Distance matrix with one call per pair
+* ------------------------------------------------------------------- */
+static void pair_loop(pair_distance distance, float32_t *pDst)
+{
+  uint32_t i;
+  uint32_t j;
+
+  for (i = 0U; i < NB_QUERIES; i++)
+  {
+    for (j = 0U; j < NB_REFERENCES; j++)
+    {
+      pDst[(i * NB_REFERENCES) + j] = distance(&queries[i * DIMENSION], &references[j * DIMENSION], DIMENSION);
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Accuracy and time of one metric
+* ------------------------------------------------------------------- */
+static arm_status check_metric(const char *name, arm_pairwise_metric metric, pair_distance distance)
+{
+  float32_t maxError = 0.0f;
+  float32_t error;
+  float64_t pairTime;
+  float64_t tileTime;
+  clock_t start;
+  uint32_t r;
+  uint32_t i;
+
+  pair_loop(distance, refDistances);
+  if (arm_pairwise_distance_f32(metric, queries, NB_QUERIES, references, NB_REFERENCES,
+                                DIMENSION, scratch, testDistances) != ARM_MATH_SUCCESS)
+  {
+    return ARM_MATH_TEST_FAILURE;
+  }
+  for (i = 0U; i < (NB_QUERIES * NB_REFERENCES); i++)
+  {
+    error = fabsf(refDistances[i] - testDistances[i]) / (fabsf(refDistances[i]) + 1e-6f);
+    maxError = (error > maxError) ? error : maxError;
+  }
+
+  start = clock();
+  for (r = 0U; r < BENCH_REPEAT; r++)
+  {
+    pair_loop(distance, refDistances);
+  }
+  pairTime = ((float64_t)(clock() - start) * 1e3) / ((float64_t)CLOCKS_PER_SEC * BENCH_REPEAT);
+
+  start = clock();
+  for (r = 0U; r < BENCH_REPEAT; r++)
+  {
+    (void)arm_pairwise_distance_f32(metric, queries, NB_QUERIES, references, NB_REFERENCES,
+                                    DIMENSION, scratch, testDistances);
+  }
+  tileTime = ((float64_t)(clock() - start) * 1e3) / ((float64_t)CLOCKS_PER_SEC * BENCH_REPEAT);
+
+  printf("%-10s max rel error %.2e  per pair %7.3f ms  pairwise %7.3f ms\n", name, maxError, pairTime, tileTime);
+
+  return (maxError > REL_THRESHOLD) ? ARM_MATH_TEST_FAILURE : ARM_MATH_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------
+* k nearest neighbours of every query against a full scan
+* ------------------------------------------------------------------- */
+static arm_status check_knn(void)
+{
+  const float32_t *pRow;
+  float32_t last;
+  uint32_t lastIndex;
+  uint32_t best;
+  uint32_t i;
+  uint32_t j;
+  uint32_t n;
+
+  (void)arm_pairwise_distance_f32(ARM_PAIRWISE_SQEUCLIDEAN, queries, NB_QUERIES, references, NB_REFERENCES,
+                                  DIMENSION, scratch, testDistances);
+
+  for (i = 0U; i < NB_QUERIES; i++)
+  {
+    pRow = &testDistances[i * NB_REFERENCES];
+    if (arm_distance_topk_f32(pRow, NB_REFERENCES, K, topDistances, topIndex) != K)
+    {
+      return ARM_MATH_TEST_FAILURE;
+    }
+
+    /* n-th neighbour: smallest distance after the (n-1)-th, smallest index first */
+    last = -1.0f;
+    lastIndex = 0U;
+    for (n = 0U; n < K; n++)
+    {
+      best = NB_REFERENCES;
+      for (j = 0U; j < NB_REFERENCES; j++)
+      {
+        if (((pRow[j] > last) || ((pRow[j] == last) && (j > lastIndex))) &&
+            ((best == NB_REFERENCES) || (pRow[j] < pRow[best])))
+        {
+          best = j;
+        }
+      }
+      if ((best != topIndex[n]) || (pRow[best] != topDistances[n]))
+      {
+        return ARM_MATH_TEST_FAILURE;
+      }
+      last = pRow[best];
+      lastIndex = best;
+    }
+  }
+
+  printf("knn        k = %u neighbours of %u queries match the full scan\n", K, NB_QUERIES);
+
+  return ARM_MATH_SUCCESS;
+}
+
+int32_t main(void)
+{
+  arm_status status = ARM_MATH_SUCCESS;
+  uint32_t i;
+
+  printf("START\n");
+
+  if (arm_pairwise_distance_scratch_size_f32(DIMENSION) > SCRATCH_SIZE)
+  {
+    printf("FAILURE\n");
+    return 1;
+  }
+
+  for (i = 0U; i < (NB_QUERIES * DIMENSION); i++)
+  {
+    queries[i] = random_f32();
+  }
+  for (i = 0U; i < (NB_REFERENCES * DIMENSION); i++)
+  {
+    references[i] = random_f32();
+  }
+
+  printf("%u x %u vectors of dimension %u\n", NB_QUERIES, NB_REFERENCES, DIMENSION);
+  if (check_metric("euclidean", ARM_PAIRWISE_EUCLIDEAN, arm_euclidean_distance_f32) != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+  if (check_metric("cityblock", ARM_PAIRWISE_CITYBLOCK, arm_cityblock_distance_f32) != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+  if (check_metric("chebyshev", ARM_PAIRWISE_CHEBYSHEV, arm_chebyshev_distance_f32) != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+  if (check_metric("cosine", ARM_PAIRWISE_COSINE, arm_cosine_distance_f32) != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+  if (check_knn() != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  printf((status == ARM_MATH_SUCCESS) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (status == ARM_MATH_SUCCESS) ? 0 : 1;
+}
+
+ /** \endlink */
@@ -0,0 +1,259 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_blocked_example_f32.c
+ * Description:  Blocked matrix multiplication accuracy check and benchmark across sizes
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup MatMultBlockedExample Blocked Matrix Multiplication Example
+ *
+ * \par Description:
+ * \par
+ * Checks the cache blocked matrix multiplications against arm_mat_mult_f32(),
+ * arm_mat_mult_q31() and arm_mat_mult_q15() for square and odd sizes, then
+ * prints the time of the direct and blocked versions for square matrices from
+ * 16 x 16 to <code>MAX_DIM</code> x <code>MAX_DIM</code>.
+ *
+ * \par
+ * The time is measured with the C library clock(): run on the host or with
+ * semihosting. The matrices take <code>10 * MAX_DIM * MAX_DIM</code> words:
+ * reduce <code>MAX_DIM</code> for targets with less memory.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_mat_init_f32(), arm_mat_init_q31(), arm_mat_init_q15()
+ * - arm_mat_mult_f32(), arm_mat_mult_q31(), arm_mat_mult_q15()
+ * - arm_mat_mult_blocked_workspace_size_f32()
+ * - arm_mat_mult_blocked_workspace_size_q31()
+ * - arm_mat_mult_blocked_workspace_size_q15()
+ * - arm_mat_mult_blocked_f32()
+ * - arm_mat_mult_blocked_q31()
+ * - arm_mat_mult_blocked_q15()
+ *
+ * @} */
+
+#include "arm_math.h"
+#include <stdio.h>
+#include <time.h>
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define MAX_DIM         512
+#define BENCH_MACS      (64.0 * 1024.0 * 1024.0)
+#define REL_THRESHOLD   1e-5f
+
+/* ----------------------------------------------------------------------
+* Declare matrices and workspaces
+* ------------------------------------------------------------------- */
+static float32_t aF32[MAX_DIM * MAX_DIM];
+static float32_t bF32[MAX_DIM * MAX_DIM];
+static float32_t refF32[MAX_DIM * MAX_DIM];
+static float32_t testF32[MAX_DIM * MAX_DIM];
+static q31_t aQ31[MAX_DIM * MAX_DIM];
+static q31_t bQ31[MAX_DIM * MAX_DIM];
+static q31_t refQ31[MAX_DIM * MAX_DIM];
+static q31_t testQ31[MAX_DIM * MAX_DIM];
+static q15_t aQ15[MAX_DIM * MAX_DIM];
+static q15_t bQ15[MAX_DIM * MAX_DIM];
+static q15_t refQ15[MAX_DIM * MAX_DIM];
+static q15_t testQ15[MAX_DIM * MAX_DIM];
+static float32_t workF32[MAX_DIM * MAX_DIM];
+static q31_t workQ31[MAX_DIM * MAX_DIM];
+static q15_t workQ15[MAX_DIM * MAX_DIM];
+
+/* ----------------------------------------------------------------------
+* Pseudo random values in [-0.5, 0.5)
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345U;
+
+static float32_t random_f32(void)
+{
+  seed = (seed * 1664525U) + 1013904223U;
+  return ((float32_t)(seed >> 8) / 16777216.0f) - 0.5f;
+}
+
+/* ----------------------------------------------------------------------
+* Blocked against direct multiplication of M x K by K x N matrices
+* ------------------------------------------------------------------- */
+static arm_status check_size(uint16_t M, uint16_t K, uint16_t N)
+{
+  arm_matrix_instance_f32 af, bf, cf;
+  arm_matrix_instance_q31 aq31, bq31, cq31;
+  arm_matrix_instance_q15 aq15, bq15, cq15;
+  float32_t maxError = 0.0f;
+  float32_t error;
+  uint32_t mismatchQ31 = 0U;
+  uint32_t mismatchQ15 = 0U;
+  uint32_t i;
+
+  arm_mat_init_f32(&af, M, K, aF32);
+  arm_mat_init_f32(&bf, K, N, bF32);
+  arm_mat_init_q31(&aq31, M, K, aQ31);
+  arm_mat_init_q31(&bq31, K, N, bQ31);
+  arm_mat_init_q15(&aq15, M, K, aQ15);
+  arm_mat_init_q15(&bq15, K, N, bQ15);
+
+  if ((arm_mat_mult_blocked_workspace_size_f32(&af, &bf) > (MAX_DIM * MAX_DIM)) ||
+      (arm_mat_mult_blocked_workspace_size_q31(&aq31, &bq31) > (MAX_DIM * MAX_DIM)) ||
+      (arm_mat_mult_blocked_workspace_size_q15(&aq15, &bq15) > (MAX_DIM * MAX_DIM)))
+  {
+    return ARM_MATH_TEST_FAILURE;
+  }
+
+  arm_mat_init_f32(&cf, M, N, refF32);
+  (void)arm_mat_mult_f32(&af, &bf, &cf);
+  arm_mat_init_f32(&cf, M, N, testF32);
+  (void)arm_mat_mult_blocked_f32(&af, &bf, &cf, workF32);
+  for (i = 0U; i < ((uint32_t)M * N); i++)
+  {
+    error = fabsf(refF32[i] - testF32[i]) / (fabsf(refF32[i]) + 1.0f);
+    maxError = (error > maxError) ? error : maxError;
+  }
+
+  arm_mat_init_q31(&cq31, M, N, refQ31);
+  (void)arm_mat_mult_q31(&aq31, &bq31, &cq31);
+  arm_mat_init_q31(&cq31, M, N, testQ31);
+  (void)arm_mat_mult_blocked_q31(&aq31, &bq31, &cq31, workQ31);
+
+  arm_mat_init_q15(&cq15, M, N, refQ15);
+  (void)arm_mat_mult_q15(&aq15, &bq15, &cq15, workQ15);
+  arm_mat_init_q15(&cq15, M, N, testQ15);
+  (void)arm_mat_mult_blocked_q15(&aq15, &bq15, &cq15, workQ15);
+
+  for (i = 0U; i < ((uint32_t)M * N); i++)
+  {
+    mismatchQ31 += (refQ31[i] != testQ31[i]) ? 1U : 0U;
+    mismatchQ15 += (refQ15[i] != testQ15[i]) ? 1U : 0U;
+  }
+
+  printf("%4u x %4u x %4u  f32 max rel error %.1e  q31 mismatch %u  q15 mismatch %u\n",
+         M, K, N, maxError, (unsigned)mismatchQ31, (unsigned)mismatchQ15);
+
+  return ((maxError > REL_THRESHOLD) || (mismatchQ31 != 0U) || (mismatchQ15 != 0U)) ?
+         ARM_MATH_TEST_FAILURE : ARM_MATH_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------
+* Time in ns per multiply-accumulate of N x N matrices
+* ------------------------------------------------------------------- */
+#define BENCH(CALL, RESULT)                                                   \
+  {                                                                           \
+    clock_t start = clock();                                                  \
+    for (r = 0U; r < repeat; r++)                                             \
+    {                                                                         \
+      (void)CALL;                                                             \
+    }                                                                         \
+    RESULT = ((float64_t)(clock() - start) * 1e9) /                           \
+             ((float64_t)CLOCKS_PER_SEC * repeat * N * N * N);                \
+  }
+
+static void bench_size(uint16_t N)
+{
+  arm_matrix_instance_f32 af, bf, cf;
+  arm_matrix_instance_q31 aq31, bq31, cq31;
+  arm_matrix_instance_q15 aq15, bq15, cq15;
+  uint32_t repeat = (uint32_t)(BENCH_MACS / ((float64_t)N * N * N)) + 1U;
+  float64_t t[6];
+  uint32_t r;
+
+  arm_mat_init_f32(&af, N, N, aF32);
+  arm_mat_init_f32(&bf, N, N, bF32);
+  arm_mat_init_f32(&cf, N, N, testF32);
+  arm_mat_init_q31(&aq31, N, N, aQ31);
+  arm_mat_init_q31(&bq31, N, N, bQ31);
+  arm_mat_init_q31(&cq31, N, N, testQ31);
+  arm_mat_init_q15(&aq15, N, N, aQ15);
+  arm_mat_init_q15(&bq15, N, N, bQ15);
+  arm_mat_init_q15(&cq15, N, N, testQ15);
+
+  BENCH(arm_mat_mult_f32(&af, &bf, &cf), t[0])
+  BENCH(arm_mat_mult_blocked_f32(&af, &bf, &cf, workF32), t[1])
+  BENCH(arm_mat_mult_q31(&aq31, &bq31, &cq31), t[2])
+  BENCH(arm_mat_mult_blocked_q31(&aq31, &bq31, &cq31, workQ31), t[3])
+  BENCH(arm_mat_mult_q15(&aq15, &bq15, &cq15, workQ15), t[4])
+  BENCH(arm_mat_mult_blocked_q15(&aq15, &bq15, &cq15, workQ15), t[5])
+
+  printf("%4u  %7.3f %7.3f   %7.3f %7.3f   %7.3f %7.3f\n", N, t[0], t[1], t[2], t[3], t[4], t[5]);
+}
+
+int32_t main(void)
+{
+  static const uint16_t sizes[][3] = {
+    { 4, 4, 4 }, { 64, 64, 64 }, { 65, 65, 65 }, { 37, 129, 71 }, { 97, 129, 71 },
+    { 131, 67, 131 }, { 3, 300, 300 }, { 100, 1, 5000 }, { 129, 300, 33 }, { 256, 256, 256 },
+    { 513, 200, 7 }
+  };
+  arm_status status = ARM_MATH_SUCCESS;
+  uint16_t N;
+  uint32_t i;
+
+  printf("START\n");
+
+  for (i = 0U; i < (MAX_DIM * MAX_DIM); i++)
+  {
+    aF32[i] = random_f32();
+    bF32[i] = random_f32();
+  }
+  /* Fixed-point inputs scaled so that the sums do not saturate */
+  arm_float_to_q31(aF32, aQ31, MAX_DIM * MAX_DIM);
+  arm_float_to_q31(bF32, bQ31, MAX_DIM * MAX_DIM);
+  arm_scale_f32(aF32, 0.125f, refF32, MAX_DIM * MAX_DIM);
+  arm_float_to_q15(refF32, aQ15, MAX_DIM * MAX_DIM);
+  arm_scale_f32(bF32, 0.125f, refF32, MAX_DIM * MAX_DIM);
+  arm_float_to_q15(refF32, bQ15, MAX_DIM * MAX_DIM);
+
+  for (i = 0U; i < (sizeof(sizes) / sizeof(sizes[0])); i++)
+  {
+    if (((uint32_t)sizes[i][0] * sizes[i][1] > (MAX_DIM * MAX_DIM)) ||
+        ((uint32_t)sizes[i][1] * sizes[i][2] > (MAX_DIM * MAX_DIM)) ||
+        ((uint32_t)sizes[i][0] * sizes[i][2] > (MAX_DIM * MAX_DIM)))
+    {
+      continue;
+    }
+    if (check_size(sizes[i][0], sizes[i][1], sizes[i][2]) != ARM_MATH_SUCCESS)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  printf("\nns per multiply-accumulate, N x N matrices\n");
+  printf("f32 blocked calls arm_mat_mult_f32() up to %u multiply-accumulates\n",
+         (unsigned)ARM_MAT_MULT_BLOCKED_MIN_MACS_F32);
+  printf("   N      f32 blocked      q31 blocked      q15 blocked\n");
+  for (N = 16U; N <= MAX_DIM; N <<= 1U)
+  {
+    bench_size(N);
+  }
+
+  printf((status == ARM_MATH_SUCCESS) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (status == ARM_MATH_SUCCESS) ? 0 : 1;
+}
+
+ /** \endlink */
@@ -0,0 +1,423 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_small_example_f32.c
+ * Description:  Small matrix functions and Kalman filter accuracy check and benchmark
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup MatSmallExample Small Matrix Functions and Kalman Filter Example
+ *
+ * \par Description:
+ * \par
+ * Checks the 2 x 2 to 6 x 6 matrix multiplications, transposes and inverses
+ * against arm_mat_mult_f32(), arm_mat_trans_f32() and arm_mat_inverse_f32(),
+ * then runs a constant velocity Kalman filter in three dimensions (6 states,
+ * 3 position measurements) with arm_kalman_step_f32() and with the generic
+ * matrix functions, and compares the estimates. The time of each version is
+ * printed.
+ *
+ * \par
+ * The time is measured with the C library clock(): run on the host or with
+ * semihosting, and use a large enough <code>BENCH_REPEAT</code> for the clock
+ * resolution.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_mat_init_f32()
+ * - arm_mat_mult_f32(), arm_mat_trans_f32(), arm_mat_inverse_f32()
+ * - arm_mat_add_f32(), arm_mat_sub_f32(), arm_mat_vec_mult_f32()
+ * - arm_mat_mult_2x2_f32() to arm_mat_mult_6x6_f32()
+ * - arm_mat_trans_2x2_f32() to arm_mat_trans_6x6_f32()
+ * - arm_mat_inverse_2x2_f32() to arm_mat_inverse_6x6_f32()
+ * - arm_kalman_init_f32()
+ * - arm_kalman_step_f32()
+ *
+ * @} */
+
+#include "arm_math.h"
+#include <stdio.h>
+#include <time.h>
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define BENCH_REPEAT    1000000U
+#define TEST_REPEAT     100U
+#define KALMAN_STEPS    1000U
+#define DT              0.01f
+#define REL_THRESHOLD   1e-4f
+
+#define NUM_STATES      6U
+#define NUM_MEAS        3U
+
+typedef arm_status (*mat_binary_fn)(const arm_matrix_instance_f32 *,
+                                    const arm_matrix_instance_f32 *,
+                                    arm_matrix_instance_f32 *);
+typedef arm_status (*mat_unary_fn)(const arm_matrix_instance_f32 *,
+                                   arm_matrix_instance_f32 *);
+
+static const mat_binary_fn multSmall[ARM_MAT_SMALL_MAX_DIM + 1U] = {
+  NULL, NULL, arm_mat_mult_2x2_f32, arm_mat_mult_3x3_f32,
+  arm_mat_mult_4x4_f32, arm_mat_mult_5x5_f32, arm_mat_mult_6x6_f32
+};
+static const mat_unary_fn transSmall[ARM_MAT_SMALL_MAX_DIM + 1U] = {
+  NULL, NULL, arm_mat_trans_2x2_f32, arm_mat_trans_3x3_f32,
+  arm_mat_trans_4x4_f32, arm_mat_trans_5x5_f32, arm_mat_trans_6x6_f32
+};
+static const mat_unary_fn inverseSmall[ARM_MAT_SMALL_MAX_DIM + 1U] = {
+  NULL, NULL, arm_mat_inverse_2x2_f32, arm_mat_inverse_3x3_f32,
+  arm_mat_inverse_4x4_f32, arm_mat_inverse_5x5_f32, arm_mat_inverse_6x6_f32
+};
+
+/* ----------------------------------------------------------------------
+* Declare matrices
+* ------------------------------------------------------------------- */
+#define MAX_SIZE (ARM_MAT_SMALL_MAX_DIM * ARM_MAT_SMALL_MAX_DIM)
+
+static float32_t aData[MAX_SIZE];
+static float32_t bData[MAX_SIZE];
+static float32_t refData[MAX_SIZE];
+static float32_t testData[MAX_SIZE];
+
+/* ----------------------------------------------------------------------
+* Pseudo random values in [-0.5, 0.5)
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345U;
+
+static float32_t random_f32(void)
+{
+  seed = (seed * 1664525U) + 1013904223U;
+  return ((float32_t)(seed >> 8) / 16777216.0f) - 0.5f;
+}
+
+/* ----------------------------------------------------------------------
+* Largest difference relative to the reference
+* ------------------------------------------------------------------- */
+static float32_t max_error_f32(const float32_t *pRef, const float32_t *pTest, uint32_t length)
+{
+  float32_t maxError = 0.0f;
+  float32_t error;
+  uint32_t i;
+
+  for (i = 0U; i < length; i++)
+  {
+    error = fabsf(pRef[i] - pTest[i]) / (fabsf(pRef[i]) + 1.0f);
+    maxError = (error > maxError) ? error : maxError;
+  }
+
+  return maxError;
+}
+
+/* ----------------------------------------------------------------------
+* Time in ns of one call
+* ------------------------------------------------------------------- */
+#define BENCH(CALL, RESULT)                                                   \
+  {                                                                           \
+    clock_t start = clock();                                                  \
+    for (r = 0U; r < BENCH_REPEAT; r++)                                       \
+    {                                                                         \
+      (void)CALL;                                                             \
+    }                                                                         \
+    RESULT = ((float64_t)(clock() - start) * 1e9) /                           \
+             ((float64_t)CLOCKS_PER_SEC * BENCH_REPEAT);                      \
+  }
+
+/* ----------------------------------------------------------------------
+* Small against generic functions for n x n matrices
+* ------------------------------------------------------------------- */
+static arm_status check_size(uint16_t n)
+{
+  arm_matrix_instance_f32 a, b, ref, test;
+  float32_t errMult = 0.0f;
+  float32_t errTrans = 0.0f;
+  float32_t errInverse = 0.0f;
+  float32_t error;
+  float64_t t[6];
+  uint32_t r;
+  uint32_t i;
+
+  arm_mat_init_f32(&a, n, n, aData);
+  arm_mat_init_f32(&b, n, n, bData);
+  arm_mat_init_f32(&ref, n, n, refData);
+  arm_mat_init_f32(&test, n, n, testData);
+
+  for (r = 0U; r < TEST_REPEAT; r++)
+  {
+    for (i = 0U; i < ((uint32_t)n * n); i++)
+    {
+      aData[i] = random_f32();
+      bData[i] = random_f32();
+    }
+    /* Well conditioned A */
+    for (i = 0U; i < n; i++)
+    {
+      aData[(i * n) + i] += 2.0f;
+    }
+
+    (void)arm_mat_mult_f32(&a, &b, &ref);
+    (void)multSmall[n](&a, &b, &test);
+    error = max_error_f32(refData, testData, (uint32_t)n * n);
+    errMult = (error > errMult) ? error : errMult;
+
+    (void)arm_mat_trans_f32(&a, &ref);
+    (void)transSmall[n](&a, &test);
+    error = max_error_f32(refData, testData, (uint32_t)n * n);
+    errTrans = (error > errTrans) ? error : errTrans;
+
+    if (inverseSmall[n](&a, &test) != ARM_MATH_SUCCESS)
+    {
+      return ARM_MATH_TEST_FAILURE;
+    }
+    (void)arm_mat_inverse_f32(&a, &ref);
+    error = max_error_f32(refData, testData, (uint32_t)n * n);
+    errInverse = (error > errInverse) ? error : errInverse;
+  }
+
+  BENCH(arm_mat_mult_f32(&a, &b, &ref), t[0])
+  BENCH(multSmall[n](&a, &b, &ref), t[1])
+  BENCH(arm_mat_trans_f32(&a, &ref), t[2])
+  BENCH(transSmall[n](&a, &ref), t[3])
+  BENCH(arm_mat_inverse_f32(&a, &ref), t[4])
+  BENCH(inverseSmall[n](&a, &ref), t[5])
+
+  printf("%u x %u  %6.1f %6.1f   %6.1f %6.1f   %6.1f %6.1f   max rel error %.1e %.1e %.1e\n",
+         n, n, t[0], t[1], t[2], t[3], t[4], t[5], errMult, errTrans, errInverse);
+
+  return ((errMult > REL_THRESHOLD) || (errTrans > REL_THRESHOLD) || (errInverse > REL_THRESHOLD)) ?
+         ARM_MATH_TEST_FAILURE : ARM_MATH_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------
+* Kalman filter model: constant velocity in 3 dimensions
+* ------------------------------------------------------------------- */
+static float32_t F[NUM_STATES * NUM_STATES];
+static float32_t Q[NUM_STATES * NUM_STATES];
+static float32_t H[NUM_MEAS * NUM_STATES];
+static float32_t R[NUM_MEAS * NUM_MEAS];
+static float32_t state[NUM_STATES];
+static float32_t P[NUM_STATES * NUM_STATES];
+static float32_t refState[NUM_STATES];
+static float32_t refP[NUM_STATES * NUM_STATES];
+static float32_t measurements[KALMAN_STEPS * NUM_MEAS];
+
+static void kalman_model(void)
+{
+  uint32_t i;
+
+  for (i = 0U; i < (NUM_STATES * NUM_STATES); i++)
+  {
+    F[i] = 0.0f;
+    Q[i] = 0.0f;
+    P[i] = 0.0f;
+  }
+  for (i = 0U; i < (NUM_MEAS * NUM_STATES); i++)
+  {
+    H[i] = 0.0f;
+  }
+  for (i = 0U; i < (NUM_MEAS * NUM_MEAS); i++)
+  {
+    R[i] = 0.0f;
+  }
+
+  /* Positions in states 0 to 2, velocities in states 3 to 5 */
+  for (i = 0U; i < NUM_STATES; i++)
+  {
+    F[(i * NUM_STATES) + i] = 1.0f;
+    Q[(i * NUM_STATES) + i] = (i < NUM_MEAS) ? 1e-6f : 1e-3f;
+    P[(i * NUM_STATES) + i] = 1.0f;
+    state[i] = 0.0f;
+  }
+  for (i = 0U; i < NUM_MEAS; i++)
+  {
+    F[(i * NUM_STATES) + NUM_MEAS + i] = DT;
+    H[(i * NUM_STATES) + i] = 1.0f;
+    R[(i * NUM_MEAS) + i] = 0.01f;
+  }
+
+  /* Noisy positions of a target moving at {1, -2, 0.5} */
+  for (i = 0U; i < KALMAN_STEPS; i++)
+  {
+    measurements[(i * NUM_MEAS) + 0U] = (1.0f * DT * (float32_t)i) + (0.2f * random_f32());
+    measurements[(i * NUM_MEAS) + 1U] = (-2.0f * DT * (float32_t)i) + (0.2f * random_f32());
+    measurements[(i * NUM_MEAS) + 2U] = (0.5f * DT * (float32_t)i) + (0.2f * random_f32());
+  }
+
+  arm_copy_f32(state, refState, NUM_STATES);
+  arm_copy_f32(P, refP, NUM_STATES * NUM_STATES);
+}
+
+/* ----------------------------------------------------------------------
+* Same prediction and update with the generic matrix functions
+* ------------------------------------------------------------------- */
+static void kalman_step_generic(const float32_t *pZ)
+{
+  static float32_t Ft[NUM_STATES * NUM_STATES];
+  static float32_t FP[NUM_STATES * NUM_STATES];
+  static float32_t Ht[NUM_STATES * NUM_MEAS];
+  static float32_t PHt[NUM_STATES * NUM_MEAS];
+  static float32_t S[NUM_MEAS * NUM_MEAS];
+  static float32_t Si[NUM_MEAS * NUM_MEAS];
+  static float32_t K[NUM_STATES * NUM_MEAS];
+  static float32_t KH[NUM_STATES * NUM_STATES];
+  static float32_t KHP[NUM_STATES * NUM_STATES];
+  float32_t xp[NUM_STATES];
+  float32_t Hx[NUM_MEAS];
+  float32_t y[NUM_MEAS];
+  float32_t Ky[NUM_STATES];
+  arm_matrix_instance_f32 mF, mQ, mH, mR, mP, mFt, mFP, mHt, mPHt, mS, mSi, mK, mKH, mKHP;
+
+  arm_mat_init_f32(&mF, NUM_STATES, NUM_STATES, F);
+  arm_mat_init_f32(&mQ, NUM_STATES, NUM_STATES, Q);
+  arm_mat_init_f32(&mH, NUM_MEAS, NUM_STATES, H);
+  arm_mat_init_f32(&mR, NUM_MEAS, NUM_MEAS, R);
+  arm_mat_init_f32(&mP, NUM_STATES, NUM_STATES, refP);
+  arm_mat_init_f32(&mFt, NUM_STATES, NUM_STATES, Ft);
+  arm_mat_init_f32(&mFP, NUM_STATES, NUM_STATES, FP);
+  arm_mat_init_f32(&mHt, NUM_STATES, NUM_MEAS, Ht);
+  arm_mat_init_f32(&mPHt, NUM_STATES, NUM_MEAS, PHt);
+  arm_mat_init_f32(&mS, NUM_MEAS, NUM_MEAS, S);
+  arm_mat_init_f32(&mSi, NUM_MEAS, NUM_MEAS, Si);
+  arm_mat_init_f32(&mK, NUM_STATES, NUM_MEAS, K);
+  arm_mat_init_f32(&mKH, NUM_STATES, NUM_STATES, KH);
+  arm_mat_init_f32(&mKHP, NUM_STATES, NUM_STATES, KHP);
+
+  /* x = F x, P = F P F' + Q */
+  arm_mat_vec_mult_f32(&mF, refState, xp);
+  (void)arm_mat_mult_f32(&mF, &mP, &mFP);
+  (void)arm_mat_trans_f32(&mF, &mFt);
+  (void)arm_mat_mult_f32(&mFP, &mFt, &mP);
+  (void)arm_mat_add_f32(&mP, &mQ, &mP);
+
+  /* K = P H' inv(H P H' + R) */
+  (void)arm_mat_trans_f32(&mH, &mHt);
+  (void)arm_mat_mult_f32(&mP, &mHt, &mPHt);
+  (void)arm_mat_mult_f32(&mH, &mPHt, &mS);
+  (void)arm_mat_add_f32(&mS, &mR, &mS);
+  (void)arm_mat_inverse_f32(&mS, &mSi);
+  (void)arm_mat_mult_f32(&mPHt, &mSi, &mK);
+
+  /* x = x + K (z - H x), P = P - K H P */
+  arm_mat_vec_mult_f32(&mH, xp, Hx);
+  arm_sub_f32(pZ, Hx, y, NUM_MEAS);
+  arm_mat_vec_mult_f32(&mK, y, Ky);
+  arm_add_f32(xp, Ky, refState, NUM_STATES);
+  (void)arm_mat_mult_f32(&mK, &mH, &mKH);
+  (void)arm_mat_mult_f32(&mKH, &mP, &mKHP);
+  (void)arm_mat_sub_f32(&mP, &mKHP, &mP);
+}
+
+/* ----------------------------------------------------------------------
+* Fused against generic Kalman filter
+* ------------------------------------------------------------------- */
+static arm_status check_kalman(void)
+{
+  arm_kalman_instance_f32 S;
+  arm_matrix_instance_f32 mF, mQ, mH, mR, mP;
+  float32_t errState = 0.0f;
+  float32_t errP = 0.0f;
+  float32_t error;
+  float64_t t[2];
+  clock_t start;
+  uint32_t i;
+
+  kalman_model();
+
+  arm_mat_init_f32(&mF, NUM_STATES, NUM_STATES, F);
+  arm_mat_init_f32(&mQ, NUM_STATES, NUM_STATES, Q);
+  arm_mat_init_f32(&mH, NUM_MEAS, NUM_STATES, H);
+  arm_mat_init_f32(&mR, NUM_MEAS, NUM_MEAS, R);
+  arm_mat_init_f32(&mP, NUM_STATES, NUM_STATES, P);
+  if (arm_kalman_init_f32(&S, &mF, &mQ, &mH, &mR, state, &mP) != ARM_MATH_SUCCESS)
+  {
+    return ARM_MATH_TEST_FAILURE;
+  }
+
+  for (i = 0U; i < KALMAN_STEPS; i++)
+  {
+    if (arm_kalman_step_f32(&S, &measurements[i * NUM_MEAS]) != ARM_MATH_SUCCESS)
+    {
+      return ARM_MATH_TEST_FAILURE;
+    }
+    kalman_step_generic(&measurements[i * NUM_MEAS]);
+
+    error = max_error_f32(refState, state, NUM_STATES);
+    errState = (error > errState) ? error : errState;
+    error = max_error_f32(refP, P, NUM_STATES * NUM_STATES);
+    errP = (error > errP) ? error : errP;
+  }
+
+  start = clock();
+  for (i = 0U; i < BENCH_REPEAT; i++)
+  {
+    kalman_step_generic(&measurements[(i % KALMAN_STEPS) * NUM_MEAS]);
+  }
+  t[0] = ((float64_t)(clock() - start) * 1e9) / ((float64_t)CLOCKS_PER_SEC * BENCH_REPEAT);
+
+  start = clock();
+  for (i = 0U; i < BENCH_REPEAT; i++)
+  {
+    (void)arm_kalman_step_f32(&S, &measurements[(i % KALMAN_STEPS) * NUM_MEAS]);
+  }
+  t[1] = ((float64_t)(clock() - start) * 1e9) / ((float64_t)CLOCKS_PER_SEC * BENCH_REPEAT);
+
+  printf("\nKalman filter, %u states, %u measurements\n", NUM_STATES, NUM_MEAS);
+  printf("velocity estimate {%.3f, %.3f, %.3f}\n", state[3], state[4], state[5]);
+  printf("max rel error state %.1e  covariance %.1e\n", errState, errP);
+  printf("ns per step: generic %.1f  fused %.1f\n", t[0], t[1]);
+
+  return ((errState > REL_THRESHOLD) || (errP > REL_THRESHOLD)) ? ARM_MATH_TEST_FAILURE : ARM_MATH_SUCCESS;
+}
+
+int32_t main(void)
+{
+  arm_status status = ARM_MATH_SUCCESS;
+  uint16_t n;
+
+  printf("START\n");
+
+  printf("ns per call, generic and small functions\n");
+  printf("size      mult           trans          inverse\n");
+  for (n = 2U; n <= ARM_MAT_SMALL_MAX_DIM; n++)
+  {
+    if (check_size(n) != ARM_MATH_SUCCESS)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  if (check_kalman() != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  printf((status == ARM_MATH_SUCCESS) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (status == ARM_MATH_SUCCESS) ? 0 : 1;
+}
+
+ /** \endlink */
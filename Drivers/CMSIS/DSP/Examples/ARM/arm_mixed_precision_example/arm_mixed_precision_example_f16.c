@@ -0,0 +1,418 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mixed_precision_example_f16.c
+ * Description:  Half-precision storage with single-precision accumulation, error and throughput
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup MixedPrecisionExample Mixed Precision Example
+ *
+ * \par Description:
+ * \par
+ * Computes dot products, FIR filters, matrix vector and matrix products of
+ * random half-precision data in three ways: in half precision (arm_dot_prod_f16(),
+ * arm_fir_f16(), arm_mat_vec_mult_f16(), arm_mat_mult_f16()), with half-precision
+ * storage and single-precision accumulation (arm_dot_prod_f16_f32(),
+ * arm_fir_f16_f32(), arm_mat_vec_mult_f16_f32(), arm_mat_mult_f16_f32() and the
+ * acc32 versions with half-precision outputs), and in single precision on the
+ * same values. The signal to noise ratio of every result against a double
+ * precision reference is printed: the mixed precision functions must have the
+ * accuracy of the single-precision ones, and their half-precision outputs the
+ * accuracy of a single rounding to half precision.
+ *
+ * \par
+ * Last, prints the time per multiply-accumulate and the bytes of input read
+ * per multiply-accumulate of the three versions. The time is measured with the
+ * C library clock(): run on the host or with semihosting.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_dot_prod_f16_f32()
+ * - arm_dot_prod_acc32_f16()
+ * - arm_fir_f16_f32()
+ * - arm_fir_acc32_f16()
+ * - arm_mat_vec_mult_f16_f32()
+ * - arm_mat_vec_mult_acc32_f16()
+ * - arm_mat_mult_f16_f32()
+ * - arm_mat_mult_acc32_f16()
+ * - and the f16 and f32 versions
+ * - arm_float_to_f16()
+ * - arm_f16_to_float()
+ *
+ * @} */
+
+#include "arm_math.h"
+#include "arm_math_f16.h"
+#include <stdio.h>
+#include <time.h>
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define DOT_LENGTH      65536
+#define NUM_TAPS        256
+#define BLOCK_SIZE      64
+#define NUM_SAMPLES     4096
+#define NUM_ROWS        64
+#define NUM_COLS        512
+#define NUM_COLS_B      32
+#define BENCH_LOOPS     20
+#define MAX_LOSS_DB     3.0f
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+static float32_t srcA32[DOT_LENGTH];
+static float32_t srcB32[DOT_LENGTH];
+static float16_t srcA16[DOT_LENGTH];
+static float16_t srcB16[DOT_LENGTH];
+static float32_t out32[NUM_SAMPLES];
+static float16_t out16[NUM_SAMPLES];
+static float32_t outF16[NUM_SAMPLES];
+static float32_t outMixed[NUM_SAMPLES];
+static float32_t outAcc32[NUM_SAMPLES];
+static float64_t ref64[NUM_SAMPLES];
+static float32_t state32[NUM_TAPS + BLOCK_SIZE - 1];
+static float16_t state16[NUM_TAPS + 8 * ((BLOCK_SIZE + 7) / 8) + BLOCK_SIZE - 1];
+static float16_t coeffs16[NUM_TAPS];
+
+/* ----------------------------------------------------------------------
+* Pseudo random values in [-0.5, 0.5)
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345U;
+
+static float32_t random_f32(void)
+{
+  seed = (seed * 1664525U) + 1013904223U;
+  return ((float32_t)(seed >> 8) / 16777216.0f) - 0.5f;
+}
+
+/* Random half-precision values and the same values in single precision */
+static void random_data(float32_t *pDst32, float16_t *pDst16, uint32_t length)
+{
+  uint32_t i;
+
+  for (i = 0U; i < length; i++)
+  {
+    pDst32[i] = random_f32();
+  }
+  arm_float_to_f16(pDst32, pDst16, length);
+  arm_f16_to_float(pDst16, pDst32, length);
+}
+
+/* ----------------------------------------------------------------------
+* Signal to noise ratio in dB against a double precision reference
+* ------------------------------------------------------------------- */
+static float32_t snr_f64(const float64_t *pRef, const float32_t *pTest, uint32_t length)
+{
+  float64_t signal = 0.0;
+  float64_t noise = 0.0;
+  uint32_t i;
+
+  for (i = 0U; i < length; i++)
+  {
+    signal += pRef[i] * pRef[i];
+    noise += (pRef[i] - pTest[i]) * (pRef[i] - pTest[i]);
+  }
+
+  return (noise == 0.0) ? 300.0f : (float32_t)(10.0 * log10(signal / noise));
+}
+
+/* ----------------------------------------------------------------------
+* Accuracy of the half, mixed and single precision results
+* ------------------------------------------------------------------- */
+static int32_t report(const char *pName, uint32_t length)
+{
+  float32_t snrF16 = snr_f64(ref64, outF16, length);
+  float32_t snrMixed = snr_f64(ref64, outMixed, length);
+  float32_t snrAcc32 = snr_f64(ref64, outAcc32, length);
+  float32_t snrF32 = snr_f64(ref64, out32, length);
+  float32_t snrRound;
+  uint32_t i;
+
+  /* Reference rounded once to half precision */
+  for (i = 0U; i < length; i++)
+  {
+    out16[i] = (float16_t)ref64[i];
+  }
+  arm_f16_to_float(out16, outF16, length);
+  snrRound = snr_f64(ref64, outF16, length);
+
+  printf("%-12s f16 %6.1f  f16_f32 %6.1f  acc32_f16 %6.1f (rounding %6.1f)  f32 %6.1f dB\n",
+         pName, snrF16, snrMixed, snrAcc32, snrRound, snrF32);
+
+  return (snrMixed >= (snrF32 - MAX_LOSS_DB)) && (snrAcc32 >= (snrRound - MAX_LOSS_DB));
+}
+
+/* ----------------------------------------------------------------------
+* Dot products of growing length
+* ------------------------------------------------------------------- */
+static int32_t check_dot(void)
+{
+  uint32_t length;
+  uint32_t n = 0U;
+  uint32_t i;
+  float64_t sum;
+  float16_t result16;
+
+  random_data(srcA32, srcA16, DOT_LENGTH);
+  random_data(srcB32, srcB16, DOT_LENGTH);
+
+  for (length = 16U; length <= DOT_LENGTH; length <<= 1U)
+  {
+    sum = 0.0;
+    for (i = 0U; i < length; i++)
+    {
+      sum += (float64_t)srcA32[i] * srcB32[i];
+    }
+    ref64[n] = sum;
+
+    arm_dot_prod_f16(srcA16, srcB16, length, &result16);
+    outF16[n] = (float32_t)result16;
+    arm_dot_prod_f16_f32(srcA16, srcB16, length, &outMixed[n]);
+    arm_dot_prod_acc32_f16(srcA16, srcB16, length, &result16);
+    outAcc32[n] = (float32_t)result16;
+    arm_dot_prod_f32(srcA32, srcB32, length, &out32[n]);
+    n++;
+  }
+
+  return report("dot product", n);
+}
+
+/* ----------------------------------------------------------------------
+* FIR filter processed by blocks
+* ------------------------------------------------------------------- */
+static int32_t check_fir(void)
+{
+  arm_fir_instance_f32 fir32;
+  arm_fir_instance_f16 fir16;
+  uint32_t pos;
+  uint32_t k;
+
+  /* Coefficients in srcB, time reversed as for arm_fir_f32() */
+  random_data(srcA32, srcA16, NUM_SAMPLES);
+  random_data(srcB32, coeffs16, NUM_TAPS);
+
+  for (pos = 0U; pos < NUM_SAMPLES; pos++)
+  {
+    ref64[pos] = 0.0;
+    for (k = 0U; (k < NUM_TAPS) && (k <= pos); k++)
+    {
+      ref64[pos] += (float64_t)srcB32[NUM_TAPS - 1U - k] * srcA32[pos - k];
+    }
+  }
+
+  arm_fir_init_f32(&fir32, NUM_TAPS, srcB32, state32, BLOCK_SIZE);
+  for (pos = 0U; pos < NUM_SAMPLES; pos += BLOCK_SIZE)
+  {
+    arm_fir_f32(&fir32, &srcA32[pos], &out32[pos], BLOCK_SIZE);
+  }
+  arm_fir_init_f16(&fir16, NUM_TAPS, coeffs16, state16, BLOCK_SIZE);
+  for (pos = 0U; pos < NUM_SAMPLES; pos += BLOCK_SIZE)
+  {
+    arm_fir_f16(&fir16, &srcA16[pos], &out16[pos], BLOCK_SIZE);
+  }
+  arm_f16_to_float(out16, outF16, NUM_SAMPLES);
+  arm_fir_init_f16(&fir16, NUM_TAPS, coeffs16, state16, BLOCK_SIZE);
+  for (pos = 0U; pos < NUM_SAMPLES; pos += BLOCK_SIZE)
+  {
+    arm_fir_f16_f32(&fir16, &srcA16[pos], &outMixed[pos], BLOCK_SIZE);
+  }
+  arm_fir_init_f16(&fir16, NUM_TAPS, coeffs16, state16, BLOCK_SIZE);
+  for (pos = 0U; pos < NUM_SAMPLES; pos += BLOCK_SIZE)
+  {
+    arm_fir_acc32_f16(&fir16, &srcA16[pos], &out16[pos], BLOCK_SIZE);
+  }
+  arm_f16_to_float(out16, outAcc32, NUM_SAMPLES);
+
+  return report("fir", NUM_SAMPLES);
+}
+
+/* ----------------------------------------------------------------------
+* Matrix vector and matrix products
+* ------------------------------------------------------------------- */
+static int32_t check_mat(void)
+{
+  arm_matrix_instance_f32 matA32;
+  arm_matrix_instance_f32 matB32;
+  arm_matrix_instance_f32 matC32;
+  arm_matrix_instance_f16 matA16;
+  arm_matrix_instance_f16 matB16;
+  arm_matrix_instance_f16 matC16;
+  int32_t status;
+  uint32_t i;
+  uint32_t j;
+  uint32_t k;
+
+  /* A in srcA, B and the vector in srcB */
+  random_data(srcA32, srcA16, NUM_ROWS * NUM_COLS);
+  random_data(srcB32, srcB16, NUM_COLS * NUM_COLS_B);
+  arm_mat_init_f32(&matA32, NUM_ROWS, NUM_COLS, srcA32);
+  arm_mat_init_f16(&matA16, NUM_ROWS, NUM_COLS, srcA16);
+
+  for (i = 0U; i < NUM_ROWS; i++)
+  {
+    ref64[i] = 0.0;
+    for (k = 0U; k < NUM_COLS; k++)
+    {
+      ref64[i] += (float64_t)srcA32[(i * NUM_COLS) + k] * srcB32[k];
+    }
+  }
+  arm_mat_vec_mult_f16(&matA16, srcB16, out16);
+  arm_f16_to_float(out16, outF16, NUM_ROWS);
+  arm_mat_vec_mult_f16_f32(&matA16, srcB16, outMixed);
+  arm_mat_vec_mult_acc32_f16(&matA16, srcB16, out16);
+  arm_f16_to_float(out16, outAcc32, NUM_ROWS);
+  arm_mat_vec_mult_f32(&matA32, srcB32, out32);
+  status = report("mat vec", NUM_ROWS);
+
+  for (i = 0U; i < NUM_ROWS; i++)
+  {
+    for (j = 0U; j < NUM_COLS_B; j++)
+    {
+      ref64[(i * NUM_COLS_B) + j] = 0.0;
+      for (k = 0U; k < NUM_COLS; k++)
+      {
+        ref64[(i * NUM_COLS_B) + j] += (float64_t)srcA32[(i * NUM_COLS) + k] * srcB32[(k * NUM_COLS_B) + j];
+      }
+    }
+  }
+  arm_mat_init_f32(&matB32, NUM_COLS, NUM_COLS_B, srcB32);
+  arm_mat_init_f16(&matB16, NUM_COLS, NUM_COLS_B, srcB16);
+  arm_mat_init_f16(&matC16, NUM_ROWS, NUM_COLS_B, out16);
+
+  (void)arm_mat_mult_f16(&matA16, &matB16, &matC16);
+  arm_f16_to_float(out16, outF16, NUM_ROWS * NUM_COLS_B);
+  arm_mat_init_f32(&matC32, NUM_ROWS, NUM_COLS_B, outMixed);
+  (void)arm_mat_mult_f16_f32(&matA16, &matB16, &matC32);
+  (void)arm_mat_mult_acc32_f16(&matA16, &matB16, &matC16);
+  arm_f16_to_float(out16, outAcc32, NUM_ROWS * NUM_COLS_B);
+  arm_mat_init_f32(&matC32, NUM_ROWS, NUM_COLS_B, out32);
+  (void)arm_mat_mult_f32(&matA32, &matB32, &matC32);
+  status &= report("mat mult", NUM_ROWS * NUM_COLS_B);
+
+  return status;
+}
+
+/* ----------------------------------------------------------------------
+* Time per multiply-accumulate in ns of the dot products and FIR filters
+* ------------------------------------------------------------------- */
+static void bench(void)
+{
+  arm_fir_instance_f32 fir32;
+  arm_fir_instance_f16 fir16;
+  float64_t times[6];
+  float32_t result32;
+  float16_t result16;
+  clock_t start;
+  uint32_t loop;
+  uint32_t pos;
+
+  start = clock();
+  for (loop = 0U; loop < BENCH_LOOPS; loop++)
+  {
+    arm_dot_prod_f16(srcA16, srcB16, DOT_LENGTH, &result16);
+  }
+  times[0] = ((float64_t)(clock() - start) * 1e9) / ((float64_t)CLOCKS_PER_SEC * BENCH_LOOPS * DOT_LENGTH);
+  start = clock();
+  for (loop = 0U; loop < BENCH_LOOPS; loop++)
+  {
+    arm_dot_prod_f16_f32(srcA16, srcB16, DOT_LENGTH, &result32);
+  }
+  times[1] = ((float64_t)(clock() - start) * 1e9) / ((float64_t)CLOCKS_PER_SEC * BENCH_LOOPS * DOT_LENGTH);
+  start = clock();
+  for (loop = 0U; loop < BENCH_LOOPS; loop++)
+  {
+    arm_dot_prod_f32(srcA32, srcB32, DOT_LENGTH, &result32);
+  }
+  times[2] = ((float64_t)(clock() - start) * 1e9) / ((float64_t)CLOCKS_PER_SEC * BENCH_LOOPS * DOT_LENGTH);
+
+  arm_fir_init_f16(&fir16, NUM_TAPS, coeffs16, state16, BLOCK_SIZE);
+  start = clock();
+  for (pos = 0U; pos < NUM_SAMPLES; pos += BLOCK_SIZE)
+  {
+    arm_fir_f16(&fir16, &srcA16[pos], &out16[pos], BLOCK_SIZE);
+  }
+  times[3] = ((float64_t)(clock() - start) * 1e9) / ((float64_t)CLOCKS_PER_SEC * NUM_SAMPLES * NUM_TAPS);
+  arm_fir_init_f16(&fir16, NUM_TAPS, coeffs16, state16, BLOCK_SIZE);
+  start = clock();
+  for (pos = 0U; pos < NUM_SAMPLES; pos += BLOCK_SIZE)
+  {
+    arm_fir_f16_f32(&fir16, &srcA16[pos], &outMixed[pos], BLOCK_SIZE);
+  }
+  times[4] = ((float64_t)(clock() - start) * 1e9) / ((float64_t)CLOCKS_PER_SEC * NUM_SAMPLES * NUM_TAPS);
+  arm_fir_init_f32(&fir32, NUM_TAPS, srcB32, state32, BLOCK_SIZE);
+  start = clock();
+  for (pos = 0U; pos < NUM_SAMPLES; pos += BLOCK_SIZE)
+  {
+    arm_fir_f32(&fir32, &srcA32[pos], &out32[pos], BLOCK_SIZE);
+  }
+  times[5] = ((float64_t)(clock() - start) * 1e9) / ((float64_t)CLOCKS_PER_SEC * NUM_SAMPLES * NUM_TAPS);
+
+  printf("\nns per multiply-accumulate, bytes of input read per multiply-accumulate\n");
+  printf("              f16          f16_f32      f32\n");
+  printf("dot product   %6.3f (4)   %6.3f (4)   %6.3f (8)\n", times[0], times[1], times[2]);
+  printf("fir           %6.3f (4)   %6.3f (4)   %6.3f (8)\n", times[3], times[4], times[5]);
+}
+
+int32_t main(void)
+{
+  int32_t passed;
+
+  printf("START\n");
+
+  passed = check_dot();
+  passed &= check_fir();
+  passed &= check_mat();
+
+  random_data(srcA32, srcA16, DOT_LENGTH);
+  random_data(srcB32, srcB16, DOT_LENGTH);
+  bench();
+
+  printf((passed != 0) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (passed != 0) ? 0 : 1;
+}
+
+#else
+
+/* Nothing checked without float16: reported as skipped, not as a pass */
+int32_t main(void)
+{
+  printf("START\n");
+  printf("float16 not supported by the compiler\n");
+  printf("SKIPPED\n");
+
+  return 0;
+}
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
+
+ /** \endlink */
@@ -0,0 +1,382 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_multichannel_filter_example_f32.c
+ * Description:  Multi-channel biquad and FIR check against per-channel instances and benchmark
+ *
+ * $Date:        19 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup MultichannelFilterExample Multi-channel Filter Example
+ *
+ * \par Description:
+ * \par
+ * Filters an interleaved random stream of N channels with the multi-channel
+ * biquad cascade and FIR filters, and compares every output sample with N
+ * single-channel instances (arm_biquad_cascade_df2T_f32(), arm_fir_f32())
+ * run on the de-interleaved channels. The channel counts include 1, 2 and
+ * counts that are not a multiple of 4 (3, 5, 7, 11, 13), so that the
+ * vector loops and their tails are both covered. The block size changes
+ * from call to call and every other call filters in place, to check that
+ * the state carries over between calls in both cases. Then prints the
+ * time per sample of the multi-channel filters and of N instances
+ * (de-interleave, filter, interleave), the best of several runs, and fails
+ * if the multi-channel FIR is slower than the N instances.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_biquad_cascade_mc_df2T_init_f32(), arm_biquad_cascade_mc_df2T_f32()
+ * - arm_fir_mc_init_f32(), arm_fir_mc_f32()
+ * - arm_biquad_cascade_df2T_init_f32(), arm_biquad_cascade_df2T_f32()
+ * - arm_fir_init_f32(), arm_fir_f32()
+ *
+ * @} */
+
+#include "arm_math.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define MAX_CHANNELS    16U
+#define MAX_BLOCK       64U
+#define MAX_STAGES      4U
+#define MAX_TAPS        29U
+#define CALLS           12U
+#define BENCH_CHANNELS  6U
+#define BENCH_SAMPLES   20000U
+#define BENCH_RUNS      5U
+/* Same operations in the same order per channel: only the fused multiply-add
+   of the vector code can change the rounding */
+#define REL_THRESHOLD   1e-5f
+
+/* ----------------------------------------------------------------------
+* Declare the buffers
+* ------------------------------------------------------------------- */
+static float32_t inputMc[MAX_CHANNELS * MAX_BLOCK];
+static float32_t outputMc[MAX_CHANNELS * MAX_BLOCK];
+static float32_t inputCh[MAX_BLOCK];
+static float32_t outputCh[MAX_BLOCK];
+static float32_t biquadCoeffs[5U * MAX_STAGES];
+static float32_t firCoeffs[MAX_TAPS];
+static float32_t biquadStateMc[2U * MAX_STAGES * MAX_CHANNELS];
+static float32_t biquadStateCh[MAX_CHANNELS][2U * MAX_STAGES];
+static float32_t firStateMc[(MAX_TAPS + MAX_BLOCK - 1U) * MAX_CHANNELS];
+static float32_t firStateCh[MAX_CHANNELS][MAX_TAPS + MAX_BLOCK - 1U];
+static arm_biquad_cascade_df2T_instance_f32 biquadCh[MAX_CHANNELS];
+static arm_fir_instance_f32 firCh[MAX_CHANNELS];
+
+/* ----------------------------------------------------------------------
+* Pseudo random values in [-0.5, 0.5)
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345U;
+
+static float32_t random_f32(void)
+{
+  seed = (seed * 1664525U) + 1013904223U;
+  return ((float32_t)(seed >> 8) / 16777216.0f) - 0.5f;
+}
+
+/* ----------------------------------------------------------------------
+* Low-pass biquad stages (cutoffs from 0.05 to 0.2 of the sampling rate),
+* feedback coefficients negated as expected by the DF2T functions
+* ------------------------------------------------------------------- */
+static void design_biquads(uint32_t numStages)
+{
+  float32_t w0, alpha, a0;
+  uint32_t stage;
+
+  for (stage = 0U; stage < numStages; stage++)
+  {
+    w0 = 2.0f * PI * (0.05f + (0.05f * (float32_t)stage));
+    alpha = sinf(w0) / (2.0f * 0.8f);
+    a0 = 1.0f + alpha;
+    biquadCoeffs[(5U * stage) + 0U] = ((1.0f - cosf(w0)) / 2.0f) / a0;
+    biquadCoeffs[(5U * stage) + 1U] = (1.0f - cosf(w0)) / a0;
+    biquadCoeffs[(5U * stage) + 2U] = ((1.0f - cosf(w0)) / 2.0f) / a0;
+    biquadCoeffs[(5U * stage) + 3U] = (2.0f * cosf(w0)) / a0;
+    biquadCoeffs[(5U * stage) + 4U] = -(1.0f - alpha) / a0;
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Largest difference of channel c relative to the reference
+* ------------------------------------------------------------------- */
+static float32_t channel_error(const float32_t *ref, const float32_t *test, uint32_t c,
+                               uint32_t numChannels, uint32_t blockSize)
+{
+  float32_t error, maxError = 0.0f;
+  uint32_t n;
+
+  for (n = 0U; n < blockSize; n++)
+  {
+    error = fabsf(ref[n] - test[(n * numChannels) + c]) / (1.0f + fabsf(ref[n]));
+    maxError = (error > maxError) ? error : maxError;
+  }
+
+  return maxError;
+}
+
+static void deinterleave(const float32_t *src, float32_t *dst, uint32_t c, uint32_t numChannels, uint32_t blockSize)
+{
+  uint32_t n;
+
+  for (n = 0U; n < blockSize; n++)
+  {
+    dst[n] = src[(n * numChannels) + c];
+  }
+}
+
+static void interleave(const float32_t *src, float32_t *dst, uint32_t c, uint32_t numChannels, uint32_t blockSize)
+{
+  uint32_t n;
+
+  for (n = 0U; n < blockSize; n++)
+  {
+    dst[(n * numChannels) + c] = src[n];
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Multi-channel against per-channel filters, for one channel count
+* ------------------------------------------------------------------- */
+static arm_status check_channels(uint32_t numChannels, uint32_t numStages, uint32_t numTaps)
+{
+  arm_biquad_cascade_mc_df2T_instance_f32 biquadMc;
+  arm_fir_mc_instance_f32 firMc;
+  float32_t biquadError = 0.0f;
+  float32_t firError = 0.0f;
+  float32_t error;
+  uint32_t blockSize;
+  uint32_t call;
+  uint32_t pass;
+  uint32_t c;
+  uint32_t i;
+
+  arm_biquad_cascade_mc_df2T_init_f32(&biquadMc, (uint8_t)numStages, (uint16_t)numChannels, biquadCoeffs, biquadStateMc);
+  arm_fir_mc_init_f32(&firMc, (uint16_t)numTaps, (uint16_t)numChannels, firCoeffs, firStateMc, MAX_BLOCK);
+  for (c = 0U; c < numChannels; c++)
+  {
+    arm_biquad_cascade_df2T_init_f32(&biquadCh[c], (uint8_t)numStages, biquadCoeffs, biquadStateCh[c]);
+    arm_fir_init_f32(&firCh[c], (uint16_t)numTaps, firCoeffs, firStateCh[c], MAX_BLOCK);
+  }
+
+  for (call = 0U; call < CALLS; call++)
+  {
+    /* Block sizes of 1 up to MAX_BLOCK, odd ones included */
+    blockSize = (call == 0U) ? 1U : (1U + ((call * 23U) % MAX_BLOCK));
+
+    /* pass 0: biquad, pass 1: FIR. Odd calls filter in place */
+    for (pass = 0U; pass < 2U; pass++)
+    {
+      for (i = 0U; i < (numChannels * blockSize); i++)
+      {
+        inputMc[i] = random_f32();
+      }
+
+      if ((call % 2U) == 1U)
+      {
+        (void)memcpy(outputMc, inputMc, numChannels * blockSize * sizeof(float32_t));
+        if (pass == 0U)
+        {
+          arm_biquad_cascade_mc_df2T_f32(&biquadMc, outputMc, outputMc, blockSize);
+        }
+        else
+        {
+          arm_fir_mc_f32(&firMc, outputMc, outputMc, blockSize);
+        }
+      }
+      else
+      {
+        if (pass == 0U)
+        {
+          arm_biquad_cascade_mc_df2T_f32(&biquadMc, inputMc, outputMc, blockSize);
+        }
+        else
+        {
+          arm_fir_mc_f32(&firMc, inputMc, outputMc, blockSize);
+        }
+      }
+
+      for (c = 0U; c < numChannels; c++)
+      {
+        deinterleave(inputMc, inputCh, c, numChannels, blockSize);
+        if (pass == 0U)
+        {
+          arm_biquad_cascade_df2T_f32(&biquadCh[c], inputCh, outputCh, blockSize);
+          error = channel_error(outputCh, outputMc, c, numChannels, blockSize);
+          biquadError = (error > biquadError) ? error : biquadError;
+        }
+        else
+        {
+          arm_fir_f32(&firCh[c], inputCh, outputCh, blockSize);
+          error = channel_error(outputCh, outputMc, c, numChannels, blockSize);
+          firError = (error > firError) ? error : firError;
+        }
+      }
+    }
+  }
+
+  printf("channels %2u  stages %u  taps %2u  max rel error: biquad %.1e  FIR %.1e\n",
+         (unsigned)numChannels, (unsigned)numStages, (unsigned)numTaps, biquadError, firError);
+
+  return ((biquadError > REL_THRESHOLD) || (firError > REL_THRESHOLD)) ? ARM_MATH_TEST_FAILURE : ARM_MATH_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------
+* Time per sample of the multi-channel filters and of N instances
+* ------------------------------------------------------------------- */
+static float64_t best_time(float64_t best, clock_t start)
+{
+  float64_t t = (float64_t)(clock() - start);
+
+  return (t < best) ? t : best;
+}
+
+static arm_status bench(void)
+{
+  arm_biquad_cascade_mc_df2T_instance_f32 biquadMc;
+  arm_fir_mc_instance_f32 firMc;
+  const uint32_t blocks = BENCH_SAMPLES / MAX_BLOCK;
+  float64_t tBiquadMc = 1e30, tBiquadCh = 1e30, tFirMc = 1e30, tFirCh = 1e30;
+  clock_t start;
+  uint32_t run;
+  uint32_t block;
+  uint32_t c;
+
+  for (c = 0U; c < (BENCH_CHANNELS * MAX_BLOCK); c++)
+  {
+    inputMc[c] = random_f32();
+  }
+
+  arm_biquad_cascade_mc_df2T_init_f32(&biquadMc, MAX_STAGES, BENCH_CHANNELS, biquadCoeffs, biquadStateMc);
+  arm_fir_mc_init_f32(&firMc, MAX_TAPS, BENCH_CHANNELS, firCoeffs, firStateMc, MAX_BLOCK);
+  for (c = 0U; c < BENCH_CHANNELS; c++)
+  {
+    arm_biquad_cascade_df2T_init_f32(&biquadCh[c], MAX_STAGES, biquadCoeffs, biquadStateCh[c]);
+    arm_fir_init_f32(&firCh[c], MAX_TAPS, firCoeffs, firStateCh[c], MAX_BLOCK);
+  }
+
+  for (run = 0U; run < BENCH_RUNS; run++)
+  {
+    start = clock();
+    for (block = 0U; block < blocks; block++)
+    {
+      arm_biquad_cascade_mc_df2T_f32(&biquadMc, inputMc, outputMc, MAX_BLOCK);
+    }
+    tBiquadMc = best_time(tBiquadMc, start);
+
+    start = clock();
+    for (block = 0U; block < blocks; block++)
+    {
+      for (c = 0U; c < BENCH_CHANNELS; c++)
+      {
+        deinterleave(inputMc, inputCh, c, BENCH_CHANNELS, MAX_BLOCK);
+        arm_biquad_cascade_df2T_f32(&biquadCh[c], inputCh, outputCh, MAX_BLOCK);
+        interleave(outputCh, outputMc, c, BENCH_CHANNELS, MAX_BLOCK);
+      }
+    }
+    tBiquadCh = best_time(tBiquadCh, start);
+
+    start = clock();
+    for (block = 0U; block < blocks; block++)
+    {
+      arm_fir_mc_f32(&firMc, inputMc, outputMc, MAX_BLOCK);
+    }
+    tFirMc = best_time(tFirMc, start);
+
+    start = clock();
+    for (block = 0U; block < blocks; block++)
+    {
+      for (c = 0U; c < BENCH_CHANNELS; c++)
+      {
+        deinterleave(inputMc, inputCh, c, BENCH_CHANNELS, MAX_BLOCK);
+        arm_fir_f32(&firCh[c], inputCh, outputCh, MAX_BLOCK);
+        interleave(outputCh, outputMc, c, BENCH_CHANNELS, MAX_BLOCK);
+      }
+    }
+    tFirCh = best_time(tFirCh, start);
+  }
+
+  printf("\n%u channels, ns per sample and channel: multi-channel / %u instances\n",
+         BENCH_CHANNELS, BENCH_CHANNELS);
+  printf("  biquad %u stages  %6.2f / %6.2f\n", MAX_STAGES,
+         (tBiquadMc * 1e9) / ((float64_t)CLOCKS_PER_SEC * blocks * MAX_BLOCK * BENCH_CHANNELS),
+         (tBiquadCh * 1e9) / ((float64_t)CLOCKS_PER_SEC * blocks * MAX_BLOCK * BENCH_CHANNELS));
+  printf("  FIR %u taps       %6.2f / %6.2f\n", MAX_TAPS,
+         (tFirMc * 1e9) / ((float64_t)CLOCKS_PER_SEC * blocks * MAX_BLOCK * BENCH_CHANNELS),
+         (tFirCh * 1e9) / ((float64_t)CLOCKS_PER_SEC * blocks * MAX_BLOCK * BENCH_CHANNELS));
+
+  if (tFirMc > tFirCh)
+  {
+    printf("  multi-channel FIR slower than %u instances\n", BENCH_CHANNELS);
+    return ARM_MATH_TEST_FAILURE;
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+int32_t main(void)
+{
+  static const uint32_t channels[] = { 1U, 2U, 3U, 4U, 5U, 7U, 8U, 11U, 13U, MAX_CHANNELS };
+  static const uint32_t stages[] = { 1U, 2U, MAX_STAGES };
+  static const uint32_t taps[] = { 1U, 4U, 7U, MAX_TAPS };
+  arm_status status = ARM_MATH_SUCCESS;
+  uint32_t i;
+  uint32_t j;
+
+  printf("START\n");
+
+  design_biquads(MAX_STAGES);
+  for (i = 0U; i < MAX_TAPS; i++)
+  {
+    firCoeffs[i] = random_f32() * (2.0f / (float32_t)MAX_TAPS);
+  }
+
+  for (i = 0U; i < (sizeof(channels) / sizeof(channels[0])); i++)
+  {
+    for (j = 0U; j < (sizeof(stages) / sizeof(stages[0])); j++)
+    {
+      if (check_channels(channels[i], stages[j], taps[(i + j) % (sizeof(taps) / sizeof(taps[0]))]) != ARM_MATH_SUCCESS)
+      {
+        status = ARM_MATH_TEST_FAILURE;
+      }
+    }
+  }
+
+  if (bench() != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  printf((status == ARM_MATH_SUCCESS) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (status == ARM_MATH_SUCCESS) ? 0 : 1;
+}
+
+ /** \endlink */
@@ -0,0 +1,279 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_radix_sort_example_f32.c
+ * Description:  Radix sort and argsort check and benchmark against the comparison sorts
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup RadixSortExample Radix Sort and Argsort Example
+ *
+ * \par Description:
+ * \par
+ * Checks arm_argsort_f32() for every algorithm against arm_merge_argsort_f32(),
+ * the radix sort of arm_sort_f32() against the quick sort, and the Q31 and Q15
+ * radix sorts and argsorts, in both directions, on data with many equal values.
+ * Then prints the time per element of the quick, merge and radix sorts and
+ * argsorts for sizes from 64 to <code>BENCH_MAX_SIZE</code> elements.
+ *
+ * \par
+ * The benchmark buffers take <code>24 * BENCH_MAX_SIZE</code> bytes: define a
+ * smaller <code>BENCH_MAX_SIZE</code> to run on a target.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_sort_init_f32(), arm_sort_init_buffer_f32(), arm_sort_f32(), arm_argsort_f32()
+ * - arm_merge_sort_init_f32(), arm_merge_sort_f32(), arm_merge_argsort_f32()
+ * - arm_radix_sort_init_q31(), arm_radix_sort_q31(), arm_radix_argsort_q31()
+ * - arm_radix_sort_init_q15(), arm_radix_sort_q15(), arm_radix_argsort_q15()
+ *
+ * @} */
+
+#include "arm_math.h"
+#include <stdio.h>
+#include <time.h>
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define CHECK_MAX_SIZE  1024U
+#ifndef BENCH_MAX_SIZE
+#define BENCH_MAX_SIZE  (1U << 20)
+#endif
+#define BENCH_ELEMENTS  (1U << 22)
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+static float32_t srcF32[BENCH_MAX_SIZE];
+static float32_t dstF32[BENCH_MAX_SIZE];
+static uint32_t sortIndex[BENCH_MAX_SIZE];
+static uint32_t buffer[3U * BENCH_MAX_SIZE];
+static uint32_t refIndex[CHECK_MAX_SIZE];
+static float32_t refF32[CHECK_MAX_SIZE];
+static q31_t srcQ31[CHECK_MAX_SIZE];
+static q31_t dstQ31[CHECK_MAX_SIZE];
+static q15_t srcQ15[CHECK_MAX_SIZE];
+static q15_t dstQ15[CHECK_MAX_SIZE];
+
+/* ----------------------------------------------------------------------
+* Pseudo random values in [-0.5, 0.5)
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345U;
+
+static float32_t random_f32(void)
+{
+  seed = (seed * 1664525U) + 1013904223U;
+  return ((float32_t)(seed >> 8) / 16777216.0f) - 0.5f;
+}
+
+/* ----------------------------------------------------------------------
+* Permutation in order, equal values in the order of their indices
+* ------------------------------------------------------------------- */
+#define CHECK_ORDER(pSrc, pIdx, n, dir, pErr)                                  \
+do {                                                                           \
+  uint32_t k_;                                                                 \
+  for (k_ = 1U; k_ < (n); k_++)                                                \
+  {                                                                            \
+    if ((pSrc)[(pIdx)[k_ - 1U]] == (pSrc)[(pIdx)[k_]])                         \
+    {                                                                          \
+      *(pErr) |= ((pIdx)[k_ - 1U] > (pIdx)[k_]);                               \
+    }                                                                          \
+    else                                                                       \
+    {                                                                          \
+      *(pErr) |= (((dir) == ARM_SORT_ASCENDING) !=                             \
+                  ((pSrc)[(pIdx)[k_ - 1U]] < (pSrc)[(pIdx)[k_]]));             \
+    }                                                                          \
+  }                                                                            \
+} while (0)
+
+static int32_t check_permutation(const uint32_t *pIdx, uint32_t n)
+{
+  static uint8_t seen[CHECK_MAX_SIZE];
+  uint32_t k;
+
+  memset(seen, 0, n);
+  for (k = 0U; k < n; k++)
+  {
+    if ((pIdx[k] >= n) || (seen[pIdx[k]] != 0U))
+    {
+      return 1;
+    }
+    seen[pIdx[k]] = 1U;
+  }
+  return 0;
+}
+
+/* ----------------------------------------------------------------------
+* All the algorithms for one size and one direction
+* ------------------------------------------------------------------- */
+static arm_status check_size(uint32_t n, arm_sort_dir dir)
+{
+  static const arm_sort_alg algs[] = { ARM_SORT_BITONIC, ARM_SORT_BUBBLE, ARM_SORT_HEAP,
+    ARM_SORT_INSERTION, ARM_SORT_QUICK, ARM_SORT_SELECTION, ARM_SORT_RADIX };
+  arm_sort_instance_f32 sort;
+  arm_merge_sort_instance_f32 merge;
+  arm_radix_sort_instance_q31 radixQ31;
+  arm_radix_sort_instance_q15 radixQ15;
+  int32_t err = 0;
+  uint32_t a;
+  uint32_t k;
+
+  /* Values on a coarse grid so that many are equal, no -0.0 */
+  for (k = 0U; k < n; k++)
+  {
+    srcF32[k] = (float32_t)(int32_t)(random_f32() * 64.0f) * 0.25f;
+    srcF32[k] = (srcF32[k] == 0.0f) ? 0.0f : srcF32[k];
+    srcQ31[k] = (random_f32() < 0.0f) ? (q31_t)(random_f32() * 4.0e9f) : (q31_t)(random_f32() * 16.0f);
+    srcQ15[k] = (q15_t)(random_f32() * 65535.0f);
+  }
+
+  arm_merge_sort_init_f32(&merge, dir, (float32_t *)buffer);
+  arm_merge_argsort_f32(&merge, srcF32, refIndex, n);
+  err |= check_permutation(refIndex, n);
+  CHECK_ORDER(srcF32, refIndex, n, dir, &err);
+
+  for (a = 0U; a < (sizeof(algs) / sizeof(algs[0])); a++)
+  {
+    if ((algs[a] == ARM_SORT_BITONIC) && ((n & (n - 1U)) != 0U))
+    {
+      continue;
+    }
+    arm_sort_init_buffer_f32(&sort, algs[a], dir, buffer);
+    arm_argsort_f32(&sort, srcF32, sortIndex, n);
+    err |= (memcmp(sortIndex, refIndex, n * sizeof(uint32_t)) != 0);
+  }
+
+  /* Radix values against quick sort values */
+  arm_sort_init_f32(&sort, ARM_SORT_QUICK, dir);
+  arm_sort_f32(&sort, srcF32, refF32, n);
+  arm_sort_init_buffer_f32(&sort, ARM_SORT_RADIX, dir, buffer);
+  arm_sort_f32(&sort, srcF32, dstF32, n);
+  err |= (memcmp(refF32, dstF32, n * sizeof(float32_t)) != 0);
+
+  arm_radix_sort_init_q31(&radixQ31, dir, buffer);
+  arm_radix_argsort_q31(&radixQ31, srcQ31, sortIndex, n);
+  arm_radix_sort_q31(&radixQ31, srcQ31, dstQ31, n);
+  err |= check_permutation(sortIndex, n);
+  CHECK_ORDER(srcQ31, sortIndex, n, dir, &err);
+  for (k = 0U; k < n; k++)
+  {
+    err |= (dstQ31[k] != srcQ31[sortIndex[k]]);
+  }
+
+  arm_radix_sort_init_q15(&radixQ15, dir, buffer);
+  arm_radix_argsort_q15(&radixQ15, srcQ15, sortIndex, n);
+  arm_radix_sort_q15(&radixQ15, srcQ15, dstQ15, n);
+  err |= check_permutation(sortIndex, n);
+  CHECK_ORDER(srcQ15, sortIndex, n, dir, &err);
+  for (k = 0U; k < n; k++)
+  {
+    err |= (dstQ15[k] != srcQ15[sortIndex[k]]);
+  }
+
+  if (err != 0)
+  {
+    printf("size %4u %s: FAILURE\n", (unsigned)n, (dir == ARM_SORT_ASCENDING) ? "ascending " : "descending");
+  }
+
+  return (err != 0) ? ARM_MATH_TEST_FAILURE : ARM_MATH_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------
+* Time per element in ns: 0 quick, 1 merge, 2 radix, 3..5 argsorts
+* ------------------------------------------------------------------- */
+static void bench_size(uint32_t n, float64_t *pTime)
+{
+  arm_sort_instance_f32 quick;
+  arm_sort_instance_f32 radix;
+  arm_merge_sort_instance_f32 merge;
+  uint32_t repeat = (BENCH_ELEMENTS / n) + 1U;
+  uint32_t algo;
+  uint32_t r;
+  clock_t start;
+
+  arm_sort_init_f32(&quick, ARM_SORT_QUICK, ARM_SORT_ASCENDING);
+  arm_sort_init_buffer_f32(&radix, ARM_SORT_RADIX, ARM_SORT_ASCENDING, buffer);
+  arm_merge_sort_init_f32(&merge, ARM_SORT_ASCENDING, (float32_t *)buffer);
+
+  for (algo = 0U; algo < 6U; algo++)
+  {
+    start = clock();
+    for (r = 0U; r < repeat; r++)
+    {
+      switch (algo)
+      {
+        case 0U: arm_sort_f32(&quick, srcF32, dstF32, n); break;
+        case 1U: arm_merge_sort_f32(&merge, srcF32, dstF32, n); break;
+        case 2U: arm_sort_f32(&radix, srcF32, dstF32, n); break;
+        case 3U: arm_argsort_f32(&quick, srcF32, sortIndex, n); break;
+        case 4U: arm_merge_argsort_f32(&merge, srcF32, sortIndex, n); break;
+        default: arm_argsort_f32(&radix, srcF32, sortIndex, n); break;
+      }
+    }
+    pTime[algo] = ((float64_t)(clock() - start) * 1e9) / ((float64_t)CLOCKS_PER_SEC * repeat * n);
+  }
+}
+
+int32_t main(void)
+{
+  static const uint32_t checkSizes[] = { 1U, 2U, 3U, 16U, 17U, 100U, 128U, 1000U, CHECK_MAX_SIZE };
+  arm_status status = ARM_MATH_SUCCESS;
+  float64_t t[6];
+  uint32_t n;
+  uint32_t i;
+
+  printf("START\n");
+
+  for (i = 0U; i < (sizeof(checkSizes) / sizeof(checkSizes[0])); i++)
+  {
+    if ((check_size(checkSizes[i], ARM_SORT_ASCENDING) != ARM_MATH_SUCCESS) ||
+        (check_size(checkSizes[i], ARM_SORT_DESCENDING) != ARM_MATH_SUCCESS))
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  for (i = 0U; i < BENCH_MAX_SIZE; i++)
+  {
+    srcF32[i] = random_f32();
+  }
+
+  printf("\nns per element         sort                    argsort\n");
+  printf("   size    quick    merge    radix    quick    merge    radix\n");
+  for (n = 64U; n <= BENCH_MAX_SIZE; n <<= 2U)
+  {
+    bench_size(n, t);
+    printf("%7u %8.1f %8.1f %8.1f %8.1f %8.1f %8.1f\n", (unsigned)n, t[0], t[1], t[2], t[3], t[4], t[5]);
+  }
+
+  printf((status == ARM_MATH_SUCCESS) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (status == ARM_MATH_SUCCESS) ? 0 : 1;
+}
+
+ /** \endlink */
@@ -0,0 +1,299 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_example_f32.c
+ * Description:  Sliding window statistics check against the block functions and benchmark
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup SlidingStatsExample Sliding Window Statistics Example
+ *
+ * \par Description:
+ * \par
+ * Feeds a random stream, by blocks of random sizes, to the sliding window
+ * statistics for several window sizes. After every block, the mean, variance,
+ * RMS, minimum and maximum of the window are compared with the block functions
+ * applied to the last <code>windowSize</code> samples: the fixed-point results
+ * must be identical (the square of the Q31 RMS within a few LSB of the mean square), the floating-point results
+ * within a tolerance. Then prints the time per sample of the sliding update and
+ * of the block functions on the whole window.
+ *
+ * \par
+ * The stream alternates large and small amplitudes and has an offset in its
+ * second half, to show that the floating-point errors do not build up.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_sliding_stats_init_f32(), arm_sliding_stats_init_q31(), arm_sliding_stats_init_q15()
+ * - arm_sliding_stats_f32(), arm_sliding_stats_q31(), arm_sliding_stats_q15()
+ * - arm_sliding_mean_f32(), arm_sliding_var_f32(), arm_sliding_rms_f32(), arm_sliding_max_f32(), arm_sliding_min_f32()
+ * - arm_sliding_mean_q31(), arm_sliding_var_q31(), arm_sliding_rms_q31(), arm_sliding_max_q31(), arm_sliding_min_q31()
+ * - arm_sliding_mean_q15(), arm_sliding_var_q15(), arm_sliding_rms_q15(), arm_sliding_max_q15(), arm_sliding_min_q15()
+ * - arm_mean_f32(), arm_var_f32(), arm_rms_f32(), arm_max_f32(), arm_min_f32()
+ * - arm_mean_q31(), arm_var_q31(), arm_max_q31(), arm_min_q31()
+ * - arm_mean_q15(), arm_var_q15(), arm_rms_q15(), arm_max_q15(), arm_min_q15()
+ *
+ * @} */
+
+#include "arm_math.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define MAX_WINDOW      1024U
+#define STREAM_LENGTH   20000U
+#define MAX_BLOCK       5U
+#define BENCH_WINDOW    256U
+/* The stream power drops by 10^4: until the next recomputation of the sums, the
+   error of the floating-point variance is about 10^4 times the float precision */
+#define REL_THRESHOLD   1e-2f
+#define MS_Q31_LSB      4.0
+
+/* ----------------------------------------------------------------------
+* Declare the streams and the window buffers
+* ------------------------------------------------------------------- */
+static float32_t streamF32[STREAM_LENGTH];
+static q31_t streamQ31[STREAM_LENGTH];
+static q15_t streamQ15[STREAM_LENGTH];
+static float32_t windowF32[MAX_WINDOW];
+static q31_t windowQ31[MAX_WINDOW];
+static q15_t windowQ15[MAX_WINDOW];
+static uint32_t queueF32[2U * MAX_WINDOW];
+static uint32_t queueQ31[2U * MAX_WINDOW];
+static uint32_t queueQ15[2U * MAX_WINDOW];
+
+/* ----------------------------------------------------------------------
+* Pseudo random values in [-0.5, 0.5)
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345U;
+
+static float32_t random_f32(void)
+{
+  seed = (seed * 1664525U) + 1013904223U;
+  return ((float32_t)(seed >> 8) / 16777216.0f) - 0.5f;
+}
+
+/* ----------------------------------------------------------------------
+* Difference relative to the block result
+* ------------------------------------------------------------------- */
+static float32_t rel_error_f32(float32_t ref, float32_t test, float32_t scale)
+{
+  return fabsf(ref - test) / (fabsf(ref) + scale);
+}
+
+/* ----------------------------------------------------------------------
+* Sliding against block statistics for one window size
+* ------------------------------------------------------------------- */
+static arm_status check_window(uint32_t windowSize)
+{
+  arm_sliding_stats_instance_f32 sf32;
+  arm_sliding_stats_instance_q31 sq31;
+  arm_sliding_stats_instance_q15 sq15;
+  float32_t refF32[5], testF32[5];
+  q31_t refQ31[5], testQ31[5];
+  float64_t meanSquare;
+  float64_t rms;
+  q15_t refQ15[5], testQ15[5];
+  uint32_t refIndex[2], testIndex[2];
+  float32_t maxError = 0.0f;
+  float32_t error;
+  uint32_t mismatch = 0U;
+  uint32_t pos = 0U;
+  uint32_t blkCnt;
+  uint32_t start;
+  uint32_t n;
+  uint32_t i;
+
+  (void)arm_sliding_stats_init_f32(&sf32, windowSize, windowF32, queueF32);
+  (void)arm_sliding_stats_init_q31(&sq31, windowSize, windowQ31, queueQ31);
+  (void)arm_sliding_stats_init_q15(&sq15, windowSize, windowQ15, queueQ15);
+
+  while (pos < STREAM_LENGTH)
+  {
+    blkCnt = 1U + ((uint32_t)((random_f32() + 0.5f) * MAX_BLOCK) % MAX_BLOCK);
+    blkCnt = ((STREAM_LENGTH - pos) < blkCnt) ? (STREAM_LENGTH - pos) : blkCnt;
+
+    arm_sliding_stats_f32(&sf32, &streamF32[pos], blkCnt);
+    arm_sliding_stats_q31(&sq31, &streamQ31[pos], blkCnt);
+    arm_sliding_stats_q15(&sq15, &streamQ15[pos], blkCnt);
+    pos += blkCnt;
+
+    n = (pos < windowSize) ? pos : windowSize;
+    start = pos - n;
+
+    /* Floating-point */
+    arm_mean_f32(&streamF32[start], n, &refF32[0]);
+    arm_var_f32(&streamF32[start], n, &refF32[1]);
+    arm_rms_f32(&streamF32[start], n, &refF32[2]);
+    arm_max_f32(&streamF32[start], n, &refF32[3], &refIndex[0]);
+    arm_min_f32(&streamF32[start], n, &refF32[4], &refIndex[1]);
+    arm_sliding_mean_f32(&sf32, &testF32[0]);
+    arm_sliding_var_f32(&sf32, &testF32[1]);
+    arm_sliding_rms_f32(&sf32, &testF32[2]);
+    arm_sliding_max_f32(&sf32, &testF32[3], &testIndex[0]);
+    arm_sliding_min_f32(&sf32, &testF32[4], &testIndex[1]);
+
+    /* Mean relative to the RMS, variance relative to the mean square */
+    error = rel_error_f32(refF32[0], testF32[0], refF32[2]);
+    maxError = (error > maxError) ? error : maxError;
+    error = rel_error_f32(refF32[1], testF32[1], refF32[2] * refF32[2]);
+    maxError = (error > maxError) ? error : maxError;
+    error = rel_error_f32(refF32[2], testF32[2], 0.0f);
+    maxError = (error > maxError) ? error : maxError;
+    mismatch += ((refF32[3] != testF32[3]) || (refF32[4] != testF32[4]) ||
+                 (refIndex[0] != testIndex[0]) || (refIndex[1] != testIndex[1])) ? 1U : 0U;
+
+    /* Q31 */
+    arm_mean_q31(&streamQ31[start], n, &refQ31[0]);
+    arm_var_q31(&streamQ31[start], n, &refQ31[1]);
+    arm_max_q31(&streamQ31[start], n, &refQ31[3], &refIndex[0]);
+    arm_min_q31(&streamQ31[start], n, &refQ31[4], &refIndex[1]);
+    arm_sliding_mean_q31(&sq31, &testQ31[0]);
+    arm_sliding_var_q31(&sq31, &testQ31[1]);
+    arm_sliding_rms_q31(&sq31, &testQ31[2]);
+    arm_sliding_max_q31(&sq31, &testQ31[3], &testIndex[0]);
+    arm_sliding_min_q31(&sq31, &testQ31[4], &testIndex[1]);
+
+    /* Mean square of the 1.23 samples in double, compared with the square of the
+       result since the square root of a Q31 mean square has few significant bits
+       for small signals */
+    meanSquare = 0.0;
+    for (i = start; i < pos; i++)
+    {
+      meanSquare += ((float64_t)(streamQ31[i] >> 8) / 8388608.0) * ((float64_t)(streamQ31[i] >> 8) / 8388608.0);
+    }
+    meanSquare = meanSquare / (float64_t)n;
+    rms = (float64_t)testQ31[2] / 2147483648.0;
+
+    mismatch += ((refQ31[0] != testQ31[0]) || (labs((long)refQ31[1] - (long)testQ31[1]) > 1L) ||
+                 (fabs((rms * rms) - meanSquare) > ((MS_Q31_LSB / 2147483648.0) + (meanSquare * 1e-6))) ||
+                 (refQ31[3] != testQ31[3]) || (refQ31[4] != testQ31[4]) ||
+                 (refIndex[0] != testIndex[0]) || (refIndex[1] != testIndex[1])) ? 1U : 0U;
+
+    /* Q15 */
+    arm_mean_q15(&streamQ15[start], n, &refQ15[0]);
+    arm_var_q15(&streamQ15[start], n, &refQ15[1]);
+    arm_rms_q15(&streamQ15[start], n, &refQ15[2]);
+    arm_max_q15(&streamQ15[start], n, &refQ15[3], &refIndex[0]);
+    arm_min_q15(&streamQ15[start], n, &refQ15[4], &refIndex[1]);
+    arm_sliding_mean_q15(&sq15, &testQ15[0]);
+    arm_sliding_var_q15(&sq15, &testQ15[1]);
+    arm_sliding_rms_q15(&sq15, &testQ15[2]);
+    arm_sliding_max_q15(&sq15, &testQ15[3], &testIndex[0]);
+    arm_sliding_min_q15(&sq15, &testQ15[4], &testIndex[1]);
+
+    for (i = 0U; i < 5U; i++)
+    {
+      mismatch += (refQ15[i] != testQ15[i]) ? 1U : 0U;
+    }
+    mismatch += ((refIndex[0] != testIndex[0]) || (refIndex[1] != testIndex[1])) ? 1U : 0U;
+  }
+
+  printf("window %4u  f32 max rel error %.1e  mismatches %u\n",
+         (unsigned)windowSize, maxError, (unsigned)mismatch);
+
+  return ((maxError > REL_THRESHOLD) || (mismatch != 0U)) ? ARM_MATH_TEST_FAILURE : ARM_MATH_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------
+* Time per sample of the sliding update and of the block functions
+* ------------------------------------------------------------------- */
+static void bench(void)
+{
+  arm_sliding_stats_instance_f32 sf32;
+  float32_t result;
+  uint32_t index;
+  clock_t start;
+  float64_t tSliding;
+  float64_t tBlock;
+  uint32_t pos;
+
+  (void)arm_sliding_stats_init_f32(&sf32, BENCH_WINDOW, windowF32, queueF32);
+
+  start = clock();
+  for (pos = 0U; pos < STREAM_LENGTH; pos++)
+  {
+    arm_sliding_stats_f32(&sf32, &streamF32[pos], 1U);
+    arm_sliding_mean_f32(&sf32, &result);
+    arm_sliding_var_f32(&sf32, &result);
+    arm_sliding_rms_f32(&sf32, &result);
+    arm_sliding_max_f32(&sf32, &result, &index);
+    arm_sliding_min_f32(&sf32, &result, &index);
+  }
+  tSliding = ((float64_t)(clock() - start) * 1e9) / ((float64_t)CLOCKS_PER_SEC * STREAM_LENGTH);
+
+  start = clock();
+  for (pos = BENCH_WINDOW; pos < STREAM_LENGTH; pos++)
+  {
+    arm_mean_f32(&streamF32[pos - BENCH_WINDOW], BENCH_WINDOW, &result);
+    arm_var_f32(&streamF32[pos - BENCH_WINDOW], BENCH_WINDOW, &result);
+    arm_rms_f32(&streamF32[pos - BENCH_WINDOW], BENCH_WINDOW, &result);
+    arm_max_f32(&streamF32[pos - BENCH_WINDOW], BENCH_WINDOW, &result, &index);
+    arm_min_f32(&streamF32[pos - BENCH_WINDOW], BENCH_WINDOW, &result, &index);
+  }
+  tBlock = ((float64_t)(clock() - start) * 1e9) / ((float64_t)CLOCKS_PER_SEC * (STREAM_LENGTH - BENCH_WINDOW));
+
+  printf("\nwindow %u, ns per sample for the 5 statistics: sliding %.1f  block %.1f\n",
+         BENCH_WINDOW, tSliding, tBlock);
+}
+
+int32_t main(void)
+{
+  static const uint32_t windows[] = { 1U, 2U, 7U, 100U, 256U, 1000U, MAX_WINDOW };
+  arm_status status = ARM_MATH_SUCCESS;
+  float32_t amplitude;
+  uint32_t i;
+
+  printf("START\n");
+
+  for (i = 0U; i < STREAM_LENGTH; i++)
+  {
+    amplitude = (((i / 3000U) % 2U) == 0U) ? 1.0f : 0.01f;
+    streamF32[i] = (amplitude * random_f32()) + ((i >= (STREAM_LENGTH / 2U)) ? 100.0f : 0.0f);
+    streamQ31[i] = (q31_t)(random_f32() * 4.0e9f * amplitude);
+    streamQ15[i] = (q15_t)(random_f32() * 65000.0f * amplitude);
+  }
+
+  for (i = 0U; i < (sizeof(windows) / sizeof(windows[0])); i++)
+  {
+    if (check_window(windows[i]) != ARM_MATH_SUCCESS)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  bench();
+
+  printf((status == ARM_MATH_SUCCESS) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (status == ARM_MATH_SUCCESS) ? 0 : 1;
+}
+
+ /** \endlink */
@@ -0,0 +1,509 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sparse_matrix_example_f32.c
+ * Description:  CSR sparse matrix accuracy check against the dense functions and benchmark
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup SparseMatrixExample Sparse Matrix Example
+ *
+ * \par Description:
+ * \par
+ * Builds a random matrix with about 5% non-zero values in CSR format, with
+ * arm_mat_csr_from_dense_f32() and with arm_mat_csr_from_triplets_f32() from
+ * shuffled and partly duplicated triplets, and checks that both give the same
+ * matrix. The products of the CSR matrix and of its transpose with a vector and
+ * with a dense matrix are then compared with the dense functions:
+ * arm_mat_vec_mult_f32(), arm_mat_mult_f32() and arm_mat_trans_f32(). The Q31
+ * and Q15 functions must give exactly the results of the dense functions.
+ *
+ * \par
+ * Last, prints the time of the matrix vector and of the matrix matrix products
+ * of a 256 x 256 matrix for densities from 1% to 50%, next to the time of the
+ * dense functions. The time is measured with the C library clock(): run on the
+ * host or with semihosting.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_mat_csr_init_f32()
+ * - arm_mat_csr_from_dense_f32()
+ * - arm_mat_csr_from_triplets_f32()
+ * - arm_mat_csr_vec_mult_f32()
+ * - arm_mat_csr_trans_vec_mult_f32()
+ * - arm_mat_csr_mult_f32()
+ * - arm_mat_csr_trans_mult_f32()
+ * - and the same Q31 and Q15 functions
+ * - arm_mat_init_f32()
+ * - arm_mat_vec_mult_f32()
+ * - arm_mat_mult_f32()
+ * - arm_mat_trans_f32()
+ * - and the same Q31 and Q15 functions
+ * - arm_float_to_q31()
+ * - arm_float_to_q15()
+ *
+ * @} */
+
+#include "arm_math.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define NUM_ROWS        100
+#define NUM_COLS        120
+#define NUM_COLS_B      24
+#define DENSITY         0.05f
+#define MAX_NON_ZEROS   (NUM_ROWS * NUM_COLS)
+#define BENCH_SIZE      256
+#define BENCH_COLS_B    16
+#define BENCH_LOOPS     200
+#define SNR_THRESHOLD   120.0f
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+static float32_t denseF32[BENCH_SIZE * BENCH_SIZE];
+static float32_t transF32[NUM_ROWS * NUM_COLS];
+static float32_t matBF32[BENCH_SIZE * BENCH_COLS_B];
+static float32_t vecF32[BENCH_SIZE];
+static float32_t refF32[BENCH_SIZE * BENCH_COLS_B];
+static float32_t outF32[BENCH_SIZE * BENCH_COLS_B];
+static q31_t denseQ31[NUM_ROWS * NUM_COLS];
+static q31_t transQ31[NUM_ROWS * NUM_COLS];
+static q31_t matBQ31[NUM_COLS * NUM_COLS_B];
+static q31_t vecQ31[NUM_COLS];
+static q31_t refQ31[NUM_COLS * NUM_COLS_B];
+static q31_t outQ31[NUM_COLS * NUM_COLS_B];
+static q15_t denseQ15[NUM_ROWS * NUM_COLS];
+static q15_t transQ15[NUM_ROWS * NUM_COLS];
+static q15_t matBQ15[NUM_COLS * NUM_COLS_B];
+static q15_t vecQ15[NUM_COLS];
+static q15_t refQ15[NUM_COLS * NUM_COLS_B];
+static q15_t outQ15[NUM_COLS * NUM_COLS_B];
+static q15_t stateQ15[NUM_COLS * NUM_COLS_B];
+static q63_t scratch[NUM_COLS];
+
+static uint32_t rowPtr[BENCH_SIZE + 1];
+static uint32_t rowPtr2[BENCH_SIZE + 1];
+static uint16_t colIdx[BENCH_SIZE * BENCH_SIZE];
+static uint16_t colIdx2[MAX_NON_ZEROS];
+static float32_t dataF32[BENCH_SIZE * BENCH_SIZE];
+static float32_t dataF32b[MAX_NON_ZEROS];
+static q31_t dataQ31[MAX_NON_ZEROS];
+static q31_t dataQ31b[MAX_NON_ZEROS];
+static q15_t dataQ15[MAX_NON_ZEROS];
+static q15_t dataQ15b[MAX_NON_ZEROS];
+
+static uint16_t tripRows[2 * MAX_NON_ZEROS];
+static uint16_t tripCols[2 * MAX_NON_ZEROS];
+static float32_t tripF32[2 * MAX_NON_ZEROS];
+static q31_t tripQ31[2 * MAX_NON_ZEROS];
+static q15_t tripQ15[2 * MAX_NON_ZEROS];
+
+/* ----------------------------------------------------------------------
+* Pseudo random values in [-0.5, 0.5)
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345U;
+
+static float32_t random_f32(void)
+{
+  seed = (seed * 1664525U) + 1013904223U;
+  return ((float32_t)(seed >> 8) / 16777216.0f) - 0.5f;
+}
+
+/* Random matrix with the given fraction of non-zero values */
+static void random_sparse_f32(float32_t *pDst, uint32_t length, float32_t density)
+{
+  uint32_t i;
+
+  for (i = 0U; i < length; i++)
+  {
+    pDst[i] = ((random_f32() + 0.5f) < density) ? random_f32() : 0.0f;
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Signal to noise ratio in dB
+* ------------------------------------------------------------------- */
+static float32_t snr_f32(const float32_t *pRef, const float32_t *pTest, uint32_t length)
+{
+  float64_t signal = 0.0;
+  float64_t noise = 0.0;
+  uint32_t i;
+
+  for (i = 0U; i < length; i++)
+  {
+    signal += (float64_t)pRef[i] * pRef[i];
+    noise += ((float64_t)pRef[i] - pTest[i]) * ((float64_t)pRef[i] - pTest[i]);
+  }
+
+  return (noise == 0.0) ? 300.0f : (float32_t)(10.0 * log10(signal / noise));
+}
+
+/* ----------------------------------------------------------------------
+* Triplets of a dense matrix in reverse order, with the first value of
+* every row split in two halves given as two triplets
+* ------------------------------------------------------------------- */
+static uint32_t make_triplets(const float32_t *pDense, uint32_t numRows, uint32_t numCols)
+{
+  uint32_t numTriplets = 0U;
+  uint32_t row;
+  uint32_t col;
+  uint32_t idx;
+  int32_t split;
+
+  for (row = numRows; row > 0U; row--)
+  {
+    split = 1;
+    for (col = numCols; col > 0U; col--)
+    {
+      idx = ((row - 1U) * numCols) + (col - 1U);
+      if (pDense[idx] != 0.0f)
+      {
+        tripRows[numTriplets] = (uint16_t)(row - 1U);
+        tripCols[numTriplets] = (uint16_t)(col - 1U);
+        tripF32[numTriplets] = pDense[idx];
+        tripQ31[numTriplets] = denseQ31[idx];
+        tripQ15[numTriplets] = denseQ15[idx];
+        if (split != 0)
+        {
+          /* Halves added back exactly by the builder */
+          tripF32[numTriplets] = 0.5f * pDense[idx];
+          tripQ31[numTriplets] = denseQ31[idx] >> 1;
+          tripQ15[numTriplets] = (q15_t)(denseQ15[idx] >> 1);
+          numTriplets++;
+          tripRows[numTriplets] = (uint16_t)(row - 1U);
+          tripCols[numTriplets] = (uint16_t)(col - 1U);
+          tripF32[numTriplets] = pDense[idx] - tripF32[numTriplets - 1U];
+          tripQ31[numTriplets] = denseQ31[idx] - tripQ31[numTriplets - 1U];
+          tripQ15[numTriplets] = (q15_t)(denseQ15[idx] - tripQ15[numTriplets - 1U]);
+          split = 0;
+        }
+        numTriplets++;
+      }
+    }
+  }
+
+  return numTriplets;
+}
+
+/* Same structure in two CSR matrices */
+static int32_t same_structure(uint32_t numRows, uint32_t numNonZeros)
+{
+  return (memcmp(rowPtr, rowPtr2, (numRows + 1U) * sizeof(uint32_t)) == 0) &&
+         (memcmp(colIdx, colIdx2, numNonZeros * sizeof(uint16_t)) == 0);
+}
+
+/* ----------------------------------------------------------------------
+* Floating-point checks
+* ------------------------------------------------------------------- */
+static arm_status check_f32(uint32_t numTriplets)
+{
+  arm_matrix_csr_instance_f32 csr;
+  arm_matrix_csr_instance_f32 csr2;
+  arm_matrix_instance_f32 matA;
+  arm_matrix_instance_f32 matAt;
+  arm_matrix_instance_f32 matB;
+  arm_matrix_instance_f32 matRef;
+  arm_matrix_instance_f32 matOut;
+  arm_status status = ARM_MATH_SUCCESS;
+  float32_t snr[4];
+  uint32_t i;
+
+  arm_mat_init_f32(&matA, NUM_ROWS, NUM_COLS, denseF32);
+  arm_mat_init_f32(&matAt, NUM_COLS, NUM_ROWS, transF32);
+  (void)arm_mat_trans_f32(&matA, &matAt);
+
+  arm_mat_csr_init_f32(&csr, NUM_ROWS, NUM_COLS, 0U, rowPtr, colIdx, dataF32);
+  arm_mat_csr_init_f32(&csr2, NUM_ROWS, NUM_COLS, 0U, rowPtr2, colIdx2, dataF32b);
+  if ((arm_mat_csr_from_dense_f32(&matA, &csr, MAX_NON_ZEROS) != ARM_MATH_SUCCESS) ||
+      (arm_mat_csr_from_triplets_f32(numTriplets, tripRows, tripCols, tripF32, &csr2, 2U * MAX_NON_ZEROS) != ARM_MATH_SUCCESS) ||
+      (csr.numNonZeros != csr2.numNonZeros) || !same_structure(NUM_ROWS, csr.numNonZeros) ||
+      (memcmp(dataF32, dataF32b, csr.numNonZeros * sizeof(float32_t)) != 0))
+  {
+    printf("f32 CSR construction mismatch\n");
+    return ARM_MATH_TEST_FAILURE;
+  }
+
+  /* A * x and A' * x */
+  arm_mat_vec_mult_f32(&matA, vecF32, refF32);
+  arm_mat_csr_vec_mult_f32(&csr, vecF32, outF32);
+  snr[0] = snr_f32(refF32, outF32, NUM_ROWS);
+  arm_mat_vec_mult_f32(&matAt, vecF32, refF32);
+  arm_mat_csr_trans_vec_mult_f32(&csr, vecF32, outF32);
+  snr[1] = snr_f32(refF32, outF32, NUM_COLS);
+
+  /* A * B and A' * B */
+  arm_mat_init_f32(&matB, NUM_COLS, NUM_COLS_B, matBF32);
+  arm_mat_init_f32(&matRef, NUM_ROWS, NUM_COLS_B, refF32);
+  arm_mat_init_f32(&matOut, NUM_ROWS, NUM_COLS_B, outF32);
+  (void)arm_mat_mult_f32(&matA, &matB, &matRef);
+  (void)arm_mat_csr_mult_f32(&csr, &matB, &matOut);
+  snr[2] = snr_f32(refF32, outF32, NUM_ROWS * NUM_COLS_B);
+
+  arm_mat_init_f32(&matB, NUM_ROWS, NUM_COLS_B, matBF32);
+  arm_mat_init_f32(&matRef, NUM_COLS, NUM_COLS_B, refF32);
+  arm_mat_init_f32(&matOut, NUM_COLS, NUM_COLS_B, outF32);
+  (void)arm_mat_mult_f32(&matAt, &matB, &matRef);
+  (void)arm_mat_csr_trans_mult_f32(&csr, &matB, &matOut);
+  snr[3] = snr_f32(refF32, outF32, NUM_COLS * NUM_COLS_B);
+
+  printf("f32  %5u values  SNR  A*x %6.1f  A'*x %6.1f  A*B %6.1f  A'*B %6.1f dB\n",
+         (unsigned)csr.numNonZeros, snr[0], snr[1], snr[2], snr[3]);
+  for (i = 0U; i < 4U; i++)
+  {
+    if (snr[i] < SNR_THRESHOLD)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  return status;
+}
+
+/* ----------------------------------------------------------------------
+* Q31 checks: same results as the dense functions
+* ------------------------------------------------------------------- */
+static arm_status check_q31(uint32_t numTriplets)
+{
+  arm_matrix_csr_instance_q31 csr;
+  arm_matrix_csr_instance_q31 csr2;
+  arm_matrix_instance_q31 matA;
+  arm_matrix_instance_q31 matAt;
+  arm_matrix_instance_q31 matB;
+  arm_matrix_instance_q31 matRef;
+  arm_matrix_instance_q31 matOut;
+  int32_t same[4];
+
+  arm_mat_init_q31(&matA, NUM_ROWS, NUM_COLS, denseQ31);
+  arm_mat_init_q31(&matAt, NUM_COLS, NUM_ROWS, transQ31);
+  (void)arm_mat_trans_q31(&matA, &matAt);
+
+  arm_mat_csr_init_q31(&csr, NUM_ROWS, NUM_COLS, 0U, rowPtr, colIdx, dataQ31);
+  arm_mat_csr_init_q31(&csr2, NUM_ROWS, NUM_COLS, 0U, rowPtr2, colIdx2, dataQ31b);
+  if ((arm_mat_csr_from_dense_q31(&matA, &csr, MAX_NON_ZEROS) != ARM_MATH_SUCCESS) ||
+      (arm_mat_csr_from_triplets_q31(numTriplets, tripRows, tripCols, tripQ31, &csr2, 2U * MAX_NON_ZEROS) != ARM_MATH_SUCCESS) ||
+      (csr.numNonZeros != csr2.numNonZeros) || !same_structure(NUM_ROWS, csr.numNonZeros) ||
+      (memcmp(dataQ31, dataQ31b, csr.numNonZeros * sizeof(q31_t)) != 0))
+  {
+    printf("q31 CSR construction mismatch\n");
+    return ARM_MATH_TEST_FAILURE;
+  }
+
+  arm_mat_vec_mult_q31(&matA, vecQ31, refQ31);
+  arm_mat_csr_vec_mult_q31(&csr, vecQ31, outQ31);
+  same[0] = (memcmp(refQ31, outQ31, NUM_ROWS * sizeof(q31_t)) == 0);
+  arm_mat_vec_mult_q31(&matAt, vecQ31, refQ31);
+  arm_mat_csr_trans_vec_mult_q31(&csr, vecQ31, outQ31, scratch);
+  same[1] = (memcmp(refQ31, outQ31, NUM_COLS * sizeof(q31_t)) == 0);
+
+  arm_mat_init_q31(&matB, NUM_COLS, NUM_COLS_B, matBQ31);
+  arm_mat_init_q31(&matRef, NUM_ROWS, NUM_COLS_B, refQ31);
+  arm_mat_init_q31(&matOut, NUM_ROWS, NUM_COLS_B, outQ31);
+  (void)arm_mat_mult_q31(&matA, &matB, &matRef);
+  (void)arm_mat_csr_mult_q31(&csr, &matB, &matOut);
+  same[2] = (memcmp(refQ31, outQ31, NUM_ROWS * NUM_COLS_B * sizeof(q31_t)) == 0);
+
+  arm_mat_init_q31(&matB, NUM_ROWS, NUM_COLS_B, matBQ31);
+  arm_mat_init_q31(&matRef, NUM_COLS, NUM_COLS_B, refQ31);
+  arm_mat_init_q31(&matOut, NUM_COLS, NUM_COLS_B, outQ31);
+  (void)arm_mat_mult_q31(&matAt, &matB, &matRef);
+  (void)arm_mat_csr_trans_mult_q31(&csr, &matB, &matOut, scratch);
+  same[3] = (memcmp(refQ31, outQ31, NUM_COLS * NUM_COLS_B * sizeof(q31_t)) == 0);
+
+  printf("q31  %5u values  same as dense  A*x %d  A'*x %d  A*B %d  A'*B %d\n",
+         (unsigned)csr.numNonZeros, (int)same[0], (int)same[1], (int)same[2], (int)same[3]);
+
+  return (same[0] && same[1] && same[2] && same[3]) ? ARM_MATH_SUCCESS : ARM_MATH_TEST_FAILURE;
+}
+
+/* ----------------------------------------------------------------------
+* Q15 checks: same results as the dense functions
+* ------------------------------------------------------------------- */
+static arm_status check_q15(uint32_t numTriplets)
+{
+  arm_matrix_csr_instance_q15 csr;
+  arm_matrix_csr_instance_q15 csr2;
+  arm_matrix_instance_q15 matA;
+  arm_matrix_instance_q15 matAt;
+  arm_matrix_instance_q15 matB;
+  arm_matrix_instance_q15 matRef;
+  arm_matrix_instance_q15 matOut;
+  int32_t same[4];
+
+  arm_mat_init_q15(&matA, NUM_ROWS, NUM_COLS, denseQ15);
+  arm_mat_init_q15(&matAt, NUM_COLS, NUM_ROWS, transQ15);
+  (void)arm_mat_trans_q15(&matA, &matAt);
+
+  arm_mat_csr_init_q15(&csr, NUM_ROWS, NUM_COLS, 0U, rowPtr, colIdx, dataQ15);
+  arm_mat_csr_init_q15(&csr2, NUM_ROWS, NUM_COLS, 0U, rowPtr2, colIdx2, dataQ15b);
+  if ((arm_mat_csr_from_dense_q15(&matA, &csr, MAX_NON_ZEROS) != ARM_MATH_SUCCESS) ||
+      (arm_mat_csr_from_triplets_q15(numTriplets, tripRows, tripCols, tripQ15, &csr2, 2U * MAX_NON_ZEROS) != ARM_MATH_SUCCESS) ||
+      (csr.numNonZeros != csr2.numNonZeros) || !same_structure(NUM_ROWS, csr.numNonZeros) ||
+      (memcmp(dataQ15, dataQ15b, csr.numNonZeros * sizeof(q15_t)) != 0))
+  {
+    printf("q15 CSR construction mismatch\n");
+    return ARM_MATH_TEST_FAILURE;
+  }
+
+  arm_mat_vec_mult_q15(&matA, vecQ15, refQ15);
+  arm_mat_csr_vec_mult_q15(&csr, vecQ15, outQ15);
+  same[0] = (memcmp(refQ15, outQ15, NUM_ROWS * sizeof(q15_t)) == 0);
+  arm_mat_vec_mult_q15(&matAt, vecQ15, refQ15);
+  arm_mat_csr_trans_vec_mult_q15(&csr, vecQ15, outQ15, scratch);
+  same[1] = (memcmp(refQ15, outQ15, NUM_COLS * sizeof(q15_t)) == 0);
+
+  arm_mat_init_q15(&matB, NUM_COLS, NUM_COLS_B, matBQ15);
+  arm_mat_init_q15(&matRef, NUM_ROWS, NUM_COLS_B, refQ15);
+  arm_mat_init_q15(&matOut, NUM_ROWS, NUM_COLS_B, outQ15);
+  (void)arm_mat_mult_q15(&matA, &matB, &matRef, stateQ15);
+  (void)arm_mat_csr_mult_q15(&csr, &matB, &matOut);
+  same[2] = (memcmp(refQ15, outQ15, NUM_ROWS * NUM_COLS_B * sizeof(q15_t)) == 0);
+
+  arm_mat_init_q15(&matB, NUM_ROWS, NUM_COLS_B, matBQ15);
+  arm_mat_init_q15(&matRef, NUM_COLS, NUM_COLS_B, refQ15);
+  arm_mat_init_q15(&matOut, NUM_COLS, NUM_COLS_B, outQ15);
+  (void)arm_mat_mult_q15(&matAt, &matB, &matRef, stateQ15);
+  (void)arm_mat_csr_trans_mult_q15(&csr, &matB, &matOut, scratch);
+  same[3] = (memcmp(refQ15, outQ15, NUM_COLS * NUM_COLS_B * sizeof(q15_t)) == 0);
+
+  printf("q15  %5u values  same as dense  A*x %d  A'*x %d  A*B %d  A'*B %d\n",
+         (unsigned)csr.numNonZeros, (int)same[0], (int)same[1], (int)same[2], (int)same[3]);
+
+  return (same[0] && same[1] && same[2] && same[3]) ? ARM_MATH_SUCCESS : ARM_MATH_TEST_FAILURE;
+}
+
+/* ----------------------------------------------------------------------
+* Time in us of the sparse and dense products for one density
+* ------------------------------------------------------------------- */
+static void bench_density(float32_t density, float64_t *pTimes)
+{
+  arm_matrix_csr_instance_f32 csr;
+  arm_matrix_instance_f32 matA;
+  arm_matrix_instance_f32 matB;
+  arm_matrix_instance_f32 matOut;
+  clock_t start;
+  uint32_t loop;
+
+  random_sparse_f32(denseF32, BENCH_SIZE * BENCH_SIZE, density);
+  arm_mat_init_f32(&matA, BENCH_SIZE, BENCH_SIZE, denseF32);
+  arm_mat_init_f32(&matB, BENCH_SIZE, BENCH_COLS_B, matBF32);
+  arm_mat_init_f32(&matOut, BENCH_SIZE, BENCH_COLS_B, outF32);
+  arm_mat_csr_init_f32(&csr, BENCH_SIZE, BENCH_SIZE, 0U, rowPtr, colIdx, dataF32);
+  (void)arm_mat_csr_from_dense_f32(&matA, &csr, BENCH_SIZE * BENCH_SIZE);
+
+  start = clock();
+  for (loop = 0U; loop < BENCH_LOOPS; loop++)
+  {
+    arm_mat_csr_vec_mult_f32(&csr, vecF32, outF32);
+  }
+  pTimes[0] = ((float64_t)(clock() - start) * 1e6) / ((float64_t)CLOCKS_PER_SEC * BENCH_LOOPS);
+
+  start = clock();
+  for (loop = 0U; loop < BENCH_LOOPS; loop++)
+  {
+    arm_mat_vec_mult_f32(&matA, vecF32, outF32);
+  }
+  pTimes[1] = ((float64_t)(clock() - start) * 1e6) / ((float64_t)CLOCKS_PER_SEC * BENCH_LOOPS);
+
+  start = clock();
+  for (loop = 0U; loop < BENCH_LOOPS; loop++)
+  {
+    (void)arm_mat_csr_mult_f32(&csr, &matB, &matOut);
+  }
+  pTimes[2] = ((float64_t)(clock() - start) * 1e6) / ((float64_t)CLOCKS_PER_SEC * BENCH_LOOPS);
+
+  start = clock();
+  for (loop = 0U; loop < BENCH_LOOPS; loop++)
+  {
+    (void)arm_mat_mult_f32(&matA, &matB, &matOut);
+  }
+  pTimes[3] = ((float64_t)(clock() - start) * 1e6) / ((float64_t)CLOCKS_PER_SEC * BENCH_LOOPS);
+}
+
+int32_t main(void)
+{
+  static const float32_t densities[] = { 0.01f, 0.02f, 0.05f, 0.1f, 0.2f, 0.5f };
+  arm_status status = ARM_MATH_SUCCESS;
+  float64_t times[4];
+  uint32_t numTriplets;
+  uint32_t i;
+
+  printf("START\n");
+
+  random_sparse_f32(denseF32, NUM_ROWS * NUM_COLS, DENSITY);
+  for (i = 0U; i < (BENCH_SIZE * BENCH_COLS_B); i++)
+  {
+    matBF32[i] = random_f32();
+  }
+  for (i = 0U; i < BENCH_SIZE; i++)
+  {
+    vecF32[i] = random_f32();
+  }
+  arm_float_to_q31(denseF32, denseQ31, NUM_ROWS * NUM_COLS);
+  arm_float_to_q15(denseF32, denseQ15, NUM_ROWS * NUM_COLS);
+  arm_float_to_q31(matBF32, matBQ31, NUM_COLS * NUM_COLS_B);
+  arm_float_to_q15(matBF32, matBQ15, NUM_COLS * NUM_COLS_B);
+  arm_float_to_q31(vecF32, vecQ31, NUM_COLS);
+  arm_float_to_q15(vecF32, vecQ15, NUM_COLS);
+
+  /* Values that round to 0 in Q15 are not stored in the Q15 matrix */
+  for (i = 0U; i < (NUM_ROWS * NUM_COLS); i++)
+  {
+    if ((denseQ15[i] == 0) || (denseQ31[i] == 0))
+    {
+      denseF32[i] = 0.0f;
+      denseQ31[i] = 0;
+      denseQ15[i] = 0;
+    }
+  }
+  numTriplets = make_triplets(denseF32, NUM_ROWS, NUM_COLS);
+
+  if ((check_f32(numTriplets) != ARM_MATH_SUCCESS) ||
+      (check_q31(numTriplets) != ARM_MATH_SUCCESS) ||
+      (check_q15(numTriplets) != ARM_MATH_SUCCESS))
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  printf("\n%u x %u matrix, us per product, B with %u columns\n", BENCH_SIZE, BENCH_SIZE, BENCH_COLS_B);
+  printf("density   csr A*x  dense A*x   csr A*B  dense A*B\n");
+  for (i = 0U; i < (sizeof(densities) / sizeof(densities[0])); i++)
+  {
+    bench_density(densities[i], times);
+    printf("%6.0f%% %9.2f %10.2f %9.2f %10.2f\n", densities[i] * 100.0f, times[0], times[1], times[2], times[3]);
+  }
+
+  printf((status == ARM_MATH_SUCCESS) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (status == ARM_MATH_SUCCESS) ? 0 : 1;
+}
+
+ /** \endlink */
@@ -0,0 +1,312 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spline_batch_example_f32.c
+ * Description:  Cubic spline interpolation of unsorted x values, check and benchmark
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup SplineBatchExample Spline Interpolation of Unsorted Values Example
+ *
+ * \par Description:
+ * \par
+ * Interpolates a random function known at evenly spaced and at randomly spaced
+ * x values, with natural and parabolic runout splines. For sorted x values
+ * inside and outside the range of the known values, including the known values
+ * themselves, checks that arm_spline_batch_f32() gives the results of
+ * arm_spline_f32(). The same x values are then shuffled: arm_spline_batch_f32()
+ * must give the same outputs in the shuffled order.
+ *
+ * \par
+ * Last, prints the time per interpolated value of arm_spline_batch_f32() on
+ * random x values, of arm_spline_f32() on the same values already sorted, and
+ * of arm_spline_f32() on the random values sorted first with the radix
+ * arm_argsort_f32() (sort, interpolation and scatter of the outputs), for 16
+ * to 1024 known points. The time is measured with the C library clock(): run
+ * on the host or with semihosting.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_spline_init_f32()
+ * - arm_spline_f32()
+ * - arm_spline_batch_f32()
+ * - arm_sort_init_buffer_f32()
+ * - arm_argsort_f32()
+ *
+ * @} */
+
+#include "arm_math.h"
+#include <stdio.h>
+#include <time.h>
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define MAX_POINTS      1024
+#define NUM_QUERIES     4096
+#define BENCH_LOOPS     100
+#define SNR_THRESHOLD   100.0f
+
+/* ----------------------------------------------------------------------
+* Declare I/O buffers
+* ------------------------------------------------------------------- */
+static float32_t knotsX[MAX_POINTS];
+static float32_t knotsY[MAX_POINTS];
+static float32_t coeffs[3 * (MAX_POINTS - 1)];
+static float32_t tempBuffer[2 * MAX_POINTS - 1];
+static float32_t sortedX[NUM_QUERIES];
+static float32_t shuffledX[NUM_QUERIES];
+static uint32_t order[NUM_QUERIES];
+static float32_t refOutput[NUM_QUERIES];
+static float32_t testOutput[NUM_QUERIES];
+static float32_t shuffledOutput[NUM_QUERIES];
+static uint32_t sortIndex[NUM_QUERIES];
+static uint32_t sortBuffer[3 * NUM_QUERIES];
+
+/* ----------------------------------------------------------------------
+* Pseudo random values in [-0.5, 0.5)
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345U;
+
+static float32_t random_f32(void)
+{
+  seed = (seed * 1664525U) + 1013904223U;
+  return ((float32_t)(seed >> 8) / 16777216.0f) - 0.5f;
+}
+
+/* ----------------------------------------------------------------------
+* Signal to noise ratio in dB
+* ------------------------------------------------------------------- */
+static float32_t snr_f32(const float32_t *pRef, const float32_t *pTest, uint32_t length)
+{
+  float64_t signal = 0.0;
+  float64_t noise = 0.0;
+  uint32_t i;
+
+  for (i = 0U; i < length; i++)
+  {
+    signal += (float64_t)pRef[i] * pRef[i];
+    noise += ((float64_t)pRef[i] - pTest[i]) * ((float64_t)pRef[i] - pTest[i]);
+  }
+
+  return (noise == 0.0) ? 300.0f : (float32_t)(10.0 * log10(signal / noise));
+}
+
+/* ----------------------------------------------------------------------
+* Known points, evenly spaced or with random steps from 0.2 to 1.8
+* ------------------------------------------------------------------- */
+static void make_points(uint32_t numPoints, int32_t even)
+{
+  uint32_t i;
+
+  knotsX[0] = -3.0f;
+  knotsY[0] = random_f32();
+  for (i = 1U; i < numPoints; i++)
+  {
+    knotsX[i] = (even != 0) ? (-3.0f + (float32_t)i) : (knotsX[i - 1U] + 1.0f + (1.6f * random_f32()));
+    knotsY[i] = random_f32();
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Sorted x values from 2 units before the first point to 2 units after the
+* last one, every known x value included, and a random permutation
+* ------------------------------------------------------------------- */
+static void make_queries(uint32_t numPoints)
+{
+  const float32_t start = knotsX[0] - 2.0f;
+  const float32_t step = ((knotsX[numPoints - 1U] + 2.0f) - start) / (float32_t)NUM_QUERIES;
+  uint32_t i;
+  uint32_t j;
+  uint32_t tmp;
+
+  for (i = 0U; i < NUM_QUERIES; i++)
+  {
+    sortedX[i] = start + ((float32_t)i * step);
+  }
+
+  /* Replace the closest sorted value by every known value */
+  for (i = 0U; i < numPoints; i++)
+  {
+    j = (uint32_t)((knotsX[i] - start) / step);
+    sortedX[j] = knotsX[i];
+  }
+
+  for (i = 0U; i < NUM_QUERIES; i++)
+  {
+    order[i] = i;
+  }
+  for (i = NUM_QUERIES - 1U; i > 0U; i--)
+  {
+    j = (uint32_t)((random_f32() + 0.5f) * (float32_t)(i + 1U));
+    tmp = order[i];
+    order[i] = order[j];
+    order[j] = tmp;
+  }
+  for (i = 0U; i < NUM_QUERIES; i++)
+  {
+    shuffledX[i] = sortedX[order[i]];
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Sorted and shuffled x values against arm_spline_f32()
+* ------------------------------------------------------------------- */
+static arm_status check_spline(uint32_t numPoints, int32_t even, arm_spline_type type)
+{
+  arm_spline_instance_f32 S;
+  uint32_t i;
+  int32_t sameShuffled = 1;
+  float32_t snr;
+
+  make_points(numPoints, even);
+  arm_spline_init_f32(&S, type, knotsX, knotsY, numPoints, coeffs, tempBuffer);
+  make_queries(numPoints);
+
+  arm_spline_f32(&S, sortedX, refOutput, NUM_QUERIES);
+  arm_spline_batch_f32(&S, sortedX, testOutput, NUM_QUERIES);
+  snr = snr_f32(refOutput, testOutput, NUM_QUERIES);
+
+  arm_spline_batch_f32(&S, shuffledX, shuffledOutput, NUM_QUERIES);
+  for (i = 0U; i < NUM_QUERIES; i++)
+  {
+    if (shuffledOutput[i] != testOutput[order[i]])
+    {
+      sameShuffled = 0;
+    }
+  }
+
+  printf("%4u points %-7s %-9s  invStep %6.3f  SNR %6.1f dB  shuffled %s\n",
+         (unsigned)numPoints, (even != 0) ? "even" : "random",
+         (type == ARM_SPLINE_NATURAL) ? "natural" : "parabolic",
+         S.invStep, snr, (sameShuffled != 0) ? "same" : "DIFFERENT");
+
+  /* Evenly spaced points select the grid path, many random ones the search */
+  if ((snr < SNR_THRESHOLD) || (sameShuffled == 0) ||
+      ((even != 0) && (S.invStep == 0.0f)) ||
+      ((even == 0) && (numPoints >= 16U) && (S.invStep != 0.0f)))
+  {
+    return ARM_MATH_TEST_FAILURE;
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------
+* Time per interpolated value in ns
+* ------------------------------------------------------------------- */
+static void bench_spline(uint32_t numPoints, int32_t even, float64_t *pTimes)
+{
+  arm_spline_instance_f32 S;
+  arm_sort_instance_f32 sort;
+  clock_t start;
+  uint32_t loop;
+  uint32_t i;
+
+  make_points(numPoints, even);
+  arm_spline_init_f32(&S, ARM_SPLINE_NATURAL, knotsX, knotsY, numPoints, coeffs, tempBuffer);
+  make_queries(numPoints);
+
+  start = clock();
+  for (loop = 0U; loop < BENCH_LOOPS; loop++)
+  {
+    arm_spline_batch_f32(&S, shuffledX, testOutput, NUM_QUERIES);
+  }
+  pTimes[0] = ((float64_t)(clock() - start) * 1e9) / ((float64_t)CLOCKS_PER_SEC * BENCH_LOOPS * NUM_QUERIES);
+
+  start = clock();
+  for (loop = 0U; loop < BENCH_LOOPS; loop++)
+  {
+    arm_spline_f32(&S, sortedX, refOutput, NUM_QUERIES);
+  }
+  pTimes[1] = ((float64_t)(clock() - start) * 1e9) / ((float64_t)CLOCKS_PER_SEC * BENCH_LOOPS * NUM_QUERIES);
+
+  /* Random values sorted first, outputs put back in the input order */
+  arm_sort_init_buffer_f32(&sort, ARM_SORT_RADIX, ARM_SORT_ASCENDING, sortBuffer);
+  start = clock();
+  for (loop = 0U; loop < BENCH_LOOPS; loop++)
+  {
+    arm_argsort_f32(&sort, shuffledX, sortIndex, NUM_QUERIES);
+    for (i = 0U; i < NUM_QUERIES; i++)
+    {
+      sortedX[i] = shuffledX[sortIndex[i]];
+    }
+    arm_spline_f32(&S, sortedX, refOutput, NUM_QUERIES);
+    for (i = 0U; i < NUM_QUERIES; i++)
+    {
+      testOutput[sortIndex[i]] = refOutput[i];
+    }
+  }
+  pTimes[2] = ((float64_t)(clock() - start) * 1e9) / ((float64_t)CLOCKS_PER_SEC * BENCH_LOOPS * NUM_QUERIES);
+}
+
+int32_t main(void)
+{
+  static const uint32_t testPoints[] = { 3U, 5U, 16U, 100U, 1024U };
+  arm_status status = ARM_MATH_SUCCESS;
+  float64_t timesEven[3];
+  float64_t timesRandom[3];
+  uint32_t numPoints;
+  uint32_t i;
+
+  printf("START\n");
+
+  /* A single interval: the parabolic runout spline is not defined */
+  if ((check_spline(2U, 1, ARM_SPLINE_NATURAL) != ARM_MATH_SUCCESS) ||
+      (check_spline(2U, 0, ARM_SPLINE_NATURAL) != ARM_MATH_SUCCESS))
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  for (i = 0U; i < (sizeof(testPoints) / sizeof(testPoints[0])); i++)
+  {
+    if ((check_spline(testPoints[i], 1, ARM_SPLINE_NATURAL) != ARM_MATH_SUCCESS) ||
+        (check_spline(testPoints[i], 1, ARM_SPLINE_PARABOLIC_RUNOUT) != ARM_MATH_SUCCESS) ||
+        (check_spline(testPoints[i], 0, ARM_SPLINE_NATURAL) != ARM_MATH_SUCCESS) ||
+        (check_spline(testPoints[i], 0, ARM_SPLINE_PARABOLIC_RUNOUT) != ARM_MATH_SUCCESS))
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+
+  printf("\nns per value, %u values\n", NUM_QUERIES);
+  printf("         evenly spaced points              random points\n");
+  printf("points   batch    sorted   argsort      batch    sorted   argsort\n");
+  for (numPoints = 16U; numPoints <= MAX_POINTS; numPoints <<= 2U)
+  {
+    bench_spline(numPoints, 1, timesEven);
+    bench_spline(numPoints, 0, timesRandom);
+    printf("%6u %7.2f %9.2f %9.2f  %9.2f %9.2f %9.2f\n", (unsigned)numPoints,
+           timesEven[0], timesEven[1], timesEven[2], timesRandom[0], timesRandom[1], timesRandom[2]);
+  }
+
+  printf((status == ARM_MATH_SUCCESS) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (status == ARM_MATH_SUCCESS) ? 0 : 1;
+}
+
+ /** \endlink */
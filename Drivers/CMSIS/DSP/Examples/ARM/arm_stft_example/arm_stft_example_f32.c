@@ -0,0 +1,330 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_example_f32.c
+ * Description:  Streaming STFT and MFCC accuracy check and throughput benchmark
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup StftExample Streaming STFT Example
+ *
+ * \par Description:
+ * \par
+ * Pushes a test signal in blocks of varying length to arm_stft_f32() and checks
+ * every magnitude and MFCC frame against the separate calls: window multiply,
+ * arm_rfft_fast_f32() and arm_cmplx_mag_f32(), or arm_mfcc_f32() on a copy of the
+ * frame. Then measures the throughput in frames per second of both approaches.
+ *
+ * \par
+ * The Hann window, Mel filters (triangular, on the Mel scale) and DCT-II matrix
+ * are computed at run time. The time is measured with the C library clock(): run
+ * on the host or with semihosting.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_hanning_f32()
+ * - arm_mfcc_init_f32()
+ * - arm_mfcc_f32()
+ * - arm_rfft_fast_f32()
+ * - arm_cmplx_mag_f32()
+ * - arm_stft_arena_size_f32()
+ * - arm_stft_init_f32()
+ * - arm_stft_mfcc_init_f32()
+ * - arm_stft_f32()
+ *
+ * @} */
+
+#include "arm_math.h"
+#include <stdio.h>
+#include <time.h>
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define FFT_LEN         512
+#define HOP_LEN         160
+#define NB_MEL          40
+#define NB_DCT          13
+#define SAMPLE_RATE     16000.0f
+#define SIGNAL_LEN      32000
+#define MAX_FRAMES      (((SIGNAL_LEN - FFT_LEN) / HOP_LEN) + 1)
+#define BENCH_ROUNDS    20
+#define ABS_ERROR       1.0e-3f
+
+/* ----------------------------------------------------------------------
+* Declare buffers
+* ------------------------------------------------------------------- */
+static float32_t window[FFT_LEN];
+static float32_t dctCoefs[NB_DCT * NB_MEL];
+static float32_t melCoefs[FFT_LEN];
+static uint32_t  melPos[NB_MEL];
+static uint32_t  melLengths[NB_MEL];
+static float32_t signal[SIGNAL_LEN];
+static float32_t arena[(3 * FFT_LEN) + 2];
+static float32_t frame[FFT_LEN];
+static float32_t tmp[FFT_LEN + 2];
+static float32_t streamOut[MAX_FRAMES * ((FFT_LEN / 2) + 1)];
+static float32_t refOut[(FFT_LEN / 2) + 1];
+
+static arm_mfcc_instance_f32 mfcc;
+static arm_rfft_fast_instance_f32 rfft;
+static arm_stft_instance_f32 stft;
+
+/* ----------------------------------------------------------------------
+* Pseudo random numbers
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345U;
+
+static uint32_t random_u32(void)
+{
+  seed = (seed * 1664525U) + 1013904223U;
+  return seed >> 8;
+}
+
+static float32_t mel(float32_t freq)
+{
+  return 1127.0f * logf(1.0f + (freq / 700.0f));
+}
+
+/* ----------------------------------------------------------------------
+* Mel filter bank and DCT-II matrix in the arm_mfcc_init_f32() format
+* ------------------------------------------------------------------- */
+static void make_mfcc_tables(void)
+{
+  float32_t edges[NB_MEL + 2];
+  float32_t melMax = mel(SAMPLE_RATE / 2.0f);
+  float32_t m;
+  uint32_t filt;
+  uint32_t bin;
+  uint32_t nbCoefs = 0U;
+
+  for (filt = 0U; filt < (NB_MEL + 2U); filt++)
+  {
+    /* Filter edges in bins */
+    m = (melMax * (float32_t)filt) / (float32_t)(NB_MEL + 1);
+    edges[filt] = (700.0f * (expf(m / 1127.0f) - 1.0f)) * (float32_t)FFT_LEN / SAMPLE_RATE;
+  }
+
+  for (filt = 0U; filt < NB_MEL; filt++)
+  {
+    melPos[filt] = (uint32_t)ceilf(edges[filt]);
+    melLengths[filt] = 0U;
+    for (bin = melPos[filt]; (float32_t)bin < edges[filt + 2U]; bin++)
+    {
+      if ((float32_t)bin <= edges[filt + 1U])
+      {
+        melCoefs[nbCoefs] = ((float32_t)bin - edges[filt]) / (edges[filt + 1U] - edges[filt]);
+      }
+      else
+      {
+        melCoefs[nbCoefs] = (edges[filt + 2U] - (float32_t)bin) / (edges[filt + 2U] - edges[filt + 1U]);
+      }
+      nbCoefs++;
+      melLengths[filt]++;
+    }
+  }
+
+  for (filt = 0U; filt < NB_DCT; filt++)
+  {
+    for (bin = 0U; bin < NB_MEL; bin++)
+    {
+      dctCoefs[(filt * NB_MEL) + bin] = sqrtf(2.0f / NB_MEL) *
+        cosf((PI / NB_MEL) * ((float32_t)bin + 0.5f) * (float32_t)filt);
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Reference feature of the frame starting at pos, with separate calls
+* ------------------------------------------------------------------- */
+static void reference_frame(arm_stft_feature feature, uint32_t pos, float32_t *pDst)
+{
+  if (feature == ARM_STFT_MFCC)
+  {
+    arm_copy_f32(&signal[pos], frame, FFT_LEN);
+    arm_mfcc_f32(&mfcc, frame, pDst, tmp);
+  }
+  else
+  {
+    arm_mult_f32(&signal[pos], window, frame, FFT_LEN);
+    arm_rfft_fast_f32(&rfft, frame, tmp, 0);
+    tmp[FFT_LEN] = tmp[1];
+    tmp[FFT_LEN + 1] = 0.0f;
+    tmp[1] = 0.0f;
+    arm_cmplx_mag_f32(tmp, pDst, (FFT_LEN / 2) + 1);
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Streams the signal in blocks of random length and checks every frame
+* ------------------------------------------------------------------- */
+static uint32_t stream_signal(uint32_t maxBlock)
+{
+  uint32_t pos = 0U;
+  uint32_t frames = 0U;
+  uint32_t nbFrames;
+  uint32_t blkCnt;
+  uint32_t maxFrames;
+
+  while (pos < SIGNAL_LEN)
+  {
+    blkCnt = (maxBlock > 1U) ? (1U + (random_u32() % maxBlock)) : 1U;
+    blkCnt = (blkCnt > (SIGNAL_LEN - pos)) ? (SIGNAL_LEN - pos) : blkCnt;
+    /* Sometimes less output space than needed */
+    maxFrames = (random_u32() % 4U == 0U) ? 1U : (MAX_FRAMES - frames);
+
+    pos += arm_stft_f32(&stft, &signal[pos], blkCnt, &streamOut[frames * stft.frameSize], maxFrames, &nbFrames);
+    frames += nbFrames;
+  }
+  /* Frame completed by the last sample */
+  (void)arm_stft_f32(&stft, NULL, 0U, &streamOut[frames * stft.frameSize], 1U, &nbFrames);
+
+  return frames + nbFrames;
+}
+
+static arm_status check_stream(arm_stft_feature feature, uint32_t maxBlock)
+{
+  uint32_t frames;
+  uint32_t k;
+  uint32_t i;
+  float32_t maxError = 0.0f;
+  float32_t err;
+
+  arm_stft_reset_f32(&stft);
+  frames = stream_signal(maxBlock);
+  if (frames != MAX_FRAMES)
+  {
+    printf("%u frames instead of %u\n", (unsigned)frames, (unsigned)MAX_FRAMES);
+    return ARM_MATH_TEST_FAILURE;
+  }
+
+  for (k = 0U; k < frames; k++)
+  {
+    reference_frame(feature, k * HOP_LEN, refOut);
+    for (i = 0U; i < stft.frameSize; i++)
+    {
+      err = fabsf(refOut[i] - streamOut[(k * stft.frameSize) + i]) / (1.0f + fabsf(refOut[i]));
+      maxError = (err > maxError) ? err : maxError;
+    }
+  }
+
+  printf("%s blocks up to %4u: %u frames, max error %g\n",
+         (feature == ARM_STFT_MFCC) ? "mfcc     " : "magnitude", (unsigned)maxBlock, (unsigned)frames, maxError);
+
+  return (maxError < ABS_ERROR) ? ARM_MATH_SUCCESS : ARM_MATH_TEST_FAILURE;
+}
+
+/* ----------------------------------------------------------------------
+* Frames per second, separate calls and streaming
+* ------------------------------------------------------------------- */
+static void bench(arm_stft_feature feature)
+{
+  clock_t start;
+  float64_t separate;
+  float64_t streaming;
+  uint32_t round;
+  uint32_t k;
+  uint32_t nbFrames;
+
+  start = clock();
+  for (round = 0U; round < BENCH_ROUNDS; round++)
+  {
+    for (k = 0U; k < MAX_FRAMES; k++)
+    {
+      reference_frame(feature, k * HOP_LEN, refOut);
+    }
+  }
+  separate = ((float64_t)BENCH_ROUNDS * MAX_FRAMES * CLOCKS_PER_SEC) / (float64_t)(clock() - start + 1);
+
+  start = clock();
+  for (round = 0U; round < BENCH_ROUNDS; round++)
+  {
+    arm_stft_reset_f32(&stft);
+    (void)arm_stft_f32(&stft, signal, SIGNAL_LEN, streamOut, MAX_FRAMES, &nbFrames);
+  }
+  streaming = ((float64_t)BENCH_ROUNDS * MAX_FRAMES * CLOCKS_PER_SEC) / (float64_t)(clock() - start + 1);
+
+  printf("%s: separate calls %10.0f frames/s, streaming %10.0f frames/s\n",
+         (feature == ARM_STFT_MFCC) ? "mfcc     " : "magnitude", separate, streaming);
+}
+
+int32_t main(void)
+{
+  static const uint32_t maxBlocks[] = { 1U, 7U, 160U, 1000U, SIGNAL_LEN };
+  arm_status status = ARM_MATH_SUCCESS;
+  uint32_t i;
+
+  printf("START\n");
+
+  for (i = 0U; i < SIGNAL_LEN; i++)
+  {
+    signal[i] = (0.5f * sinf(0.05f * (float32_t)i)) + ((float32_t)random_u32() / 33554432.0f) - 0.25f;
+  }
+
+  arm_hanning_f32(window, FFT_LEN);
+  make_mfcc_tables();
+  if ((arm_mfcc_init_f32(&mfcc, FFT_LEN, NB_MEL, NB_DCT, dctCoefs, melPos, melLengths, melCoefs, window) != ARM_MATH_SUCCESS) ||
+      (arm_rfft_fast_init_f32(&rfft, FFT_LEN) != ARM_MATH_SUCCESS) ||
+      (arm_stft_arena_size_f32(FFT_LEN) > (sizeof(arena) / sizeof(arena[0]))))
+  {
+    printf("FAILURE\n");
+    return 1;
+  }
+
+  if (arm_stft_init_f32(&stft, FFT_LEN, HOP_LEN, ARM_STFT_MAGNITUDE, window, arena) != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+  for (i = 0U; i < (sizeof(maxBlocks) / sizeof(maxBlocks[0])); i++)
+  {
+    if (check_stream(ARM_STFT_MAGNITUDE, maxBlocks[i]) != ARM_MATH_SUCCESS)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+  bench(ARM_STFT_MAGNITUDE);
+
+  if (arm_stft_mfcc_init_f32(&stft, &mfcc, HOP_LEN, arena) != ARM_MATH_SUCCESS)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+  for (i = 0U; i < (sizeof(maxBlocks) / sizeof(maxBlocks[0])); i++)
+  {
+    if (check_stream(ARM_STFT_MFCC, maxBlocks[i]) != ARM_MATH_SUCCESS)
+    {
+      status = ARM_MATH_TEST_FAILURE;
+    }
+  }
+  bench(ARM_STFT_MFCC);
+
+  printf((status == ARM_MATH_SUCCESS) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (status == ARM_MATH_SUCCESS) ? 0 : 1;
+}
+
+ /** \endlink */
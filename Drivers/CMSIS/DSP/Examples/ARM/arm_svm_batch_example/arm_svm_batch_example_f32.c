@@ -0,0 +1,278 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_svm_batch_example_f32.c
+ * Description:  SVM and Bayes batch prediction accuracy check and throughput benchmark
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores, host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup groupExamples
+ * @{
+ *
+ * @defgroup SvmBatchExample SVM and Bayes Batch Prediction Example
+ *
+ * \par Description:
+ * \par
+ * Classifies the same random input vectors with the single vector SVM and
+ * naive Gaussian Bayes predictions and with their batch versions, counts the
+ * different decisions, then prints the number of vectors classified per second
+ * by both approaches.
+ *
+ * \par
+ * The decisions can differ for inputs whose decision value is within rounding
+ * of the threshold: the test fails when more than <code>MAX_MISMATCH</code>
+ * decisions out of <code>NB_VECTORS</code> differ.
+ *
+ * \par
+ * The time is measured with the C library clock(): run on the host or with
+ * semihosting.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_svm_linear_init_f32()
+ * - arm_svm_polynomial_init_f32()
+ * - arm_svm_rbf_init_f32()
+ * - arm_svm_sigmoid_init_f32()
+ * - arm_svm_linear_predict_f32()
+ * - arm_svm_polynomial_predict_f32()
+ * - arm_svm_rbf_predict_f32()
+ * - arm_svm_sigmoid_predict_f32()
+ * - arm_svm_predict_batch_scratch_size_f32()
+ * - arm_svm_linear_predict_batch_f32()
+ * - arm_svm_polynomial_predict_batch_f32()
+ * - arm_svm_rbf_predict_batch_f32()
+ * - arm_svm_sigmoid_predict_batch_f32()
+ * - arm_gaussian_naive_bayes_predict_f32()
+ * - arm_gaussian_naive_bayes_predict_batch_scratch_size_f32()
+ * - arm_gaussian_naive_bayes_predict_batch_f32()
+ *
+ * @} */
+
+#include "arm_math.h"
+#include <stdio.h>
+#include <time.h>
+
+/* ----------------------------------------------------------------------
+* Defines each of the tests performed
+* ------------------------------------------------------------------- */
+#define NB_SUPPORT_VECTORS  64
+#define VECTOR_DIMENSION    16
+#define NB_CLASSES          8
+#define NB_VECTORS          4096
+#define BENCH_REPEAT        8
+#define MAX_MISMATCH        (NB_VECTORS / 1000)
+#define SCRATCH_SIZE        (NB_SUPPORT_VECTORS * (VECTOR_DIMENSION + 1 + ARM_SVM_BATCH_ROWS) + ARM_SVM_BATCH_ROWS)
+
+/* ----------------------------------------------------------------------
+* Declare model and I/O buffers
+* ------------------------------------------------------------------- */
+static float32_t supportVectors[NB_SUPPORT_VECTORS * VECTOR_DIMENSION];
+static float32_t dualCoefficients[NB_SUPPORT_VECTORS];
+static const int32_t classes[2] = { -1, 1 };
+static float32_t theta[NB_CLASSES * VECTOR_DIMENSION];
+static float32_t sigma[NB_CLASSES * VECTOR_DIMENSION];
+static float32_t classPriors[NB_CLASSES];
+static float32_t input[NB_VECTORS * VECTOR_DIMENSION];
+static float32_t scratch[SCRATCH_SIZE];
+static float32_t probabilities[NB_CLASSES];
+static int32_t refResult[NB_VECTORS];
+static int32_t testResult[NB_VECTORS];
+static uint32_t refClass[NB_VECTORS];
+static uint32_t testClass[NB_VECTORS];
+
+static arm_svm_linear_instance_f32 linearSvm;
+static arm_svm_polynomial_instance_f32 polySvm;
+static arm_svm_rbf_instance_f32 rbfSvm;
+static arm_svm_sigmoid_instance_f32 sigmoidSvm;
+static arm_gaussian_naive_bayes_instance_f32 bayes;
+
+/* ----------------------------------------------------------------------
+* Pseudo random values in [-0.5, 0.5)
+* ------------------------------------------------------------------- */
+static uint32_t seed = 12345U;
+
+static float32_t random_f32(void)
+{
+  seed = (seed * 1664525U) + 1013904223U;
+  return ((float32_t)(seed >> 8) / 16777216.0f) - 0.5f;
+}
+
+/* ----------------------------------------------------------------------
+* Vectors per second of NB_VECTORS * BENCH_REPEAT classifications
+* ------------------------------------------------------------------- */
+static float64_t rate(clock_t start)
+{
+  float64_t seconds = (float64_t)(clock() - start) / (float64_t)CLOCKS_PER_SEC;
+
+  return (seconds > 0.0) ? ((float64_t)NB_VECTORS * BENCH_REPEAT) / seconds : 0.0;
+}
+
+/* ----------------------------------------------------------------------
+* Decisions of one SVM kernel: single vector calls against one batch call
+* ------------------------------------------------------------------- */
+#define CHECK_SVM(NAME, INSTANCE)                                                     \
+  {                                                                                   \
+    uint32_t mismatch = 0U;                                                           \
+    float64_t single;                                                                 \
+    float64_t batch;                                                                  \
+    clock_t start;                                                                    \
+    uint32_t r;                                                                       \
+                                                                                      \
+    for (i = 0U; i < NB_VECTORS; i++)                                                 \
+    {                                                                                 \
+      arm_svm_##NAME##_predict_f32(&INSTANCE, &input[i * VECTOR_DIMENSION], &refResult[i]); \
+    }                                                                                 \
+    arm_svm_##NAME##_predict_batch_f32(&INSTANCE, input, NB_VECTORS, scratch, testResult); \
+    for (i = 0U; i < NB_VECTORS; i++)                                                 \
+    {                                                                                 \
+      mismatch += (refResult[i] != testResult[i]) ? 1U : 0U;                          \
+    }                                                                                 \
+                                                                                      \
+    start = clock();                                                                  \
+    for (r = 0U; r < BENCH_REPEAT; r++)                                               \
+    {                                                                                 \
+      for (i = 0U; i < NB_VECTORS; i++)                                               \
+      {                                                                               \
+        arm_svm_##NAME##_predict_f32(&INSTANCE, &input[i * VECTOR_DIMENSION], &refResult[i]); \
+      }                                                                               \
+    }                                                                                 \
+    single = rate(start);                                                             \
+    start = clock();                                                                  \
+    for (r = 0U; r < BENCH_REPEAT; r++)                                               \
+    {                                                                                 \
+      arm_svm_##NAME##_predict_batch_f32(&INSTANCE, input, NB_VECTORS, scratch, testResult); \
+    }                                                                                 \
+    batch = rate(start);                                                              \
+                                                                                      \
+    printf("%-10s mismatch %4u  single %10.0f  batch %10.0f vectors/s\n",            \
+           #NAME, (unsigned)mismatch, single, batch);                                 \
+    if (mismatch > MAX_MISMATCH)                                                      \
+    {                                                                                 \
+      status = ARM_MATH_TEST_FAILURE;                                                 \
+    }                                                                                 \
+  }
+
+int32_t main(void)
+{
+  arm_status status = ARM_MATH_SUCCESS;
+  uint32_t mismatch = 0U;
+  float64_t single;
+  float64_t batch;
+  clock_t start;
+  uint32_t r;
+  uint32_t i;
+
+  printf("START\n");
+
+  if ((arm_svm_predict_batch_scratch_size_f32(NB_SUPPORT_VECTORS, VECTOR_DIMENSION) > SCRATCH_SIZE) ||
+      (arm_gaussian_naive_bayes_predict_batch_scratch_size_f32(VECTOR_DIMENSION, NB_CLASSES) > SCRATCH_SIZE))
+  {
+    printf("FAILURE\n");
+    return 1;
+  }
+
+  /* Random model, inputs in the range of the support vectors */
+  for (i = 0U; i < (NB_SUPPORT_VECTORS * VECTOR_DIMENSION); i++)
+  {
+    supportVectors[i] = 2.0f * random_f32();
+  }
+  for (i = 0U; i < NB_SUPPORT_VECTORS; i++)
+  {
+    dualCoefficients[i] = random_f32();
+  }
+  for (i = 0U; i < (NB_VECTORS * VECTOR_DIMENSION); i++)
+  {
+    input[i] = 2.0f * random_f32();
+  }
+
+  arm_svm_linear_init_f32(&linearSvm, NB_SUPPORT_VECTORS, VECTOR_DIMENSION, 0.1f,
+                          dualCoefficients, supportVectors, classes);
+  arm_svm_polynomial_init_f32(&polySvm, NB_SUPPORT_VECTORS, VECTOR_DIMENSION, 0.1f,
+                              dualCoefficients, supportVectors, classes, 3, 0.5f, 0.25f);
+  arm_svm_rbf_init_f32(&rbfSvm, NB_SUPPORT_VECTORS, VECTOR_DIMENSION, 0.1f,
+                       dualCoefficients, supportVectors, classes, 0.2f);
+  arm_svm_sigmoid_init_f32(&sigmoidSvm, NB_SUPPORT_VECTORS, VECTOR_DIMENSION, 0.1f,
+                           dualCoefficients, supportVectors, classes, 0.5f, 0.25f);
+
+  CHECK_SVM(linear, linearSvm)
+  CHECK_SVM(polynomial, polySvm)
+  CHECK_SVM(rbf, rbfSvm)
+  CHECK_SVM(sigmoid, sigmoidSvm)
+
+  /* Naive Gaussian Bayes with random class means and variances */
+  for (i = 0U; i < (NB_CLASSES * VECTOR_DIMENSION); i++)
+  {
+    theta[i] = 2.0f * random_f32();
+    sigma[i] = 0.5f + random_f32();
+  }
+  for (i = 0U; i < NB_CLASSES; i++)
+  {
+    classPriors[i] = 1.0f / NB_CLASSES;
+  }
+  bayes.vectorDimension = VECTOR_DIMENSION;
+  bayes.numberOfClasses = NB_CLASSES;
+  bayes.theta = theta;
+  bayes.sigma = sigma;
+  bayes.classPriors = classPriors;
+  bayes.epsilon = 1e-9f;
+
+  for (i = 0U; i < NB_VECTORS; i++)
+  {
+    refClass[i] = arm_gaussian_naive_bayes_predict_f32(&bayes, &input[i * VECTOR_DIMENSION], probabilities, NULL);
+  }
+  arm_gaussian_naive_bayes_predict_batch_f32(&bayes, input, NB_VECTORS, scratch, testClass);
+  for (i = 0U; i < NB_VECTORS; i++)
+  {
+    mismatch += (refClass[i] != testClass[i]) ? 1U : 0U;
+  }
+
+  start = clock();
+  for (r = 0U; r < BENCH_REPEAT; r++)
+  {
+    for (i = 0U; i < NB_VECTORS; i++)
+    {
+      refClass[i] = arm_gaussian_naive_bayes_predict_f32(&bayes, &input[i * VECTOR_DIMENSION], probabilities, NULL);
+    }
+  }
+  single = rate(start);
+  start = clock();
+  for (r = 0U; r < BENCH_REPEAT; r++)
+  {
+    arm_gaussian_naive_bayes_predict_batch_f32(&bayes, input, NB_VECTORS, scratch, testClass);
+  }
+  batch = rate(start);
+
+  printf("%-10s mismatch %4u  single %10.0f  batch %10.0f vectors/s\n",
+         "bayes", (unsigned)mismatch, single, batch);
+  if (mismatch > MAX_MISMATCH)
+  {
+    status = ARM_MATH_TEST_FAILURE;
+  }
+
+  printf((status == ARM_MATH_SUCCESS) ? "SUCCESS\n" : "FAILURE\n");
+
+  return (status == ARM_MATH_SUCCESS) ? 0 : 1;
+}
+
+ /** \endlink */
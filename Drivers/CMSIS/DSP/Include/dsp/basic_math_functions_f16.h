@@ -118,6 +118,32 @@ extern "C"
         uint32_t blockSize,
         float16_t * result);
 
+  /**
+   * @brief Dot product of half-precision vectors accumulated in single precision.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @param[out] result     output result returned here
+   */
+  void arm_dot_prod_f16_f32(
+  const float16_t * pSrcA,
+  const float16_t * pSrcB,
+        uint32_t blockSize,
+        float32_t * result);
+
+  /**
+   * @brief Dot product of half-precision vectors accumulated in single precision, half-precision result.
+   * @param[in]  pSrcA      points to the first input vector
+   * @param[in]  pSrcB      points to the second input vector
+   * @param[in]  blockSize  number of samples in each vector
+   * @param[out] result     output result returned here
+   */
+  void arm_dot_prod_acc32_f16(
+  const float16_t * pSrcA,
+  const float16_t * pSrcB,
+        uint32_t blockSize,
+        float16_t * result);
+
   /**
    * @brief Floating-point vector multiplication.
    * @param[in]  pSrcA      points to the first input vector
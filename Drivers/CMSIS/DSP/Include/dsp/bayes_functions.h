@@ -78,6 +78,36 @@ uint32_t arm_gaussian_naive_bayes_predict_f32(const arm_gaussian_naive_bayes_ins
    float32_t *pOutputProbabilities,
    float32_t *pBufferB);
 
+/**
+ * @brief Number of input vectors per block of the batch Naive Gaussian Bayesian Estimator
+ */
+#define ARM_BAYES_BATCH_ROWS 16U
+
+/**
+ * @brief Size of the scratch buffer of the batch Naive Gaussian Bayesian Estimator
+ *
+ * @param[in]  vectorDimension  dimension of vector space
+ * @param[in]  numberOfClasses  number of different classes
+ * @return Number of float32_t values of the pScratch argument
+ */
+uint32_t arm_gaussian_naive_bayes_predict_batch_scratch_size_f32(uint32_t vectorDimension,
+   uint32_t numberOfClasses);
+
+/**
+ * @brief Naive Gaussian Bayesian Estimator of several input vectors
+ *
+ * @param[in]  S           points to a naive bayes instance structure
+ * @param[in]  in          points to numVectors input vectors
+ * @param[in]  numVectors  number of input vectors
+ * @param[in]  pScratch    points to the scratch buffer
+ * @param[out] pResult     points to the numVectors predicted classes
+ */
+void arm_gaussian_naive_bayes_predict_batch_f32(const arm_gaussian_naive_bayes_instance_f32 *S,
+   const float32_t * in,
+   uint32_t numVectors,
+   float32_t * pScratch,
+   uint32_t * pResult);
+
 
 #ifdef   __cplusplus
 }
@@ -335,6 +335,7 @@ float32_t arm_yule_distance(const uint32_t *pA, const uint32_t *pB, uint32_t num
 
 typedef enum
   {
+    ARM_DTW_NO_WINDOW = 0,
     ARM_DTW_SAKOE_CHIBA_WINDOW = 1,
     /*ARM_DTW_ITAKURA_WINDOW = 2,*/
     ARM_DTW_SLANTED_BAND_WINDOW = 3
@@ -379,6 +380,170 @@ arm_status arm_dtw_distance_f32(const arm_matrix_instance_f32 *pDistance,
 void arm_dtw_path_f32(const arm_matrix_instance_f32 *pDTW,
                       int16_t *pPath,
                       uint32_t *pathLength);
+
+/**
+ * @brief Local distance between two samples for the memory-bounded DTW.
+ */
+typedef enum
+  {
+    ARM_DTW_CITYBLOCK = 0,   /**< Sum of the absolute differences */
+    ARM_DTW_SQEUCLIDEAN = 1, /**< Sum of the squared differences */
+    ARM_DTW_EUCLIDEAN = 2    /**< Square root of the sum of the squared differences */
+  } arm_dtw_local_distance;
+
+/**
+ * @brief Instance structure for the memory-bounded DTW.
+ */
+typedef struct
+  {
+    uint32_t dimension;                   /**< Number of values per sample of the sequences */
+    arm_dtw_local_distance localDistance; /**< Distance between a query and a template sample */
+    arm_dtw_window windowType;            /**< Window, ARM_DTW_NO_WINDOW for none */
+    int32_t windowSize;                   /**< Window size */
+    uint32_t maxTemplateLength;           /**< Longest template supported by the buffer */
+    float32_t *pRows;                     /**< Two rows of cost, 2 * maxTemplateLength values */
+  } arm_dtw_instance_f32;
+
+/**
+ * @brief         Initialization of the memory-bounded DTW
+ * @param[out]    S                  points to the DTW instance
+ * @param[in]     dimension          number of values per sample of the sequences
+ * @param[in]     localDistance      distance between a query and a template sample
+ * @param[in]     windowType         window, ARM_DTW_NO_WINDOW for none
+ * @param[in]     windowSize         window size
+ * @param[in]     pBuffer            buffer of 2 * maxTemplateLength values
+ * @param[in]     maxTemplateLength  longest template
+ * @return Error if the window type or local distance is not recognized
+ *
+ */
+arm_status arm_dtw_init_f32(arm_dtw_instance_f32 *S,
+                            uint32_t dimension,
+                            arm_dtw_local_distance localDistance,
+                            arm_dtw_window windowType,
+                            int32_t windowSize,
+                            float32_t *pBuffer,
+                            uint32_t maxTemplateLength);
+
+/**
+ * @brief         Memory-bounded Dynamic Time Warping distance of two sequences
+ * @param[in]     S               points to the DTW instance
+ * @param[in]     pQuery          query, queryLength samples of dimension values
+ * @param[in]     queryLength     query length
+ * @param[in]     pTemplate       template, templateLength samples of dimension values
+ * @param[in]     templateLength  template length
+ * @param[in]     bestSoFar       distance above which the computation is abandoned, F32_MAX for none
+ * @param[out]    distance        distance, F32_MAX if abandoned
+ * @return Error in case no path can be found with window constraint
+ *
+ */
+arm_status arm_dtw_sequence_distance_f32(const arm_dtw_instance_f32 *S,
+                                         const float32_t *pQuery,
+                                         uint32_t queryLength,
+                                         const float32_t *pTemplate,
+                                         uint32_t templateLength,
+                                         float32_t bestSoFar,
+                                         float32_t *distance);
+
+/**
+ * @brief         Envelope of a template for arm_dtw_lb_keogh_f32()
+ * @param[in]     S               points to the DTW instance (dimension 1)
+ * @param[in]     pTemplate       template
+ * @param[in]     templateLength  template length
+ * @param[in]     queryLength     length of the queries compared to the template
+ * @param[out]    pUpper          upper envelope, queryLength values
+ * @param[out]    pLower          lower envelope, queryLength values
+ * @return Error if the dimension is not 1 or a query index has no template index in the window
+ *
+ */
+arm_status arm_dtw_envelope_f32(const arm_dtw_instance_f32 *S,
+                                const float32_t *pTemplate,
+                                uint32_t templateLength,
+                                uint32_t queryLength,
+                                float32_t *pUpper,
+                                float32_t *pLower);
+
+/**
+ * @brief         LB_Keogh lower bound of the memory-bounded DTW distance
+ * @param[in]     S               points to the DTW instance (dimension 1)
+ * @param[in]     pQuery          query
+ * @param[in]     queryLength     query length
+ * @param[in]     templateLength  template length
+ * @param[in]     pUpper          upper envelope of the template
+ * @param[in]     pLower          lower envelope of the template
+ * @param[in]     bestSoFar       bound above which the computation is stopped, F32_MAX for none
+ * @return Lower bound of the distance
+ *
+ */
+float32_t arm_dtw_lb_keogh_f32(const arm_dtw_instance_f32 *S,
+                               const float32_t *pQuery,
+                               uint32_t queryLength,
+                               uint32_t templateLength,
+                               const float32_t *pUpper,
+                               const float32_t *pLower,
+                               float32_t bestSoFar);
+
+/**
+ * @brief Number of vectors of pB per tile of arm_pairwise_distance_f32()
+ */
+#define ARM_PAIRWISE_TILE 64U
+
+/**
+ * @brief Metric of arm_pairwise_distance_f32()
+ */
+typedef enum
+{
+  ARM_PAIRWISE_EUCLIDEAN = 0,   /**< Euclidean distance */
+  ARM_PAIRWISE_SQEUCLIDEAN = 1, /**< Squared euclidean distance */
+  ARM_PAIRWISE_CITYBLOCK = 2,   /**< Cityblock (Manhattan) distance */
+  ARM_PAIRWISE_CHEBYSHEV = 3,   /**< Chebyshev distance */
+  ARM_PAIRWISE_COSINE = 4       /**< Cosine distance */
+} arm_pairwise_metric;
+
+/**
+ * @brief         Size of the scratch buffer of arm_pairwise_distance_f32()
+ * @param[in]     dimension  vector length
+ * @return Number of float32_t values of the pScratch argument
+ *
+ */
+uint32_t arm_pairwise_distance_scratch_size_f32(uint32_t dimension);
+
+/**
+ * @brief         Distance matrix between two sets of vectors
+ * @param[in]     metric     distance
+ * @param[in]     pA         numA vectors
+ * @param[in]     numA       number of vectors in pA
+ * @param[in]     pB         numB vectors
+ * @param[in]     numB       number of vectors in pB
+ * @param[in]     dimension  vector length
+ * @param[in]     pScratch   scratch buffer
+ * @param[out]    pDst       numA x numB distances, row major
+ * @return Error if the metric is unknown
+ *
+ */
+arm_status arm_pairwise_distance_f32(arm_pairwise_metric metric,
+                                     const float32_t *pA,
+                                     uint32_t numA,
+                                     const float32_t *pB,
+                                     uint32_t numB,
+                                     uint32_t dimension,
+                                     float32_t *pScratch,
+                                     float32_t *pDst);
+
+/**
+ * @brief         k smallest distances in increasing order
+ * @param[in]     pSrc       distances
+ * @param[in]     blockSize  number of distances
+ * @param[in]     k          number of values to select
+ * @param[out]    pDst       min(k, blockSize) smallest distances
+ * @param[out]    pIndex     their indexes in pSrc
+ * @return Number of selected values
+ *
+ */
+uint32_t arm_distance_topk_f32(const float32_t *pSrc,
+                               uint32_t blockSize,
+                               uint32_t k,
+                               float32_t *pDst,
+                               uint32_t *pIndex);
 #ifdef   __cplusplus
 }
 #endif
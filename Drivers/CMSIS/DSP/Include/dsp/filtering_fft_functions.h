@@ -0,0 +1,146 @@
+/******************************************************************************
+ * @file     filtering_fft_functions.h
+ * @brief    Public header file for CMSIS DSP Library
+ * @version  V1.0.0
+ * @date     19 October 2026
+ * Target Processor: Cortex-M and Cortex-A cores
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ 
+#ifndef FILTERING_FFT_FUNCTIONS_H_
+#define FILTERING_FFT_FUNCTIONS_H_
+
+#include "arm_math_types.h"
+#include "arm_math_memory.h"
+
+#include "dsp/none.h"
+#include "dsp/utils.h"
+
+#include "dsp/transform_functions.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Smallest and largest partition length of the FFT based FIR filter.
+ *        The FFT length is twice the partition length (32 to 4096).
+ */
+#define ARM_FIR_FFT_MIN_PARTITION 16U
+#define ARM_FIR_FFT_MAX_PARTITION 2048U
+
+  /**
+   * @brief Instance structure for the floating-point FFT based FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;     /**< number of filter coefficients in the filter. */
+          uint16_t numPart;     /**< number of filter partitions. */
+          uint32_t partLen;     /**< partition length, the FFT length is 2 * partLen. */
+          uint32_t inCount;     /**< input samples of the current partition already received. */
+          uint32_t outCount;    /**< output samples of the current partition already produced. */
+          uint32_t fdlIndex;    /**< slot of the newest spectrum in the frequency domain delay line. */
+          float32_t *pSpectra;  /**< filter partition spectra, numPart * 2 * partLen values. */
+          float32_t *pFdl;      /**< frequency domain delay line, (numPart - 1) * 2 * partLen values. */
+          float32_t *pWindow;   /**< time domain input window, 2 * partLen values. */
+          float32_t *pHist;     /**< contribution of the past partitions to the current one, 2 * partLen values. */
+          float32_t *pScratch;  /**< working buffer, 2 * partLen values. */
+          float32_t *pAcc;      /**< working buffer, 2 * partLen values. */
+          arm_rfft_fast_instance_f32 rfft; /**< real FFT of length 2 * partLen. */
+  } arm_fir_fft_instance_f32;
+
+  /**
+   * @brief  Partition length selected for a filter length and a block size.
+   * @param[in]  numTaps    number of filter coefficients in the filter.
+   * @param[in]  blockSize  number of samples usually processed per call.
+   * @return     partition length
+   */
+  uint32_t arm_fir_fft_partition_f32(
+        uint16_t numTaps,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Size of the buffer needed by an FFT based FIR filter.
+   * @param[in]  numTaps    number of filter coefficients in the filter.
+   * @param[in]  blockSize  number of samples usually processed per call.
+   * @return     number of float32_t values
+   */
+  uint32_t arm_fir_fft_buffer_size_f32(
+        uint16_t numTaps,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FFT based FIR filter.
+   * @param[in,out] S          points to an instance of the FFT based FIR filter structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients, time reversed as for arm_fir_f32().
+   * @param[in]     pBuffer    points to a buffer of arm_fir_fft_buffer_size_f32() values.
+   * @param[in]     blockSize  number of samples usually processed per call.
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : <code>numTaps</code> is 0
+   */
+  arm_status arm_fir_fft_init_f32(
+        arm_fir_fft_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pBuffer,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Clears the state of the floating-point FFT based FIR filter.
+   * @param[in,out] S  points to an instance of the FFT based FIR filter structure.
+   */
+  void arm_fir_fft_reset_f32(
+        arm_fir_fft_instance_f32 * S);
+
+  /**
+   * @brief Processing function for the floating-point FFT based FIR filter (overlap-save).
+   * @param[in,out] S          points to an instance of the FFT based FIR filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fir_fft_f32(
+        arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief Convolution of a sequence with the filter of an FFT based FIR instance (overlap-add).
+   * @param[in,out] S       points to an instance of the FFT based FIR filter structure, its state is cleared.
+   * @param[in]     pSrc    points to the input sequence.
+   * @param[in]     srcLen  length of the input sequence.
+   * @param[out]    pDst    points to the output sequence of length srcLen + numTaps - 1.
+   */
+  void arm_conv_fft_f32(
+        arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t srcLen,
+        float32_t * pDst);
+
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ifndef _FILTERING_FFT_FUNCTIONS_H_ */
@@ -264,6 +264,47 @@ extern "C"
         float32_t * pState,
         uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the floating-point multi-channel FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;     /**< number of filter coefficients in the filter. */
+          uint16_t numChannels; /**< number of interleaved channels. */
+          float32_t *pState;    /**< points to the state variable array. The array is of length (numTaps+blockSize-1)*numChannels. */
+    const float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_mc_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point multi-channel FIR filter.
+   * @param[in]  S          points to an instance of the floating-point multi-channel FIR structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_fir_mc_f32(
+  const arm_fir_mc_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point multi-channel FIR filter.
+   * @param[in,out] S            points to an instance of the floating-point multi-channel FIR filter structure.
+   * @param[in]     numTaps      Number of filter coefficients in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     blockSize    number of samples per channel that are processed at a time.
+   */
+  void arm_fir_mc_init_f32(
+        arm_fir_mc_instance_f32 * S,
+        uint16_t numTaps,
+        uint16_t numChannels,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
   /**
    * @brief  Initialization function for the floating-point FIR filter.
    * @param[in,out] S          points to an instance of the floating-point FIR filter structure.
@@ -1295,6 +1336,46 @@ void arm_biquad_cascade_df2T_compute_coefs_f32(
         float32_t * pState);
 
 
+  /**
+   * @brief Instance structure for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+          uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+          uint16_t numChannels;      /**< number of interleaved channels. */
+          float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    const float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_mc_df2T_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. N interleaved channels
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_biquad_cascade_mc_df2T_f32(
+  const arm_biquad_cascade_mc_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   */
+  void arm_biquad_cascade_mc_df2T_init_f32(
+        arm_biquad_cascade_mc_df2T_instance_f32 * S,
+        uint8_t numStages,
+        uint16_t numChannels,
+  const float32_t * pCoeffs,
+        float32_t * pState);
+
+
   /**
    * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
    * @param[in,out] S          points to an instance of the filter data structure.
@@ -2563,6 +2644,87 @@ void arm_levinson_durbin_q31(const q31_t *phi,
   q31_t *err,
   int nbCoefs);
 
+  /**
+   * @brief Instance structure for the floating-point rational FIR resampler.
+   */
+  typedef struct
+  {
+        uint16_t L;                    /**< upsample factor. */
+        uint16_t M;                    /**< downsample factor. */
+        uint16_t phaseLength;          /**< length of each polyphase filter component. */
+        uint32_t offset;               /**< position of the next output at the upsampled rate, from the first sample of the next block. */
+  const float32_t *pCoeffs;            /**< points to the coefficient array. The array is of length L*phaseLength. */
+        float32_t *pState;             /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+  } arm_fir_resample_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point rational FIR resampler.
+   * @param[in,out] S          points to an instance of the floating-point FIR resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients, ordered as for arm_fir_interpolate_f32().
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  largest number of input samples processed per call.
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : <code>L</code> or <code>M</code> is 0
+   *                  - \ref ARM_MATH_LENGTH_ERROR   : <code>numTaps</code> is 0 or not a multiple of <code>L</code>
+   */
+  arm_status arm_fir_resample_init_f32(
+        arm_fir_resample_instance_f32 * S,
+        uint16_t L,
+        uint16_t M,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point rational FIR resampler.
+   * @param[in,out] S          points to an instance of the floating-point FIR resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of at least (blockSize * L) / M + 1 samples.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples
+   */
+  uint32_t arm_fir_resample_f32(
+        arm_fir_resample_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Lowpass filter for the floating-point rational FIR resampler (windowed sinc).
+   * @param[in]     L          upsample factor.
+   * @param[in]     numTaps    number of filter coefficients, a multiple of <code>L</code>.
+   * @param[in]     cutoff     cutoff frequency relative to the input sample rate.
+   * @param[out]    pCoeffs    points to the <code>numTaps</code> filter coefficients.
+   */
+  void arm_fir_resample_design_f32(
+        uint16_t L,
+        uint16_t numTaps,
+        float32_t cutoff,
+        float32_t * pCoeffs);
+
+  /**
+   * @brief  Splits a resampling ratio in stages with small factors.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     maxFactor  largest upsample or downsample factor of a stage.
+   * @param[out]    pStageL    points to the upsample factors of the stages.
+   * @param[out]    pStageM    points to the downsample factors of the stages.
+   * @param[in]     maxStages  length of the <code>pStageL</code> and <code>pStageM</code> arrays.
+   * @return        number of stages, 0 if the ratio cannot be split
+   */
+  uint32_t arm_fir_resample_plan_f32(
+        uint32_t L,
+        uint32_t M,
+        uint32_t maxFactor,
+        uint16_t * pStageL,
+        uint16_t * pStageM,
+        uint32_t maxStages);
+
 #ifdef   __cplusplus
 }
 #endif
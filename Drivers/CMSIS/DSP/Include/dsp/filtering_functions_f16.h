@@ -79,6 +79,32 @@ extern "C"
         float16_t * pDst,
         uint32_t blockSize);
 
+  /**
+   * @brief Half-precision FIR filter with single-precision accumulation.
+   * @param[in]  S          points to an instance of the floating-point FIR structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_fir_f16_f32(
+  const arm_fir_instance_f16 * S,
+  const float16_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief Half-precision FIR filter with single-precision accumulation, half-precision output.
+   * @param[in]  S          points to an instance of the floating-point FIR structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_fir_acc32_f16(
+  const arm_fir_instance_f16 * S,
+  const float16_t * pSrc,
+        float16_t * pDst,
+        uint32_t blockSize);
+
 
   /**
    * @brief Instance structure for the floating-point Biquad cascade filter.
@@ -98,6 +98,29 @@ extern "C"
           const q7_t *pData;        /**< points to the data table. */
   } arm_bilinear_interp_instance_q7;
 
+#define ARM_IMAGE_RESIZE_MAX_CHANNELS 4        /**< largest number of interleaved channels of the image resize */
+#define ARM_IMAGE_RESIZE_ONE          32768U   /**< interpolation weight of 1.0 (weights in Q15) */
+
+  /**
+   * @brief Instance structure for the batched bilinear image resize of 8-bit pixels.
+   */
+  typedef struct
+  {
+          uint16_t numChannels;  /**< number of interleaved channels of a pixel (1 for Y, 3 for RGB). */
+          uint16_t cropCols;     /**< number of columns of the source region. */
+          uint16_t dstRows;      /**< number of rows of the output image. */
+          uint16_t dstCols;      /**< number of columns of the output image. */
+          uint32_t srcStride;    /**< distance between two source rows, in bytes. */
+          uint32_t srcOffset;    /**< offset of the first pixel of the source region, in bytes. */
+          uint16_t *pRowIndex;   /**< first source row of every output row, relative to the region. */
+          uint16_t *pRowWeight;  /**< weight of the second source row of every output row, in Q15. */
+          uint16_t *pColIndex;   /**< line buffer offset of the left value of every output value. */
+          uint16_t *pColWeight;  /**< weight of the right value of every output value, in Q15. */
+          uint16_t *pLine;       /**< line buffer: region row interpolated between two source rows, in Q7. */
+          float32_t scale[ARM_IMAGE_RESIZE_MAX_CHANNELS + 3];   /**< normalization scale of Q22 pixels, repeated per channel. */
+          float32_t offset[ARM_IMAGE_RESIZE_MAX_CHANNELS + 3];  /**< normalization offset, repeated per channel. */
+  } arm_image_resize_instance;
+
 
   /**
    * @brief Struct for specifying cubic spline type
@@ -118,6 +141,7 @@ extern "C"
     const float32_t * y;       /**< y values */
     uint32_t n_x;              /**< Number of known data points */
     float32_t * coeffs;        /**< Coefficients buffer (b,c, and d) */
+    float32_t invStep;         /**< 1/h when the x values are evenly spaced by h, 0 otherwise */
   } arm_spline_instance_f32;
 
 
@@ -153,6 +177,19 @@ extern "C"
           float32_t * coeffs,
           float32_t * tempBuffer);
 
+  /**
+   * @brief Floating-point cubic spline interpolation of x values in any order.
+   * @param[in]  S          points to an instance of the floating-point spline structure.
+   * @param[in]  xq         points to the x values of the interpolated data points.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples of output data.
+   */
+  void arm_spline_batch_f32(
+  const arm_spline_instance_f32 * S,
+  const float32_t * xq,
+        float32_t * pDst,
+        uint32_t blockSize);
+
 
    /**
    * @brief  Process function for the floating-point Linear Interpolation Function.
@@ -267,6 +304,85 @@ q7_t arm_linear_interp_q7(
   q31_t X,
   q31_t Y);
 
+  /**
+   * @brief  Size of the buffer of a batched bilinear image resize.
+   * @param[in]     numChannels  number of interleaved channels of a pixel.
+   * @param[in]     cropCols     number of columns of the source region.
+   * @param[in]     dstCols      number of columns of the output image.
+   * @param[in]     dstRows      number of rows of the output image.
+   * @return        number of uint16_t values of the <code>pBuffer</code> argument of arm_image_resize_init()
+   */
+  uint32_t arm_image_resize_buffer_size(
+        uint16_t numChannels,
+        uint16_t cropCols,
+        uint16_t dstCols,
+        uint16_t dstRows);
+
+  /**
+   * @brief  Initialization function for the batched bilinear image resize.
+   * @param[in,out] S            points to an instance of the image resize structure.
+   * @param[in]     numChannels  number of interleaved channels of a pixel, 1 to ARM_IMAGE_RESIZE_MAX_CHANNELS.
+   * @param[in]     srcStride    distance between two rows of the source frame, in bytes.
+   * @param[in]     cropX        first column of the source region.
+   * @param[in]     cropY        first row of the source region.
+   * @param[in]     cropCols     number of columns of the source region, at least 2.
+   * @param[in]     cropRows     number of rows of the source region, at least 2.
+   * @param[in]     dstCols      number of columns of the output image.
+   * @param[in]     dstRows      number of rows of the output image.
+   * @param[in]     pScale       points to the normalization scale of every channel, or NULL for 1.
+   * @param[in]     pOffset      points to the normalization offset of every channel, or NULL for 0.
+   * @param[in]     pBuffer      points to the buffer of arm_image_resize_buffer_size() values.
+   * @return        execution status
+   *                  - \ref ARM_MATH_SUCCESS        : Operation successful
+   *                  - \ref ARM_MATH_ARGUMENT_ERROR : unsupported number of channels or image size
+   */
+  arm_status arm_image_resize_init(
+        arm_image_resize_instance * S,
+        uint16_t numChannels,
+        uint32_t srcStride,
+        uint16_t cropX,
+        uint16_t cropY,
+        uint16_t cropCols,
+        uint16_t cropRows,
+        uint16_t dstCols,
+        uint16_t dstRows,
+  const float32_t * pScale,
+  const float32_t * pOffset,
+        uint16_t * pBuffer);
+
+  /**
+   * @brief  Batched bilinear image resize with 8-bit unsigned output.
+   * @param[in]     S     points to an instance of the image resize structure.
+   * @param[in]     pSrc  points to the source frame.
+   * @param[out]    pDst  points to the output image of dstRows * dstCols * numChannels values.
+   */
+  void arm_image_resize_u8(
+  const arm_image_resize_instance * S,
+  const uint8_t * pSrc,
+        uint8_t * pDst);
+
+  /**
+   * @brief  Batched bilinear image resize with normalized Q7 output.
+   * @param[in]     S     points to an instance of the image resize structure.
+   * @param[in]     pSrc  points to the source frame.
+   * @param[out]    pDst  points to the output image of dstRows * dstCols * numChannels values.
+   */
+  void arm_image_resize_q7(
+  const arm_image_resize_instance * S,
+  const uint8_t * pSrc,
+        q7_t * pDst);
+
+  /**
+   * @brief  Batched bilinear image resize with normalized floating-point output.
+   * @param[in]     S     points to an instance of the image resize structure.
+   * @param[in]     pSrc  points to the source frame.
+   * @param[out]    pDst  points to the output image of dstRows * dstCols * numChannels values.
+   */
+  void arm_image_resize_f32(
+  const arm_image_resize_instance * S,
+  const uint8_t * pSrc,
+        float32_t * pDst);
+
 
 #ifdef   __cplusplus
 }
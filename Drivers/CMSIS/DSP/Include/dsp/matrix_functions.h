@@ -462,6 +462,352 @@ arm_status arm_mat_mult_opt_q31(
         arm_matrix_instance_q31 * pDst,
         q31_t *pState);
 
+/**
+ * @brief Rows of B per packed panel of the blocked matrix multiplications
+ *
+ * With ARM_MAT_MULT_BLOCKED_NC, sets the panel size: about half of the data cache.
+ */
+#ifndef ARM_MAT_MULT_BLOCKED_KC
+#define ARM_MAT_MULT_BLOCKED_KC 128U
+#endif
+
+/**
+ * @brief Columns of B per packed panel of the blocked matrix multiplications
+ */
+#ifndef ARM_MAT_MULT_BLOCKED_NC
+#define ARM_MAT_MULT_BLOCKED_NC 32U
+#endif
+
+/**
+ * @brief Number of values of B up to which the blocked matrix multiplications call the direct ones
+ */
+#ifndef ARM_MAT_MULT_BLOCKED_MIN_SIZE
+#define ARM_MAT_MULT_BLOCKED_MIN_SIZE 4096U
+#endif
+
+/**
+ * @brief Number of multiply-accumulates up to which arm_mat_mult_blocked_f32() calls arm_mat_mult_f32()
+ *
+ * Below it the packing costs more than it saves: on Cortex-M, 64 x 64 products
+ * are faster with arm_mat_mult_f32(). Can be set to 0 on cores with a data cache,
+ * where the blocked kernel is faster from small sizes.
+ */
+#ifndef ARM_MAT_MULT_BLOCKED_MIN_MACS_F32
+#define ARM_MAT_MULT_BLOCKED_MIN_MACS_F32 (96U * 96U * 96U)
+#endif
+
+  /**
+   * @brief Size of the workspace of arm_mat_mult_blocked_f32()
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @return     Number of float32_t values of the workspace
+   */
+uint32_t arm_mat_mult_blocked_workspace_size_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB);
+
+  /**
+   * @brief Floating-point cache blocked matrix multiplication
+   * @param[in]  pSrcA       points to the first input matrix structure
+   * @param[in]  pSrcB       points to the second input matrix structure
+   * @param[out] pDst        points to output matrix structure
+   * @param[in]  pWorkspace  points to the packing buffer
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_blocked_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst,
+        float32_t * pWorkspace);
+
+  /**
+   * @brief Size of the workspace of arm_mat_mult_blocked_q31()
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @return     Number of q31_t values of the workspace
+   */
+uint32_t arm_mat_mult_blocked_workspace_size_q31(
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB);
+
+  /**
+   * @brief Q31 cache blocked matrix multiplication
+   * @param[in]  pSrcA       points to the first input matrix structure
+   * @param[in]  pSrcB       points to the second input matrix structure
+   * @param[out] pDst        points to output matrix structure
+   * @param[in]  pWorkspace  points to the packing buffer
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_blocked_q31(
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+        arm_matrix_instance_q31 * pDst,
+        q31_t * pWorkspace);
+
+  /**
+   * @brief Size of the workspace of arm_mat_mult_blocked_q15()
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @return     Number of q15_t values of the workspace
+   */
+uint32_t arm_mat_mult_blocked_workspace_size_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB);
+
+  /**
+   * @brief Q15 cache blocked matrix multiplication
+   * @param[in]  pSrcA       points to the first input matrix structure
+   * @param[in]  pSrcB       points to the second input matrix structure
+   * @param[out] pDst        points to output matrix structure
+   * @param[in]  pWorkspace  points to the packing buffer
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_blocked_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+        arm_matrix_instance_q15 * pDst,
+        q15_t * pWorkspace);
+
+/**
+ * @brief Largest dimension of the small matrix functions and of the Kalman filter
+ */
+#define ARM_MAT_SMALL_MAX_DIM 6U
+
+  /**
+   * @brief Floating-point 2 x 2 matrix multiplication
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_2x2_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point 3 x 3 matrix multiplication
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_3x3_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point 4 x 4 matrix multiplication
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_4x4_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point 5 x 5 matrix multiplication
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_5x5_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point 6 x 6 matrix multiplication
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_6x6_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point 2 x 2 matrix transpose
+   * @param[in]  pSrc  points to the input matrix structure
+   * @param[out] pDst  points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_trans_2x2_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point 3 x 3 matrix transpose
+   * @param[in]  pSrc  points to the input matrix structure
+   * @param[out] pDst  points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_trans_3x3_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point 4 x 4 matrix transpose
+   * @param[in]  pSrc  points to the input matrix structure
+   * @param[out] pDst  points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_trans_4x4_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point 5 x 5 matrix transpose
+   * @param[in]  pSrc  points to the input matrix structure
+   * @param[out] pDst  points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_trans_5x5_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point 6 x 6 matrix transpose
+   * @param[in]  pSrc  points to the input matrix structure
+   * @param[out] pDst  points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_trans_6x6_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point 2 x 2 matrix inverse
+   * @param[in]  pSrc  points to the input matrix structure
+   * @param[out] pDst  points to output matrix structure
+   * @return     The function returns ARM_MATH_SIZE_MISMATCH, ARM_MATH_SINGULAR or ARM_MATH_SUCCESS.
+   */
+arm_status arm_mat_inverse_2x2_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point 3 x 3 matrix inverse
+   * @param[in]  pSrc  points to the input matrix structure
+   * @param[out] pDst  points to output matrix structure
+   * @return     The function returns ARM_MATH_SIZE_MISMATCH, ARM_MATH_SINGULAR or ARM_MATH_SUCCESS.
+   */
+arm_status arm_mat_inverse_3x3_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point 4 x 4 matrix inverse
+   * @param[in]  pSrc  points to the input matrix structure
+   * @param[out] pDst  points to output matrix structure
+   * @return     The function returns ARM_MATH_SIZE_MISMATCH, ARM_MATH_SINGULAR or ARM_MATH_SUCCESS.
+   */
+arm_status arm_mat_inverse_4x4_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point 5 x 5 matrix inverse
+   * @param[in]  pSrc  points to the input matrix structure
+   * @param[out] pDst  points to output matrix structure
+   * @return     The function returns ARM_MATH_SIZE_MISMATCH, ARM_MATH_SINGULAR or ARM_MATH_SUCCESS.
+   */
+arm_status arm_mat_inverse_5x5_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point 6 x 6 matrix inverse
+   * @param[in]  pSrc  points to the input matrix structure
+   * @param[out] pDst  points to output matrix structure
+   * @return     The function returns ARM_MATH_SIZE_MISMATCH, ARM_MATH_SINGULAR or ARM_MATH_SUCCESS.
+   */
+arm_status arm_mat_inverse_6x6_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point Kalman filter.
+   */
+  typedef struct
+  {
+    uint16_t numStates;     /**< number of states n, 1 to ARM_MAT_SMALL_MAX_DIM. */
+    uint16_t numMeas;       /**< number of measurements m, 1 to ARM_MAT_SMALL_MAX_DIM. */
+    const float32_t *pF;    /**< points to the n x n state transition matrix. */
+    const float32_t *pQ;    /**< points to the n x n process noise covariance matrix. */
+    const float32_t *pH;    /**< points to the m x n observation matrix. */
+    const float32_t *pR;    /**< points to the m x m measurement noise covariance matrix. */
+    float32_t *pState;      /**< points to the state estimate of n values. */
+    float32_t *pP;          /**< points to the n x n covariance of the state estimate. */
+  } arm_kalman_instance_f32;
+
+  /**
+   * @brief Initialization function for the floating-point Kalman filter
+   * @param[out]    S       points to an instance of the Kalman filter structure
+   * @param[in]     pF      points to the n x n state transition matrix
+   * @param[in]     pQ      points to the n x n process noise covariance matrix
+   * @param[in]     pH      points to the m x n observation matrix
+   * @param[in]     pR      points to the m x m measurement noise covariance matrix
+   * @param[in,out] pState  points to the state estimate of n values
+   * @param[in,out] pP      points to the n x n covariance of the state estimate
+   * @return        The function returns ARM_MATH_ARGUMENT_ERROR, ARM_MATH_SIZE_MISMATCH or ARM_MATH_SUCCESS.
+   */
+arm_status arm_kalman_init_f32(
+        arm_kalman_instance_f32 * S,
+  const arm_matrix_instance_f32 * pF,
+  const arm_matrix_instance_f32 * pQ,
+  const arm_matrix_instance_f32 * pH,
+  const arm_matrix_instance_f32 * pR,
+        float32_t * pState,
+        arm_matrix_instance_f32 * pP);
+
+  /**
+   * @brief Prediction step of the floating-point Kalman filter
+   * @param[in,out] S  points to an instance of the Kalman filter structure
+   */
+void arm_kalman_predict_f32(
+  const arm_kalman_instance_f32 * S);
+
+  /**
+   * @brief Update step of the floating-point Kalman filter
+   * @param[in,out] S   points to an instance of the Kalman filter structure
+   * @param[in]     pZ  points to the measurement of m values
+   * @return        The function returns ARM_MATH_SINGULAR or ARM_MATH_SUCCESS.
+   */
+arm_status arm_kalman_update_f32(
+  const arm_kalman_instance_f32 * S,
+  const float32_t * pZ);
+
+  /**
+   * @brief Prediction and update steps of the floating-point Kalman filter
+   * @param[in,out] S   points to an instance of the Kalman filter structure
+   * @param[in]     pZ  points to the measurement of m values
+   * @return        The function returns ARM_MATH_SINGULAR or ARM_MATH_SUCCESS.
+   */
+arm_status arm_kalman_step_f32(
+  const arm_kalman_instance_f32 * S,
+  const float32_t * pZ);
+
   /**
    * @brief Q31 matrix and vector multiplication
    * @param[in]  pSrcMat  points to the input matrix structure
@@ -849,6 +1195,350 @@ float64_t arm_householder_f64(
     float64_t * pOut
     );
 
+  /**
+   * @brief Instance structure for the floating-point sparse matrix in compressed sparse row (CSR) format.
+   */
+  typedef struct
+  {
+    uint16_t numRows;       /**< number of rows of the matrix.                               */
+    uint16_t numCols;       /**< number of columns of the matrix.                            */
+    uint32_t numNonZeros;   /**< number of stored values.                                    */
+    uint32_t *pRowPtr;      /**< points to the first value of every row, numRows + 1 values. */
+    uint16_t *pColIdx;      /**< points to the column of every stored value.                 */
+    float32_t *pData;       /**< points to the stored values, row by row.                    */
+  } arm_matrix_csr_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sparse matrix in compressed sparse row (CSR) format.
+   */
+  typedef struct
+  {
+    uint16_t numRows;       /**< number of rows of the matrix.                               */
+    uint16_t numCols;       /**< number of columns of the matrix.                            */
+    uint32_t numNonZeros;   /**< number of stored values.                                    */
+    uint32_t *pRowPtr;      /**< points to the first value of every row, numRows + 1 values. */
+    uint16_t *pColIdx;      /**< points to the column of every stored value.                 */
+    q31_t *pData;           /**< points to the stored values, row by row.                    */
+  } arm_matrix_csr_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 sparse matrix in compressed sparse row (CSR) format.
+   */
+  typedef struct
+  {
+    uint16_t numRows;       /**< number of rows of the matrix.                               */
+    uint16_t numCols;       /**< number of columns of the matrix.                            */
+    uint32_t numNonZeros;   /**< number of stored values.                                    */
+    uint32_t *pRowPtr;      /**< points to the first value of every row, numRows + 1 values. */
+    uint16_t *pColIdx;      /**< points to the column of every stored value.                 */
+    q15_t *pData;           /**< points to the stored values, row by row.                    */
+  } arm_matrix_csr_instance_q15;
+
+  /**
+   * @brief Floating-point CSR matrix initialization.
+   * @param[out] S            points to an instance of the floating-point CSR matrix structure
+   * @param[in]  numRows      number of rows of the matrix
+   * @param[in]  numCols      number of columns of the matrix
+   * @param[in]  numNonZeros  number of stored values
+   * @param[in]  pRowPtr      points to the row indexes, numRows + 1 values
+   * @param[in]  pColIdx      points to the column indexes
+   * @param[in]  pData        points to the stored values
+   */
+void arm_mat_csr_init_f32(
+  arm_matrix_csr_instance_f32 * S,
+  uint16_t numRows,
+  uint16_t numCols,
+  uint32_t numNonZeros,
+  uint32_t * pRowPtr,
+  uint16_t * pColIdx,
+  float32_t * pData);
+
+  /**
+   * @brief Floating-point CSR matrix from a dense matrix.
+   * @param[in]  pSrc         points to the dense matrix structure
+   * @param[out] pDst         points to an initialized CSR matrix structure
+   * @param[in]  maxNonZeros  number of values that pColIdx and pData of pDst can hold
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code>.
+   */
+arm_status arm_mat_csr_from_dense_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_csr_instance_f32 * pDst,
+        uint32_t maxNonZeros);
+
+  /**
+   * @brief Floating-point CSR matrix from (row, column, value) triplets.
+   * @param[in]  numTriplets  number of triplets
+   * @param[in]  pRows        points to the row of every triplet
+   * @param[in]  pCols        points to the column of every triplet
+   * @param[in]  pValues      points to the value of every triplet
+   * @param[out] pDst         points to an initialized CSR matrix structure
+   * @param[in]  maxNonZeros  number of values that pColIdx and pData of pDst can hold
+   * @return     The function returns
+   * <code>ARM_MATH_ARGUMENT_ERROR</code>, <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code>.
+   */
+arm_status arm_mat_csr_from_triplets_f32(
+        uint32_t numTriplets,
+  const uint16_t * pRows,
+  const uint16_t * pCols,
+  const float32_t * pValues,
+        arm_matrix_csr_instance_f32 * pDst,
+        uint32_t maxNonZeros);
+
+  /**
+   * @brief Floating-point CSR matrix and vector multiplication.
+   * @param[in]  pSrcMat  points to the CSR matrix structure
+   * @param[in]  pVec     points to the input vector, numCols values
+   * @param[out] pDst     points to the output vector, numRows values
+   */
+void arm_mat_csr_vec_mult_f32(
+  const arm_matrix_csr_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst);
+
+  /**
+   * @brief Floating-point transposed CSR matrix and vector multiplication.
+   * @param[in]  pSrcMat  points to the CSR matrix structure
+   * @param[in]  pVec     points to the input vector, numRows values
+   * @param[out] pDst     points to the output vector, numCols values
+   */
+void arm_mat_csr_trans_vec_mult_f32(
+  const arm_matrix_csr_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst);
+
+  /**
+   * @brief Floating-point CSR matrix and dense matrix multiplication.
+   * @param[in]  pSrcA  points to the CSR matrix structure
+   * @param[in]  pSrcB  points to the dense matrix structure
+   * @param[out] pDst   points to the dense output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_csr_mult_f32(
+  const arm_matrix_csr_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point transposed CSR matrix and dense matrix multiplication.
+   * @param[in]  pSrcA  points to the CSR matrix structure
+   * @param[in]  pSrcB  points to the dense matrix structure
+   * @param[out] pDst   points to the dense output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_csr_trans_mult_f32(
+  const arm_matrix_csr_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Q31 CSR matrix initialization.
+   * @param[out] S            points to an instance of the Q31 CSR matrix structure
+   * @param[in]  numRows      number of rows of the matrix
+   * @param[in]  numCols      number of columns of the matrix
+   * @param[in]  numNonZeros  number of stored values
+   * @param[in]  pRowPtr      points to the row indexes, numRows + 1 values
+   * @param[in]  pColIdx      points to the column indexes
+   * @param[in]  pData        points to the stored values
+   */
+void arm_mat_csr_init_q31(
+  arm_matrix_csr_instance_q31 * S,
+  uint16_t numRows,
+  uint16_t numCols,
+  uint32_t numNonZeros,
+  uint32_t * pRowPtr,
+  uint16_t * pColIdx,
+  q31_t * pData);
+
+  /**
+   * @brief Q31 CSR matrix from a dense matrix.
+   * @param[in]  pSrc         points to the dense matrix structure
+   * @param[out] pDst         points to an initialized CSR matrix structure
+   * @param[in]  maxNonZeros  number of values that pColIdx and pData of pDst can hold
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code>.
+   */
+arm_status arm_mat_csr_from_dense_q31(
+  const arm_matrix_instance_q31 * pSrc,
+        arm_matrix_csr_instance_q31 * pDst,
+        uint32_t maxNonZeros);
+
+  /**
+   * @brief Q31 CSR matrix from (row, column, value) triplets.
+   * @param[in]  numTriplets  number of triplets
+   * @param[in]  pRows        points to the row of every triplet
+   * @param[in]  pCols        points to the column of every triplet
+   * @param[in]  pValues      points to the value of every triplet
+   * @param[out] pDst         points to an initialized CSR matrix structure
+   * @param[in]  maxNonZeros  number of values that pColIdx and pData of pDst can hold
+   * @return     The function returns
+   * <code>ARM_MATH_ARGUMENT_ERROR</code>, <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code>.
+   */
+arm_status arm_mat_csr_from_triplets_q31(
+        uint32_t numTriplets,
+  const uint16_t * pRows,
+  const uint16_t * pCols,
+  const q31_t * pValues,
+        arm_matrix_csr_instance_q31 * pDst,
+        uint32_t maxNonZeros);
+
+  /**
+   * @brief Q31 CSR matrix and vector multiplication.
+   * @param[in]  pSrcMat  points to the CSR matrix structure
+   * @param[in]  pVec     points to the input vector, numCols values
+   * @param[out] pDst     points to the output vector, numRows values
+   */
+void arm_mat_csr_vec_mult_q31(
+  const arm_matrix_csr_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+        q31_t * pDst);
+
+  /**
+   * @brief Q31 transposed CSR matrix and vector multiplication.
+   * @param[in]  pSrcMat   points to the CSR matrix structure
+   * @param[in]  pVec      points to the input vector, numRows values
+   * @param[out] pDst      points to the output vector, numCols values
+   * @param[in]  pScratch  points to the 64-bit accumulators, numCols values
+   */
+void arm_mat_csr_trans_vec_mult_q31(
+  const arm_matrix_csr_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+        q31_t * pDst,
+        q63_t * pScratch);
+
+  /**
+   * @brief Q31 CSR matrix and dense matrix multiplication.
+   * @param[in]  pSrcA  points to the CSR matrix structure
+   * @param[in]  pSrcB  points to the dense matrix structure
+   * @param[out] pDst   points to the dense output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_csr_mult_q31(
+  const arm_matrix_csr_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+        arm_matrix_instance_q31 * pDst);
+
+  /**
+   * @brief Q31 transposed CSR matrix and dense matrix multiplication.
+   * @param[in]  pSrcA     points to the CSR matrix structure
+   * @param[in]  pSrcB     points to the dense matrix structure
+   * @param[out] pDst      points to the dense output matrix structure
+   * @param[in]  pScratch  points to the 64-bit accumulators, numCols of pSrcA values
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_csr_trans_mult_q31(
+  const arm_matrix_csr_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+        arm_matrix_instance_q31 * pDst,
+        q63_t * pScratch);
+
+  /**
+   * @brief Q15 CSR matrix initialization.
+   * @param[out] S            points to an instance of the Q15 CSR matrix structure
+   * @param[in]  numRows      number of rows of the matrix
+   * @param[in]  numCols      number of columns of the matrix
+   * @param[in]  numNonZeros  number of stored values
+   * @param[in]  pRowPtr      points to the row indexes, numRows + 1 values
+   * @param[in]  pColIdx      points to the column indexes
+   * @param[in]  pData        points to the stored values
+   */
+void arm_mat_csr_init_q15(
+  arm_matrix_csr_instance_q15 * S,
+  uint16_t numRows,
+  uint16_t numCols,
+  uint32_t numNonZeros,
+  uint32_t * pRowPtr,
+  uint16_t * pColIdx,
+  q15_t * pData);
+
+  /**
+   * @brief Q15 CSR matrix from a dense matrix.
+   * @param[in]  pSrc         points to the dense matrix structure
+   * @param[out] pDst         points to an initialized CSR matrix structure
+   * @param[in]  maxNonZeros  number of values that pColIdx and pData of pDst can hold
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code>.
+   */
+arm_status arm_mat_csr_from_dense_q15(
+  const arm_matrix_instance_q15 * pSrc,
+        arm_matrix_csr_instance_q15 * pDst,
+        uint32_t maxNonZeros);
+
+  /**
+   * @brief Q15 CSR matrix from (row, column, value) triplets.
+   * @param[in]  numTriplets  number of triplets
+   * @param[in]  pRows        points to the row of every triplet
+   * @param[in]  pCols        points to the column of every triplet
+   * @param[in]  pValues      points to the value of every triplet
+   * @param[out] pDst         points to an initialized CSR matrix structure
+   * @param[in]  maxNonZeros  number of values that pColIdx and pData of pDst can hold
+   * @return     The function returns
+   * <code>ARM_MATH_ARGUMENT_ERROR</code>, <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code>.
+   */
+arm_status arm_mat_csr_from_triplets_q15(
+        uint32_t numTriplets,
+  const uint16_t * pRows,
+  const uint16_t * pCols,
+  const q15_t * pValues,
+        arm_matrix_csr_instance_q15 * pDst,
+        uint32_t maxNonZeros);
+
+  /**
+   * @brief Q15 CSR matrix and vector multiplication.
+   * @param[in]  pSrcMat  points to the CSR matrix structure
+   * @param[in]  pVec     points to the input vector, numCols values
+   * @param[out] pDst     points to the output vector, numRows values
+   */
+void arm_mat_csr_vec_mult_q15(
+  const arm_matrix_csr_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+        q15_t * pDst);
+
+  /**
+   * @brief Q15 transposed CSR matrix and vector multiplication.
+   * @param[in]  pSrcMat   points to the CSR matrix structure
+   * @param[in]  pVec      points to the input vector, numRows values
+   * @param[out] pDst      points to the output vector, numCols values
+   * @param[in]  pScratch  points to the 64-bit accumulators, numCols values
+   */
+void arm_mat_csr_trans_vec_mult_q15(
+  const arm_matrix_csr_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+        q15_t * pDst,
+        q63_t * pScratch);
+
+  /**
+   * @brief Q15 CSR matrix and dense matrix multiplication.
+   * @param[in]  pSrcA  points to the CSR matrix structure
+   * @param[in]  pSrcB  points to the dense matrix structure
+   * @param[out] pDst   points to the dense output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_csr_mult_q15(
+  const arm_matrix_csr_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+        arm_matrix_instance_q15 * pDst);
+
+  /**
+   * @brief Q15 transposed CSR matrix and dense matrix multiplication.
+   * @param[in]  pSrcA     points to the CSR matrix structure
+   * @param[in]  pSrcB     points to the dense matrix structure
+   * @param[out] pDst      points to the dense output matrix structure
+   * @param[in]  pScratch  points to the 64-bit accumulators, numCols of pSrcA values
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_csr_trans_mult_q15(
+  const arm_matrix_csr_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+        arm_matrix_instance_q15 * pDst,
+        q63_t * pScratch);
+
 #ifdef   __cplusplus
 }
 #endif
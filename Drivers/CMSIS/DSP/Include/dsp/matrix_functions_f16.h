@@ -38,6 +38,9 @@ extern "C"
 
 #include "dsp/none.h"
 #include "dsp/utils.h"
+
+/* For arm_matrix_instance_f32 */
+#include "dsp/matrix_functions.h"
     
 #if defined(ARM_FLOAT16_SUPPORTED)
 
@@ -110,6 +113,32 @@ arm_status arm_mat_cmplx_trans_f16(
    * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
    */
 arm_status arm_mat_mult_f16(
+  const arm_matrix_instance_f16 * pSrcA,
+  const arm_matrix_instance_f16 * pSrcB,
+        arm_matrix_instance_f16 * pDst);
+
+  /**
+   * @brief Half-precision matrix multiplication with single-precision accumulation
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_f16_f32(
+  const arm_matrix_instance_f16 * pSrcA,
+  const arm_matrix_instance_f16 * pSrcB,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Half-precision matrix multiplication with single-precision accumulation, half-precision output
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_acc32_f16(
   const arm_matrix_instance_f16 * pSrcA,
   const arm_matrix_instance_f16 * pSrcB,
         arm_matrix_instance_f16 * pDst);
@@ -124,6 +153,28 @@ void arm_mat_vec_mult_f16(
   const float16_t *pVec, 
   float16_t *pDst);
 
+  /**
+   * @brief Half-precision matrix and vector multiplication with single-precision accumulation
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to the input vector
+   * @param[out] pDst     points to the output vector
+   */
+void arm_mat_vec_mult_f16_f32(
+  const arm_matrix_instance_f16 *pSrcMat,
+  const float16_t *pVec,
+  float32_t *pDst);
+
+  /**
+   * @brief Half-precision matrix and vector multiplication with single-precision accumulation, half-precision output
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to the input vector
+   * @param[out] pDst     points to the output vector
+   */
+void arm_mat_vec_mult_acc32_f16(
+  const arm_matrix_instance_f16 *pSrcMat,
+  const float16_t *pVec,
+  float16_t *pDst);
+
   /**
    * @brief Floating-point matrix subtraction
    * @param[in]  pSrcA  points to the first input matrix structure
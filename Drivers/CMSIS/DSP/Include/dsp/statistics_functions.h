@@ -980,6 +980,307 @@ const float64_t * pSrc,
       uint32_t blockSize,
       float64_t * pResult);
 
+/**
+ * @brief Monotonic queue of window positions used by the sliding minimum and maximum.
+ */
+typedef struct
+{
+  uint32_t *pPos;           /**< positions in the window buffer, windowSize entries. */
+  uint32_t head;            /**< index of the first position in pPos. */
+  uint32_t count;           /**< number of positions in the queue. */
+} arm_sliding_deque_instance;
+
+/**
+ * @brief Instance structure for the floating-point sliding window statistics.
+ */
+typedef struct
+{
+  uint32_t windowSize;      /**< number of samples of the window. */
+  uint32_t count;           /**< number of samples in the window, up to windowSize. */
+  uint32_t index;           /**< position of the next sample in pState. */
+  float32_t mean;           /**< mean of the window. */
+  float32_t m2;             /**< sum of the squared deviations from the mean. */
+  float32_t meanComp;       /**< rounding error of mean (Kahan compensation). */
+  float32_t m2Comp;         /**< rounding error of m2 (Kahan compensation). */
+  float32_t *pState;        /**< points to the window of windowSize samples. */
+  arm_sliding_deque_instance maxQueue;  /**< positions of the decreasing maxima. */
+  arm_sliding_deque_instance minQueue;  /**< positions of the increasing minima. */
+} arm_sliding_stats_instance_f32;
+
+/**
+ * @brief Instance structure for the Q31 sliding window statistics.
+ */
+typedef struct
+{
+  uint32_t windowSize;      /**< number of samples of the window. */
+  uint32_t count;           /**< number of samples in the window, up to windowSize. */
+  uint32_t index;           /**< position of the next sample in pState. */
+  q63_t sum;                /**< sum of the samples. */
+  q63_t sumShifted;         /**< sum of the samples in 1.23 format. */
+  q63_t sumOfSquares;       /**< sum of the squares of the samples in 1.23 format. */
+  q31_t *pState;            /**< points to the window of windowSize samples. */
+  arm_sliding_deque_instance maxQueue;  /**< positions of the decreasing maxima. */
+  arm_sliding_deque_instance minQueue;  /**< positions of the increasing minima. */
+} arm_sliding_stats_instance_q31;
+
+/**
+ * @brief Instance structure for the Q15 sliding window statistics.
+ */
+typedef struct
+{
+  uint32_t windowSize;      /**< number of samples of the window. */
+  uint32_t count;           /**< number of samples in the window, up to windowSize. */
+  uint32_t index;           /**< position of the next sample in pState. */
+  q31_t sum;                /**< sum of the samples. */
+  q63_t sumOfSquares;       /**< sum of the squares of the samples. */
+  q15_t *pState;            /**< points to the window of windowSize samples. */
+  arm_sliding_deque_instance maxQueue;  /**< positions of the decreasing maxima. */
+  arm_sliding_deque_instance minQueue;  /**< positions of the increasing minima. */
+} arm_sliding_stats_instance_q15;
+
+/**
+ * @brief  Initialization function for the floating-point sliding window statistics.
+ * @param[out] S           points to an instance of the sliding window statistics structure
+ * @param[in]  windowSize  number of samples of the window
+ * @param[in]  pState      points to the window buffer of windowSize samples
+ * @param[in]  pQueue      points to the buffer of 2 * windowSize positions of the minimum and maximum
+ * @return     The function returns ARM_MATH_ARGUMENT_ERROR if windowSize is 0, ARM_MATH_SUCCESS otherwise.
+ */
+arm_status arm_sliding_stats_init_f32(
+  arm_sliding_stats_instance_f32 * S,
+  uint32_t windowSize,
+  float32_t * pState,
+  uint32_t * pQueue);
+
+/**
+ * @brief  Empties the window of the floating-point sliding window statistics.
+ * @param[in,out] S  points to an instance of the sliding window statistics structure
+ */
+void arm_sliding_stats_reset_f32(
+  arm_sliding_stats_instance_f32 * S);
+
+/**
+ * @brief  Adds samples to the window of the floating-point sliding window statistics.
+ * @param[in,out] S          points to an instance of the sliding window statistics structure
+ * @param[in]     pSrc       points to the new samples
+ * @param[in]     blockSize  number of new samples
+ */
+void arm_sliding_stats_f32(
+  arm_sliding_stats_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize);
+
+/**
+ * @brief  Mean of the window of the floating-point sliding window statistics.
+ * @param[in]  S        points to an instance of the sliding window statistics structure
+ * @param[out] pResult  mean value
+ */
+void arm_sliding_mean_f32(
+  const arm_sliding_stats_instance_f32 * S,
+  float32_t * pResult);
+
+/**
+ * @brief  Variance of the window of the floating-point sliding window statistics.
+ * @param[in]  S        points to an instance of the sliding window statistics structure
+ * @param[out] pResult  variance
+ */
+void arm_sliding_var_f32(
+  const arm_sliding_stats_instance_f32 * S,
+  float32_t * pResult);
+
+/**
+ * @brief  Root mean square of the window of the floating-point sliding window statistics.
+ * @param[in]  S        points to an instance of the sliding window statistics structure
+ * @param[out] pResult  root mean square value
+ */
+void arm_sliding_rms_f32(
+  const arm_sliding_stats_instance_f32 * S,
+  float32_t * pResult);
+
+/**
+ * @brief  Maximum of the window of the floating-point sliding window statistics.
+ * @param[in]  S        points to an instance of the sliding window statistics structure
+ * @param[out] pResult  maximum value
+ * @param[out] pIndex   index of the maximum in the window, 0 for the oldest sample
+ */
+void arm_sliding_max_f32(
+  const arm_sliding_stats_instance_f32 * S,
+  float32_t * pResult,
+  uint32_t * pIndex);
+
+/**
+ * @brief  Minimum of the window of the floating-point sliding window statistics.
+ * @param[in]  S        points to an instance of the sliding window statistics structure
+ * @param[out] pResult  minimum value
+ * @param[out] pIndex   index of the minimum in the window, 0 for the oldest sample
+ */
+void arm_sliding_min_f32(
+  const arm_sliding_stats_instance_f32 * S,
+  float32_t * pResult,
+  uint32_t * pIndex);
+
+/**
+ * @brief  Initialization function for the Q31 sliding window statistics.
+ * @param[out] S           points to an instance of the sliding window statistics structure
+ * @param[in]  windowSize  number of samples of the window
+ * @param[in]  pState      points to the window buffer of windowSize samples
+ * @param[in]  pQueue      points to the buffer of 2 * windowSize positions of the minimum and maximum
+ * @return     The function returns ARM_MATH_ARGUMENT_ERROR if windowSize is 0, ARM_MATH_SUCCESS otherwise.
+ */
+arm_status arm_sliding_stats_init_q31(
+  arm_sliding_stats_instance_q31 * S,
+  uint32_t windowSize,
+  q31_t * pState,
+  uint32_t * pQueue);
+
+/**
+ * @brief  Empties the window of the Q31 sliding window statistics.
+ * @param[in,out] S  points to an instance of the sliding window statistics structure
+ */
+void arm_sliding_stats_reset_q31(
+  arm_sliding_stats_instance_q31 * S);
+
+/**
+ * @brief  Adds samples to the window of the Q31 sliding window statistics.
+ * @param[in,out] S          points to an instance of the sliding window statistics structure
+ * @param[in]     pSrc       points to the new samples
+ * @param[in]     blockSize  number of new samples
+ */
+void arm_sliding_stats_q31(
+  arm_sliding_stats_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t blockSize);
+
+/**
+ * @brief  Mean of the window of the Q31 sliding window statistics.
+ * @param[in]  S        points to an instance of the sliding window statistics structure
+ * @param[out] pResult  mean value
+ */
+void arm_sliding_mean_q31(
+  const arm_sliding_stats_instance_q31 * S,
+  q31_t * pResult);
+
+/**
+ * @brief  Variance of the window of the Q31 sliding window statistics.
+ * @param[in]  S        points to an instance of the sliding window statistics structure
+ * @param[out] pResult  variance
+ */
+void arm_sliding_var_q31(
+  const arm_sliding_stats_instance_q31 * S,
+  q31_t * pResult);
+
+/**
+ * @brief  Root mean square of the window of the Q31 sliding window statistics.
+ * @param[in]  S        points to an instance of the sliding window statistics structure
+ * @param[out] pResult  root mean square value
+ */
+void arm_sliding_rms_q31(
+  const arm_sliding_stats_instance_q31 * S,
+  q31_t * pResult);
+
+/**
+ * @brief  Maximum of the window of the Q31 sliding window statistics.
+ * @param[in]  S        points to an instance of the sliding window statistics structure
+ * @param[out] pResult  maximum value
+ * @param[out] pIndex   index of the maximum in the window, 0 for the oldest sample
+ */
+void arm_sliding_max_q31(
+  const arm_sliding_stats_instance_q31 * S,
+  q31_t * pResult,
+  uint32_t * pIndex);
+
+/**
+ * @brief  Minimum of the window of the Q31 sliding window statistics.
+ * @param[in]  S        points to an instance of the sliding window statistics structure
+ * @param[out] pResult  minimum value
+ * @param[out] pIndex   index of the minimum in the window, 0 for the oldest sample
+ */
+void arm_sliding_min_q31(
+  const arm_sliding_stats_instance_q31 * S,
+  q31_t * pResult,
+  uint32_t * pIndex);
+
+/**
+ * @brief  Initialization function for the Q15 sliding window statistics.
+ * @param[out] S           points to an instance of the sliding window statistics structure
+ * @param[in]  windowSize  number of samples of the window
+ * @param[in]  pState      points to the window buffer of windowSize samples
+ * @param[in]  pQueue      points to the buffer of 2 * windowSize positions of the minimum and maximum
+ * @return     The function returns ARM_MATH_ARGUMENT_ERROR if windowSize is 0, ARM_MATH_SUCCESS otherwise.
+ */
+arm_status arm_sliding_stats_init_q15(
+  arm_sliding_stats_instance_q15 * S,
+  uint32_t windowSize,
+  q15_t * pState,
+  uint32_t * pQueue);
+
+/**
+ * @brief  Empties the window of the Q15 sliding window statistics.
+ * @param[in,out] S  points to an instance of the sliding window statistics structure
+ */
+void arm_sliding_stats_reset_q15(
+  arm_sliding_stats_instance_q15 * S);
+
+/**
+ * @brief  Adds samples to the window of the Q15 sliding window statistics.
+ * @param[in,out] S          points to an instance of the sliding window statistics structure
+ * @param[in]     pSrc       points to the new samples
+ * @param[in]     blockSize  number of new samples
+ */
+void arm_sliding_stats_q15(
+  arm_sliding_stats_instance_q15 * S,
+  const q15_t * pSrc,
+  uint32_t blockSize);
+
+/**
+ * @brief  Mean of the window of the Q15 sliding window statistics.
+ * @param[in]  S        points to an instance of the sliding window statistics structure
+ * @param[out] pResult  mean value
+ */
+void arm_sliding_mean_q15(
+  const arm_sliding_stats_instance_q15 * S,
+  q15_t * pResult);
+
+/**
+ * @brief  Variance of the window of the Q15 sliding window statistics.
+ * @param[in]  S        points to an instance of the sliding window statistics structure
+ * @param[out] pResult  variance
+ */
+void arm_sliding_var_q15(
+  const arm_sliding_stats_instance_q15 * S,
+  q15_t * pResult);
+
+/**
+ * @brief  Root mean square of the window of the Q15 sliding window statistics.
+ * @param[in]  S        points to an instance of the sliding window statistics structure
+ * @param[out] pResult  root mean square value
+ */
+void arm_sliding_rms_q15(
+  const arm_sliding_stats_instance_q15 * S,
+  q15_t * pResult);
+
+/**
+ * @brief  Maximum of the window of the Q15 sliding window statistics.
+ * @param[in]  S        points to an instance of the sliding window statistics structure
+ * @param[out] pResult  maximum value
+ * @param[out] pIndex   index of the maximum in the window, 0 for the oldest sample
+ */
+void arm_sliding_max_q15(
+  const arm_sliding_stats_instance_q15 * S,
+  q15_t * pResult,
+  uint32_t * pIndex);
+
+/**
+ * @brief  Minimum of the window of the Q15 sliding window statistics.
+ * @param[in]  S        points to an instance of the sliding window statistics structure
+ * @param[out] pResult  minimum value
+ * @param[out] pIndex   index of the minimum in the window, 0 for the oldest sample
+ */
+void arm_sliding_min_q15(
+  const arm_sliding_stats_instance_q15 * S,
+  q15_t * pResult,
+  uint32_t * pIndex);
+
 
 #ifdef   __cplusplus
 }
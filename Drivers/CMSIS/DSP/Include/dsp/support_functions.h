@@ -292,8 +292,10 @@ const q7_t * pSrc,
              /**< Insertion sort */
     ARM_SORT_QUICK     = 4,
              /**< Quick sort     */
-    ARM_SORT_SELECTION = 5
+    ARM_SORT_SELECTION = 5,
              /**< Selection sort */
+    ARM_SORT_RADIX     = 6
+             /**< Radix sort, needs a working buffer */
   } arm_sort_alg;
 
   /**
@@ -314,6 +316,7 @@ const q7_t * pSrc,
   {
     arm_sort_alg alg;        /**< Sorting algorithm selected */
     arm_sort_dir dir;        /**< Sorting order (direction)  */
+    uint32_t * buffer;       /**< Working buffer of the radix sort, NULL if none */
   } arm_sort_instance_f32;  
 
   /**
@@ -338,6 +341,30 @@ const q7_t * pSrc,
     arm_sort_alg alg, 
     arm_sort_dir dir); 
 
+  /**
+   * @param[in,out]  S            points to an instance of the sorting structure.
+   * @param[in]      alg          Selected algorithm.
+   * @param[in]      dir          Sorting order.
+   * @param[in]      buffer       Working buffer of the radix sort.
+   */
+  void arm_sort_init_buffer_f32(
+    arm_sort_instance_f32 * S,
+    arm_sort_alg alg,
+    arm_sort_dir dir,
+    uint32_t * buffer);
+
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pIndex     points to the indices of the sorted data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_argsort_f32(
+    const arm_sort_instance_f32 * S,
+    const float32_t * pSrc,
+          uint32_t * pIndex,
+          uint32_t blockSize);
+
   /**
    * @brief Instance structure for the sorting algorithms.
    */
@@ -369,6 +396,104 @@ const q7_t * pSrc,
     arm_sort_dir dir,
     float32_t * buffer);
 
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pIndex     points to the indices of the sorted data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_merge_argsort_f32(
+    const arm_merge_sort_instance_f32 * S,
+    const float32_t * pSrc,
+          uint32_t * pIndex,
+          uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q31 radix sort.
+   */
+  typedef struct
+  {
+    arm_sort_dir dir;        /**< Sorting order (direction)  */
+    uint32_t * buffer;       /**< Working buffer */
+  } arm_radix_sort_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 radix sort.
+   */
+  typedef struct
+  {
+    arm_sort_dir dir;        /**< Sorting order (direction)  */
+    uint32_t * buffer;       /**< Working buffer */
+  } arm_radix_sort_instance_q15;
+
+  /**
+   * @param[in,out]  S            points to an instance of the sorting structure.
+   * @param[in]      dir          Sorting order.
+   * @param[in]      buffer       Working buffer.
+   */
+  void arm_radix_sort_init_q31(
+    arm_radix_sort_instance_q31 * S,
+    arm_sort_dir dir,
+    uint32_t * buffer);
+
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_radix_sort_q31(
+    const arm_radix_sort_instance_q31 * S,
+    const q31_t * pSrc,
+          q31_t * pDst,
+          uint32_t blockSize);
+
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pIndex     points to the indices of the sorted data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_radix_argsort_q31(
+    const arm_radix_sort_instance_q31 * S,
+    const q31_t * pSrc,
+          uint32_t * pIndex,
+          uint32_t blockSize);
+
+  /**
+   * @param[in,out]  S            points to an instance of the sorting structure.
+   * @param[in]      dir          Sorting order.
+   * @param[in]      buffer       Working buffer.
+   */
+  void arm_radix_sort_init_q15(
+    arm_radix_sort_instance_q15 * S,
+    arm_sort_dir dir,
+    uint32_t * buffer);
+
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_radix_sort_q15(
+    const arm_radix_sort_instance_q15 * S,
+    const q15_t * pSrc,
+          q15_t * pDst,
+          uint32_t blockSize);
+
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pIndex     points to the indices of the sorted data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_radix_argsort_q15(
+    const arm_radix_sort_instance_q15 * S,
+    const q15_t * pSrc,
+          uint32_t * pIndex,
+          uint32_t blockSize);
+
  
  
   /**
@@ -41,6 +41,11 @@ extern "C"
 
 #define STEP(x) (x) <= 0 ? 0 : 1
 
+/**
+ * @brief Number of input vectors per block of the SVM batch prediction functions
+ */
+#define ARM_SVM_BATCH_ROWS 16U
+
 /**
  * @defgroup groupSVM SVM Functions
  * This set of functions is implementing SVM classification on 2 classes.
@@ -271,6 +276,76 @@ void arm_svm_sigmoid_predict_f32(const arm_svm_sigmoid_instance_f32 *S,
    int32_t * pResult);
 
 
+/**
+ * @brief Size of the scratch buffer of the SVM batch prediction functions
+ * @param[in]    nbOfSupportVectors  Number of support vectors
+ * @param[in]    vectorDimension     Dimension of vector space
+ * @return Number of float32_t values of the pScratch argument
+ */
+uint32_t arm_svm_predict_batch_scratch_size_f32(uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension);
+
+
+/**
+ * @brief SVM linear prediction of several input vectors
+ * @param[in]    S           Pointer to an instance of the linear SVM structure.
+ * @param[in]    in          Pointer to numVectors input vectors
+ * @param[in]    numVectors  Number of input vectors
+ * @param[in]    pScratch    Pointer to the scratch buffer
+ * @param[out]   pResult     Decision values
+ */
+void arm_svm_linear_predict_batch_f32(const arm_svm_linear_instance_f32 *S,
+   const float32_t * in,
+   uint32_t numVectors,
+   float32_t * pScratch,
+   int32_t * pResult);
+
+
+/**
+ * @brief SVM polynomial prediction of several input vectors
+ * @param[in]    S           Pointer to an instance of the polynomial SVM structure.
+ * @param[in]    in          Pointer to numVectors input vectors
+ * @param[in]    numVectors  Number of input vectors
+ * @param[in]    pScratch    Pointer to the scratch buffer
+ * @param[out]   pResult     Decision values
+ */
+void arm_svm_polynomial_predict_batch_f32(const arm_svm_polynomial_instance_f32 *S,
+   const float32_t * in,
+   uint32_t numVectors,
+   float32_t * pScratch,
+   int32_t * pResult);
+
+
+/**
+ * @brief SVM rbf prediction of several input vectors
+ * @param[in]    S           Pointer to an instance of the rbf SVM structure.
+ * @param[in]    in          Pointer to numVectors input vectors
+ * @param[in]    numVectors  Number of input vectors
+ * @param[in]    pScratch    Pointer to the scratch buffer
+ * @param[out]   pResult     Decision values
+ */
+void arm_svm_rbf_predict_batch_f32(const arm_svm_rbf_instance_f32 *S,
+   const float32_t * in,
+   uint32_t numVectors,
+   float32_t * pScratch,
+   int32_t * pResult);
+
+
+/**
+ * @brief SVM sigmoid prediction of several input vectors
+ * @param[in]    S           Pointer to an instance of the sigmoid SVM structure.
+ * @param[in]    in          Pointer to numVectors input vectors
+ * @param[in]    numVectors  Number of input vectors
+ * @param[in]    pScratch    Pointer to the scratch buffer
+ * @param[out]   pResult     Decision values
+ */
+void arm_svm_sigmoid_predict_batch_f32(const arm_svm_sigmoid_instance_f32 *S,
+   const float32_t * in,
+   uint32_t numVectors,
+   float32_t * pScratch,
+   int32_t * pResult);
+
+
 
 
 #ifdef   __cplusplus
@@ -248,6 +248,13 @@ void arm_cfft_q15(
           uint8_t ifftFlag,
           uint8_t bitReverseFlag);
 
+void arm_cfft_bfp_q15(
+    const arm_cfft_instance_q15 * S,
+          q15_t * p1,
+          uint8_t ifftFlag,
+          uint8_t bitReverseFlag,
+          int16_t * pExponent);
+
   /**
    * @brief Instance structure for the fixed-point CFFT/CIFFT function.
    */
@@ -287,6 +294,13 @@ void arm_cfft_q31(
           uint8_t ifftFlag,
           uint8_t bitReverseFlag);
 
+void arm_cfft_bfp_q31(
+    const arm_cfft_instance_q31 * S,
+          q31_t * p1,
+          uint8_t ifftFlag,
+          uint8_t bitReverseFlag,
+          int16_t * pExponent);
+
   /**
    * @brief Instance structure for the floating-point CFFT/CIFFT function.
    */
@@ -321,6 +335,14 @@ arm_status arm_cfft_init_16_f32(arm_cfft_instance_f32 * S);
   arm_cfft_instance_f32 * S,
   uint16_t fftLen);
 
+  uint32_t arm_cfft_dynamic_buffer_size_f32(
+  uint16_t fftLen);
+
+  arm_status arm_cfft_init_dynamic_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pBuffer);
+
   void arm_cfft_f32(
   const arm_cfft_instance_f32 * S,
         float32_t * p1,
@@ -433,6 +455,12 @@ arm_status arm_rfft_init_8192_q15(
         q15_t * pSrc,
         q15_t * pDst);
 
+  void arm_rfft_bfp_q15(
+  const arm_rfft_instance_q15 * S,
+        q15_t * pSrc,
+        q15_t * pDst,
+        int16_t * pExponent);
+
   /**
    * @brief Instance structure for the Q31 RFFT/RIFFT function.
    */
@@ -507,6 +535,12 @@ arm_status arm_rfft_init_8192_q15(
         q31_t * pSrc,
         q31_t * pDst);
 
+  void arm_rfft_bfp_q31(
+  const arm_rfft_instance_q31 * S,
+        q31_t * pSrc,
+        q31_t * pDst,
+        int16_t * pExponent);
+
   /**
    * @brief Instance structure for the floating-point RFFT/RIFFT function.
    */
@@ -587,6 +621,14 @@ arm_status arm_rfft_fast_init_f32 (
          arm_rfft_fast_instance_f32 * S,
          uint16_t fftLen);
 
+uint32_t arm_rfft_fast_dynamic_buffer_size_f32 (
+         uint16_t fftLen);
+
+arm_status arm_rfft_fast_init_dynamic_f32 (
+         arm_rfft_fast_instance_f32 * S,
+         uint16_t fftLen,
+         float32_t * pBuffer);
+
 
   void arm_rfft_fast_f32(
         const arm_rfft_fast_instance_f32 * S,
@@ -867,6 +909,100 @@ arm_status arm_mfcc_init_f32(
   float32_t *pTmp
   );
 
+  /**
+   * @brief Feature computed by the streaming STFT for every frame.
+   */
+  typedef enum
+  {
+    ARM_STFT_MAGNITUDE = 0,  /**< Magnitude spectrum, fftLen/2+1 values per frame */
+    ARM_STFT_POWER = 1,      /**< Power spectrum, fftLen/2+1 values per frame */
+    ARM_STFT_MFCC = 2        /**< MFCC, nbDctOutputs values per frame */
+  } arm_stft_feature;
+
+  /**
+   * @brief Instance structure for the floating-point streaming STFT.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                  /**< frame and FFT length */
+          uint16_t hopLen;                  /**< number of samples between two frames */
+          uint16_t frameSize;               /**< number of values per output frame */
+          uint16_t writeIndex;              /**< next write position in the ring, the oldest sample */
+          uint32_t hopCount;                /**< samples still needed to complete the next frame */
+          arm_stft_feature feature;         /**< feature computed for every frame */
+    const float32_t *pWindow;               /**< points to the window, fftLen values */
+    const arm_mfcc_instance_f32 *pMfcc;     /**< points to the MFCC instance for ARM_STFT_MFCC */
+          float32_t *pRing;                 /**< points to the input ring, fftLen values */
+          float32_t *pFrame;                /**< points to the windowed frame, fftLen values */
+          float32_t *pSpectrum;             /**< points to the spectrum, fftLen + 2 values */
+          arm_rfft_fast_instance_f32 rfft;  /**< internal RFFT instance */
+  } arm_stft_instance_f32;
+
+/**
+  @brief         Size of the arena of a streaming STFT.
+  @param[in]     fftLen  frame and FFT length
+  @return        number of float32_t values of the arena
+ */
+  uint32_t arm_stft_arena_size_f32(
+  uint16_t fftLen);
+
+/**
+  @brief         Initialization of a streaming STFT computing a spectrum per frame.
+  @param[out]    S        points to the STFT instance structure
+  @param[in]     fftLen   frame and FFT length
+  @param[in]     hopLen   number of samples between two frames
+  @param[in]     feature  ARM_STFT_MAGNITUDE or ARM_STFT_POWER
+  @param[in]     pWindow  points to the window, fftLen values
+  @param[in]     pArena   points to the arena of arm_stft_arena_size_f32() values
+  @return        execution status
+ */
+  arm_status arm_stft_init_f32(
+  arm_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopLen,
+  arm_stft_feature feature,
+  const float32_t *pWindow,
+  float32_t *pArena);
+
+/**
+  @brief         Initialization of a streaming STFT computing the MFCC of every frame.
+  @param[out]    S       points to the STFT instance structure
+  @param[in]     pMfcc   points to an initialized MFCC instance
+  @param[in]     hopLen  number of samples between two frames
+  @param[in]     pArena  points to the arena of arm_stft_arena_size_f32() values
+  @return        execution status
+ */
+  arm_status arm_stft_mfcc_init_f32(
+  arm_stft_instance_f32 * S,
+  const arm_mfcc_instance_f32 * pMfcc,
+  uint16_t hopLen,
+  float32_t *pArena);
+
+/**
+  @brief         Clears the input ring of a streaming STFT.
+  @param[in,out] S  points to the STFT instance structure
+ */
+  void arm_stft_reset_f32(
+  arm_stft_instance_f32 * S);
+
+/**
+  @brief         Streaming STFT.
+  @param[in,out] S          points to the STFT instance structure
+  @param[in]     pSrc       points to the input samples
+  @param[in]     blockSize  number of input samples
+  @param[out]    pDst       points to the output frames
+  @param[in]     maxFrames  maximum number of frames written to pDst
+  @param[out]    pNbFrames  number of frames written to pDst
+  @return        number of input samples consumed
+ */
+  uint32_t arm_stft_f32(
+  arm_stft_instance_f32 * S,
+  const float32_t *pSrc,
+  uint32_t blockSize,
+  float32_t *pDst,
+  uint32_t maxFrames,
+  uint32_t *pNbFrames);
+
  /**
    * @brief Instance structure for the Q31 MFCC function.
    */
@@ -1144,6 +1280,210 @@ arm_status arm_mfcc_init_q15(
   );
 
 
+  /**
+   * @brief Instance structure for the floating-point Goertzel bank.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                 /**< number of frequency bins */
+          uint32_t blockSize;               /**< number of samples of a block, length of the DFT */
+    const float32_t *pCoeffs;               /**< points to the coefficients, 6 * numBins values */
+  } arm_goertzel_instance_f32;
+
+/**
+ * @brief Largest block size of the Q31 Goertzel bank.
+ */
+#define ARM_GOERTZEL_MAX_BLOCKSIZE_Q31 32768U
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel bank.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                 /**< number of frequency bins */
+          uint32_t blockSize;               /**< number of samples of a block, length of the DFT */
+          uint8_t postShift;                /**< the bins are scaled by 2^-postShift */
+    const q31_t *pCoeffs;                   /**< points to the coefficients, 7 * numBins values */
+  } arm_goertzel_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                 /**< number of frequency bins */
+          uint16_t fftLen;                  /**< length of the sliding window */
+          uint16_t writeIndex;              /**< position of the next sample in the window */
+    const uint16_t *pBins;                  /**< points to the bin indexes, numBins values */
+          float32_t *pCos;                  /**< points to cos(2 * pi * n / fftLen), fftLen values */
+          float32_t *pSin;                  /**< points to sin(2 * pi * n / fftLen), fftLen values */
+          float32_t *pWindow;               /**< points to the last fftLen samples */
+          float32_t *pState;                /**< points to the modulated bins, 4 * numBins values */
+  } arm_sliding_dft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                 /**< number of frequency bins */
+          uint16_t fftLen;                  /**< length of the sliding window */
+          uint16_t writeIndex;              /**< position of the next sample in the window */
+          uint8_t postShift;                /**< the bins are scaled by 2^-postShift */
+    const uint16_t *pBins;                  /**< points to the bin indexes, numBins values */
+          q31_t *pCos;                      /**< points to cos(2 * pi * n / fftLen), fftLen values */
+          q31_t *pSin;                      /**< points to sin(2 * pi * n / fftLen), fftLen values */
+          q31_t *pWindow;                   /**< points to the last fftLen samples */
+          q31_t *pState;                    /**< points to the modulated bins, 2 * numBins values */
+  } arm_sliding_dft_instance_q31;
+
+/**
+  @brief         Initialization of a floating-point Goertzel bank.
+  @param[out]    S          points to the Goertzel instance structure
+  @param[in]     numBins    number of frequency bins
+  @param[in]     pBins      points to the frequencies in cycles per block, numBins values
+  @param[in]     blockSize  number of samples of a block
+  @param[out]    pCoeffs    points to the coefficients, 6 * numBins values
+  @return        execution status
+ */
+  arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  const float32_t * pBins,
+  uint32_t blockSize,
+  float32_t * pCoeffs);
+
+/**
+  @brief         Floating-point Goertzel bank.
+  @param[in]     S     points to the Goertzel instance structure
+  @param[in]     pSrc  points to the block of blockSize samples
+  @param[out]    pDst  points to the complex bins, 2 * numBins values
+ */
+  void arm_goertzel_f32(
+  const arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst);
+
+/**
+  @brief         Initialization of a Q31 Goertzel bank.
+  @param[out]    S          points to the Goertzel instance structure
+  @param[in]     numBins    number of frequency bins
+  @param[in]     pBins      points to the frequencies in cycles per block, numBins values
+  @param[in]     blockSize  number of samples of a block, 2 to ARM_GOERTZEL_MAX_BLOCKSIZE_Q31
+  @param[out]    pCoeffs    points to the coefficients, 7 * numBins values
+  @return        execution status
+ */
+  arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  const float32_t * pBins,
+  uint32_t blockSize,
+  q31_t * pCoeffs);
+
+/**
+  @brief         Q31 Goertzel bank.
+  @param[in]     S     points to the Goertzel instance structure
+  @param[in]     pSrc  points to the block of blockSize samples
+  @param[out]    pDst  points to the complex bins scaled by 2^-postShift, 2 * numBins values
+ */
+  void arm_goertzel_q31(
+  const arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst);
+
+/**
+  @brief         Size of the buffer of a floating-point sliding DFT.
+  @param[in]     numBins  number of frequency bins
+  @param[in]     fftLen   length of the sliding window
+  @return        number of float32_t values of the buffer
+ */
+  uint32_t arm_sliding_dft_buffer_size_f32(
+  uint16_t numBins,
+  uint16_t fftLen);
+
+/**
+  @brief         Initialization of a floating-point sliding DFT.
+  @param[out]    S        points to the sliding DFT instance structure
+  @param[in]     numBins  number of frequency bins
+  @param[in]     pBins    points to the bin indexes, numBins values smaller than fftLen
+  @param[in]     fftLen   length of the sliding window
+  @param[in]     pBuffer  points to the buffer of arm_sliding_dft_buffer_size_f32() values
+  @return        execution status
+ */
+  arm_status arm_sliding_dft_init_f32(
+  arm_sliding_dft_instance_f32 * S,
+  uint16_t numBins,
+  const uint16_t * pBins,
+  uint16_t fftLen,
+  float32_t * pBuffer);
+
+/**
+  @brief         Clears the window of a floating-point sliding DFT.
+  @param[in,out] S  points to the sliding DFT instance structure
+ */
+  void arm_sliding_dft_reset_f32(
+  arm_sliding_dft_instance_f32 * S);
+
+/**
+  @brief         Floating-point sliding DFT.
+  @param[in,out] S          points to the sliding DFT instance structure
+  @param[in]     pSrc       points to the new samples
+  @param[in]     blockSize  number of new samples
+  @param[out]    pDst       points to the complex bins of the last fftLen samples, 2 * numBins values
+ */
+  void arm_sliding_dft_f32(
+  arm_sliding_dft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst);
+
+/**
+  @brief         Size of the buffer of a Q31 sliding DFT.
+  @param[in]     numBins  number of frequency bins
+  @param[in]     fftLen   length of the sliding window
+  @return        number of q31_t values of the buffer
+ */
+  uint32_t arm_sliding_dft_buffer_size_q31(
+  uint16_t numBins,
+  uint16_t fftLen);
+
+/**
+  @brief         Initialization of a Q31 sliding DFT.
+  @param[out]    S        points to the sliding DFT instance structure
+  @param[in]     numBins  number of frequency bins
+  @param[in]     pBins    points to the bin indexes, numBins values smaller than fftLen
+  @param[in]     fftLen   length of the sliding window, at least 2
+  @param[in]     pBuffer  points to the buffer of arm_sliding_dft_buffer_size_q31() values
+  @return        execution status
+ */
+  arm_status arm_sliding_dft_init_q31(
+  arm_sliding_dft_instance_q31 * S,
+  uint16_t numBins,
+  const uint16_t * pBins,
+  uint16_t fftLen,
+  q31_t * pBuffer);
+
+/**
+  @brief         Clears the window of a Q31 sliding DFT.
+  @param[in,out] S  points to the sliding DFT instance structure
+ */
+  void arm_sliding_dft_reset_q31(
+  arm_sliding_dft_instance_q31 * S);
+
+/**
+  @brief         Q31 sliding DFT.
+  @param[in,out] S          points to the sliding DFT instance structure
+  @param[in]     pSrc       points to the new samples
+  @param[in]     blockSize  number of new samples
+  @param[out]    pDst       points to the complex bins of the last fftLen samples scaled by
+                            2^-postShift, 2 * numBins values
+ */
+  void arm_sliding_dft_q31(
+  arm_sliding_dft_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pDst);
+
 #ifdef   __cplusplus
 }
 #endif
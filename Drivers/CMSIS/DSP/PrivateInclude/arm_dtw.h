@@ -0,0 +1,141 @@
+/******************************************************************************
+ * @file     arm_dtw.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.0.0
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ARM_DTW_H_
+#define ARM_DTW_H_
+
+#include "dsp/distance_functions.h"
+#include <math.h>
+#include <stdlib.h>
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief        Same test as the matrix built by arm_dtw_init_window_q7()
+ * @param[in]    S               points to the DTW instance
+ * @param[in]    q               query index
+ * @param[in]    t               template index
+ * @param[in]    queryLength     query length
+ * @param[in]    templateLength  template length
+ * @return 1 if the cell is inside the window
+ */
+__STATIC_INLINE int32_t arm_dtw_in_window(
+  const arm_dtw_instance_f32 *S,
+  int32_t q,
+  int32_t t,
+  int32_t queryLength,
+  int32_t templateLength)
+{
+  float32_t diag;
+
+  switch (S->windowType)
+  {
+    case ARM_DTW_SAKOE_CHIBA_WINDOW:
+      return (abs(q - t) <= S->windowSize);
+
+    case ARM_DTW_SLANTED_BAND_WINDOW:
+      diag = (1.0f * q * templateLength / queryLength);
+      return (fabsf((float32_t)t - diag) <= (float32_t)S->windowSize);
+
+    default:
+      return 1;
+  }
+}
+
+/**
+ * @brief        Template indices of a query row inside the window
+ * @param[in]    S               points to the DTW instance
+ * @param[in]    q               query index
+ * @param[in]    queryLength     query length
+ * @param[in]    templateLength  template length
+ * @param[out]   pLo             first template index
+ * @param[out]   pHi             last template index, lower than *pLo if the row is empty
+ *
+ * The band is estimated from the window equation then adjusted with the exact
+ * test so that it contains the same cells as the window matrix.
+ */
+__STATIC_INLINE void arm_dtw_window_band(
+  const arm_dtw_instance_f32 *S,
+  int32_t q,
+  int32_t queryLength,
+  int32_t templateLength,
+  int32_t *pLo,
+  int32_t *pHi)
+{
+  int32_t lo;
+  int32_t hi;
+  float32_t diag;
+
+  switch (S->windowType)
+  {
+    case ARM_DTW_SAKOE_CHIBA_WINDOW:
+      lo = q - S->windowSize;
+      hi = q + S->windowSize;
+      break;
+
+    case ARM_DTW_SLANTED_BAND_WINDOW:
+      diag = (1.0f * q * templateLength / queryLength);
+      lo = (int32_t)ceilf(diag - (float32_t)S->windowSize);
+      hi = (int32_t)floorf(diag + (float32_t)S->windowSize);
+      break;
+
+    default:
+      lo = 0;
+      hi = templateLength - 1;
+      break;
+  }
+
+  lo = (lo < 0) ? 0 : lo;
+  hi = (hi > (templateLength - 1)) ? (templateLength - 1) : hi;
+
+  /* Rounding of the window equation at the edges */
+  while ((lo <= hi) && !arm_dtw_in_window(S, q, lo, queryLength, templateLength))
+  {
+    lo++;
+  }
+  while ((lo > 0) && arm_dtw_in_window(S, q, lo - 1, queryLength, templateLength))
+  {
+    lo--;
+  }
+  while ((hi >= lo) && !arm_dtw_in_window(S, q, hi, queryLength, templateLength))
+  {
+    hi--;
+  }
+  while ((hi < (templateLength - 1)) && (hi >= lo) && arm_dtw_in_window(S, q, hi + 1, queryLength, templateLength))
+  {
+    hi++;
+  }
+
+  *pLo = lo;
+  *pHi = hi;
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* #ifndef ARM_DTW_H_ */
@@ -0,0 +1,79 @@
+/******************************************************************************
+ * @file     arm_dynamic_tables.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.0.0
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef ARM_DYNAMIC_TABLES_H_
+#define ARM_DYNAMIC_TABLES_H_
+
+#include "arm_math_types.h"
+#include <math.h>
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/* 2 * pi in double precision */
+#define ARM_DYNAMIC_TABLES_2PI  6.28318530717958647692
+
+/**
+ * @brief        Angle of a twiddle factor
+ * @param[in]    i  index of the twiddle factor
+ * @param[in]    N  length of the transform
+ * @return       2 * pi * i / N, computed in the order of the table generator
+ */
+__STATIC_FORCEINLINE float64_t arm_dynamic_tables_angle(
+  uint32_t i,
+  uint32_t N)
+{
+  return (ARM_DYNAMIC_TABLES_2PI * (float64_t)i) / (float64_t)N;
+}
+
+/**
+ * @brief        Value of the static FFT tables of arm_common_tables.c
+ * @param[in]    x  value in double precision
+ * @return       x as printed with 9 decimals in the table sources
+ */
+__STATIC_FORCEINLINE float32_t arm_dynamic_tables_value_f32(
+  float64_t x)
+{
+  return (float32_t)(round(x * 1e9) / 1e9);
+}
+
+/**
+ * @brief        Value of the static FFT tables of arm_mve_tables.c
+ * @param[in]    x  value in double precision
+ * @return       x rounded to float32_t, then printed with 20 decimals in the table sources
+ */
+__STATIC_FORCEINLINE float32_t arm_dynamic_tables_mve_value_f32(
+  float64_t x)
+{
+  return (float32_t)(round((float64_t)(float32_t)x * 1e20) / 1e20);
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ARM_DYNAMIC_TABLES_H_ */
@@ -0,0 +1,125 @@
+/******************************************************************************
+ * @file     arm_image_resize.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.0.0
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef ARM_IMAGE_RESIZE_H_
+#define ARM_IMAGE_RESIZE_H_
+
+#include "dsp/interpolation_functions.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief        Interpolates the crop row of an output row between its two source rows
+ * @param[in]    S     points to an instance of the image resize structure
+ * @param[in]    pSrc  points to the source frame
+ * @param[in]    row   output row
+ *
+ * The line buffer receives the <code>cropCols * numChannels</code> values in Q7
+ * (pixel value times 128, rounded).
+ */
+__STATIC_FORCEINLINE void arm_image_resize_vertical(
+  const arm_image_resize_instance * S,
+  const uint8_t * pSrc,
+        uint32_t row)
+{
+  const uint8_t *pTop = &pSrc[S->srcOffset + ((uint32_t)S->pRowIndex[row] * S->srcStride)];
+  const uint8_t *pBot = &pTop[S->srcStride];
+  const uint32_t wBot = S->pRowWeight[row];
+  const uint32_t wTop = ARM_IMAGE_RESIZE_ONE - wBot;
+  uint16_t *pLine = S->pLine;
+  uint32_t blkCnt;
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+  uint32x4_t vecAcc;
+
+  blkCnt = ((uint32_t)S->cropCols * S->numChannels) >> 2U;
+  while (blkCnt > 0U)
+  {
+    vecAcc = vmulq_n_u32(vldrbq_u32(pTop), wTop);
+    vecAcc = vmlaq_n_u32(vecAcc, vldrbq_u32(pBot), wBot);
+    vstrhq_u32(pLine, vrshrq_n_u32(vecAcc, 8));
+
+    pTop += 4;
+    pBot += 4;
+    pLine += 4;
+    blkCnt--;
+  }
+  blkCnt = ((uint32_t)S->cropCols * S->numChannels) & 0x3U;
+#else
+  blkCnt = (uint32_t)S->cropCols * S->numChannels;
+#endif
+
+  while (blkCnt > 0U)
+  {
+    *pLine++ = (uint16_t)((((uint32_t)*pTop++ * wTop) + ((uint32_t)*pBot++ * wBot) + 128U) >> 8);
+    blkCnt--;
+  }
+}
+
+/**
+ * @brief        Interpolates an output value in the line buffer
+ * @param[in]    S  points to an instance of the image resize structure
+ * @param[in]    j  output value in the row (column times numChannels plus channel)
+ * @return       pixel value in Q22
+ */
+__STATIC_FORCEINLINE int32_t arm_image_resize_horizontal(
+  const arm_image_resize_instance * S,
+        uint32_t j)
+{
+  const uint16_t *pLeft = &S->pLine[S->pColIndex[j]];
+  int32_t left = (int32_t)pLeft[0];
+  int32_t right = (int32_t)pLeft[S->numChannels];
+
+  return (left << 15) + ((right - left) * (int32_t)S->pColWeight[j]);
+}
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+/**
+ * @brief        Interpolates 4 output values in the line buffer
+ * @param[in]    S  points to an instance of the image resize structure
+ * @param[in]    j  first output value in the row
+ * @return       pixel values in Q22
+ */
+__STATIC_FORCEINLINE int32x4_t arm_image_resize_horizontal_vec(
+  const arm_image_resize_instance * S,
+        uint32_t j)
+{
+  uint32x4_t vecIdx = vldrhq_u32(&S->pColIndex[j]);
+  int32x4_t vecW = vreinterpretq_s32_u32(vldrhq_u32(&S->pColWeight[j]));
+  int32x4_t vecLeft = vreinterpretq_s32_u32(vldrhq_gather_shifted_offset_u32(S->pLine, vecIdx));
+  int32x4_t vecRight = vreinterpretq_s32_u32(vldrhq_gather_shifted_offset_u32(&S->pLine[S->numChannels], vecIdx));
+
+  return vaddq_s32(vshlq_n_s32(vecLeft, 15), vmulq_s32(vsubq_s32(vecRight, vecLeft), vecW));
+}
+#endif
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ARM_IMAGE_RESIZE_H_ */
@@ -0,0 +1,54 @@
+/******************************************************************************
+ * @file     arm_mat_small.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.0.0
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ARM_MAT_SMALL_H_
+#define ARM_MAT_SMALL_H_
+
+#include "dsp/matrix_functions.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Full unrolling of a loop with a compile-time trip count
+ *
+ * The kernels of the small matrix functions and of the Kalman filter have loops of
+ * at most ARM_MAT_SMALL_MAX_DIM squared iterations. Without the hint, compilers
+ * at -O2 keep the outer loops rolled, with the local matrices in memory.
+ */
+#if defined(__clang__)
+  #define ARM_MAT_SMALL_UNROLL _Pragma("clang loop unroll(full)")
+#elif defined(__GNUC__) && (__GNUC__ >= 8)
+  #define ARM_MAT_SMALL_UNROLL _Pragma("GCC unroll 36")
+#else
+  #define ARM_MAT_SMALL_UNROLL
+#endif
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ARM_MAT_SMALL_H_ */
@@ -0,0 +1,110 @@
+/******************************************************************************
+ * @file     arm_sliding_stats.h
+ * @brief    Private header file for CMSIS DSP Library
+ * @version  V1.0.0
+ * @date     18 October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2010-2026 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ARM_SLIDING_STATS_H_
+#define ARM_SLIDING_STATS_H_
+
+#include "dsp/statistics_functions.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief        Removes the first position of a queue if it is the sample leaving the window
+ * @param[in,out] Q           points to the queue
+ * @param[in]     pos         position of the sample leaving the window
+ * @param[in]     windowSize  number of samples of the window
+ */
+__STATIC_FORCEINLINE void arm_sliding_queue_expire(
+  arm_sliding_deque_instance * Q,
+  uint32_t pos,
+  uint32_t windowSize)
+{
+  if ((Q->count > 0U) && (Q->pPos[Q->head] == pos))
+  {
+    Q->head = (Q->head + 1U == windowSize) ? 0U : (Q->head + 1U);
+    Q->count--;
+  }
+}
+
+/**
+ * @brief        Last position of a non empty queue
+ * @param[in]    Q           points to the queue
+ * @param[in]    windowSize  number of samples of the window
+ * @return       position in the window buffer
+ */
+__STATIC_FORCEINLINE uint32_t arm_sliding_queue_back(
+  const arm_sliding_deque_instance * Q,
+  uint32_t windowSize)
+{
+  uint32_t i = Q->head + Q->count - 1U;
+
+  return Q->pPos[(i >= windowSize) ? (i - windowSize) : i];
+}
+
+/**
+ * @brief        Appends a position to a queue
+ * @param[in,out] Q           points to the queue
+ * @param[in]     pos         position of the new sample
+ * @param[in]     windowSize  number of samples of the window
+ */
+__STATIC_FORCEINLINE void arm_sliding_queue_push(
+  arm_sliding_deque_instance * Q,
+  uint32_t pos,
+  uint32_t windowSize)
+{
+  uint32_t i = Q->head + Q->count;
+
+  Q->pPos[(i >= windowSize) ? (i - windowSize) : i] = pos;
+  Q->count++;
+}
+
+/**
+ * @brief        Index in the window of the first position of a queue
+ * @param[in]    Q           points to the queue
+ * @param[in]    count       number of samples in the window
+ * @param[in]    index       position of the next sample in the window buffer
+ * @param[in]    windowSize  number of samples of the window
+ * @return       index from the oldest sample of the window
+ */
+__STATIC_FORCEINLINE uint32_t arm_sliding_queue_front_index(
+  const arm_sliding_deque_instance * Q,
+  uint32_t count,
+  uint32_t index,
+  uint32_t windowSize)
+{
+  /* The oldest sample is at position 0 until the window is full */
+  uint32_t oldest = (count == windowSize) ? index : 0U;
+  uint32_t pos = Q->pPos[Q->head];
+
+  return (pos >= oldest) ? (pos - oldest) : (pos + windowSize - oldest);
+}
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ARM_SLIDING_STATS_H_ */
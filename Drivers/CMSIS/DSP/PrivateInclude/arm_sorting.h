@@ -104,6 +104,222 @@ extern "C"
           float32_t * pDst,
           uint32_t blockSize);
 
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_radix_sort_f32(
+    const arm_sort_instance_f32 * S,
+          float32_t * pSrc,
+          float32_t * pDst,
+          uint32_t blockSize);
+
+  /**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pIndex     points to the indices of the sorted data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_radix_argsort_f32(
+    const arm_sort_instance_f32 * S,
+    const float32_t * pSrc,
+          uint32_t * pIndex,
+          uint32_t blockSize);
+
+/**
+ * @brief Order of the argsorts: true if the element of index a is placed before
+ *        the element of index b. Equal values are placed in the order of their indices.
+ */
+__STATIC_FORCEINLINE int32_t arm_argsort_before_f32(
+  const float32_t * pSrc,
+  uint32_t a,
+  uint32_t b,
+  uint8_t dir)
+{
+    float32_t x = pSrc[a];
+    float32_t y = pSrc[b];
+
+    if (x == y)
+    {
+        return (a < b) ? 1 : 0;
+    }
+
+    return (dir == (uint8_t)ARM_SORT_ASCENDING) ? ((x < y) ? 1 : 0) : ((x > y) ? 1 : 0);
+}
+
+/* Number of buckets of the radix sorts: digits of 8 bits */
+#define ARM_RADIX_SORT_BUCKETS 256U
+
+/**
+ * @brief Stable LSD radix sort of unsigned 32-bit keys, 8 bits per pass.
+ * @param[in,out] pKey       keys, sorted on return
+ * @param[in]     pKeyTmp    working buffer of blockSize keys
+ * @param[in,out] pIndex     values moved with the keys, NULL if none
+ * @param[in]     pIndexTmp  working buffer of blockSize values, unused if pIndex is NULL
+ * @param[in]     blockSize  number of keys
+ *
+ * A pass is skipped when all the keys have the same digit.
+ */
+__STATIC_INLINE void arm_radix_sort_u32(
+  uint32_t * pKey,
+  uint32_t * pKeyTmp,
+  uint32_t * pIndex,
+  uint32_t * pIndexTmp,
+  uint32_t blockSize)
+{
+    uint32_t count[ARM_RADIX_SORT_BUCKETS];
+    uint32_t *pIn = pKey;
+    uint32_t *pOut = pKeyTmp;
+    uint32_t *pIdxIn = pIndex;
+    uint32_t *pIdxOut = pIndexTmp;
+    uint32_t *pTmp;
+    uint32_t shift, i, d, sum, c;
+
+    if (blockSize < 2U)
+    {
+        return;
+    }
+
+    for (shift = 0U; shift < 32U; shift += 8U)
+    {
+        for (d = 0U; d < ARM_RADIX_SORT_BUCKETS; d++)
+        {
+            count[d] = 0U;
+        }
+        for (i = 0U; i < blockSize; i++)
+        {
+            count[(pIn[i] >> shift) & 0xFFU]++;
+        }
+
+        if (count[(pIn[0] >> shift) & 0xFFU] == blockSize)
+        {
+            continue;
+        }
+
+        /* Bucket start positions */
+        sum = 0U;
+        for (d = 0U; d < ARM_RADIX_SORT_BUCKETS; d++)
+        {
+            c = count[d];
+            count[d] = sum;
+            sum += c;
+        }
+
+        if (pIdxIn != NULL)
+        {
+            for (i = 0U; i < blockSize; i++)
+            {
+                d = count[(pIn[i] >> shift) & 0xFFU]++;
+                pOut[d] = pIn[i];
+                pIdxOut[d] = pIdxIn[i];
+            }
+            pTmp = pIdxIn; pIdxIn = pIdxOut; pIdxOut = pTmp;
+        }
+        else
+        {
+            for (i = 0U; i < blockSize; i++)
+            {
+                pOut[count[(pIn[i] >> shift) & 0xFFU]++] = pIn[i];
+            }
+        }
+        pTmp = pIn; pIn = pOut; pOut = pTmp;
+    }
+
+    if (pIn != pKey)
+    {
+        memcpy(pKey, pIn, blockSize * sizeof(uint32_t));
+        if (pIndex != NULL)
+        {
+            memcpy(pIndex, pIdxIn, blockSize * sizeof(uint32_t));
+        }
+    }
+}
+
+/**
+ * @brief Stable LSD radix sort of unsigned 16-bit keys, 8 bits per pass.
+ * @param[in,out] pKey       keys, sorted on return
+ * @param[in]     pKeyTmp    working buffer of blockSize keys
+ * @param[in,out] pIndex     values moved with the keys, NULL if none
+ * @param[in]     pIndexTmp  working buffer of blockSize values, unused if pIndex is NULL
+ * @param[in]     blockSize  number of keys
+ */
+__STATIC_INLINE void arm_radix_sort_u16(
+  uint16_t * pKey,
+  uint16_t * pKeyTmp,
+  uint32_t * pIndex,
+  uint32_t * pIndexTmp,
+  uint32_t blockSize)
+{
+    uint32_t count[ARM_RADIX_SORT_BUCKETS];
+    uint16_t *pIn = pKey;
+    uint16_t *pOut = pKeyTmp;
+    uint16_t *pTmp;
+    uint32_t *pIdxIn = pIndex;
+    uint32_t *pIdxOut = pIndexTmp;
+    uint32_t *pIdxTmp;
+    uint32_t shift, i, d, sum, c;
+
+    if (blockSize < 2U)
+    {
+        return;
+    }
+
+    for (shift = 0U; shift < 16U; shift += 8U)
+    {
+        for (d = 0U; d < ARM_RADIX_SORT_BUCKETS; d++)
+        {
+            count[d] = 0U;
+        }
+        for (i = 0U; i < blockSize; i++)
+        {
+            count[((uint32_t)pIn[i] >> shift) & 0xFFU]++;
+        }
+
+        if (count[((uint32_t)pIn[0] >> shift) & 0xFFU] == blockSize)
+        {
+            continue;
+        }
+
+        sum = 0U;
+        for (d = 0U; d < ARM_RADIX_SORT_BUCKETS; d++)
+        {
+            c = count[d];
+            count[d] = sum;
+            sum += c;
+        }
+
+        if (pIdxIn != NULL)
+        {
+            for (i = 0U; i < blockSize; i++)
+            {
+                d = count[((uint32_t)pIn[i] >> shift) & 0xFFU]++;
+                pOut[d] = pIn[i];
+                pIdxOut[d] = pIdxIn[i];
+            }
+            pIdxTmp = pIdxIn; pIdxIn = pIdxOut; pIdxOut = pIdxTmp;
+        }
+        else
+        {
+            for (i = 0U; i < blockSize; i++)
+            {
+                pOut[count[((uint32_t)pIn[i] >> shift) & 0xFFU]++] = pIn[i];
+            }
+        }
+        pTmp = pIn; pIn = pOut; pOut = pTmp;
+    }
+
+    if (pIn != pKey)
+    {
+        memcpy(pKey, pIn, blockSize * sizeof(uint16_t));
+        if (pIndex != NULL)
+        {
+            memcpy(pIndex, pIdxIn, blockSize * sizeof(uint32_t));
+        }
+    }
+}
+
 #if defined(ARM_MATH_NEON)
 
 #define vtrn256_128q(a, b)                   \
@@ -1578,6 +1578,90 @@ extern "C"
 
 #endif /* (defined(ARM_MATH_MVEI) || defined(ARM_MATH_HELIUM)) */
 
+/*
+ * Spectra in the arm_rfft_fast_f32() packed format:
+ * {X[0] (real), X[N/2] (real), re(X[1]), im(X[1]), ..., re(X[N/2-1]), im(X[N/2-1])}
+ */
+
+/**
+  @brief         pAcc += pA * pB for two spectra in the arm_rfft_fast_f32() packed format.
+  @param[in]     pA      points to the first spectrum
+  @param[in]     pB      points to the second spectrum
+  @param[in,out] pAcc    points to the accumulated spectrum
+  @param[in]     fftLen  real FFT length
+ */
+__STATIC_INLINE void arm_rfft_fast_cmac_f32(
+  const float32_t * pA,
+  const float32_t * pB,
+        float32_t * pAcc,
+        uint32_t fftLen)
+{
+  uint32_t blkCnt;
+  float32_t aRe, aIm, bRe, bIm;
+
+  /* DC and Nyquist bins are real */
+  pAcc[0] += pA[0] * pB[0];
+  pAcc[1] += pA[1] * pB[1];
+  pA += 2;
+  pB += 2;
+  pAcc += 2;
+
+  blkCnt = (fftLen - 2U) >> 1;
+
+  while (blkCnt > 0U)
+  {
+    aRe = *pA++;
+    aIm = *pA++;
+    bRe = *pB++;
+    bIm = *pB++;
+    *pAcc++ += (aRe * bRe) - (aIm * bIm);
+    *pAcc++ += (aRe * bIm) + (aIm * bRe);
+    blkCnt--;
+  }
+}
+
+/**
+  @brief         Computes the contribution of the past partitions of an FFT based
+                 FIR filter to the next partition, from its frequency domain delay line.
+  @param[in,out] S  points to an instance of the FFT based FIR filter structure
+ */
+__STATIC_INLINE void arm_fir_fft_history_f32(
+  arm_fir_fft_instance_f32 * S)
+{
+  const uint32_t fftLen = 2U * S->partLen;
+  const uint32_t numSlot = (uint32_t)S->numPart - 1U;
+  uint32_t part;
+  uint32_t slot = S->fdlIndex;
+
+  arm_fill_f32(0.0f, S->pHist, fftLen);
+
+  /* Partition p applies to the spectrum received p - 1 partitions ago */
+  for (part = 1U; part <= numSlot; part++)
+  {
+    arm_rfft_fast_cmac_f32(&S->pFdl[slot * fftLen], &S->pSpectra[part * fftLen], S->pHist, fftLen);
+    slot = (slot == 0U) ? (numSlot - 1U) : (slot - 1U);
+  }
+}
+
+/**
+  @brief         Stores a new spectrum in the frequency domain delay line of an
+                 FFT based FIR filter, over the oldest one.
+  @param[in,out] S     points to an instance of the FFT based FIR filter structure
+  @param[in]     pSrc  points to the spectrum
+ */
+__STATIC_INLINE void arm_fir_fft_push_f32(
+        arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc)
+{
+  const uint32_t numSlot = (uint32_t)S->numPart - 1U;
+
+  if (numSlot > 0U)
+  {
+    S->fdlIndex = (S->fdlIndex + 1U == numSlot) ? 0U : (S->fdlIndex + 1U);
+    arm_copy_f32(pSrc, &S->pFdl[S->fdlIndex * 2U * S->partLen], 2U * S->partLen);
+  }
+}
+
 #ifdef   __cplusplus
 }
 #endif
@@ -0,0 +1,592 @@
+#!/usr/bin/env python3
+# Generates Source/CommonTables/arm_common_tables.c of this CMSIS-DSP package.
+#
+# arm_common_tables.c is not part of the package. The tables are computed
+# from the formulas of their documentation, with the lengths declared in
+# Include/arm_common_tables.h:
+#   python3 Scripts/gen_common_tables.py [output file]
+import math, os, re, struct, sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+hdr = open(ROOT + '/Include/arm_common_tables.h').read()
+LEN_F32 = {int(n): int(v) for n, v in re.findall(r'#define ARMBITREVINDEXTABLE_(\d+)_TABLE_LENGTH \(\(uint16_t\)(\d+)\)', hdr)}
+LEN_F64 = {int(n): int(v) for n, v in re.findall(r'#define ARMBITREVINDEXTABLEF64_(\d+)_TABLE_LENGTH \(\(uint16_t\)(\d+)\)', hdr)}
+LEN_FIX = {int(n): int(v) for n, v in re.findall(r'#define ARMBITREVINDEXTABLE_FIXED_(\d+)_TABLE_LENGTH \(\(uint16_t\)(\d+)\)', hdr)}
+SIZES = [16, 32, 64, 128, 256, 512, 1024, 2048, 4096]
+
+out = []
+w = out.append
+
+
+def fx(x, b):
+    v = int(round(x * (1 << b)))
+    return max(-(1 << b), min((1 << b) - 1, v))
+
+
+def hx(v, b):
+    return '0x%0*X' % ((b + 1) // 4, v & ((1 << (b + 1)) - 1))
+
+
+def f32s(x):
+    s = '%.9f' % x
+    return s + 'f'
+
+
+def f64h(x):
+    return '0x%016X' % struct.unpack('<Q', struct.pack('<d', x))[0]
+
+
+def emit(ctype, name, vals, per_line, dim=None):
+    w('const %s %s[%s] ARM_DSP_TABLE_ATTRIBUTE = {' % (ctype, name, dim if dim else len(vals)))
+    for i in range(0, len(vals), per_line):
+        w('    ' + ', '.join(vals[i:i + per_line]) + ',')
+    w('};')
+    w('')
+
+
+def doc(lines):
+    w('/**')
+    for l in lines:
+        w(('* ' + l).rstrip())
+    w('*/')
+
+
+def bitrev(i, bits):
+    return int(format(i, '0%db' % bits)[::-1], 2) if bits else 0
+
+
+def digit_rev(p, base, digits):
+    r = 0
+    for _ in range(digits):
+        r = r * base + p % base
+        p //= base
+    return r
+
+
+def radix8_perm(N):
+    # Bin held at each position of the output of arm_cfft_f32 before its
+    # final bit reversal: radix-8 stages in base 8 digit reversed order, after
+    # a first radix-2 (arm_cfft_radix8by2_f32) or radix-4 (arm_cfft_radix8by4_f32)
+    # stage that splits the bins by their value modulo 2 or 4.
+    L = N.bit_length() - 1
+    first = 1 << (L % 3)
+    M = N // first
+    return [first * digit_rev(p % M, 8, L // 3) + p // M for p in range(N)]
+
+
+def swaps_from_perm(perm):
+    cur = perm[:]
+    pos = {x: i for i, x in enumerate(cur)}
+    sw = []
+    for k in range(len(cur)):
+        if cur[k] != k:
+            j = pos[k]
+            sw.append((k, j))
+            a, b = cur[k], cur[j]
+            cur[k], cur[j] = b, a
+            pos[b] = k
+            pos[a] = j
+    return sw
+
+
+def bitrev_pairs(N):
+    L = N.bit_length() - 1
+    v = []
+    for i in range(N):
+        r = bitrev(i, L)
+        if i < r:
+            v += [str(i * 8), str(r * 8)]
+    return v
+
+
+def twid_doc(N, extra):
+    return ['\\par',
+            'Example code for %s Twiddle factors Generation:' % extra[0],
+            '\\par',
+            '<pre>for (i = 0; i < %s; i++)' % extra[1],
+            '{',
+            '%s' % extra[2],
+            '%s' % extra[3],
+            '} </pre>',
+            '\\par',
+            'where N = %d and PI = 3.14159265358979' % N,
+            '\\par',
+            'Cos and Sin values are in interleaved fashion',
+            '']
+
+
+HEADER = '''/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_common_tables.c
+ * Description:  common tables like fft twiddle factors, Bitreverse, reciprocal etc
+ *
+ * GENERATED FILE, DO NOT EDIT: made by Scripts/gen_common_tables.py
+ *
+ * This is not the arm_common_tables.c of the CMSIS-DSP releases, which is
+ * not part of this package. The tables are computed from the formulas of
+ * their documentation, with the lengths of arm_common_tables.h. The bit
+ * reversal tables give the permutations of the release tables, with the
+ * swaps in a different order.
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math_types.h"
+#include "arm_common_tables.h"
+
+/**
+  @ingroup ComplexFFT
+ */
+
+/**
+  @addtogroup CFFT_CIFFT Complex FFT Tables
+  @{
+ */
+'''
+w(HEADER)
+
+# ---------------------------------------------------------------- armBitRevTable
+doc(['\\par',
+     'Pseudo code for Generation of Bit reversal Table is',
+     '\\par',
+     '<pre>for (l = 1; l <= N/4; l++)',
+     '{',
+     '  for (i = 0; i < logN2; i++)',
+     '  {',
+     '    a[i] = l & (1 << i);',
+     '  }',
+     '  for (j = 0; j < logN2; j++)',
+     '  {',
+     '    if (a[j] != 0)',
+     '    y[l] += (1 << ((logN2 - 1) - j));',
+     '  }',
+     '  y[l] = y[l] >> 1;',
+     ' } </pre>',
+     '\\par',
+     'where N = 4096, logN2 = 12',
+     '\\par',
+     'N is the maximum FFT Size supported',
+     ''])
+emit('uint16_t', 'armBitRevTable', [hx(bitrev(k + 1, 12) >> 1, 15) for k in range(1024)], 8)
+
+# ---------------------------------------------------------------- F64 twiddles
+for N in SIZES:
+    doc(twid_doc(N, ('Double Precision Floating-point', 'N',
+                     'twiddleCoefF64[2*i]   = cos(i * 2*PI/(double)N);',
+                     'twiddleCoefF64[2*i+1] = sin(i * 2*PI/(double)N);')))
+    v = []
+    for i in range(N):
+        v += ['(uint64_t)' + f64h(math.cos(2 * math.pi * i / N)), '(uint64_t)' + f64h(math.sin(2 * math.pi * i / N))]
+    emit('uint64_t', 'twiddleCoefF64_%d' % N, v, 2)
+
+# ---------------------------------------------------------------- f32 twiddles
+for N in SIZES:
+    doc(twid_doc(N, ('Floating-point', 'N',
+                     'twiddleCoef[2*i]   = cos(i * 2*PI/(float)N);',
+                     'twiddleCoef[2*i+1] = sin(i * 2*PI/(float)N);')))
+    v = []
+    for i in range(N):
+        v += [f32s(math.cos(2 * math.pi * i / N)), f32s(math.sin(2 * math.pi * i / N))]
+    emit('float32_t', 'twiddleCoef_%d' % N, v, 2)
+
+# ---------------------------------------------------------------- q31 / q15 twiddles
+for b, t in ((31, 'q31'), (15, 'q15')):
+    for N in SIZES:
+        doc(['\\par',
+             'Example code for %s Twiddle factors Generation:' % t.upper(),
+             '\\par',
+             '<pre>for (i = 0; i < 3N/4; i++)',
+             '{',
+             '   twiddleCoef%s[2*i]   = cos(i * 2*PI/(float)N);' % t.upper(),
+             '   twiddleCoef%s[2*i+1] = sin(i * 2*PI/(float)N);' % t.upper(),
+             '} </pre>',
+             '\\par',
+             'where N = %d and PI = 3.14159265358979' % N,
+             '\\par',
+             'Cos and Sin values are interleaved fashion',
+             '\\par',
+             'Convert Floating point to %s (Fixed point 1.%d):' % (t.upper(), b),
+             '   round(twiddleCoef%s(i) * pow(2, %d))' % (t.upper(), b),
+             ''])
+        v = []
+        for i in range(3 * N // 4):
+            v += [hx(fx(math.cos(2 * math.pi * i / N), b), b), hx(fx(math.sin(2 * math.pi * i / N), b), b)]
+        emit('q%d_t' % b, 'twiddleCoef_%d_%s' % (N, t), v, 8 if b == 31 else 8)
+
+# ---------------------------------------------------------------- rfft twiddles
+for N in SIZES[1:]:
+    doc(['\\par',
+         'Example code for Double Precision Floating-point RFFT Twiddle factors Generation:',
+         '\\par',
+         '<pre>for (i = 0; i < N/2; i++)',
+         '{',
+         '   twiddleCoefF64_rfft[2*i]   = sin(i * 2*PI/(double)N);',
+         '   twiddleCoefF64_rfft[2*i+1] = cos(i * 2*PI/(double)N);',
+         '} </pre>',
+         '\\par',
+         'where N = %d, PI = 3.14159265358979' % N,
+         ''])
+    v = []
+    for i in range(N // 2):
+        v += ['(uint64_t)' + f64h(math.sin(2 * math.pi * i / N)), '(uint64_t)' + f64h(math.cos(2 * math.pi * i / N))]
+    emit('uint64_t', 'twiddleCoefF64_rfft_%d' % N, v, 2)
+
+for N in SIZES[1:]:
+    doc(['\\par',
+         'Example code for Floating-point RFFT Twiddle factors Generation:',
+         '\\par',
+         '<pre>for (i = 0; i < N/2; i++)',
+         '{',
+         '   twiddleCoef_rfft[2*i]   = sin(i * 2*PI/(float)N);',
+         '   twiddleCoef_rfft[2*i+1] = cos(i * 2*PI/(float)N);',
+         '} </pre>',
+         '\\par',
+         'where N = %d, PI = 3.14159265358979' % N,
+         ''])
+    v = []
+    for i in range(N // 2):
+        v += [f32s(math.sin(2 * math.pi * i / N)), f32s(math.cos(2 * math.pi * i / N))]
+    emit('float32_t', 'twiddleCoef_rfft_%d' % N, v, 2)
+
+# ---------------------------------------------------------------- bit reversal index tables
+w('/*')
+w('* @brief  Double Precision Floating-point bit reversal tables')
+w('* @ingroup DSPConstants')
+w('*/')
+w('')
+for N in SIZES:
+    v = bitrev_pairs(N)
+    assert len(v) == LEN_F64[N], (N, len(v))
+    emit('uint16_t', 'armBitRevIndexTableF64_%d' % N, v, 8, 'ARMBITREVINDEXTABLEF64_%d_TABLE_LENGTH' % N)
+
+w('/*')
+w('* @brief  Floating-point bit reversal tables')
+w('* @ingroup DSPConstants')
+w('*/')
+w('')
+for N in SIZES:
+    sw = swaps_from_perm(radix8_perm(N))
+    assert 2 * len(sw) <= LEN_F32[N], (N, len(sw), LEN_F32[N])
+    v = []
+    for a, b in sw:
+        v += [str(a * 8), str(b * 8)]
+    # pad with self-swaps of element 0 so the table keeps the length declared in the header
+    while len(v) < LEN_F32[N]:
+        v += ['0', '0']
+    emit('uint16_t', 'armBitRevIndexTable%d' % N, v, 8, 'ARMBITREVINDEXTABLE_%d_TABLE_LENGTH' % N)
+
+w('/*')
+w('* @brief  Q31 bit reversal tables')
+w('* @ingroup DSPConstants')
+w('*/')
+w('')
+for N in SIZES:
+    v = bitrev_pairs(N)
+    assert len(v) == LEN_FIX[N], (N, len(v))
+    emit('uint16_t', 'armBitRevIndexTable_fixed_%d' % N, v, 8, 'ARMBITREVINDEXTABLE_FIXED_%d_TABLE_LENGTH' % N)
+
+w('/**')
+w('  @} end of CFFT_CIFFT group')
+w('*/')
+w('')
+
+# ---------------------------------------------------------------- real FFT
+w('''/**
+  @ingroup RealFFT
+ */
+
+/**
+  @addtogroup RealFFT_Table Real FFT Tables
+  @{
+ */
+''')
+n = 4096
+for nm, sgn in (('realCoefA', -1), ('realCoefB', 1)):
+    doc(['\\par',
+         'Generation of realCoef%s array:' % nm[-1],
+         '\\par',
+         'n = 4096',
+         '<pre>for (i = 0; i < n; i++)',
+         '{',
+         '   pATable[2 * i]     = 0.5 * ( 1.0 %s sin (2 * PI / (double) (2 * n) * (double) i));' % ('-' if sgn < 0 else '+'),
+         '   pATable[2 * i + 1] = 0.5 * (%s1.0 * cos (2 * PI / (double) (2 * n) * (double) i));' % ('-' if sgn < 0 else ' '),
+         '} </pre>',
+         ''])
+    v = []
+    for i in range(n):
+        a = 2 * math.pi * i / (2 * n)
+        v += [f32s(0.5 * (1 + sgn * math.sin(a))), f32s(0.5 * sgn * math.cos(a))]
+    emit('float32_t', nm, v, 2)
+
+for b, t in ((31, 'Q31'), (15, 'Q15')):
+    for nm, sgn in (('realCoefA', -1), ('realCoefB', 1)):
+        doc(['\\par',
+             'Generation of realCoef%s%s array:' % (nm[-1], t),
+             '\\par',
+             'n = 4096',
+             '<pre>for (i = 0; i < n; i++)',
+             '{',
+             '   pATable[2 * i]     = 0.5 * ( 1.0 %s sin (2 * PI / (double) (2 * n) * (double) i));' % ('-' if sgn < 0 else '+'),
+             '   pATable[2 * i + 1] = 0.5 * (%s1.0 * cos (2 * PI / (double) (2 * n) * (double) i));' % ('-' if sgn < 0 else ' '),
+             '} </pre>',
+             '\\par',
+             'Convert to fixed point %s format' % t,
+             '    round(pATable[i] * pow(2, %d))' % b,
+             ''])
+        v = []
+        for i in range(n):
+            a = 2 * math.pi * i / (2 * n)
+            v += [hx(fx(0.5 * (1 + sgn * math.sin(a)), b), b), hx(fx(0.5 * sgn * math.cos(a), b), b)]
+        emit('q%d_t' % b, nm + t, v, 8)
+
+w('''/**
+  @} end RealFFT_Table
+*/
+''')
+
+# ---------------------------------------------------------------- DCT4
+w('''/**
+  @ingroup DCT4_IDCT4
+ */
+
+/**
+  @addtogroup DCT4_IDCT4_Table DCT Type IV Tables
+  @{
+ */
+''')
+DCT = [128, 512, 2048, 8192]
+for kind, ctype, conv in (('', 'float32_t', lambda x: f32s(x)),
+                          ('Q15', 'q15_t', lambda x: hx(fx(x, 15), 15)),
+                          ('Q31', 'q31_t', lambda x: hx(fx(x, 31), 31))):
+    for N in DCT:
+        doc(['\\par',
+             'Weights %stable is generated using the formula :' % (kind + ' ' if kind else ''),
+             '<pre>weights[n] = e^(-j*n*pi/(2*N))</pre>',
+             '\\par',
+             'C command to generate the table',
+             '<pre>for (i = 0; i < N; i++)',
+             '{',
+             '   weights[(2*i)]   =  cos (i * c);',
+             '   weights[(2*i)+1] = -sin (i * c);',
+             '} </pre>',
+             '\\par',
+             'where N = %d and c = pi/(2*N)' % N,
+             ''] + (['\\par', 'Convert to fixed point %s format' % kind,
+                     '    round(weights%s(i) * pow(2, %d))' % (kind, 15 if kind == 'Q15' else 31), ''] if kind else []))
+        c = math.pi / (2 * N)
+        v = []
+        for i in range(N):
+            v += [conv(math.cos(i * c)), conv(-math.sin(i * c))]
+        emit(ctype, 'Weights%s_%d' % (kind if kind else '', N), v, 2 if not kind else 8)
+
+        doc(['\\par',
+             'cosFactor %stables are generated using the formula :' % (kind + ' ' if kind else ''),
+             '<pre>cos_factors[n] = cos((2n+1)*pi/(4*N))</pre>',
+             '\\par',
+             'C command to generate the table',
+             '\\par',
+             '<pre>for (i = 0; i < N; i++)',
+             '{',
+             '   cos_factors[i] = cos((2*i+1)*c/2);',
+             '} </pre>',
+             '\\par',
+             'where N = %d and c = pi/(2*N)' % N,
+             ''] + (['\\par', 'Convert to fixed point %s format' % kind,
+                     '    round(cos_factors%s(i) * pow(2, %d))' % (kind, 15 if kind == 'Q15' else 31), ''] if kind else []))
+        v = [conv(math.cos((2 * i + 1) * c / 2)) for i in range(N)]
+        emit(ctype, 'cos_factors%s_%d' % (kind, N), v, 4 if not kind else 8)
+
+w('''/**
+  @} end DCT4_IDCT4_Table
+*/
+''')
+
+# ---------------------------------------------------------------- reciprocal
+w('''/**
+  @ingroup groupFilters
+ */
+''')
+doc(['\\par',
+     'Initial approximation of the reciprocal used by the Q15 normalized LMS filter.',
+     'The input is normalized to [0.5, 1) and the table is indexed by the',
+     '6 bits following the sign and leading one.',
+     '\\par',
+     '<pre>for (i = 0; i < 64; i++)',
+     '{',
+     '   x = (64 + i + 0.5) / 128;',
+     '   armRecipTableQ15[i] = round((1 / x) * pow(2, 14));',
+     '} </pre>',
+     ''])
+emit('q15_t', 'armRecipTableQ15', [hx(fx(128.0 / (64 + i + 0.5) / 2.0, 15), 15) for i in range(64)], 8)
+doc(['\\par',
+     'Initial approximation of the reciprocal used by the Q31 normalized LMS filter.',
+     '\\par',
+     '<pre>for (i = 0; i < 64; i++)',
+     '{',
+     '   x = (64 + i + 0.5) / 128;',
+     '   armRecipTableQ31[i] = round((1 / x) * pow(2, 30));',
+     '} </pre>',
+     ''])
+emit('q31_t', 'armRecipTableQ31', [hx(fx(128.0 / (64 + i + 0.5) / 2.0, 31), 31) for i in range(64)], 8)
+
+# ---------------------------------------------------------------- sin tables
+w('''/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup sin
+  @{
+ */
+''')
+T = 512
+doc(['\\par',
+     'Example code for the generation of the floating-point sine table:',
+     '<pre>tableSize = 512;',
+     'for (n = 0; n < (tableSize + 1); n++)',
+     '{',
+     '   sinTable[n] = sin(2*PI*n/tableSize);',
+     '}</pre>',
+     '\\par',
+     'where PI value is  3.14159265358979',
+     ''])
+emit('float32_t', 'sinTable_f32', [f32s(math.sin(2 * math.pi * i / T)) for i in range(T + 1)], 4, 'FAST_MATH_TABLE_SIZE + 1')
+doc(['\\par',
+     'Table values are in Q31 (1.31 fixed-point format) and generation is done in',
+     'three steps.  First,  generate sin values in floating point:',
+     '<pre>tableSize = 512;',
+     'for (n = 0; n < (tableSize + 1); n++)',
+     '{',
+     '   sinTable[n] = sin(2*PI*n/tableSize);',
+     '} </pre>',
+     'where PI value is  3.14159265358979',
+     '\\par',
+     'Second, convert floating-point to Q31 (fixed point):',
+     '   (sinTable[i] * pow(2, 31))',
+     '\\par',
+     'Finally, round to the nearest integer value:',
+     '   sinTable[i] += (sinTable[i] > 0 ? 0.5 : -0.5);',
+     ''])
+emit('q31_t', 'sinTable_q31', [hx(fx(math.sin(2 * math.pi * i / T), 31), 31) for i in range(T + 1)], 8, 'FAST_MATH_TABLE_SIZE + 1')
+doc(['\\par',
+     'Table values are in Q15 (1.15 fixed-point format) and generation is done in',
+     'three steps.  First,  generate sin values in floating point:',
+     '<pre>tableSize = 512;',
+     'for (n = 0; n < (tableSize + 1); n++)',
+     '{',
+     '   sinTable[n] = sin(2*PI*n/tableSize);',
+     '} </pre>',
+     'where PI value is  3.14159265358979',
+     '\\par',
+     'Second, convert floating-point to Q15 (fixed point):',
+     '   (sinTable[i] * pow(2, 15))',
+     '\\par',
+     'Finally, round to the nearest integer value:',
+     '   sinTable[i] += (sinTable[i] > 0 ? 0.5 : -0.5);',
+     ''])
+emit('q15_t', 'sinTable_q15', [hx(fx(math.sin(2 * math.pi * i / T), 15), 15) for i in range(T + 1)], 8, 'FAST_MATH_TABLE_SIZE + 1')
+w('''/**
+  @} end of sin group
+*/
+''')
+
+# ---------------------------------------------------------------- sqrt
+w('''/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup SQRT
+  @{
+ */
+''')
+doc(['\\par',
+     'Initial 1/sqrt(x) estimate for the Newton iteration of arm_sqrt_q31.',
+     'The normalized input lies in [0.25, 1) and is indexed by its 5 top bits.',
+     '<pre>for (i = 0; i < 32; i++)',
+     '{',
+     '   sqrt_initial_lut_q31[i] = round(pow(2, 28) / sqrt((8 + i) / 32.0));',
+     '} </pre>',
+     ''])
+emit('q31_t', 'sqrt_initial_lut_q31', [hx(int(round((1 << 28) / math.sqrt((8 + i) / 32.0))), 31) for i in range(32)], 8)
+doc(['\\par',
+     'Initial 1/sqrt(x) estimate for the Newton iteration of arm_sqrt_q15.',
+     '<pre>for (i = 0; i < 16; i++)',
+     '{',
+     '   sqrt_initial_lut_q15[i] = round(pow(2, 12) / sqrt((4 + i) / 16.0));',
+     '} </pre>',
+     ''])
+emit('q15_t', 'sqrt_initial_lut_q15', [hx(int(round((1 << 12) / math.sqrt((4 + i) / 16.0))), 15) for i in range(16)], 8)
+w('''/**
+  @} end of SQRT group
+*/
+''')
+
+# ---------------------------------------------------------------- MVE
+w('#if (defined(ARM_MATH_MVEI) || defined(ARM_MATH_HELIUM)) && !defined(ARM_MATH_AUTOVECTORIZE)')
+w('')
+for b, f, t in ((15, 13, 'Q15'), (31, 29, 'Q31')):
+    doc(['\\par',
+         'Piecewise linear estimate of 1/sqrt(x) used by FAST_VSQRT_%s.' % t,
+         'Entry pair (A, B) of segment idx approximates 1/sqrt(x) = A - B * x',
+         'on [idx/128, (idx+1)/128), both in Q%d. Normalized inputs only use' % f,
+         'idx >= 32, the lower segments are left at zero.',
+         ''])
+    v = []
+    for idx in range(128):
+        if idx < 32:
+            v += ['0', '0']
+            continue
+        x0, x1 = idx / 128.0, (idx + 1) / 128.0
+        B = (1 / math.sqrt(x0) - 1 / math.sqrt(x1)) / (x1 - x0)
+        A = 1 / math.sqrt(x0) + B * x0
+        v += [hx(int(round(A * (1 << f))), b), hx(int(round(B * (1 << f))), b)]
+    emit('q%d_t' % b, 'sqrtTable_' + t, v, 8)
+doc(['\\par', 'Number of bits set in each byte value', ''])
+emit('unsigned char', 'hwLUT', [str(bin(i).count('1')) for i in range(256)], 16)
+w('#endif')
+w('')
+w('#if (defined(ARM_MATH_MVEF) || defined(ARM_MATH_HELIUM)) && !defined(ARM_MATH_AUTOVECTORIZE)')
+w('''
+const float32_t exp_tab[8] ARM_DSP_TABLE_ATTRIBUTE = {
+    (1.f),
+    (0.0416598916054f),
+    (0.500000596046f),
+    (0.0014122662833f),
+    (1.00000011921f),
+    (0.00833693705499f),
+    (0.166665703058f),
+    (0.000195780929062f),
+};
+
+const float32_t __logf_lut_f32[8] ARM_DSP_TABLE_ATTRIBUTE = {
+    -2.295614848256274f,         /*p0*/
+    -2.470711633419806f,         /*p4*/
+    -5.686926051100417f,         /*p2*/
+    -0.165253547131978f,         /*p6*/
+    +5.175912446351073f,         /*p1*/
+    +0.844006986174912f,         /*p5*/
+    +4.584458825456749f,         /*p3*/
+    +0.014127821926000f          /*p7*/
+};
+''')
+w('#endif')
+
+open(sys.argv[1] if len(sys.argv) > 1 else ROOT + '/Source/CommonTables/arm_common_tables.c', 'w').write('\n'.join(out) + '\n')
@@ -29,6 +29,7 @@
 #include "arm_abs_f16.c"
 #include "arm_add_f16.c"
 #include "arm_dot_prod_f16.c"
+#include "arm_dot_prod_f16_f32.c"
 #include "arm_mult_f16.c"
 #include "arm_negate_f16.c"
 #include "arm_offset_f16.c"
@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dot_prod_f16_f32.c
+ * Description:  Dot product of half-precision vectors with single-precision accumulation
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/basic_math_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+/**
+  @brief         Dot product of half-precision vectors accumulated in single precision.
+  @param[in]     pSrcA      points to the first input vector.
+  @param[in]     pSrcB      points to the second input vector.
+  @param[in]     blockSize  number of samples in each vector.
+  @param[out]    result     output result returned here.
+
+  @par           Details
+                   The inputs are read in half precision, which halves the memory traffic of
+                   arm_dot_prod_f32(), and every product is added in single precision. The error
+                   no longer grows with the rounding of a half-precision accumulator as with
+                   arm_dot_prod_f16(): it is the one of arm_dot_prod_f32() on the same values.
+ */
+#if defined(ARM_MATH_MVE_FLOAT16) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+#include "arm_helium_utils.h"
+
+ARM_DSP_ATTRIBUTE void arm_dot_prod_f16_f32(
+  const float16_t * pSrcA,
+  const float16_t * pSrcB,
+        uint32_t blockSize,
+        float32_t * result)
+{
+    f16x8_t vecA, vecB;
+    f32x4_t accBottom = vdupq_n_f32(0.0f);
+    f32x4_t accTop = vdupq_n_f32(0.0f);
+    mve_pred16_t p0;
+    int32_t blkCnt = (int32_t)blockSize;
+
+    /* 8 half-precision values widened to 2 vectors of 4 (even and odd lanes) */
+    while (blkCnt > 0)
+    {
+        p0 = vctp16q((uint32_t)blkCnt);
+        vecA = vldrhq_z_f16(pSrcA, p0);
+        vecB = vldrhq_z_f16(pSrcB, p0);
+
+        accBottom = vfmaq(accBottom, vcvtbq_f32_f16(vecA), vcvtbq_f32_f16(vecB));
+        accTop = vfmaq(accTop, vcvttq_f32_f16(vecA), vcvttq_f32_f16(vecB));
+
+        pSrcA += 8;
+        pSrcB += 8;
+        blkCnt -= 8;
+    }
+
+    *result = vecAddAcrossF32Mve(vaddq(accBottom, accTop));
+}
+
+#else
+ARM_DSP_ATTRIBUTE void arm_dot_prod_f16_f32(
+  const float16_t * pSrcA,
+  const float16_t * pSrcB,
+        uint32_t blockSize,
+        float32_t * result)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        float32_t sum = 0.0f;                          /* Temporary return variable */
+
+#if defined (ARM_MATH_LOOPUNROLL) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+  /* Loop unrolling: Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+    sum += (float32_t)(*pSrcA++) * (float32_t)(*pSrcB++);
+
+    sum += (float32_t)(*pSrcA++) * (float32_t)(*pSrcB++);
+
+    sum += (float32_t)(*pSrcA++) * (float32_t)(*pSrcB++);
+
+    sum += (float32_t)(*pSrcA++) * (float32_t)(*pSrcB++);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining outputs */
+  blkCnt = blockSize % 0x4U;
+
+#else
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+    sum += (float32_t)(*pSrcA++) * (float32_t)(*pSrcB++);
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Store result in destination buffer */
+  *result = sum;
+}
+#endif /* defined(ARM_MATH_MVE_FLOAT16) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @brief         Dot product of half-precision vectors accumulated in single precision, half-precision result.
+  @param[in]     pSrcA      points to the first input vector.
+  @param[in]     pSrcB      points to the second input vector.
+  @param[in]     blockSize  number of samples in each vector.
+  @param[out]    result     output result returned here.
+
+  @par           Details
+                   Result of arm_dot_prod_f16_f32() rounded once to half precision.
+ */
+ARM_DSP_ATTRIBUTE void arm_dot_prod_acc32_f16(
+  const float16_t * pSrcA,
+  const float16_t * pSrcB,
+        uint32_t blockSize,
+        float16_t * result)
+{
+  float32_t sum;
+
+  arm_dot_prod_f16_f32(pSrcA, pSrcB, blockSize, &sum);
+  *result = (float16_t)sum;
+}
+
+/**
+  @} end of BasicDotProd group
+ */
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
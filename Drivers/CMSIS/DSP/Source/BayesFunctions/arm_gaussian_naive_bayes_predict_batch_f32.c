@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_gaussian_naive_bayes_predict_batch_f32.c
+ * Description:  Naive Gaussian Bayesian Estimator batch prediction of several input vectors
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/bayes_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/support_functions.h"
+#include "dsp/matrix_functions.h"
+#include <math.h>
+
+#define DPI_F (2.0f*3.1415926535897932384626433832795f)
+
+/**
+ * @addtogroup groupBayes
+ * @{
+ */
+
+/**
+ * @brief Size of the scratch buffer of the batch Naive Gaussian Bayesian Estimator
+ *
+ * @param[in]  vectorDimension  dimension of vector space
+ * @param[in]  numberOfClasses  number of different classes
+ * @return number of float32_t values of the <code>pScratch</code> argument
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_gaussian_naive_bayes_predict_batch_scratch_size_f32(
+  uint32_t vectorDimension,
+  uint32_t numberOfClasses)
+{
+  /* Class coefficients, class constants, input block, log likelihood block */
+  return (((2U * vectorDimension) + 1U + ARM_BAYES_BATCH_ROWS) * numberOfClasses) +
+         (2U * vectorDimension * ARM_BAYES_BATCH_ROWS);
+}
+
+/**
+ * @brief Naive Gaussian Bayesian Estimator of several input vectors
+ *
+ * @param[in]  S           points to a naive bayes instance structure
+ * @param[in]  in          points to <code>numVectors</code> input vectors of <code>vectorDimension</code> values
+ * @param[in]  numVectors  number of input vectors
+ * @param[in]  pScratch    points to arm_gaussian_naive_bayes_predict_batch_scratch_size_f32() values
+ * @param[out] pResult     points to the <code>numVectors</code> predicted classes
+ *
+ * @par Algorithm
+ * The log likelihood of class k is expanded in
+ * <code>c[k] + sum(-0.5 / sigma[k][j] * x[j]^2 + theta[k][j] / sigma[k][j] * x[j])</code>,
+ * where <code>c[k]</code> gathers the prior and the terms which do not depend on x.
+ * The coefficients and the constants are computed once per call, then the input
+ * vectors are processed by blocks of \ref ARM_BAYES_BATCH_ROWS rows: the block of
+ * <code>[x^2, x]</code> rows times the coefficients is one matrix product computed by
+ * arm_mat_mult_f32(), and the predicted class is the index of the maximum of each row.
+ *
+ * @par Accuracy
+ * Same predictions as arm_gaussian_naive_bayes_predict_f32() except when two classes
+ * have log likelihoods within rounding: the expanded form has a larger absolute error
+ * when the inputs are far from 0 compared to the standard deviations.
+ */
+ARM_DSP_ATTRIBUTE void arm_gaussian_naive_bayes_predict_batch_f32(
+  const arm_gaussian_naive_bayes_instance_f32 *S,
+  const float32_t * in,
+  uint32_t numVectors,
+  float32_t * pScratch,
+  uint32_t * pResult)
+{
+  const uint32_t dim = S->vectorDimension;
+  const uint32_t nbClasses = S->numberOfClasses;
+  float32_t *pCoefs = pScratch;
+  float32_t *pConsts = &pCoefs[2U * dim * nbClasses];
+  float32_t *pBlock = &pConsts[nbClasses];
+  float32_t *pLogs = &pBlock[2U * dim * ARM_BAYES_BATCH_ROWS];
+  arm_matrix_instance_f32 block;
+  arm_matrix_instance_f32 coefs;
+  arm_matrix_instance_f32 logs;
+  float32_t sigma;
+  float32_t theta;
+  float32_t acc;
+  float32_t maxLog;
+  uint32_t numRows;
+  uint32_t row;
+  uint32_t k;
+  uint32_t j;
+
+  /* Coefficients (2 * dim) x nbClasses: -0.5 / sigma for x^2 then theta / sigma for x */
+  for (k = 0U; k < nbClasses; k++)
+  {
+    acc = 0.0f;
+    for (j = 0U; j < dim; j++)
+    {
+      sigma = S->sigma[(k * dim) + j] + S->epsilon;
+      theta = S->theta[(k * dim) + j];
+
+      pCoefs[(j * nbClasses) + k] = -0.5f / sigma;
+      pCoefs[((dim + j) * nbClasses) + k] = theta / sigma;
+      acc += logf(DPI_F * sigma) + ((theta * theta) / sigma);
+    }
+    pConsts[k] = logf(S->classPriors[k]) - (0.5f * acc);
+  }
+
+  arm_mat_init_f32(&coefs, (uint16_t)(2U * dim), (uint16_t)nbClasses, pCoefs);
+
+  while (numVectors > 0U)
+  {
+    numRows = (numVectors > ARM_BAYES_BATCH_ROWS) ? ARM_BAYES_BATCH_ROWS : numVectors;
+
+    for (row = 0U; row < numRows; row++)
+    {
+      arm_mult_f32(&in[row * dim], &in[row * dim], &pBlock[row * 2U * dim], dim);
+      arm_copy_f32(&in[row * dim], &pBlock[(row * 2U * dim) + dim], dim);
+    }
+
+    arm_mat_init_f32(&block, (uint16_t)numRows, (uint16_t)(2U * dim), pBlock);
+    arm_mat_init_f32(&logs, (uint16_t)numRows, (uint16_t)nbClasses, pLogs);
+    (void)arm_mat_mult_f32(&block, &coefs, &logs);
+
+    for (row = 0U; row < numRows; row++)
+    {
+      arm_add_f32(&pLogs[row * nbClasses], pConsts, &pLogs[row * nbClasses], nbClasses);
+      arm_max_f32(&pLogs[row * nbClasses], nbClasses, &maxLog, &pResult[row]);
+    }
+
+    in += numRows * dim;
+    pResult += numRows;
+    numVectors -= numRows;
+  }
+}
+
+/**
+ * @} end of groupBayes group
+ */
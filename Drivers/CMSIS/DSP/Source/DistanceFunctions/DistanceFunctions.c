@@ -51,4 +51,9 @@
 #include "arm_yule_distance.c"
 #include "arm_dtw_distance_f32.c"
 #include "arm_dtw_path_f32.c"
-#include "arm_dtw_init_window_q7.c"
\ No newline at end of file
+#include "arm_dtw_init_window_q7.c"
+#include "arm_dtw_init_f32.c"
+#include "arm_dtw_sequence_distance_f32.c"
+#include "arm_dtw_lb_keogh_f32.c"
+#include "arm_pairwise_distance_f32.c"
+#include "arm_distance_topk_f32.c"
\ No newline at end of file
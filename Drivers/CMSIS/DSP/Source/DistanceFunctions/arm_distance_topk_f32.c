@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_distance_topk_f32.c
+ * Description:  Partial sort of the k smallest distances
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/distance_functions.h"
+
+/**
+  @ingroup groupDistance
+ */
+
+/**
+  @addtogroup PairwiseDist
+  @{
+ */
+
+/**
+  @brief         k smallest values of a vector of distances, in increasing order.
+  @param[in]     pSrc       points to the distances, for instance one row of arm_pairwise_distance_f32()
+  @param[in]     blockSize  number of distances
+  @param[in]     k          number of values to select
+  @param[out]    pDst       points to the min(k, blockSize) smallest distances in increasing order
+  @param[out]    pIndex     points to their min(k, blockSize) indexes in pSrc
+  @return        number of values written to pDst and pIndex
+
+  @par           Details
+                   Partial insertion sort: a value is compared to the largest selected one, and
+                   only inserted when it is smaller. The cost is about <code>blockSize</code> comparisons
+                   when k is small compared to blockSize, <code>blockSize * k</code> in the worst case
+                   (decreasing distances). Equal distances keep the smallest index first.
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_distance_topk_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        uint32_t k,
+        float32_t * pDst,
+        uint32_t * pIndex)
+{
+  uint32_t count = 0U;
+  uint32_t pos;
+  uint32_t i;
+  float32_t value;
+
+  k = (k > blockSize) ? blockSize : k;
+  if (k == 0U)
+  {
+    return 0U;
+  }
+
+  for (i = 0U; i < blockSize; i++)
+  {
+    value = pSrc[i];
+
+    if (count < k)
+    {
+      pos = count;
+      count++;
+    }
+    else if (value < pDst[k - 1U])
+    {
+      /* The largest selected value is dropped */
+      pos = k - 1U;
+    }
+    else
+    {
+      continue;
+    }
+
+    while ((pos > 0U) && (value < pDst[pos - 1U]))
+    {
+      pDst[pos] = pDst[pos - 1U];
+      pIndex[pos] = pIndex[pos - 1U];
+      pos--;
+    }
+    pDst[pos] = value;
+    pIndex[pos] = i;
+  }
+
+  return count;
+}
+
+/**
+  @} end of PairwiseDist group
+ */
@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dtw_init_f32.c
+ * Description:  Initialization of the memory-bounded DTW
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/distance_functions.h"
+
+/**
+  @addtogroup DTW
+  @{
+ */
+
+
+/**
+ * @brief         Initialization of the memory-bounded DTW
+ * @param[out]    S                  points to the DTW instance
+ * @param[in]     dimension          number of values per sample of the sequences
+ * @param[in]     localDistance      distance between a query and a template sample
+ * @param[in]     windowType         window, ARM_DTW_NO_WINDOW for none
+ * @param[in]     windowSize         window size
+ * @param[in]     pBuffer            buffer of 2 * maxTemplateLength values
+ * @param[in]     maxTemplateLength  longest template
+ * @return ARM_MATH_ARGUMENT_ERROR if the window type or local distance is not recognized,
+ * or the dimension is 0
+ *
+ * @par Window
+ *
+ * The window has the same definition as the matrix built by
+ * arm_dtw_init_window_q7() for the same type and size: the
+ * memory-bounded functions test the cells on the fly instead
+ * of reading a matrix.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_dtw_init_f32(arm_dtw_instance_f32 *S,
+                            uint32_t dimension,
+                            arm_dtw_local_distance localDistance,
+                            arm_dtw_window windowType,
+                            int32_t windowSize,
+                            float32_t *pBuffer,
+                            uint32_t maxTemplateLength)
+{
+  if ((dimension == 0U) ||
+      ((localDistance != ARM_DTW_CITYBLOCK) &&
+       (localDistance != ARM_DTW_SQEUCLIDEAN) &&
+       (localDistance != ARM_DTW_EUCLIDEAN)) ||
+      ((windowType != ARM_DTW_NO_WINDOW) &&
+       (windowType != ARM_DTW_SAKOE_CHIBA_WINDOW) &&
+       (windowType != ARM_DTW_SLANTED_BAND_WINDOW)))
+  {
+    return(ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->dimension = dimension;
+  S->localDistance = localDistance;
+  S->windowType = windowType;
+  S->windowSize = windowSize;
+  S->maxTemplateLength = maxTemplateLength;
+  S->pRows = pBuffer;
+
+  return(ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of DTW group
+ */
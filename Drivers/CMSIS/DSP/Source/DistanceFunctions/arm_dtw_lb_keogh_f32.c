@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dtw_lb_keogh_f32.c
+ * Description:  LB_Keogh lower bound of the Dynamic Time Warping distance
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/distance_functions.h"
+#include "arm_dtw.h"
+
+/**
+  @addtogroup DTW
+  @{
+ */
+
+
+/**
+ * @brief         Envelope of a template for arm_dtw_lb_keogh_f32()
+ * @param[in]     S               points to the DTW instance (dimension 1)
+ * @param[in]     pTemplate       template
+ * @param[in]     templateLength  template length
+ * @param[in]     queryLength     length of the queries compared to the template
+ * @param[out]    pUpper          upper envelope, queryLength values
+ * @param[out]    pLower          lower envelope, queryLength values
+ * @return ARM_MATH_ARGUMENT_ERROR if the dimension is not 1 or a query
+ * index has no template index in the window
+ *
+ * @par Description
+ *
+ * For every query index q, the envelope is the maximum and minimum
+ * of the template samples inside the window of row q. Without window
+ * it is the maximum and minimum of the whole template.
+ * The envelope only depends on the template and the query length:
+ * it is computed once per template.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_dtw_envelope_f32(const arm_dtw_instance_f32 *S,
+                                const float32_t *pTemplate,
+                                uint32_t templateLength,
+                                uint32_t queryLength,
+                                float32_t *pUpper,
+                                float32_t *pLower)
+{
+   int32_t lo, hi;
+   float32_t maxValue, minValue;
+
+   if (S->dimension != 1U)
+   {
+     return(ARM_MATH_ARGUMENT_ERROR);
+   }
+
+   for(uint32_t q = 0; q < queryLength; q++)
+   {
+     arm_dtw_window_band(S, (int32_t)q, (int32_t)queryLength, (int32_t)templateLength, &lo, &hi);
+     if (lo > hi)
+     {
+        return(ARM_MATH_ARGUMENT_ERROR);
+     }
+
+     maxValue = pTemplate[lo];
+     minValue = pTemplate[lo];
+     for(int32_t t = lo + 1; t <= hi; t++)
+     {
+        maxValue = MAX(maxValue, pTemplate[t]);
+        minValue = MIN(minValue, pTemplate[t]);
+     }
+     pUpper[q] = maxValue;
+     pLower[q] = minValue;
+   }
+
+   return(ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief         LB_Keogh lower bound of the memory-bounded DTW distance
+ * @param[in]     S               points to the DTW instance (dimension 1)
+ * @param[in]     pQuery          query
+ * @param[in]     queryLength     query length
+ * @param[in]     templateLength  template length
+ * @param[in]     pUpper          upper envelope of the template
+ * @param[in]     pLower          lower envelope of the template
+ * @param[in]     bestSoFar       bound above which the computation is stopped, F32_MAX for none
+ * @return Lower bound of arm_dtw_sequence_distance_f32() for the same query and template
+ *
+ * @par Description
+ *
+ * Every warping path crosses every query row at least once, inside
+ * the window: the local distance of each query sample to the nearest
+ * edge of the envelope, or 0 inside it, sums to a lower bound of the
+ * DTW cost. The bound costs O(queryLength), so a nearest template
+ * search only runs arm_dtw_sequence_distance_f32(), with early abandon,
+ * on the templates whose bound is below the best distance so far:
+ *
+ * <pre>
+ *   best = F32_MAX;
+ *   for each template k:
+ *     if (arm_dtw_lb_keogh_f32(&S, query, Q, T[k], upper[k], lower[k], best) < best)
+ *       arm_dtw_sequence_distance_f32(&S, query, Q, template[k], T[k], best, &d);
+ *       if (d < best) best = d, nearest = k;
+ * </pre>
+ *
+ * The accumulation stops as soon as the bound reaches bestSoFar.
+ */
+ARM_DSP_ATTRIBUTE float32_t arm_dtw_lb_keogh_f32(const arm_dtw_instance_f32 *S,
+                               const float32_t *pQuery,
+                               uint32_t queryLength,
+                               uint32_t templateLength,
+                               const float32_t *pUpper,
+                               const float32_t *pLower,
+                               float32_t bestSoFar)
+{
+   const float32_t norm = (float32_t)(queryLength + templateLength);
+   const float32_t limit = (bestSoFar == F32_MAX) ? F32_MAX : (bestSoFar * norm);
+   float32_t accum = 0.0f;
+   float32_t excess;
+
+   for(uint32_t q = 0; (q < queryLength) && (accum < limit); q++)
+   {
+     if (pQuery[q] > pUpper[q])
+     {
+        excess = pQuery[q] - pUpper[q];
+     }
+     else if (pQuery[q] < pLower[q])
+     {
+        excess = pLower[q] - pQuery[q];
+     }
+     else
+     {
+        continue;
+     }
+
+     accum += (S->localDistance == ARM_DTW_SQEUCLIDEAN) ? (excess * excess) : excess;
+   }
+
+   return(accum / norm);
+}
+
+/**
+ * @} end of DTW group
+ */
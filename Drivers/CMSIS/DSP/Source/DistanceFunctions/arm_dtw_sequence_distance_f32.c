@@ -0,0 +1,204 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_dtw_sequence_distance_f32.c
+ * Description:  Memory-bounded Dynamic Time Warping distance
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/distance_functions.h"
+#include "arm_dtw.h"
+
+/**
+  @addtogroup DTW
+  @{
+ */
+
+/**
+ * @brief         Local distance between a query and a template sample
+ * @param[in]     S   points to the DTW instance
+ * @param[in]     pA  query sample
+ * @param[in]     pB  template sample
+ * @return distance
+ */
+static float32_t arm_dtw_local_distance_f32(const arm_dtw_instance_f32 *S,
+                                            const float32_t *pA,
+                                            const float32_t *pB)
+{
+  float32_t accum = 0.0f;
+  float32_t tmp;
+  uint32_t i;
+
+  if (S->localDistance == ARM_DTW_CITYBLOCK)
+  {
+    for (i = 0U; i < S->dimension; i++)
+    {
+      accum += fabsf(pA[i] - pB[i]);
+    }
+    return(accum);
+  }
+
+  for (i = 0U; i < S->dimension; i++)
+  {
+    tmp = pA[i] - pB[i];
+    accum += tmp * tmp;
+  }
+
+  return((S->localDistance == ARM_DTW_EUCLIDEAN) ? sqrtf(accum) : accum);
+}
+
+/**
+ * @brief         Memory-bounded Dynamic Time Warping distance of two sequences
+ * @param[in]     S               points to the DTW instance
+ * @param[in]     pQuery          query, queryLength samples of dimension values
+ * @param[in]     queryLength     query length
+ * @param[in]     pTemplate       template, templateLength samples of dimension values
+ * @param[in]     templateLength  template length
+ * @param[in]     bestSoFar       distance above which the computation is abandoned, F32_MAX for none
+ * @param[out]    distance        distance, F32_MAX if abandoned
+ * @return ARM_MATH_ARGUMENT_ERROR in case no path can be found with window constraint,
+ * ARM_MATH_LENGTH_ERROR if the template is longer than the instance buffer
+ *
+ * @par Algorithm
+ *
+ * Same result as arm_dtw_distance_f32() with the matrix of local
+ * distances between the samples and the window of the instance,
+ * but the local distances are computed on the fly and only two rows
+ * of the cost matrix are kept: O(templateLength) memory.
+ * Only the cells inside the window are computed.
+ *
+ * @par Early abandon
+ *
+ * The costs of a row are a lower bound of the final cost since every
+ * path crosses every row. When the smallest normalized cost of a row
+ * is not below bestSoFar the computation stops, distance is set to
+ * F32_MAX and the function returns ARM_MATH_SUCCESS.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_dtw_sequence_distance_f32(const arm_dtw_instance_f32 *S,
+                                         const float32_t *pQuery,
+                                         uint32_t queryLength,
+                                         const float32_t *pTemplate,
+                                         uint32_t templateLength,
+                                         float32_t bestSoFar,
+                                         float32_t *distance)
+{
+   const uint32_t dim = S->dimension;
+   const float32_t norm = (float32_t)(queryLength + templateLength);
+   float32_t *pPrev = S->pRows;
+   float32_t *pCur = &S->pRows[templateLength];
+   float32_t *pSwap;
+   int32_t prevLo, prevHi;
+   int32_t curLo, curHi;
+   int32_t lo, hi;
+   float32_t rowMin;
+   float32_t d;
+   int32_t tmp;
+
+   if (templateLength > S->maxTemplateLength)
+   {
+     return(ARM_MATH_LENGTH_ERROR);
+   }
+
+   for(uint32_t t = 0; t < (2U * templateLength); t++)
+   {
+      S->pRows[t] = F32_MAX;
+   }
+
+   /* First row: cells reached from the left only */
+   arm_dtw_window_band(S, 0, (int32_t)queryLength, (int32_t)templateLength, &lo, &hi);
+   hi = (lo > 0) ? -1 : hi;
+   pCur[0] = arm_dtw_local_distance_f32(S, pQuery, pTemplate);
+   rowMin = pCur[0];
+   for(int32_t t = 1; t <= hi; t++)
+   {
+      d = arm_dtw_local_distance_f32(S, pQuery, &pTemplate[t * dim]);
+      pCur[t] = pCur[t - 1] + d;
+      rowMin = MIN(rowMin, pCur[t]);
+   }
+   curLo = 0;
+   curHi = (hi > 0) ? hi : 0;
+   prevLo = 1;
+   prevHi = 0;
+
+   for(uint32_t q = 1; q < queryLength; q++)
+   {
+     if ((rowMin / norm) >= bestSoFar)
+     {
+        *distance = F32_MAX;
+        return(ARM_MATH_SUCCESS);
+     }
+
+     /* Current row becomes the previous one; clear the cells of row q-2 */
+     pSwap = pPrev;
+     pPrev = pCur;
+     pCur = pSwap;
+     for(int32_t t = prevLo; t <= prevHi; t++)
+     {
+        pCur[t] = F32_MAX;
+     }
+     tmp = prevLo; prevLo = curLo; curLo = tmp;
+     tmp = prevHi; prevHi = curHi; curHi = tmp;
+
+     arm_dtw_window_band(S, (int32_t)q, (int32_t)queryLength, (int32_t)templateLength, &lo, &hi);
+     if (lo > hi)
+     {
+        return(ARM_MATH_ARGUMENT_ERROR);
+     }
+
+     rowMin = F32_MAX;
+     for(int32_t t = lo; t <= hi; t++)
+     {
+        d = arm_dtw_local_distance_f32(S, &pQuery[q * dim], &pTemplate[t * dim]);
+        if (t == 0)
+        {
+           pCur[0] = pPrev[0] + d;
+        }
+        else
+        {
+           pCur[t] = MIN(pPrev[t - 1] + 2.0f * d,
+                     MIN(pCur[t - 1]  +        d,
+                         pPrev[t]     +        d));
+        }
+        rowMin = MIN(rowMin, pCur[t]);
+     }
+     curLo = lo;
+     curHi = hi;
+   }
+
+   if (pCur[templateLength - 1] >= F32_MAX)
+   {
+     return(ARM_MATH_ARGUMENT_ERROR);
+   }
+
+   *distance = pCur[templateLength - 1] / norm;
+   if (*distance >= bestSoFar)
+   {
+     *distance = F32_MAX;
+   }
+
+   return(ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of DTW group
+ */
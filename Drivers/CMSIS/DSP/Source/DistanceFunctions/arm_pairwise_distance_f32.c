@@ -0,0 +1,257 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pairwise_distance_f32.c
+ * Description:  Cache blocked pairwise distance matrix
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/distance_functions.h"
+#include <math.h>
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+#define PAIRWISE_VECTOR
+#define VLOAD(p)        vld1q(p)
+#define VSTORE(p, v)    vst1q(p, v)
+#define VDUP(x)         vdupq_n_f32(x)
+#define VSUB(a, b)      vsubq(a, b)
+#define VADD(a, b)      vaddq(a, b)
+#define VABD(a, b)      vabdq(a, b)
+#define VMAX(a, b)      vmaxnmq(a, b)
+#define VFMA(acc, a, b) vfmaq(acc, a, b)
+#elif defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
+#define PAIRWISE_VECTOR
+#define VLOAD(p)        vld1q_f32(p)
+#define VSTORE(p, v)    vst1q_f32(p, v)
+#define VDUP(x)         vdupq_n_f32(x)
+#define VSUB(a, b)      vsubq_f32(a, b)
+#define VADD(a, b)      vaddq_f32(a, b)
+#define VABD(a, b)      vabdq_f32(a, b)
+#define VMAX(a, b)      vmaxq_f32(a, b)
+#define VFMA(acc, a, b) vmlaq_f32(acc, a, b)
+#endif
+
+/* Squared euclidean: sum((b - a)^2) */
+#undef EXT
+#define EXT _sqeuclidean_f32
+#define ACC_OP(acc, a, b)    { float32_t _t = (b) - (a); (acc) += _t * _t; }
+#define VACC_OP(acc, va, vb) { float32x4_t _t = VSUB(vb, va); (acc) = VFMA(acc, _t, _t); }
+#include "arm_pairwise_distance_template.h"
+#undef EXT
+#undef ACC_OP
+#undef VACC_OP
+
+/* Cityblock: sum(|b - a|) */
+#define EXT _cityblock_f32
+#define ACC_OP(acc, a, b)    { (acc) += fabsf((b) - (a)); }
+#define VACC_OP(acc, va, vb) { (acc) = VADD(acc, VABD(vb, va)); }
+#include "arm_pairwise_distance_template.h"
+#undef EXT
+#undef ACC_OP
+#undef VACC_OP
+
+/* Chebyshev: max(|b - a|) */
+#define EXT _chebyshev_f32
+#define ACC_OP(acc, a, b)    { float32_t _t = fabsf((b) - (a)); (acc) = (_t > (acc)) ? _t : (acc); }
+#define VACC_OP(acc, va, vb) { (acc) = VMAX(acc, VABD(vb, va)); }
+#include "arm_pairwise_distance_template.h"
+#undef EXT
+#undef ACC_OP
+#undef VACC_OP
+
+/* Dot product, for the cosine distance */
+#define EXT _dot_f32
+#define ACC_OP(acc, a, b)    { (acc) += (a) * (b); }
+#define VACC_OP(acc, va, vb) { (acc) = VFMA(acc, va, vb); }
+#include "arm_pairwise_distance_template.h"
+#undef EXT
+#undef ACC_OP
+#undef VACC_OP
+
+#if defined(PAIRWISE_VECTOR)
+#undef PAIRWISE_VECTOR
+#undef VLOAD
+#undef VSTORE
+#undef VDUP
+#undef VSUB
+#undef VADD
+#undef VABD
+#undef VMAX
+#undef VFMA
+#endif
+
+/**
+  @ingroup groupDistance
+ */
+
+/**
+  @defgroup PairwiseDist Pairwise distances
+
+  Distance matrix between two sets of vectors, and selection of the k
+  smallest distances, for k-nearest-neighbour search and template matching.
+
+  @par           Algorithm
+                   The vectors of pB are processed by tiles of \ref ARM_PAIRWISE_TILE vectors,
+                   transposed in the scratch buffer so that the coordinate d of all the vectors
+                   of a tile is contiguous. Each vector of pA is then compared to a whole tile
+                   at once: for every coordinate, one value of pA is broadcast and combined with
+                   consecutive vectors of the tile. Helium and Neon keep 16 distances in vector
+                   registers during the loop over the coordinates, and the scalar version keeps 4
+                   distances in registers.
+                   A tile is read from the cache for every vector of pA instead of one call per pair.
+
+  @par           Scratch memory
+                   <code>pScratch</code> holds <code>arm_pairwise_distance_scratch_size_f32(dimension)</code>
+                   values.
+ */
+
+/**
+  @addtogroup PairwiseDist
+  @{
+ */
+
+/**
+  @brief         Size of the scratch buffer of arm_pairwise_distance_f32().
+  @param[in]     dimension  vector length
+  @return        number of float32_t values of the <code>pScratch</code> argument
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_pairwise_distance_scratch_size_f32(
+  uint32_t dimension)
+{
+  /* Transposed tile and its norms */
+  return (dimension + 1U) * ARM_PAIRWISE_TILE;
+}
+
+/**
+  @brief         Distance matrix between two sets of floating-point vectors.
+  @param[in]     metric     distance
+  @param[in]     pA         points to <code>numA</code> vectors of <code>dimension</code> values
+  @param[in]     numA       number of vectors in pA
+  @param[in]     pB         points to <code>numB</code> vectors of <code>dimension</code> values
+  @param[in]     numB       number of vectors in pB
+  @param[in]     dimension  vector length
+  @param[in]     pScratch   points to arm_pairwise_distance_scratch_size_f32() values
+  @param[out]    pDst       points to the <code>numA x numB</code> distance matrix, row major:
+                            the distance of pA[i] to pB[j] is <code>pDst[i * numB + j]</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : unknown metric
+
+  @par           Details
+                   The distances are those of arm_euclidean_distance_f32(), arm_cityblock_distance_f32(),
+                   arm_chebyshev_distance_f32() and arm_cosine_distance_f32(), with a different order of
+                   the additions. \ref ARM_PAIRWISE_SQEUCLIDEAN skips the square root of the euclidean distance,
+                   which does not change the nearest neighbours.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_pairwise_distance_f32(
+        arm_pairwise_metric metric,
+  const float32_t * pA,
+        uint32_t numA,
+  const float32_t * pB,
+        uint32_t numB,
+        uint32_t dimension,
+        float32_t * pScratch,
+        float32_t * pDst)
+{
+  void (*kernel)(const float32_t *, const float32_t *, uint32_t, uint32_t, float32_t *);
+  float32_t *pBT = pScratch;
+  float32_t *pNorms = &pScratch[dimension * ARM_PAIRWISE_TILE];
+  float32_t *pRow;
+  float32_t norm;
+  float32_t tmp;
+  uint32_t numCols;
+  uint32_t tile;
+  uint32_t row;
+  uint32_t col;
+  uint32_t dim;
+
+  switch (metric)
+  {
+    case ARM_PAIRWISE_EUCLIDEAN:
+    case ARM_PAIRWISE_SQEUCLIDEAN:
+      kernel = arm_pairwise_kernel_sqeuclidean_f32;
+      break;
+    case ARM_PAIRWISE_CITYBLOCK:
+      kernel = arm_pairwise_kernel_cityblock_f32;
+      break;
+    case ARM_PAIRWISE_CHEBYSHEV:
+      kernel = arm_pairwise_kernel_chebyshev_f32;
+      break;
+    case ARM_PAIRWISE_COSINE:
+      kernel = arm_pairwise_kernel_dot_f32;
+      break;
+    default:
+      return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  for (tile = 0U; tile < numB; tile += numCols)
+  {
+    numCols = ((numB - tile) > ARM_PAIRWISE_TILE) ? ARM_PAIRWISE_TILE : (numB - tile);
+
+    /* Tile transposed to dimension x numCols */
+    for (col = 0U; col < numCols; col++)
+    {
+      for (dim = 0U; dim < dimension; dim++)
+      {
+        pBT[(dim * numCols) + col] = pB[((tile + col) * dimension) + dim];
+      }
+    }
+
+    if (metric == ARM_PAIRWISE_COSINE)
+    {
+      for (col = 0U; col < numCols; col++)
+      {
+        arm_power_f32(&pB[(tile + col) * dimension], dimension, &pNorms[col]);
+      }
+    }
+
+    for (row = 0U; row < numA; row++)
+    {
+      pRow = &pDst[(row * numB) + tile];
+      kernel(&pA[row * dimension], pBT, numCols, dimension, pRow);
+
+      if (metric == ARM_PAIRWISE_EUCLIDEAN)
+      {
+        for (col = 0U; col < numCols; col++)
+        {
+          arm_sqrt_f32(pRow[col], &pRow[col]);
+        }
+      }
+      else if (metric == ARM_PAIRWISE_COSINE)
+      {
+        arm_power_f32(&pA[row * dimension], dimension, &norm);
+        for (col = 0U; col < numCols; col++)
+        {
+          arm_sqrt_f32(norm * pNorms[col], &tmp);
+          pRow[col] = 1.0f - (pRow[col] / tmp);
+        }
+      }
+    }
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of PairwiseDist group
+ */
@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_pairwise_distance_template.h
+ * Description:  Kernel of the pairwise distances for one row and one tile of columns
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/*
+ * Included once per metric by arm_pairwise_distance_f32.c with:
+ *   EXT                    suffix of the kernel name
+ *   ACC_OP(acc, a, b)      scalar accumulation of one coordinate
+ *   VACC_OP(acc, va, vb)   vector accumulation when PAIRWISE_VECTOR is defined
+ *
+ * The kernel computes the distances of one vector pA to the numCols columns of
+ * pBT, a tile of vectors stored transposed (dimension rows of numCols values).
+ * All accumulators start from 0.
+ */
+
+#define _PAIRWISE_FUNC(A,B) A##B
+#define PAIRWISE_FUNC(EXT) _PAIRWISE_FUNC(arm_pairwise_kernel, EXT)
+
+static void PAIRWISE_FUNC(EXT)(
+  const float32_t * pA,
+  const float32_t * pBT,
+  uint32_t numCols,
+  uint32_t dimension,
+  float32_t * pDst)
+{
+  const float32_t *pB;
+  uint32_t dim;
+  uint32_t col = 0U;
+
+#if defined(PAIRWISE_VECTOR)
+  float32_t acc;
+  float32x4_t va;
+  float32x4_t acc0;
+  float32x4_t acc1;
+  float32x4_t acc2;
+  float32x4_t acc3;
+
+  /* 16 columns per pass, accumulators kept in registers */
+  for (; (col + 16U) <= numCols; col += 16U)
+  {
+    acc0 = VDUP(0.0f);
+    acc1 = acc0;
+    acc2 = acc0;
+    acc3 = acc0;
+    pB = &pBT[col];
+    for (dim = 0U; dim < dimension; dim++)
+    {
+      va = VDUP(pA[dim]);
+      VACC_OP(acc0, va, VLOAD(pB));
+      VACC_OP(acc1, va, VLOAD(pB + 4));
+      VACC_OP(acc2, va, VLOAD(pB + 8));
+      VACC_OP(acc3, va, VLOAD(pB + 12));
+      pB += numCols;
+    }
+    VSTORE(&pDst[col], acc0);
+    VSTORE(&pDst[col + 4U], acc1);
+    VSTORE(&pDst[col + 8U], acc2);
+    VSTORE(&pDst[col + 12U], acc3);
+  }
+
+  for (; (col + 4U) <= numCols; col += 4U)
+  {
+    acc0 = VDUP(0.0f);
+    pB = &pBT[col];
+    for (dim = 0U; dim < dimension; dim++)
+    {
+      va = VDUP(pA[dim]);
+      VACC_OP(acc0, va, VLOAD(pB));
+      pB += numCols;
+    }
+    VSTORE(&pDst[col], acc0);
+  }
+
+  /* Remaining columns */
+  for (; col < numCols; col++)
+  {
+    acc = 0.0f;
+    pB = &pBT[col];
+    for (dim = 0U; dim < dimension; dim++)
+    {
+      ACC_OP(acc, pA[dim], *pB);
+      pB += numCols;
+    }
+    pDst[col] = acc;
+  }
+#else
+  float32_t acc0;
+  float32_t acc1;
+  float32_t acc2;
+  float32_t acc3;
+  float32_t a;
+
+  /* 4 columns per pass, accumulators kept in registers */
+  for (; (col + 4U) <= numCols; col += 4U)
+  {
+    acc0 = 0.0f;
+    acc1 = 0.0f;
+    acc2 = 0.0f;
+    acc3 = 0.0f;
+    pB = &pBT[col];
+    for (dim = 0U; dim < dimension; dim++)
+    {
+      a = pA[dim];
+      ACC_OP(acc0, a, pB[0]);
+      ACC_OP(acc1, a, pB[1]);
+      ACC_OP(acc2, a, pB[2]);
+      ACC_OP(acc3, a, pB[3]);
+      pB += numCols;
+    }
+    pDst[col] = acc0;
+    pDst[col + 1U] = acc1;
+    pDst[col + 2U] = acc2;
+    pDst[col + 3U] = acc3;
+  }
+
+  /* Remaining columns */
+  for (; col < numCols; col++)
+  {
+    acc0 = 0.0f;
+    pB = &pBT[col];
+    for (dim = 0U; dim < dimension; dim++)
+    {
+      ACC_OP(acc0, pA[dim], *pB);
+      pB += numCols;
+    }
+    pDst[col] = acc0;
+  }
+#endif
+}
@@ -40,9 +40,12 @@
 #include "arm_biquad_cascade_df2T_f64.c"
 #include "arm_biquad_cascade_df2T_init_f32.c"
 #include "arm_biquad_cascade_df2T_init_f64.c"
+#include "arm_biquad_cascade_mc_df2T_f32.c"
+#include "arm_biquad_cascade_mc_df2T_init_f32.c"
 #include "arm_biquad_cascade_stereo_df2T_f32.c"
 #include "arm_biquad_cascade_stereo_df2T_init_f32.c"
 #include "arm_conv_f32.c"
+#include "arm_conv_fft_f32.c"
 #include "arm_conv_fast_opt_q15.c"
 #include "arm_conv_fast_q15.c"
 #include "arm_conv_fast_q31.c"
@@ -81,6 +84,8 @@
 #include "arm_fir_decimate_q15.c"
 #include "arm_fir_decimate_q31.c"
 #include "arm_fir_f32.c"
+#include "arm_fir_fft_f32.c"
+#include "arm_fir_fft_init_f32.c"
 #include "arm_fir_f64.c"
 #include "arm_fir_fast_q15.c"
 #include "arm_fir_fast_q31.c"
@@ -89,12 +94,17 @@
 #include "arm_fir_init_q15.c"
 #include "arm_fir_init_q31.c"
 #include "arm_fir_init_q7.c"
+#include "arm_fir_mc_f32.c"
+#include "arm_fir_mc_init_f32.c"
 #include "arm_fir_interpolate_f32.c"
 #include "arm_fir_interpolate_init_f32.c"
 #include "arm_fir_interpolate_init_q15.c"
 #include "arm_fir_interpolate_init_q31.c"
 #include "arm_fir_interpolate_q15.c"
 #include "arm_fir_interpolate_q31.c"
+#include "arm_fir_resample_design_f32.c"
+#include "arm_fir_resample_f32.c"
+#include "arm_fir_resample_init_f32.c"
 #include "arm_fir_lattice_f32.c"
 #include "arm_fir_lattice_init_f32.c"
 #include "arm_fir_lattice_init_q15.c"
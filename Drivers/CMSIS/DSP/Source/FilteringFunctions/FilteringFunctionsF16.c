@@ -26,6 +26,7 @@
 
 #include "arm_fir_f16.c"
 #include "arm_fir_init_f16.c"
+#include "arm_fir_f16_f32.c"
 #include "arm_biquad_cascade_df1_f16.c"
 #include "arm_biquad_cascade_df1_init_f16.c"
 #include "arm_biquad_cascade_df2T_f16.c"
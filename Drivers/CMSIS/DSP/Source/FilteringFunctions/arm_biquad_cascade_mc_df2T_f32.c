@@ -0,0 +1,228 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_mc_df2T_f32.c
+ * Description:  Processing function for floating-point transposed direct form II Biquad cascade filter. N interleaved channels
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+*/
+
+/**
+  @addtogroup BiquadCascadeDF2T
+  @{
+ */
+
+#if !(defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE))
+/**
+  @brief         One stage of the filter for a single channel of the interleaved block.
+  @param[in]     pCoeffs      points to the 5 coefficients of the stage
+  @param[in,out] pD1          points to the d1 state of the channel
+  @param[in,out] pD2          points to the d2 state of the channel
+  @param[in]     pIn          points to the first input sample of the channel
+  @param[out]    pOut         points to the first output sample of the channel
+  @param[in]     numChannels  distance between two samples of the channel
+  @param[in]     blockSize    number of samples to process
+ */
+static void arm_biquad_cascade_mc_df2T_channel_f32(
+  const float32_t * pCoeffs,
+        float32_t * pD1,
+        float32_t * pD2,
+  const float32_t * pIn,
+        float32_t * pOut,
+        uint32_t numChannels,
+        uint32_t blockSize)
+{
+  const float32_t b0 = pCoeffs[0];
+  const float32_t b1 = pCoeffs[1];
+  const float32_t b2 = pCoeffs[2];
+  const float32_t a1 = pCoeffs[3];
+  const float32_t a2 = pCoeffs[4];
+  float32_t d1 = *pD1;
+  float32_t d2 = *pD2;
+  float32_t Xn1, acc1;
+  uint32_t sample = blockSize;
+
+  while (sample > 0U)
+  {
+    Xn1 = *pIn;
+    acc1 = b0 * Xn1 + d1;
+    d1 = b1 * Xn1 + d2;
+    d1 += a1 * acc1;
+    d2 = b2 * Xn1;
+    d2 += a2 * acc1;
+    *pOut = acc1;
+
+    pIn += numChannels;
+    pOut += numChannels;
+    sample--;
+  }
+
+  *pD1 = d1;
+  *pD2 = d2;
+}
+#endif
+
+/**
+  @brief         Processing function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+  @param[in]     S         points to an instance of the filter data structure
+  @param[in]     pSrc      points to the block of interleaved input data
+  @param[out]    pDst      points to the block of interleaved output data
+  @param[in]     blockSize number of samples to process per channel
+
+  @par           Details
+                   The input and output blocks hold <code>blockSize * numChannels</code> values, the samples of the
+                   channels interleaved: <code>{x0[0], x1[0], ..., x0[1], x1[1], ...}</code>. The stages are computed one
+                   after the other over the whole block, and inside a stage the channels are computed 4 at a time
+                   with the state kept in vector registers, so that the vector lanes are filled for any block size.
+                   The filter can be computed in place (<code>pSrc == pDst</code>).
+ */
+ARM_DSP_ATTRIBUTE void arm_biquad_cascade_mc_df2T_f32(
+  const arm_biquad_cascade_mc_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pIn = pSrc;                   /* Source pointer */
+  const float32_t *pCoeffs = S->pCoeffs;         /* Coefficient pointer */
+        float32_t *pState = S->pState;           /* State pointer */
+  const uint32_t numChannels = S->numChannels;   /* Number of channels */
+        uint32_t stage = S->numStages;           /* Loop counter */
+        uint32_t ch;                             /* Channel counter */
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+  const float32_t *px;
+        float32_t *py;
+        f32x4_t d1Vec, d2Vec, inVec, accVec;
+        mve_pred16_t p0;
+        uint32_t sample;
+#elif defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
+  const float32_t *px;
+        float32_t *py;
+        float32x4_t d1Vec, d2Vec, inVec, accVec;
+        uint32_t sample;
+#endif
+
+  if ((stage == 0U) || (blockSize == 0U))
+  {
+    return;
+  }
+
+  do
+  {
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+    const float32_t b0 = pCoeffs[0];
+    const float32_t b1 = pCoeffs[1];
+    const float32_t b2 = pCoeffs[2];
+    const float32_t a1 = pCoeffs[3];
+    const float32_t a2 = pCoeffs[4];
+
+    /* 4 channels at a time, predicated on the last channels */
+    for (ch = 0U; ch < numChannels; ch += 4U)
+    {
+      p0 = vctp32q(numChannels - ch);
+      d1Vec = vldrwq_z_f32(&pState[ch], p0);
+      d2Vec = vldrwq_z_f32(&pState[numChannels + ch], p0);
+
+      px = &pIn[ch];
+      py = &pDst[ch];
+      sample = blockSize;
+      while (sample > 0U)
+      {
+        inVec = vldrwq_z_f32(px, p0);
+        accVec = vfmaq(d1Vec, inVec, b0);
+        d1Vec = vfmaq(vfmaq(d2Vec, inVec, b1), accVec, a1);
+        d2Vec = vfmaq(vmulq(inVec, b2), accVec, a2);
+        vstrwq_p(py, accVec, p0);
+
+        px += numChannels;
+        py += numChannels;
+        sample--;
+      }
+
+      vstrwq_p(&pState[ch], d1Vec, p0);
+      vstrwq_p(&pState[numChannels + ch], d2Vec, p0);
+    }
+#else
+    ch = 0U;
+
+#if defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
+    {
+      const float32_t b0 = pCoeffs[0];
+      const float32_t b1 = pCoeffs[1];
+      const float32_t b2 = pCoeffs[2];
+      const float32_t a1 = pCoeffs[3];
+      const float32_t a2 = pCoeffs[4];
+
+      /* 4 channels at a time */
+      for (; (ch + 4U) <= numChannels; ch += 4U)
+      {
+        d1Vec = vld1q_f32(&pState[ch]);
+        d2Vec = vld1q_f32(&pState[numChannels + ch]);
+
+        px = &pIn[ch];
+        py = &pDst[ch];
+        sample = blockSize;
+        while (sample > 0U)
+        {
+          inVec = vld1q_f32(px);
+          accVec = vmlaq_n_f32(d1Vec, inVec, b0);
+          d1Vec = vmlaq_n_f32(vmlaq_n_f32(d2Vec, inVec, b1), accVec, a1);
+          d2Vec = vmlaq_n_f32(vmulq_n_f32(inVec, b2), accVec, a2);
+          vst1q_f32(py, accVec);
+
+          px += numChannels;
+          py += numChannels;
+          sample--;
+        }
+
+        vst1q_f32(&pState[ch], d1Vec);
+        vst1q_f32(&pState[numChannels + ch], d2Vec);
+      }
+    }
+#endif /* #if defined(ARM_MATH_NEON) */
+
+    /* Remaining channels one at a time */
+    for (; ch < numChannels; ch++)
+    {
+      arm_biquad_cascade_mc_df2T_channel_f32(pCoeffs, &pState[ch], &pState[numChannels + ch],
+                                             &pIn[ch], &pDst[ch], numChannels, blockSize);
+    }
+#endif /* #if defined(ARM_MATH_MVEF) */
+
+    /* Next stage works in place on the output */
+    pCoeffs += 5U;
+    pState += 2U * numChannels;
+    pIn = pDst;
+
+    stage--;
+  } while (stage > 0U);
+}
+
+/**
+  @} end of BiquadCascadeDF2T group
+ */
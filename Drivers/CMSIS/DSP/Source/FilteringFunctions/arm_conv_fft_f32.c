@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_f32.c
+ * Description:  Floating-point FFT based convolution (uniformly partitioned overlap-add)
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_fft_functions.h"
+#include "arm_vec_filtering.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_FFT
+  @{
+ */
+
+/**
+  @brief         Convolution of a sequence with the filter of an FFT based FIR instance.
+  @param[in,out] S       points to an instance of the FFT based FIR filter structure
+  @param[in]     pSrc    points to the input sequence
+  @param[in]     srcLen  length of the input sequence
+  @param[out]    pDst    points to the output sequence of length <code>srcLen + numTaps - 1</code>
+
+  @par           Details
+                   Same result as <code>arm_conv_f32(pSrc, srcLen, b, numTaps, pDst)</code> where
+                   <code>b</code> is the filter in natural order {b[0], b[1], ..., b[numTaps-1]}.
+                   The input is cut in zero padded partitions (overlap-add). The filter state is
+                   used as working memory and cleared on return: a stream filtered with
+                   arm_fir_fft_f32() restarts from zero history.
+ */
+ARM_DSP_ATTRIBUTE void arm_conv_fft_f32(
+        arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t srcLen,
+        float32_t * pDst)
+{
+  const uint32_t partLen = S->partLen;
+  const uint32_t fftLen = 2U * partLen;
+  const uint32_t dstLen = srcLen + (uint32_t)S->numTaps - 1U;
+  float32_t *pTail = S->pWindow;
+  uint32_t pos;
+  uint32_t inCnt;
+  uint32_t outCnt;
+
+  arm_fir_fft_reset_f32(S);
+
+  for (pos = 0U; pos < dstLen; pos += partLen)
+  {
+    /* Input partition zero padded to fftLen */
+    inCnt = (srcLen > pos) ? (srcLen - pos) : 0U;
+    inCnt = (inCnt > partLen) ? partLen : inCnt;
+    if (inCnt > 0U)
+    {
+      arm_copy_f32(&pSrc[pos], S->pScratch, inCnt);
+    }
+    arm_fill_f32(0.0f, &S->pScratch[inCnt], fftLen - inCnt);
+    arm_rfft_fast_f32(&S->rfft, S->pScratch, S->pAcc, 0U);
+    arm_fir_fft_push_f32(S, S->pAcc);
+
+    arm_copy_f32(S->pHist, S->pScratch, fftLen);
+    arm_rfft_fast_cmac_f32(S->pAcc, S->pSpectra, S->pScratch, fftLen);
+    arm_rfft_fast_f32(&S->rfft, S->pScratch, S->pAcc, 1U);
+
+    /* First half overlaps the tail of the previous partition */
+    outCnt = dstLen - pos;
+    outCnt = (outCnt > partLen) ? partLen : outCnt;
+    arm_add_f32(S->pAcc, pTail, &pDst[pos], outCnt);
+    arm_copy_f32(&S->pAcc[partLen], pTail, partLen);
+
+    arm_fir_fft_history_f32(S);
+  }
+
+  arm_fir_fft_reset_f32(S);
+}
+
+/**
+  @} end of FIR_FFT group
+ */
@@ -0,0 +1,137 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_f16_f32.c
+ * Description:  Half-precision FIR filter with single-precision accumulation
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/filtering_functions_f16.h"
+#include "dsp/basic_math_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+/* Filters a block into pDst32, or into pDst16 when pDst32 is NULL */
+static void arm_fir_acc32_block_f16(
+  const arm_fir_instance_f16 * S,
+  const float16_t * pSrc,
+        float32_t * pDst32,
+        float16_t * pDst16,
+        uint32_t blockSize)
+{
+  const float16_t *pCoeffs = S->pCoeffs;
+  const uint32_t numTaps = S->numTaps;
+  float16_t *pState = S->pState;
+  float16_t *pStateCurnt = &pState[numTaps - 1U];
+  float32_t acc;
+  uint32_t i;
+
+  /* New samples after the last numTaps - 1 samples */
+  for (i = 0U; i < blockSize; i++)
+  {
+    pStateCurnt[i] = pSrc[i];
+  }
+
+  for (i = 0U; i < blockSize; i++)
+  {
+    /* acc = b[numTaps-1] * x[n-numTaps+1] + ... + b[0] * x[n] */
+    arm_dot_prod_f16_f32(pCoeffs, &pState[i], numTaps, &acc);
+
+    if (pDst32 != NULL)
+    {
+      pDst32[i] = acc;
+    }
+    else
+    {
+      pDst16[i] = (float16_t)acc;
+    }
+  }
+
+  /* Last numTaps - 1 samples kept for the next block */
+  for (i = 0U; i < (numTaps - 1U); i++)
+  {
+    pState[i] = pState[blockSize + i];
+  }
+}
+
+/**
+  @brief         Half-precision FIR filter with single-precision accumulation.
+  @param[in]     S          points to an instance of the floating-point FIR filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process
+
+  @par           Details
+                   The coefficients, the state and the input stay in half precision and every output
+                   is accumulated in single precision with arm_dot_prod_f16_f32(): the filter reads
+                   half the memory of arm_fir_f32() with its accuracy on the same values, when
+                   arm_fir_f16() loses accuracy with the number of taps.
+  @par
+                   The instance is initialized by arm_fir_init_f16(). This function uses the first
+                   <code>numTaps + blockSize - 1</code> samples of the state buffer, as the version of
+                   arm_fir_f16() without Helium, and its coefficients do not need to be padded:
+                   do not mix calls to arm_fir_f16() and to this function on the same instance.
+ */
+ARM_DSP_ATTRIBUTE void arm_fir_f16_f32(
+  const arm_fir_instance_f16 * S,
+  const float16_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  arm_fir_acc32_block_f16(S, pSrc, pDst, NULL, blockSize);
+}
+
+/**
+  @brief         Half-precision FIR filter with single-precision accumulation, half-precision output.
+  @param[in]     S          points to an instance of the floating-point FIR filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process
+
+  @par           Details
+                   Outputs of arm_fir_f16_f32() rounded once to half precision.
+ */
+ARM_DSP_ATTRIBUTE void arm_fir_acc32_f16(
+  const arm_fir_instance_f16 * S,
+  const float16_t * pSrc,
+        float16_t * pDst,
+        uint32_t blockSize)
+{
+  arm_fir_acc32_block_f16(S, pSrc, NULL, pDst, blockSize);
+}
+
+/**
+  @} end of FIR group
+ */
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
@@ -0,0 +1,155 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_f32.c
+ * Description:  Floating-point FFT based FIR filter (uniformly partitioned overlap-save)
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_fft_functions.h"
+#include "arm_vec_filtering.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR_FFT FFT based FIR Filters
+
+  Long FIR filters (thousands of taps) computed in the frequency domain with
+  arm_rfft_fast_f32(). The cost per output sample grows with the logarithm of
+  the partition length plus the number of partitions, instead of the number
+  of taps for the direct form arm_fir_f32().
+
+  @par           Algorithm
+                   The filter is split in <code>numPart</code> partitions of <code>partLen</code> taps.
+                   The spectrum of every partition, zero padded to <code>2 * partLen</code>, is computed
+                   once by arm_fir_fft_init_f32(). For every partition of input, the spectrum of the last
+                   <code>2 * partLen</code> input samples is stored in a frequency domain delay line, the
+                   output spectrum is the sum of the products of the filter spectra with the delayed input
+                   spectra, and the second half of its inverse FFT is the output (overlap-save).
+                   arm_conv_fft_f32() uses the same filter spectra on zero padded input partitions and adds
+                   the overlapping halves of the inverse FFTs (overlap-add).
+
+  @par           Block size
+                   arm_fir_fft_f32() accepts any <code>blockSize</code> and produces the same samples as
+                   arm_fir_f32(), without added latency: a partition that is not complete at the end of a
+                   call is computed with the samples available, the contribution of the past partitions
+                   being computed once per partition. The partition length is chosen by
+                   arm_fir_fft_partition_f32() from the filter length and the usual block size.
+
+  @par           Memory
+                   The caller provides one buffer of <code>arm_fir_fft_buffer_size_f32(numTaps, blockSize)</code>
+                   values, that is <code>(2 * numPart + 3) * 2 * partLen</code>, about <code>4 * numTaps</code>
+                   for long filters.
+ */
+
+/**
+  @addtogroup FIR_FFT
+  @{
+ */
+
+/**
+  @brief         Filters the current partition with the inputs received so far.
+  @param[in,out] S  points to an instance of the FFT based FIR filter structure
+  @return        points to the time domain result, the outputs of the partition
+                 are at offset partLen
+ */
+static float32_t * arm_fir_fft_partition_process_f32(
+  arm_fir_fft_instance_f32 * S)
+{
+  const uint32_t partLen = S->partLen;
+  const uint32_t fftLen = 2U * partLen;
+
+  /* Previous partition and current inputs, missing inputs zeroed */
+  arm_copy_f32(S->pWindow, S->pScratch, partLen + S->inCount);
+  arm_fill_f32(0.0f, &S->pScratch[partLen + S->inCount], partLen - S->inCount);
+  arm_rfft_fast_f32(&S->rfft, S->pScratch, S->pAcc, 0U);
+
+  if (S->inCount == partLen)
+  {
+    arm_fir_fft_push_f32(S, S->pAcc);
+  }
+
+  /* Past partitions plus first filter partition applied to the current spectrum */
+  arm_copy_f32(S->pHist, S->pScratch, fftLen);
+  arm_rfft_fast_cmac_f32(S->pAcc, S->pSpectra, S->pScratch, fftLen);
+  arm_rfft_fast_f32(&S->rfft, S->pScratch, S->pAcc, 1U);
+
+  return S->pAcc;
+}
+
+/**
+  @brief         Processing function for the floating-point FFT based FIR filter.
+  @param[in,out] S          points to an instance of the FFT based FIR filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process
+ */
+ARM_DSP_ATTRIBUTE void arm_fir_fft_f32(
+        arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const uint32_t partLen = S->partLen;
+  const float32_t *pOut;
+  uint32_t blkCnt;
+  uint32_t outCnt;
+
+  while (blockSize > 0U)
+  {
+    /* Inputs up to the end of the partition */
+    blkCnt = partLen - S->inCount;
+    blkCnt = (blkCnt > blockSize) ? blockSize : blkCnt;
+
+    arm_copy_f32(pSrc, &S->pWindow[partLen + S->inCount], blkCnt);
+    S->inCount += blkCnt;
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+
+    /* Complete partition, or partial one at the end of the call */
+    if ((S->inCount == partLen) || (blockSize == 0U))
+    {
+      pOut = arm_fir_fft_partition_process_f32(S);
+
+      outCnt = S->inCount - S->outCount;
+      arm_copy_f32(&pOut[partLen + S->outCount], pDst, outCnt);
+      pDst += outCnt;
+      S->outCount = S->inCount;
+
+      if (S->inCount == partLen)
+      {
+        /* Next partition: history from the delay line, inputs shifted */
+        arm_fir_fft_history_f32(S);
+        arm_copy_f32(&S->pWindow[partLen], S->pWindow, partLen);
+        S->inCount = 0U;
+        S->outCount = 0U;
+      }
+    }
+  }
+}
+
+/**
+  @} end of FIR_FFT group
+ */
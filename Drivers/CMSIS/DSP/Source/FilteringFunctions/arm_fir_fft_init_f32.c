@@ -0,0 +1,218 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_init_f32.c
+ * Description:  Floating-point FFT based FIR filter initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_fft_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_FFT
+  @{
+ */
+
+/**
+  @brief         Partition length selected for a filter length and a block size.
+  @param[in]     numTaps    number of filter coefficients in the filter
+  @param[in]     blockSize  number of samples usually processed per call (0 if unknown)
+  @return        partition length, power of 2 from ARM_FIR_FFT_MIN_PARTITION to ARM_FIR_FFT_MAX_PARTITION
+
+  @par           Details
+                   The partition length minimizes an operation count per output sample:
+                   two real FFTs of length 2 * partLen per partition of input, plus one
+                   spectrum multiply-accumulate per filter partition.
+                   When <code>blockSize</code> is smaller than the partition, every call
+                   also pays for the FFTs of a partial partition, which favours partitions
+                   not longer than <code>blockSize</code>.
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_fir_fft_partition_f32(
+        uint16_t numTaps,
+        uint32_t blockSize)
+{
+  uint32_t partLen;
+  uint32_t bestLen = ARM_FIR_FFT_MIN_PARTITION;
+  uint32_t numPart;
+  uint32_t numCall;
+  uint32_t log2Len;
+  float32_t fftCost;
+  float32_t cost;
+  float32_t bestCost = 0.0f;
+
+  log2Len = 5U;
+  for (partLen = ARM_FIR_FFT_MIN_PARTITION; partLen <= ARM_FIR_FFT_MAX_PARTITION; partLen <<= 1U)
+  {
+    numPart = ((uint32_t)numTaps + partLen - 1U) / partLen;
+
+    /* Forward and inverse real FFT of length 2 * partLen */
+    fftCost = 2.0f * (float32_t)(2U * partLen * log2Len);
+
+    if ((blockSize == 0U) || (blockSize >= partLen))
+    {
+      cost = fftCost + (4.0f * (float32_t)(numPart * partLen));
+    }
+    else
+    {
+      /* Partial partition on every call, past partitions once per partition */
+      numCall = (partLen + blockSize - 1U) / blockSize;
+      cost = ((float32_t)numCall * (fftCost + (4.0f * (float32_t)partLen))) +
+             (4.0f * (float32_t)((numPart - 1U) * partLen));
+    }
+    cost = cost / (float32_t)partLen;
+
+    if ((partLen == ARM_FIR_FFT_MIN_PARTITION) || (cost < bestCost))
+    {
+      bestCost = cost;
+      bestLen = partLen;
+    }
+    log2Len++;
+  }
+
+  return bestLen;
+}
+
+/**
+  @brief         Size of the buffer needed by an FFT based FIR filter.
+  @param[in]     numTaps    number of filter coefficients in the filter
+  @param[in]     blockSize  number of samples usually processed per call (0 if unknown)
+  @return        number of float32_t values of the <code>pBuffer</code> argument of arm_fir_fft_init_f32()
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_fir_fft_buffer_size_f32(
+        uint16_t numTaps,
+        uint32_t blockSize)
+{
+  uint32_t partLen = arm_fir_fft_partition_f32(numTaps, blockSize);
+  uint32_t numPart = ((uint32_t)numTaps + partLen - 1U) / partLen;
+
+  /* Spectra, delay line, then window, history and 2 working buffers */
+  return ((2U * numPart) + 3U) * 2U * partLen;
+}
+
+/**
+  @brief         Initialization function for the floating-point FFT based FIR filter.
+  @param[in,out] S          points to an instance of the FFT based FIR filter structure
+  @param[in]     numTaps    number of filter coefficients in the filter
+  @param[in]     pCoeffs    points to the filter coefficients
+  @param[in]     pBuffer    points to the filter buffer
+  @param[in]     blockSize  number of samples usually processed per call (0 if unknown)
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numTaps</code> is 0
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order,
+                   as for arm_fir_init_f32():
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   The coefficients are only read during the initialization: their spectra are
+                   computed once and cached in <code>pBuffer</code>, which holds
+                   <code>arm_fir_fft_buffer_size_f32(numTaps, blockSize)</code> values.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_fir_fft_init_f32(
+        arm_fir_fft_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pBuffer,
+        uint32_t blockSize)
+{
+  uint32_t partLen;
+  uint32_t fftLen;
+  uint32_t numPart;
+  uint32_t part;
+  uint32_t tap;
+  uint32_t tapCnt;
+  arm_status status;
+
+  if (numTaps == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  partLen = arm_fir_fft_partition_f32(numTaps, blockSize);
+  fftLen = 2U * partLen;
+  numPart = ((uint32_t)numTaps + partLen - 1U) / partLen;
+
+  status = arm_rfft_fast_init_f32(&S->rfft, (uint16_t)fftLen);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  S->numTaps = numTaps;
+  S->numPart = (uint16_t)numPart;
+  S->partLen = partLen;
+  S->pSpectra = pBuffer;
+  S->pFdl = &S->pSpectra[numPart * fftLen];
+  S->pWindow = &S->pFdl[(numPart - 1U) * fftLen];
+  S->pHist = &S->pWindow[fftLen];
+  S->pScratch = &S->pHist[fftLen];
+  S->pAcc = &S->pScratch[fftLen];
+
+  /* Spectrum of every partition: b[part * partLen ...] zero padded to fftLen */
+  for (part = 0U; part < numPart; part++)
+  {
+    arm_fill_f32(0.0f, S->pScratch, fftLen);
+
+    tapCnt = (uint32_t)numTaps - (part * partLen);
+    tapCnt = (tapCnt > partLen) ? partLen : tapCnt;
+    for (tap = 0U; tap < tapCnt; tap++)
+    {
+      S->pScratch[tap] = pCoeffs[(uint32_t)numTaps - 1U - ((part * partLen) + tap)];
+    }
+
+    arm_rfft_fast_f32(&S->rfft, S->pScratch, &S->pSpectra[part * fftLen], 0U);
+  }
+
+  arm_fir_fft_reset_f32(S);
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Clears the state of the floating-point FFT based FIR filter.
+  @param[in,out] S  points to an instance of the FFT based FIR filter structure
+ */
+ARM_DSP_ATTRIBUTE void arm_fir_fft_reset_f32(
+        arm_fir_fft_instance_f32 * S)
+{
+  const uint32_t fftLen = 2U * S->partLen;
+
+  arm_fill_f32(0.0f, S->pFdl, ((uint32_t)S->numPart - 1U) * fftLen);
+  arm_fill_f32(0.0f, S->pWindow, fftLen);
+  arm_fill_f32(0.0f, S->pHist, fftLen);
+
+  S->inCount = 0U;
+  S->outCount = 0U;
+  S->fdlIndex = 0U;
+}
+
+/**
+  @} end of FIR_FFT group
+ */
@@ -0,0 +1,439 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_mc_f32.c
+ * Description:  Floating-point FIR filter processing function. N interleaved channels
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+#if !(defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE))
+/**
+  @brief         Filters 4 consecutive channels of the interleaved state buffer.
+  @param[in]     pCoeffs      points to the filter coefficients
+  @param[in]     numTaps      number of filter coefficients in the filter
+  @param[in]     pState       points to the oldest state sample of the first channel
+  @param[out]    pOut         points to the first output sample of the first channel
+  @param[in]     numChannels  distance between two samples of a channel
+  @param[in]     blockSize    number of samples to process
+  @par           Details
+                   Same loop as the vector paths with 4 scalar lanes: 2 outputs of 4 channels are accumulated
+                   together, so each coefficient is loaded once for 8 multiply-accumulates and each state
+                   sample once for 2.
+ */
+static void arm_fir_mc_4ch_f32(
+  const float32_t * pCoeffs,
+        uint32_t numTaps,
+  const float32_t * pState,
+        float32_t * pOut,
+        uint32_t numChannels,
+        uint32_t blockSize)
+{
+  const float32_t *px;
+  const float32_t *pb;
+  float32_t acc00, acc01, acc02, acc03;          /* Accumulators of the first output */
+  float32_t acc10, acc11, acc12, acc13;          /* Accumulators of the second output */
+  float32_t x00, x01, x02, x03;                  /* State samples of the first output */
+  float32_t x10, x11, x12, x13;                  /* State samples of the second output */
+  float32_t c0;
+  uint32_t tapCnt;
+  uint32_t sample = blockSize >> 1U;
+
+  while (sample > 0U)
+  {
+    acc00 = 0.0f; acc01 = 0.0f; acc02 = 0.0f; acc03 = 0.0f;
+    acc10 = 0.0f; acc11 = 0.0f; acc12 = 0.0f; acc13 = 0.0f;
+    px = pState;
+    pb = pCoeffs;
+
+    x00 = px[0]; x01 = px[1]; x02 = px[2]; x03 = px[3];
+    px += numChannels;
+
+    tapCnt = numTaps;
+    while (tapCnt > 0U)
+    {
+      x10 = px[0]; x11 = px[1]; x12 = px[2]; x13 = px[3];
+      px += numChannels;
+      c0 = *pb++;
+
+      acc00 += x00 * c0; acc01 += x01 * c0; acc02 += x02 * c0; acc03 += x03 * c0;
+      acc10 += x10 * c0; acc11 += x11 * c0; acc12 += x12 * c0; acc13 += x13 * c0;
+
+      x00 = x10; x01 = x11; x02 = x12; x03 = x13;
+      tapCnt--;
+    }
+
+    pOut[0] = acc00; pOut[1] = acc01; pOut[2] = acc02; pOut[3] = acc03;
+    pOut += numChannels;
+    pOut[0] = acc10; pOut[1] = acc11; pOut[2] = acc12; pOut[3] = acc13;
+    pOut += numChannels;
+
+    pState += 2U * numChannels;
+    sample--;
+  }
+
+  if ((blockSize & 1U) != 0U)
+  {
+    acc00 = 0.0f; acc01 = 0.0f; acc02 = 0.0f; acc03 = 0.0f;
+    px = pState;
+    pb = pCoeffs;
+
+    tapCnt = numTaps;
+    while (tapCnt > 0U)
+    {
+      c0 = *pb++;
+      acc00 += px[0] * c0; acc01 += px[1] * c0; acc02 += px[2] * c0; acc03 += px[3] * c0;
+      px += numChannels;
+      tapCnt--;
+    }
+
+    pOut[0] = acc00; pOut[1] = acc01; pOut[2] = acc02; pOut[3] = acc03;
+  }
+}
+
+/**
+  @brief         Filters a single channel of the interleaved state buffer.
+  @param[in]     pCoeffs      points to the filter coefficients
+  @param[in]     numTaps      number of filter coefficients in the filter
+  @param[in]     pState       points to the oldest state sample of the channel
+  @param[out]    pOut         points to the first output sample of the channel
+  @param[in]     numChannels  distance between two samples of the channel
+  @param[in]     blockSize    number of samples to process
+  @par           Details
+                   4 consecutive outputs share the coefficient loads, the state samples sliding through
+                   registers as in arm_fir_f32(), so that one load feeds 4 multiply-accumulates.
+ */
+static void arm_fir_mc_channel_f32(
+  const float32_t * pCoeffs,
+        uint32_t numTaps,
+  const float32_t * pState,
+        float32_t * pOut,
+        uint32_t numChannels,
+        uint32_t blockSize)
+{
+  const float32_t *px;
+  const float32_t *pb;
+  float32_t acc0;
+  uint32_t tapCnt;
+  uint32_t sample;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+  float32_t acc1, acc2, acc3;                    /* Accumulators */
+  float32_t x0, x1, x2, x3;                      /* State samples */
+  float32_t c0;                                  /* Coefficient */
+
+  /* Loop unrolling: Compute 4 outputs at a time */
+  sample = blockSize >> 2U;
+  while (sample > 0U)
+  {
+    acc0 = 0.0f;
+    acc1 = 0.0f;
+    acc2 = 0.0f;
+    acc3 = 0.0f;
+    px = pState;
+    pb = pCoeffs;
+
+    x0 = *px;
+    px += numChannels;
+    x1 = *px;
+    px += numChannels;
+    x2 = *px;
+    px += numChannels;
+
+    tapCnt = numTaps;
+    while (tapCnt > 0U)
+    {
+      x3 = *px;
+      px += numChannels;
+      c0 = *pb++;
+
+      acc0 += x0 * c0;
+      acc1 += x1 * c0;
+      acc2 += x2 * c0;
+      acc3 += x3 * c0;
+
+      x0 = x1;
+      x1 = x2;
+      x2 = x3;
+      tapCnt--;
+    }
+
+    pOut[0] = acc0;
+    pOut += numChannels;
+    pOut[0] = acc1;
+    pOut += numChannels;
+    pOut[0] = acc2;
+    pOut += numChannels;
+    pOut[0] = acc3;
+    pOut += numChannels;
+
+    pState += 4U * numChannels;
+    sample--;
+  }
+
+  /* Loop unrolling: Compute remaining outputs */
+  sample = blockSize & 0x3U;
+#else
+  sample = blockSize;
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (sample > 0U)
+  {
+    acc0 = 0.0f;
+    px = pState;
+    pb = pCoeffs;
+
+    tapCnt = numTaps;
+    while (tapCnt > 0U)
+    {
+      acc0 += *px * *pb++;
+      px += numChannels;
+      tapCnt--;
+    }
+
+    *pOut = acc0;
+
+    pState += numChannels;
+    pOut += numChannels;
+    sample--;
+  }
+}
+#endif
+
+/**
+  @brief         Processing function for the floating-point multi-channel FIR filter.
+  @param[in]     S          points to an instance of the floating-point multi-channel FIR structure
+  @param[in]     pSrc       points to the block of interleaved input data
+  @param[out]    pDst       points to the block of interleaved output data
+  @param[in]     blockSize  number of samples to process per channel
+
+  @par           Details
+                   The input and output blocks hold <code>blockSize * numChannels</code> values, the samples of the
+                   channels interleaved: <code>{x0[0], x1[0], ..., x0[1], x1[1], ...}</code>. The state buffer keeps the
+                   same layout, so one vector load reads the same delayed sample of 4 consecutive channels and the
+                   channels are filtered 4 at a time whatever the block size. Two consecutive outputs are computed
+                   together to reuse every loaded vector. The scalar code keeps the same blocking with 8
+                   accumulators, and filters the last channels one at a time, 4 outputs at a time.
+                   The filter can be computed in place (<code>pSrc == pDst</code>).
+ */
+ARM_DSP_ATTRIBUTE void arm_fir_mc_f32(
+  const arm_fir_mc_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;           /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;         /* Coefficient pointer */
+  const uint32_t numTaps = S->numTaps;           /* Number of filter coefficients in the filter */
+  const uint32_t numChannels = S->numChannels;   /* Number of channels */
+        float32_t *pStateCurnt;                  /* Points to the current sample of the state */
+        uint32_t ch;                             /* Channel counter */
+        uint32_t cnt;                            /* Loop counter */
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+  const float32_t *px;
+  const float32_t *pSamples;
+  const float32_t *pb;
+        float32_t *py;
+        f32x4_t x0Vec, x1Vec, acc0Vec, acc1Vec;
+        mve_pred16_t p0;
+        uint32_t sample, tapCnt;
+#elif defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
+  const float32_t *px;
+  const float32_t *pSamples;
+  const float32_t *pb;
+        float32_t *py;
+        float32x4_t x0Vec, x1Vec, acc0Vec, acc1Vec;
+        uint32_t sample, tapCnt;
+#endif
+
+  /* New samples are copied at the end of the state buffer */
+  pStateCurnt = &pState[(numTaps - 1U) * numChannels];
+  arm_copy_f32(pSrc, pStateCurnt, blockSize * numChannels);
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+  /* 4 channels at a time, predicated on the last channels */
+  for (ch = 0U; ch < numChannels; ch += 4U)
+  {
+    p0 = vctp32q(numChannels - ch);
+    px = &pState[ch];
+    py = &pDst[ch];
+
+    /* 2 outputs at a time, sharing the state loads */
+    sample = blockSize >> 1U;
+    while (sample > 0U)
+    {
+      pSamples = px;
+      pb = pCoeffs;
+      acc0Vec = vdupq_n_f32(0.0f);
+      acc1Vec = vdupq_n_f32(0.0f);
+
+      x0Vec = vldrwq_z_f32(pSamples, p0);
+      pSamples += numChannels;
+
+      tapCnt = numTaps;
+      while (tapCnt > 0U)
+      {
+        x1Vec = vldrwq_z_f32(pSamples, p0);
+        pSamples += numChannels;
+
+        acc0Vec = vfmaq(acc0Vec, x0Vec, *pb);
+        acc1Vec = vfmaq(acc1Vec, x1Vec, *pb);
+        pb++;
+
+        x0Vec = x1Vec;
+        tapCnt--;
+      }
+
+      vstrwq_p(py, acc0Vec, p0);
+      vstrwq_p(py + numChannels, acc1Vec, p0);
+
+      px += 2U * numChannels;
+      py += 2U * numChannels;
+      sample--;
+    }
+
+    if ((blockSize & 1U) != 0U)
+    {
+      pSamples = px;
+      pb = pCoeffs;
+      acc0Vec = vdupq_n_f32(0.0f);
+
+      tapCnt = numTaps;
+      while (tapCnt > 0U)
+      {
+        x0Vec = vldrwq_z_f32(pSamples, p0);
+        pSamples += numChannels;
+
+        acc0Vec = vfmaq(acc0Vec, x0Vec, *pb++);
+        tapCnt--;
+      }
+
+      vstrwq_p(py, acc0Vec, p0);
+    }
+  }
+#else
+  ch = 0U;
+
+#if defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
+  /* 4 channels at a time */
+  for (; (ch + 4U) <= numChannels; ch += 4U)
+  {
+    px = &pState[ch];
+    py = &pDst[ch];
+
+    /* 2 outputs at a time, sharing the state loads */
+    sample = blockSize >> 1U;
+    while (sample > 0U)
+    {
+      pSamples = px;
+      pb = pCoeffs;
+      acc0Vec = vdupq_n_f32(0.0f);
+      acc1Vec = vdupq_n_f32(0.0f);
+
+      x0Vec = vld1q_f32(pSamples);
+      pSamples += numChannels;
+
+      tapCnt = numTaps;
+      while (tapCnt > 0U)
+      {
+        x1Vec = vld1q_f32(pSamples);
+        pSamples += numChannels;
+
+        acc0Vec = vmlaq_n_f32(acc0Vec, x0Vec, *pb);
+        acc1Vec = vmlaq_n_f32(acc1Vec, x1Vec, *pb);
+        pb++;
+
+        x0Vec = x1Vec;
+        tapCnt--;
+      }
+
+      vst1q_f32(py, acc0Vec);
+      vst1q_f32(py + numChannels, acc1Vec);
+
+      px += 2U * numChannels;
+      py += 2U * numChannels;
+      sample--;
+    }
+
+    if ((blockSize & 1U) != 0U)
+    {
+      pSamples = px;
+      pb = pCoeffs;
+      acc0Vec = vdupq_n_f32(0.0f);
+
+      tapCnt = numTaps;
+      while (tapCnt > 0U)
+      {
+        x0Vec = vld1q_f32(pSamples);
+        pSamples += numChannels;
+
+        acc0Vec = vmlaq_n_f32(acc0Vec, x0Vec, *pb++);
+        tapCnt--;
+      }
+
+      vst1q_f32(py, acc0Vec);
+    }
+  }
+#endif /* #if defined(ARM_MATH_NEON) */
+
+  /* 4 channels at a time */
+  for (; (ch + 4U) <= numChannels; ch += 4U)
+  {
+    arm_fir_mc_4ch_f32(pCoeffs, numTaps, &pState[ch], &pDst[ch], numChannels, blockSize);
+  }
+
+  /* Remaining channels one at a time */
+  for (; ch < numChannels; ch++)
+  {
+    arm_fir_mc_channel_f32(pCoeffs, numTaps, &pState[ch], &pDst[ch], numChannels, blockSize);
+  }
+#endif /* #if defined(ARM_MATH_MVEF) */
+
+  /* Processing is complete.
+     Now copy the last numTaps - 1 samples to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+  pStateCurnt = pState;
+  pState = &pState[blockSize * numChannels];
+
+  cnt = (numTaps - 1U) * numChannels;
+  while (cnt > 0U)
+  {
+    *pStateCurnt++ = *pState++;
+    cnt--;
+  }
+}
+
+/**
+  @} end of FIR group
+ */
@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_mc_init_f32.c
+ * Description:  Floating-point multi-channel FIR filter initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point multi-channel FIR filter.
+  @param[in,out] S            points to an instance of the floating-point multi-channel FIR filter structure
+  @param[in]     numTaps      number of filter coefficients in the filter
+  @param[in]     numChannels  number of interleaved channels
+  @param[in]     pCoeffs      points to the filter coefficients buffer
+  @param[in]     pState       points to the state buffer
+  @param[in]     blockSize    number of samples per channel processed per call
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of filter coefficients, shared by all the channels
+                   and stored in time reversed order as for arm_fir_init_f32():
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   <code>pState</code> points to the array of state variables, interleaved like the input:
+                   it is of length <code>(numTaps+blockSize-1)*numChannels</code> samples.
+ */
+
+ARM_DSP_ATTRIBUTE void arm_fir_mc_init_f32(
+        arm_fir_mc_instance_f32 * S,
+        uint16_t numTaps,
+        uint16_t numChannels,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize)
+{
+  /* Assign filter taps and channels */
+  S->numTaps = numTaps;
+  S->numChannels = numChannels;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer. The size is always (blockSize + numTaps - 1) * numChannels */
+  memset(pState, 0, ((numTaps + (blockSize - 1U)) * (uint32_t) numChannels) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+  @} end of FIR group
+ */
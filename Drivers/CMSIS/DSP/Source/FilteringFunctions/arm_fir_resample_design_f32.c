@@ -0,0 +1,282 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_design_f32.c
+ * Description:  Filter design and stage planning for the rational FIR resampler
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+#include <math.h>
+
+/* A ratio of 32-bit factors has at most 32 prime factors */
+#define ARM_FIR_RESAMPLE_MAX_FACTORS 32U
+
+/*
+ * Groups the prime factors of x, largest first, in products not larger than
+ * maxFactor (first fit). Returns the number of groups, or
+ * ARM_FIR_RESAMPLE_MAX_FACTORS + 1 if a prime factor is larger than maxFactor.
+ */
+static uint32_t arm_fir_resample_groups(
+  uint32_t x,
+  uint32_t maxFactor,
+  uint32_t * pGroup)
+{
+  uint32_t prime[ARM_FIR_RESAMPLE_MAX_FACTORS];
+  uint32_t numPrime = 0U;
+  uint32_t numGroup = 0U;
+  uint32_t d;
+  uint32_t i;
+  uint32_t g;
+
+  for (d = 2U; (d <= (x / d)); d++)
+  {
+    while ((x % d) == 0U)
+    {
+      prime[numPrime++] = d;
+      x /= d;
+    }
+  }
+  if (x > 1U)
+  {
+    prime[numPrime++] = x;
+  }
+
+  /* Primes found in increasing order */
+  for (i = numPrime; i > 0U; i--)
+  {
+    if (prime[i - 1U] > maxFactor)
+    {
+      return ARM_FIR_RESAMPLE_MAX_FACTORS + 1U;
+    }
+    for (g = 0U; g < numGroup; g++)
+    {
+      if ((pGroup[g] * prime[i - 1U]) <= maxFactor)
+      {
+        break;
+      }
+    }
+    if (g == numGroup)
+    {
+      pGroup[numGroup++] = 1U;
+    }
+    pGroup[g] *= prime[i - 1U];
+  }
+
+  return numGroup;
+}
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Lowpass filter for the floating-point rational FIR resampler (windowed sinc).
+  @param[in]     L          upsample factor
+  @param[in]     numTaps    number of filter coefficients, a multiple of <code>L</code>
+  @param[in]     cutoff     cutoff frequency relative to the input sample rate
+  @param[out]    pCoeffs    points to the <code>numTaps</code> filter coefficients
+
+  @par           Details
+                   Sinc of cutoff frequency <code>cutoff / L</code> at the upsampled rate, weighted by a
+                   symmetric 4 term Blackman-Harris window (92 dB sidelobes), with a gain of <code>L</code>
+                   so that every polyphase component has a unit gain at 0 Hz. The cutoff should not be above
+                   <code>0.5 * min(1, L / M)</code>, the lower Nyquist frequency. The transition band, from
+                   the passband to the 92 dB attenuation, is about <code>8 * L / numTaps</code> wide relative
+                   to the input sample rate and centered on the cutoff frequency.
+                   The filter is symmetric, so it is the same in time reversed order.
+ */
+ARM_DSP_ATTRIBUTE void arm_fir_resample_design_f32(
+        uint16_t L,
+        uint16_t numTaps,
+        float32_t cutoff,
+        float32_t * pCoeffs)
+{
+  const float32_t fc = cutoff / (float32_t)L;
+  const float32_t center = 0.5f * (float32_t)(numTaps - 1U);
+  const float32_t k = (numTaps > 1U) ? ((2.0f * PI) / (float32_t)(numTaps - 1U)) : 0.0f;
+  float32_t sum = 0.0f;
+  float32_t t;
+  float32_t w;
+  uint32_t i;
+
+  for (i = 0U; i < numTaps; i++)
+  {
+    t = (float32_t)i - center;
+    w = 0.35875f - (0.48829f * cosf(k * (float32_t)i)) +
+        (0.14128f * cosf(2.0f * k * (float32_t)i)) - (0.01168f * cosf(3.0f * k * (float32_t)i));
+    pCoeffs[i] = (t == 0.0f) ? (2.0f * fc * w) : ((sinf(2.0f * PI * fc * t) / (PI * t)) * w);
+    sum += pCoeffs[i];
+  }
+
+  arm_scale_f32(pCoeffs, (float32_t)L / sum, pCoeffs, numTaps);
+}
+
+/**
+  @brief         Splits a resampling ratio in stages with small factors.
+  @param[in]     L          upsample factor
+  @param[in]     M          downsample factor
+  @param[in]     maxFactor  largest upsample or downsample factor of a stage, at most 65535
+  @param[out]    pStageL    points to the upsample factors of the stages
+  @param[out]    pStageM    points to the downsample factors of the stages
+  @param[in]     maxStages  length of the <code>pStageL</code> and <code>pStageM</code> arrays
+  @return        number of stages, 0 if a prime factor of <code>L/M</code> is larger than
+                 <code>maxFactor</code> or more than <code>maxStages</code> stages are needed
+
+  @par           Details
+                   The common factors of <code>L</code> and <code>M</code> are removed, then the prime
+                   factors of each are grouped in as few products not larger than <code>maxFactor</code>
+                   as possible, and the upsample and downsample factors are paired by decreasing size.
+                   The stages are ordered so that the sample rate stays as low as possible without going
+                   below the smaller of the input and output rates: every stage keeps the band of the
+                   final output, and the stages at a high rate can use short filters with a wide
+                   transition band.
+  @par
+                   For example 44.1 kHz to 16 kHz, <code>160/441</code>, with <code>maxFactor = 8</code>
+                   gives 4 stages: <code>5/7, 8/7, 4/3, 1/3</code>, at 31.5, 36, 48 and 16 kHz.
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_fir_resample_plan_f32(
+        uint32_t L,
+        uint32_t M,
+        uint32_t maxFactor,
+        uint16_t * pStageL,
+        uint16_t * pStageM,
+        uint32_t maxStages)
+{
+  uint32_t groupL[ARM_FIR_RESAMPLE_MAX_FACTORS];
+  uint32_t groupM[ARM_FIR_RESAMPLE_MAX_FACTORS];
+  uint32_t numL;
+  uint32_t numM;
+  uint32_t numStages;
+  uint32_t stage;
+  uint32_t best;
+  uint32_t a;
+  uint32_t b;
+  uint32_t tmp;
+  uint64_t rateNum = 1U;
+  uint64_t rateDen = 1U;
+  uint64_t floorNum;
+  uint64_t floorDen;
+
+  if ((L == 0U) || (M == 0U) || (maxFactor < 2U) || (maxFactor > 65535U))
+  {
+    return 0U;
+  }
+
+  /* Irreducible ratio */
+  a = L;
+  b = M;
+  while (b != 0U)
+  {
+    tmp = a % b;
+    a = b;
+    b = tmp;
+  }
+  L /= a;
+  M /= a;
+
+  numL = arm_fir_resample_groups(L, maxFactor, groupL);
+  numM = arm_fir_resample_groups(M, maxFactor, groupM);
+  if ((numL > ARM_FIR_RESAMPLE_MAX_FACTORS) || (numM > ARM_FIR_RESAMPLE_MAX_FACTORS))
+  {
+    return 0U;
+  }
+
+  numStages = (numL > numM) ? numL : numM;
+  numStages = (numStages == 0U) ? 1U : numStages;
+  if (numStages > maxStages)
+  {
+    return 0U;
+  }
+  for (a = numL; a < numStages; a++)
+  {
+    groupL[a] = 1U;
+  }
+  for (a = numM; a < numStages; a++)
+  {
+    groupM[a] = 1U;
+  }
+
+  /* Both lists of factors in decreasing order */
+  for (a = 1U; a < numStages; a++)
+  {
+    for (b = a; (b > 0U) && (groupL[b - 1U] < groupL[b]); b--)
+    {
+      tmp = groupL[b]; groupL[b] = groupL[b - 1U]; groupL[b - 1U] = tmp;
+    }
+    for (b = a; (b > 0U) && (groupM[b - 1U] < groupM[b]); b--)
+    {
+      tmp = groupM[b]; groupM[b] = groupM[b - 1U]; groupM[b - 1U] = tmp;
+    }
+  }
+
+  /* Lowest rate, relative to the input rate: min(1, L / M) */
+  floorNum = (L < M) ? L : 1U;
+  floorDen = (L < M) ? M : 1U;
+
+  /*
+   * Next stage: smallest ratio keeping the rate above the floor. There is always
+   * one, since the remaining stages lead to the output rate.
+   */
+  for (stage = 0U; stage < numStages; stage++)
+  {
+    best = numStages;
+    for (a = stage; a < numStages; a++)
+    {
+      if (((rateNum * groupL[a]) * floorDen) >= ((rateDen * groupM[a]) * floorNum))
+      {
+        if ((best == numStages) || (((uint64_t)groupL[a] * groupM[best]) < ((uint64_t)groupL[best] * groupM[a])))
+        {
+          best = a;
+        }
+      }
+    }
+
+    tmp = groupL[stage]; groupL[stage] = groupL[best]; groupL[best] = tmp;
+    tmp = groupM[stage]; groupM[stage] = groupM[best]; groupM[best] = tmp;
+    pStageL[stage] = (uint16_t)groupL[stage];
+    pStageM[stage] = (uint16_t)groupM[stage];
+
+    rateNum *= groupL[stage];
+    rateDen *= groupM[stage];
+    for (a = (uint32_t)rateNum, b = (uint32_t)rateDen; b != 0U; )
+    {
+      tmp = a % b;
+      a = b;
+      b = tmp;
+    }
+    rateNum /= a;
+    rateDen /= a;
+  }
+
+  return numStages;
+}
+
+/**
+  @} end of FIR_Resample group
+ */
@@ -0,0 +1,171 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_f32.c
+ * Description:  Floating-point rational L/M FIR resampler (polyphase)
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR_Resample Rational FIR Resampler
+
+  Changes the sample rate by a rational factor <code>L/M</code>, for example
+  from 44.1 kHz to 48 kHz with <code>L = 160</code> and <code>M = 147</code>.
+  Conceptually, the input is upsampled by <code>L</code> (zero stuffing), lowpass
+  filtered, and downsampled by <code>M</code>, as with arm_fir_interpolate_f32()
+  followed by arm_fir_decimate_f32(). Only the kept outputs are computed, each with
+  the <code>phaseLength = numTaps / L</code> coefficients of its polyphase component:
+  the cost per output sample is <code>phaseLength</code> multiply-accumulates, instead
+  of <code>M * phaseLength</code> for the cascade.
+
+  @par           Algorithm
+                   The output <code>y[k]</code> is the sample <code>k * M</code> of the upsampled and
+                   filtered signal: with <code>n = floor(k * M / L)</code> and <code>p = (k * M) mod L</code>,
+  <pre>
+      y[k] = b[p] * x[n] + b[p+L] * x[n-1] + ... + b[p+L*(phaseLength-1)] * x[n-phaseLength+1]
+  </pre>
+                   The phase <code>p</code> and the input position are carried from block to block, so
+                   a stream can be processed with blocks of any size. The number of outputs of a call
+                   depends on the phase and is returned by arm_fir_resample_f32(): it is at most
+                   <code>(blockSize * L) / M + 1</code>.
+
+  @par           Coefficients
+                   The coefficients are those of arm_fir_interpolate_f32(): <code>numTaps</code> values,
+                   a multiple of <code>L</code>, in time reversed order, with a gain of <code>L</code> and a
+                   cutoff frequency below the smaller of the input and output Nyquist frequencies.
+                   arm_fir_resample_design_f32() computes such a filter.
+
+  @par           Multi-stage resampling
+                   A ratio with large factors needs <code>L * phaseLength</code> coefficients. It can be
+                   split with arm_fir_resample_plan_f32() in stages with small factors, each one with its
+                   own resampler instance and shorter filter, the output of a stage being the input of the
+                   next one.
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point rational FIR resampler.
+  @param[in,out] S          points to an instance of the floating-point FIR resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data, of at least <code>(blockSize * L) / M + 1</code> samples
+  @param[in]     blockSize  number of input samples to process, at most the <code>blockSize</code> of the initialization
+  @return        number of output samples
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_fir_resample_f32(
+        arm_fir_resample_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const uint32_t L = S->L;
+  const uint32_t phaseLength = S->phaseLength;
+  const uint32_t stepIn = (uint32_t)S->M / L;
+  const uint32_t stepPhase = (uint32_t)S->M % L;
+        float32_t *pState = S->pState;
+  const float32_t *pS;
+  const float32_t *pC;
+        float32_t acc0;
+        uint32_t n = S->offset / L;
+        uint32_t p = S->offset % L;
+        uint32_t outCnt = 0U;
+        uint32_t tapCnt;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+        float32_t acc1, acc2, acc3;
+#endif
+
+  /* New samples after the phaseLength - 1 previous ones */
+  memcpy(&pState[phaseLength - 1U], pSrc, blockSize * sizeof(float32_t));
+
+  while (n < blockSize)
+  {
+    /* Inputs x[n-phaseLength+1] to x[n], coefficients of phase p with a stride of L */
+    pS = &pState[n];
+    pC = &S->pCoeffs[(L - 1U) - p];
+    acc0 = 0.0f;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+    acc1 = 0.0f;
+    acc2 = 0.0f;
+    acc3 = 0.0f;
+
+    tapCnt = phaseLength >> 2U;
+    while (tapCnt > 0U)
+    {
+      acc0 += pC[0] * pS[0];
+      acc1 += pC[L] * pS[1];
+      acc2 += pC[2U * L] * pS[2];
+      acc3 += pC[3U * L] * pS[3];
+
+      pC += 4U * L;
+      pS += 4;
+      tapCnt--;
+    }
+    acc0 += acc1 + acc2 + acc3;
+
+    tapCnt = phaseLength & 0x3U;
+#else
+    tapCnt = phaseLength;
+#endif
+
+    while (tapCnt > 0U)
+    {
+      acc0 += *pC * *pS++;
+      pC += L;
+      tapCnt--;
+    }
+
+    pDst[outCnt] = acc0;
+    outCnt++;
+
+    /* Next output M samples later at the upsampled rate */
+    n += stepIn;
+    p += stepPhase;
+    if (p >= L)
+    {
+      p -= L;
+      n++;
+    }
+  }
+
+  S->offset = ((n - blockSize) * L) + p;
+
+  /* Keep the last phaseLength - 1 samples for the next block */
+  memmove(pState, &pState[blockSize], (phaseLength - 1U) * sizeof(float32_t));
+
+  return outCnt;
+}
+
+/**
+  @} end of FIR_Resample group
+ */
@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_init_f32.c
+ * Description:  Floating-point rational FIR resampler initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/filtering_functions.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point rational FIR resampler.
+  @param[in,out] S          points to an instance of the floating-point FIR resampler structure
+  @param[in]     L          upsample factor
+  @param[in]     M          downsample factor
+  @param[in]     numTaps    number of filter coefficients in the filter
+  @param[in]     pCoeffs    points to the filter coefficient buffer
+  @param[in]     pState     points to the state buffer
+  @param[in]     blockSize  largest number of input samples processed per call
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>L</code> or <code>M</code> is 0
+                   - \ref ARM_MATH_LENGTH_ERROR   : <code>numTaps</code> is 0 or not a multiple of <code>L</code>
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order,
+                   as for arm_fir_interpolate_init_f32():
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[numTaps-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   <code>L</code> and <code>M</code> should have no common factor: the filter of
+                   <code>L/M = 320/294</code> is 2 times longer than the one of <code>160/147</code>
+                   for the same cost per output sample.
+  @par
+                   <code>pState</code> points to the array of state variables of length
+                   <code>(numTaps/L)+blockSize-1</code>. <code>blockSize * L</code> must be smaller than 2^32.
+                   The first output is computed at the time of the first input sample.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_fir_resample_init_f32(
+        arm_fir_resample_instance_f32 * S,
+        uint16_t L,
+        uint16_t M,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize)
+{
+  if ((L == 0U) || (M == 0U))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  if ((numTaps == 0U) || ((numTaps % L) != 0U))
+  {
+    return ARM_MATH_LENGTH_ERROR;
+  }
+
+  S->L = L;
+  S->M = M;
+  S->phaseLength = numTaps / L;
+  S->offset = 0U;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  memset(pState, 0, (blockSize + ((uint32_t)S->phaseLength - 1U)) * sizeof(float32_t));
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of FIR_Resample group
+ */
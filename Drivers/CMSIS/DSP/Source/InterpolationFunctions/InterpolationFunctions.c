@@ -30,12 +30,17 @@
 #include "arm_bilinear_interp_q15.c"
 #include "arm_bilinear_interp_q31.c"
 #include "arm_bilinear_interp_q7.c"
+#include "arm_image_resize_init.c"
+#include "arm_image_resize_u8.c"
+#include "arm_image_resize_q7.c"
+#include "arm_image_resize_f32.c"
 #include "arm_linear_interp_f32.c"
 #include "arm_linear_interp_q15.c"
 #include "arm_linear_interp_q31.c"
 #include "arm_linear_interp_q7.c"
 #include "arm_spline_interp_f32.c"
 #include "arm_spline_interp_init_f32.c"
+#include "arm_spline_batch_f32.c"
 
 
 
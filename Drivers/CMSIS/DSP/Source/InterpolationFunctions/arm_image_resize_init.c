@@ -0,0 +1,216 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_image_resize_init.c
+ * Description:  Batched bilinear image resize initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/interpolation_functions.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @defgroup ImageResize Bilinear Image Resize
+
+  Resizes a region of an 8-bit image (camera frame, Y plane or interleaved RGB)
+  with bilinear interpolation, and converts the result to the input format of a
+  neural network in the same pass: 8-bit unsigned, normalized Q7 or normalized
+  floating-point values.
+
+  Unlike arm_bilinear_interp_f32(), which computes one point per call, the
+  source positions and interpolation weights of every output row and column are
+  computed once by arm_image_resize_init(). Every output row is then made of two
+  passes without any index computation or bound check:
+  - the two source rows are interpolated over the width of the region into a line
+    buffer (contiguous, one multiply-accumulate per value);
+  - every output value is interpolated between two values of the line buffer.
+
+  @par           Coordinates
+                   Pixel centers are aligned (half pixel offset): output column <code>x</code>
+                   samples the region at <code>(x + 0.5) * cropCols / dstCols - 0.5</code>, clamped to
+                   the region, and likewise for the rows. This is the convention of the usual
+                   image resize functions of the neural network frameworks. Weights are in Q15.
+
+  @par           Normalization
+                   The Q7 and floating-point outputs are <code>p * scale[c] + offset[c]</code>, where
+                   <code>p</code> is the interpolated pixel value from 0 to 255 and <code>c</code> the
+                   channel. The Q7 output is rounded and saturated: with the scale and zero point of
+                   the quantized network input, it is the quantized value of the normalized pixel.
+                   The 8-bit unsigned output is the rounded pixel value.
+
+  @par           Memory
+                   The caller provides one buffer of <code>arm_image_resize_buffer_size()</code> values:
+                   the positions and weights of the rows and of the output values, and the line buffer.
+                   Planar images are resized plane by plane with <code>numChannels</code> equal to 1.
+ */
+
+/**
+  @addtogroup ImageResize
+  @{
+ */
+
+/**
+  @brief         Source position of an output row or column.
+  @param[in]     dst      output row or column
+  @param[in]     srcLen   length of the source region
+  @param[in]     dstLen   length of the output
+  @param[out]    pIndex   first of the two source positions
+  @param[out]    pWeight  weight of the second source position in Q15
+ */
+static void arm_image_resize_position(
+  uint32_t dst,
+  uint32_t srcLen,
+  uint32_t dstLen,
+  uint16_t * pIndex,
+  uint16_t * pWeight)
+{
+  /* (dst + 0.5) * srcLen / dstLen - 0.5 in Q15, rounded */
+  int64_t num = (((int64_t)((2U * dst) + 1U) * srcLen) - (int64_t)dstLen) * (int64_t)ARM_IMAGE_RESIZE_ONE;
+  uint32_t pos = (num <= 0) ? 0U : (uint32_t)((num + (int64_t)dstLen) / (2 * (int64_t)dstLen));
+  uint32_t i = pos >> 15;
+
+  if (i >= (srcLen - 1U))
+  {
+    *pIndex = (uint16_t)(srcLen - 2U);
+    *pWeight = (uint16_t)ARM_IMAGE_RESIZE_ONE;
+  }
+  else
+  {
+    *pIndex = (uint16_t)i;
+    *pWeight = (uint16_t)(pos & (ARM_IMAGE_RESIZE_ONE - 1U));
+  }
+}
+
+/**
+  @brief         Size of the buffer of a batched bilinear image resize.
+  @param[in]     numChannels  number of interleaved channels of a pixel
+  @param[in]     cropCols     number of columns of the source region
+  @param[in]     dstCols      number of columns of the output image
+  @param[in]     dstRows      number of rows of the output image
+  @return        number of uint16_t values of the <code>pBuffer</code> argument of arm_image_resize_init()
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_image_resize_buffer_size(
+        uint16_t numChannels,
+        uint16_t cropCols,
+        uint16_t dstCols,
+        uint16_t dstRows)
+{
+  /* Rows, output values, then the line buffer */
+  return (2U * (uint32_t)dstRows) + (2U * (uint32_t)dstCols * numChannels) + ((uint32_t)cropCols * numChannels);
+}
+
+/**
+  @brief         Initialization function for the batched bilinear image resize.
+  @param[in,out] S            points to an instance of the image resize structure
+  @param[in]     numChannels  number of interleaved channels of a pixel, 1 to ARM_IMAGE_RESIZE_MAX_CHANNELS
+  @param[in]     srcStride    distance between two rows of the source frame, in bytes
+  @param[in]     cropX        first column of the source region
+  @param[in]     cropY        first row of the source region
+  @param[in]     cropCols     number of columns of the source region, at least 2
+  @param[in]     cropRows     number of rows of the source region, at least 2
+  @param[in]     dstCols      number of columns of the output image
+  @param[in]     dstRows      number of rows of the output image
+  @param[in]     pScale       points to the normalization scale of every channel, or NULL for 1
+  @param[in]     pOffset      points to the normalization offset of every channel, or NULL for 0
+  @param[in]     pBuffer      points to the buffer of arm_image_resize_buffer_size() values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : unsupported number of channels, region smaller
+                                                    than 2 x 2, empty output, or line buffer offsets
+                                                    larger than 16 bits
+
+  @par           Details
+                   The source frame passed to the processing functions is not read here: the
+                   same instance resizes every frame of a camera stream.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_image_resize_init(
+        arm_image_resize_instance * S,
+        uint16_t numChannels,
+        uint32_t srcStride,
+        uint16_t cropX,
+        uint16_t cropY,
+        uint16_t cropCols,
+        uint16_t cropRows,
+        uint16_t dstCols,
+        uint16_t dstRows,
+  const float32_t * pScale,
+  const float32_t * pOffset,
+        uint16_t * pBuffer)
+{
+  const uint32_t numValues = (uint32_t)dstCols * numChannels;
+  uint16_t col;
+  uint32_t i;
+  uint32_t c;
+
+  if ((numChannels == 0U) || (numChannels > ARM_IMAGE_RESIZE_MAX_CHANNELS) ||
+      (cropCols < 2U) || (cropRows < 2U) || (dstCols == 0U) || (dstRows == 0U) ||
+      (((uint32_t)cropCols * numChannels) > 65536U))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->numChannels = numChannels;
+  S->cropCols = cropCols;
+  S->dstRows = dstRows;
+  S->dstCols = dstCols;
+  S->srcStride = srcStride;
+  S->srcOffset = ((uint32_t)cropY * srcStride) + ((uint32_t)cropX * numChannels);
+  S->pRowIndex = pBuffer;
+  S->pRowWeight = &S->pRowIndex[dstRows];
+  S->pColIndex = &S->pRowWeight[dstRows];
+  S->pColWeight = &S->pColIndex[numValues];
+  S->pLine = &S->pColWeight[numValues];
+
+  for (i = 0U; i < dstRows; i++)
+  {
+    arm_image_resize_position(i, cropRows, dstRows, &S->pRowIndex[i], &S->pRowWeight[i]);
+  }
+
+  /* Every channel of a column has the weight of the column */
+  for (i = 0U; i < dstCols; i++)
+  {
+    arm_image_resize_position(i, cropCols, dstCols, &col, &S->pColWeight[i * numChannels]);
+    for (c = 0U; c < numChannels; c++)
+    {
+      S->pColIndex[(i * numChannels) + c] = (uint16_t)(((uint32_t)col * numChannels) + c);
+      S->pColWeight[(i * numChannels) + c] = S->pColWeight[i * numChannels];
+    }
+  }
+
+  /* Repeated so that any 4 consecutive values read the scale of their channels */
+  for (i = 0U; i < (ARM_IMAGE_RESIZE_MAX_CHANNELS + 3U); i++)
+  {
+    c = i % numChannels;
+    S->scale[i] = ((pScale != NULL) ? pScale[c] : 1.0f) / 4194304.0f;
+    S->offset[i] = (pOffset != NULL) ? pOffset[c] : 0.0f;
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of ImageResize group
+ */
@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_image_resize_u8.c
+ * Description:  Batched bilinear image resize with 8-bit unsigned output
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/interpolation_functions.h"
+#include "arm_image_resize.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup ImageResize
+  @{
+ */
+
+/**
+  @brief         Batched bilinear image resize with 8-bit unsigned output.
+  @param[in]     S     points to an instance of the image resize structure
+  @param[in]     pSrc  points to the source frame
+  @param[out]    pDst  points to the output image of <code>dstRows * dstCols * numChannels</code> values
+ */
+ARM_DSP_ATTRIBUTE void arm_image_resize_u8(
+  const arm_image_resize_instance * S,
+  const uint8_t * pSrc,
+        uint8_t * pDst)
+{
+  const uint32_t numValues = (uint32_t)S->dstCols * S->numChannels;
+  uint32_t row;
+  uint32_t j;
+
+  for (row = 0U; row < S->dstRows; row++)
+  {
+    arm_image_resize_vertical(S, pSrc, row);
+    j = 0U;
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+    for (; (j + 4U) <= numValues; j += 4U)
+    {
+      vstrbq_u32(pDst, vreinterpretq_u32_s32(vrshrq_n_s32(arm_image_resize_horizontal_vec(S, j), 22)));
+      pDst += 4;
+    }
+#endif
+
+    for (; j < numValues; j++)
+    {
+      *pDst++ = (uint8_t)((arm_image_resize_horizontal(S, j) + (1 << 21)) >> 22);
+    }
+  }
+}
+
+/**
+  @} end of ImageResize group
+ */
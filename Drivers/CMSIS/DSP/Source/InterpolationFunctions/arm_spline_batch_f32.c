@@ -0,0 +1,277 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spline_batch_f32.c
+ * Description:  Floating-point cubic spline interpolation of unsorted x values
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/interpolation_functions.h"
+
+/**
+  @ingroup groupInterpolation
+ */
+
+/**
+  @addtogroup SplineInterpolate
+  @{
+ */
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+/* Intervals of 4 x values, x(i) < xq <= x(i+1), the first and last ones extended */
+static uint32x4_t arm_spline_interval_mve_f32(
+  const arm_spline_instance_f32 * S,
+        f32x4_t vecXq)
+{
+    const float32_t * x = S->x;
+    const uint32_t last = S->n_x - 2U;
+    uint32x4_t vecIdx;
+    uint32x4_t vecProbe;
+    f32x4_t vecT;
+    mve_pred16_t p0;
+    uint32_t half;
+    uint32_t len;
+
+    if (S->invStep != 0.0f)
+    {
+        /* Estimate from the step, clamped to [0, last] (NaN to 0) */
+        vecT = vmulq_n_f32(vsubq_n_f32(vecXq, x[0]), S->invStep);
+        vecT = vmaxnmq_f32(vecT, vdupq_n_f32(0.0f));
+        vecT = vminnmq_f32(vecT, vdupq_n_f32((float32_t)last));
+        vecIdx = vcvtq_u32_f32(vecT);
+
+        /* Next interval when x(i+1) < xq */
+        p0 = vcmphiq_u32(vdupq_n_u32(last), vecIdx);
+        vecProbe = vaddq_n_u32(vecIdx, 1U);
+        p0 = vcmpgtq_m_f32(vecXq, vldrwq_gather_shifted_offset_f32(x, vecProbe), p0);
+        vecIdx = vpselq_u32(vecProbe, vecIdx, p0);
+
+        /* Previous interval when xq <= x(i) */
+        p0 = vcmphiq_n_u32(vecIdx, 0U);
+        p0 = vcmpleq_m_f32(vecXq, vldrwq_gather_shifted_offset_f32(x, vecIdx), p0);
+        vecIdx = vsubq_m_n_u32(vecIdx, vecIdx, 1U, p0);
+    }
+    else
+    {
+        vecIdx = vdupq_n_u32(0U);
+        len = last + 1U;
+        while (len > 1U)
+        {
+            half = len >> 1U;
+            vecProbe = vaddq_n_u32(vecIdx, half);
+            p0 = vcmpgtq_f32(vecXq, vldrwq_gather_shifted_offset_f32(x, vecProbe));
+            vecIdx = vpselq_u32(vecProbe, vecIdx, p0);
+            len -= half;
+        }
+    }
+
+    return vecIdx;
+}
+#else
+/* Interval i of xq, x(i) < xq <= x(i+1), the first and last ones extended */
+static uint32_t arm_spline_interval_f32(
+  const arm_spline_instance_f32 * S,
+        float32_t xq)
+{
+    const float32_t * x = S->x;
+    const uint32_t last = S->n_x - 2U;
+    uint32_t i;
+    uint32_t half;
+    uint32_t len;
+    float32_t t;
+
+    if (S->invStep != 0.0f)
+    {
+        /* Estimate from the step, at most one interval away */
+        t = (xq - x[0]) * S->invStep;
+        t = (t > 0.0f) ? t : 0.0f;
+        t = (t < (float32_t)last) ? t : (float32_t)last;
+        i = (uint32_t)t;
+
+        i += ((i < last) && (x[i+1U] < xq)) ? 1U : 0U;
+        i -= ((i > 0U) && (xq <= x[i])) ? 1U : 0U;
+    }
+    else
+    {
+        /* Branchless binary search of the last i with i = 0 or x(i) < xq */
+        i = 0U;
+        len = last + 1U;
+        while (len > 1U)
+        {
+            half = len >> 1U;
+            i = (x[i+half] < xq) ? (i + half) : i;
+            len -= half;
+        }
+    }
+
+    return i;
+}
+
+/*
+ * Intervals of 4 x values with the binary search, the 4 searches in lock
+ * step so that their loads do not wait for each other
+ */
+static void arm_spline_interval4_f32(
+  const arm_spline_instance_f32 * S,
+  const float32_t * xq,
+        uint32_t * pIdx)
+{
+    const float32_t * x = S->x;
+    uint32_t i0 = 0U;
+    uint32_t i1 = 0U;
+    uint32_t i2 = 0U;
+    uint32_t i3 = 0U;
+    uint32_t half;
+    uint32_t len = S->n_x - 1U;
+
+    while (len > 1U)
+    {
+        half = len >> 1U;
+        i0 = (x[i0+half] < xq[0]) ? (i0 + half) : i0;
+        i1 = (x[i1+half] < xq[1]) ? (i1 + half) : i1;
+        i2 = (x[i2+half] < xq[2]) ? (i2 + half) : i2;
+        i3 = (x[i3+half] < xq[3]) ? (i3 + half) : i3;
+        len -= half;
+    }
+
+    pIdx[0] = i0;
+    pIdx[1] = i1;
+    pIdx[2] = i2;
+    pIdx[3] = i3;
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+ * @brief Floating-point cubic spline interpolation of x values in any order.
+ * @param[in]  S          points to an instance of the floating-point spline structure.
+ * @param[in]  xq         points to the x values of the interpolated data points.
+ * @param[out] pDst       points to the block of output data.
+ * @param[in]  blockSize  number of samples of output data.
+ *
+ * @par Details
+ *
+ * arm_spline_f32() walks the intervals and the x values together and requires
+ * sorted x values. This function finds the interval of every x value on its own:
+ * - when the known x values are evenly spaced (<code>invStep</code> set by
+ *   arm_spline_init_f32()), from (xq-x(1))/h, corrected by one interval at most;
+ * - otherwise with a binary search of ceil(log2(n-1)) steps without branches,
+ *   4 x values at a time so that the searches overlap.
+ *
+ * The polynomials are evaluated in Horner form. With Helium, 4 x values are
+ * processed at a time with gather loads of the knots and of the coefficients.
+ *
+ * @par Performance
+ *
+ * Finding the interval of every value costs more than walking the intervals:
+ * for x values that are already sorted, arm_spline_f32() is faster (2 to 4
+ * times on the host, more with many unevenly spaced points). Sorting unsorted
+ * values first with the radix arm_argsort_f32() and putting the outputs back
+ * in order costs more than the search: this function is faster up to at least
+ * 1024 known points. The arm_spline_batch_example prints the three times.
+ *
+ * The intervals, including the extension of the first and last ones outside
+ * [x(1), x(n)], are the ones of arm_spline_f32(): for sorted x values, both
+ * functions give the same results up to rounding.
+ */
+ARM_DSP_ATTRIBUTE void arm_spline_batch_f32(
+  const arm_spline_instance_f32 * S,
+  const float32_t * xq,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+    const float32_t * x = S->x;
+    const float32_t * y = S->y;
+    const uint32_t n = S->n_x;
+
+    /* Coefficients (a==y for i<=n-1) */
+    const float32_t * b = (S->coeffs);
+    const float32_t * c = (S->coeffs)+(n-1U);
+    const float32_t * d = (S->coeffs)+(2U*(n-1U));
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+    uint32x4_t vecIdx;
+    f32x4_t vecXq;
+    f32x4_t vecDiff;
+    f32x4_t vecY;
+    mve_pred16_t p0;
+    int32_t blkCnt = (int32_t)blockSize;
+
+    while (blkCnt > 0)
+    {
+        p0 = vctp32q((uint32_t)blkCnt);
+        vecXq = vldrwq_z_f32(xq, p0);
+        vecIdx = arm_spline_interval_mve_f32(S, vecXq);
+
+        /* y(i) + (xq-x(i))*(b(i) + (xq-x(i))*(c(i) + (xq-x(i))*d(i))) */
+        vecDiff = vsubq_f32(vecXq, vldrwq_gather_shifted_offset_f32(x, vecIdx));
+        vecY = vldrwq_gather_shifted_offset_f32(d, vecIdx);
+        vecY = vfmaq_f32(vldrwq_gather_shifted_offset_f32(c, vecIdx), vecY, vecDiff);
+        vecY = vfmaq_f32(vldrwq_gather_shifted_offset_f32(b, vecIdx), vecY, vecDiff);
+        vecY = vfmaq_f32(vldrwq_gather_shifted_offset_f32(y, vecIdx), vecY, vecDiff);
+        vstrwq_p_f32(pDst, vecY, p0);
+
+        xq += 4;
+        pDst += 4;
+        blkCnt -= 4;
+    }
+#else
+    uint32_t i;
+    uint32_t k;
+    uint32_t idx[4];
+    uint32_t blkCnt = blockSize;
+    float32_t diff;
+
+    /* Without the step, 4 binary searches at a time */
+    if (S->invStep == 0.0f)
+    {
+        while (blkCnt >= 4U)
+        {
+            arm_spline_interval4_f32(S, xq, idx);
+            for (k = 0U; k < 4U; k++)
+            {
+                i = idx[k];
+                diff = *xq++ - x[i];
+
+                *pDst++ = y[i] + diff*(b[i] + diff*(c[i] + diff*d[i]));
+            }
+
+            blkCnt -= 4U;
+        }
+    }
+
+    while (blkCnt > 0U)
+    {
+        i = arm_spline_interval_f32(S, *xq);
+        diff = *xq++ - x[i];
+
+        *pDst++ = y[i] + diff*(b[i] + diff*(c[i] + diff*d[i]));
+
+        blkCnt--;
+    }
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+}
+
+/**
+  @} end of SplineInterpolate group
+ */
@@ -47,6 +47,12 @@
 
   The x input array must be strictly sorted in ascending order and it must
   not contain twice the same value (x(i)<x(i+1)).
+
+  @par
+
+  The initialization function also detects x values evenly spaced by a step h,
+  each within h/4 of x(1)+(i-1)*h, and stores 1/h in <code>invStep</code> for
+  arm_spline_batch_f32().
  
 */
 
@@ -88,6 +94,7 @@ ARM_DSP_ATTRIBUTE void arm_spline_init_f32(
     float32_t Bi; /* B(i), i-th element of matrix B=LZ */
     float32_t li; /* l(i), i-th element of matrix L    */
     float32_t cp1; /* Temporary value for c(i+1) */
+    float32_t dev; /* Distance of x(i) to the evenly spaced value */
 
     int32_t i; /* Loop counter */
 
@@ -167,6 +174,22 @@ ARM_DSP_ATTRIBUTE void arm_spline_init_f32(
     /* == Finally, store the coefficients in the instance == */
 
     S->coeffs = coeffs;
+
+    /* == Evenly spaced x values, within a quarter of the step: == */
+    /*    arm_spline_batch_f32() finds the intervals from 1/h     */
+
+    hi = (x[n-1]-x[0])/(float32_t)(n-1);
+    S->invStep = 1.0f/hi;
+
+    for (i=1; i<(int32_t)n-1; i++)
+    {
+        dev = x[i]-(x[0]+(float32_t)i*hi);
+        if ((dev > 0.25f*hi) || (dev < -0.25f*hi))
+        {
+            S->invStep = 0.0f;
+            break;
+        }
+    }
 }
 
 /**
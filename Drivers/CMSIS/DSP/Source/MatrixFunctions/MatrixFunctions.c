@@ -46,6 +46,13 @@
 #include "arm_mat_mult_q15.c"
 #include "arm_mat_mult_q31.c"
 #include "arm_mat_mult_opt_q31.c"
+#include "arm_mat_mult_blocked_f32.c"
+#include "arm_mat_mult_blocked_q31.c"
+#include "arm_mat_mult_blocked_q15.c"
+#include "arm_mat_mult_small_f32.c"
+#include "arm_mat_trans_small_f32.c"
+#include "arm_mat_inverse_small_f32.c"
+#include "arm_kalman_f32.c"
 #include "arm_mat_scale_f32.c"
 #include "arm_mat_scale_q15.c"
 #include "arm_mat_scale_q31.c"
@@ -77,3 +84,12 @@
 #include "arm_mat_qr_f64.c"
 #include "arm_householder_f64.c"
 #include "arm_householder_f32.c"
+#include "arm_mat_csr_init_f32.c"
+#include "arm_mat_csr_init_q31.c"
+#include "arm_mat_csr_init_q15.c"
+#include "arm_mat_csr_vec_mult_f32.c"
+#include "arm_mat_csr_vec_mult_q31.c"
+#include "arm_mat_csr_vec_mult_q15.c"
+#include "arm_mat_csr_mult_f32.c"
+#include "arm_mat_csr_mult_q31.c"
+#include "arm_mat_csr_mult_q15.c"
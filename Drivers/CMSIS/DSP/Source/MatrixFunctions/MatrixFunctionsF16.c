@@ -31,7 +31,9 @@
 #include "arm_mat_trans_f16.c"
 #include "arm_mat_scale_f16.c"
 #include "arm_mat_mult_f16.c"
+#include "arm_mat_mult_f16_f32.c"
 #include "arm_mat_vec_mult_f16.c"
+#include "arm_mat_vec_mult_f16_f32.c"
 #include "arm_mat_cmplx_trans_f16.c"
 #include "arm_mat_cmplx_mult_f16.c"
 #include "arm_mat_inverse_f16.c"
@@ -0,0 +1,475 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_kalman_f32.c
+ * Description:  Floating-point Kalman filter for small state vectors
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+#include "arm_mat_small.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup Kalman Kalman Filter
+
+  Linear Kalman filter with up to \ref ARM_MAT_SMALL_MAX_DIM states and
+  measurements, for sensor fusion and control loops.
+
+  The model is x[k] = F x[k-1] + w with a process noise covariance Q, and
+  z[k] = H x[k] + v with a measurement noise covariance R.
+
+  @par           Algorithm
+                   Prediction:
+  <pre>
+      x = F x
+      P = F P F' + Q
+  </pre>
+  @par
+                   Update with the measurement z:
+  <pre>
+      S = H P H' + R
+      K = P H' inv(S)
+      x = x + K (z - H x)
+      P = P - K H P
+  </pre>
+  @par
+                   S is factored with a Cholesky decomposition instead of being inverted, and only
+                   one triangle of the symmetric matrices is computed. arm_kalman_step_f32() does the
+                   prediction and the update in one call: the predicted state and covariance stay in
+                   local arrays, and the state and covariance of the instance are written once.
+                   The number of states is a constant of the kernels, so their loops are unrolled
+                   by the compiler like the functions of the \ref MatrixSmall group.
+
+  @par           Memory
+                   The matrices are given as the usual matrix instance structures to arm_kalman_init_f32(),
+                   which checks their sizes once. F, Q, H and R are read at each call and can be updated
+                   between calls, for instance with the time step. The filter needs no other buffer.
+ */
+
+/**
+  @addtogroup Kalman
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point Kalman filter.
+  @param[out]    S       points to an instance of the Kalman filter structure
+  @param[in]     pF      points to the n x n state transition matrix
+  @param[in]     pQ      points to the n x n process noise covariance matrix
+  @param[in]     pH      points to the m x n observation matrix
+  @param[in]     pR      points to the m x m measurement noise covariance matrix
+  @param[in,out] pState  points to the state estimate of n values, initialized by the caller
+  @param[in,out] pP      points to the n x n covariance of the state estimate, initialized by the caller
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : n or m is 0 or larger than \ref ARM_MAT_SMALL_MAX_DIM
+                   - \ref ARM_MATH_SIZE_MISMATCH  : Matrix sizes are not consistent
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_kalman_init_f32(
+        arm_kalman_instance_f32 * S,
+  const arm_matrix_instance_f32 * pF,
+  const arm_matrix_instance_f32 * pQ,
+  const arm_matrix_instance_f32 * pH,
+  const arm_matrix_instance_f32 * pR,
+        float32_t * pState,
+        arm_matrix_instance_f32 * pP)
+{
+  const uint16_t n = pF->numRows;
+  const uint16_t m = pH->numRows;
+
+  if ((n == 0U) || (n > ARM_MAT_SMALL_MAX_DIM) || (m == 0U) || (m > ARM_MAT_SMALL_MAX_DIM))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  if ((pF->numCols != n) ||
+      (pQ->numRows != n) || (pQ->numCols != n) ||
+      (pH->numCols != n) ||
+      (pR->numRows != m) || (pR->numCols != m) ||
+      (pP->numRows != n) || (pP->numCols != n))
+  {
+    return ARM_MATH_SIZE_MISMATCH;
+  }
+
+  S->numStates = n;
+  S->numMeas = m;
+  S->pF = pF->pData;
+  S->pQ = pQ->pData;
+  S->pH = pH->pData;
+  S->pR = pR->pData;
+  S->pState = pState;
+  S->pP = pP->pData;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/* Predicted state and covariance in x and P, n constant after inlining */
+__STATIC_FORCEINLINE void arm_kalman_predict_kernel_f32(
+  const arm_kalman_instance_f32 * S,
+        float32_t * x,
+        float32_t * P,
+  const uint32_t n)
+{
+  const float32_t *pF = S->pF;
+  const float32_t *pQ = S->pQ;
+  float32_t xIn[ARM_MAT_SMALL_MAX_DIM];
+  float32_t FP[ARM_MAT_SMALL_MAX_DIM * ARM_MAT_SMALL_MAX_DIM];
+  float32_t acc;
+  uint32_t i;
+  uint32_t j;
+  uint32_t k;
+
+  ARM_MAT_SMALL_UNROLL
+  for (i = 0U; i < n; i++)
+  {
+    xIn[i] = S->pState[i];
+  }
+
+  /* x = F x and F P */
+  ARM_MAT_SMALL_UNROLL
+  for (i = 0U; i < n; i++)
+  {
+    acc = 0.0f;
+    ARM_MAT_SMALL_UNROLL
+    for (k = 0U; k < n; k++)
+    {
+      acc += pF[(i * n) + k] * xIn[k];
+    }
+    x[i] = acc;
+
+    ARM_MAT_SMALL_UNROLL
+    for (j = 0U; j < n; j++)
+    {
+      acc = 0.0f;
+      ARM_MAT_SMALL_UNROLL
+      for (k = 0U; k < n; k++)
+      {
+        acc += pF[(i * n) + k] * S->pP[(k * n) + j];
+      }
+      FP[(i * n) + j] = acc;
+    }
+  }
+
+  /* P = (F P) F' + Q, upper triangle mirrored */
+  ARM_MAT_SMALL_UNROLL
+  for (i = 0U; i < n; i++)
+  {
+    ARM_MAT_SMALL_UNROLL
+    for (j = i; j < n; j++)
+    {
+      acc = pQ[(i * n) + j];
+      ARM_MAT_SMALL_UNROLL
+      for (k = 0U; k < n; k++)
+      {
+        acc += FP[(i * n) + k] * pF[(j * n) + k];
+      }
+      P[(i * n) + j] = acc;
+      P[(j * n) + i] = acc;
+    }
+  }
+}
+
+/* Update of x and P with the measurement, n constant after inlining */
+__STATIC_FORCEINLINE arm_status arm_kalman_update_kernel_f32(
+  const arm_kalman_instance_f32 * S,
+  const float32_t * pZ,
+        float32_t * x,
+        float32_t * P,
+  const uint32_t n)
+{
+  const uint32_t m = S->numMeas;
+  const float32_t *pH = S->pH;
+  const float32_t *pR = S->pR;
+  float32_t PHt[ARM_MAT_SMALL_MAX_DIM * ARM_MAT_SMALL_MAX_DIM];
+  float32_t L[ARM_MAT_SMALL_MAX_DIM * ARM_MAT_SMALL_MAX_DIM];
+  float32_t Kt[ARM_MAT_SMALL_MAX_DIM * (ARM_MAT_SMALL_MAX_DIM + 1U)];
+  float32_t invDiag[ARM_MAT_SMALL_MAX_DIM];
+  float32_t y[ARM_MAT_SMALL_MAX_DIM];
+  float32_t acc;
+  uint32_t i;
+  uint32_t j;
+  uint32_t k;
+
+  /* P H', n x m */
+  ARM_MAT_SMALL_UNROLL
+  for (i = 0U; i < n; i++)
+  {
+    for (j = 0U; j < m; j++)
+    {
+      acc = 0.0f;
+      ARM_MAT_SMALL_UNROLL
+      for (k = 0U; k < n; k++)
+      {
+        acc += P[(i * n) + k] * pH[(j * n) + k];
+      }
+      PHt[(i * m) + j] = acc;
+    }
+  }
+
+  /* Lower triangle of S = H P H' + R, factored in place: S = L L' */
+  for (i = 0U; i < m; i++)
+  {
+    for (j = 0U; j <= i; j++)
+    {
+      acc = pR[(i * m) + j];
+      ARM_MAT_SMALL_UNROLL
+      for (k = 0U; k < n; k++)
+      {
+        acc += pH[(i * n) + k] * PHt[(k * m) + j];
+      }
+      for (k = 0U; k < j; k++)
+      {
+        acc -= L[(i * m) + k] * L[(j * m) + k];
+      }
+
+      if (j < i)
+      {
+        L[(i * m) + j] = acc * invDiag[j];
+      }
+      else
+      {
+        if (acc <= 0.0f)
+        {
+          return ARM_MATH_SINGULAR;
+        }
+        L[(i * m) + i] = sqrtf(acc);
+        invDiag[i] = 1.0f / L[(i * m) + i];
+      }
+    }
+  }
+
+  /* Innovation z - H x */
+  for (i = 0U; i < m; i++)
+  {
+    acc = pZ[i];
+    ARM_MAT_SMALL_UNROLL
+    for (k = 0U; k < n; k++)
+    {
+      acc -= pH[(i * n) + k] * x[k];
+    }
+    y[i] = acc;
+  }
+
+  /* inv(S) [y, H P] by forward and backward substitution, column n is y */
+  for (j = 0U; j <= n; j++)
+  {
+    for (i = 0U; i < m; i++)
+    {
+      acc = (j < n) ? PHt[(j * m) + i] : y[i];
+      for (k = 0U; k < i; k++)
+      {
+        acc -= L[(i * m) + k] * Kt[(k * (n + 1U)) + j];
+      }
+      Kt[(i * (n + 1U)) + j] = acc * invDiag[i];
+    }
+    for (i = m; i > 0U; i--)
+    {
+      acc = Kt[((i - 1U) * (n + 1U)) + j];
+      for (k = i; k < m; k++)
+      {
+        acc -= L[(k * m) + (i - 1U)] * Kt[(k * (n + 1U)) + j];
+      }
+      Kt[((i - 1U) * (n + 1U)) + j] = acc * invDiag[i - 1U];
+    }
+  }
+
+  /* x = x + P H' inv(S) y and P = P - P H' inv(S) H P, upper triangle mirrored */
+  ARM_MAT_SMALL_UNROLL
+  for (i = 0U; i < n; i++)
+  {
+    acc = x[i];
+    for (k = 0U; k < m; k++)
+    {
+      acc += PHt[(i * m) + k] * Kt[(k * (n + 1U)) + n];
+    }
+    x[i] = acc;
+
+    ARM_MAT_SMALL_UNROLL
+    for (j = i; j < n; j++)
+    {
+      acc = P[(i * n) + j];
+      for (k = 0U; k < m; k++)
+      {
+        acc -= PHt[(i * m) + k] * Kt[(k * (n + 1U)) + j];
+      }
+      P[(i * n) + j] = acc;
+      P[(j * n) + i] = acc;
+    }
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Prediction step of the floating-point Kalman filter.
+  @param[in,out] S  points to an instance of the Kalman filter structure
+
+  @par           Details
+                   Replaces the state and its covariance with their predictions for the next time step.
+ */
+ARM_DSP_ATTRIBUTE void arm_kalman_predict_f32(
+  const arm_kalman_instance_f32 * S)
+{
+  /* The kernel reads the state and covariance before writing them */
+  switch (S->numStates)
+  {
+    case 1U:
+      arm_kalman_predict_kernel_f32(S, S->pState, S->pP, 1U);
+      break;
+    case 2U:
+      arm_kalman_predict_kernel_f32(S, S->pState, S->pP, 2U);
+      break;
+    case 3U:
+      arm_kalman_predict_kernel_f32(S, S->pState, S->pP, 3U);
+      break;
+    case 4U:
+      arm_kalman_predict_kernel_f32(S, S->pState, S->pP, 4U);
+      break;
+    case 5U:
+      arm_kalman_predict_kernel_f32(S, S->pState, S->pP, 5U);
+      break;
+    default:
+      arm_kalman_predict_kernel_f32(S, S->pState, S->pP, 6U);
+      break;
+  }
+}
+
+/**
+  @brief         Update step of the floating-point Kalman filter.
+  @param[in,out] S   points to an instance of the Kalman filter structure
+  @param[in]     pZ  points to the measurement of m values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS  : Operation successful
+                   - \ref ARM_MATH_SINGULAR : Innovation covariance S is not positive definite,
+                                              the state and its covariance are not modified
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_kalman_update_f32(
+  const arm_kalman_instance_f32 * S,
+  const float32_t * pZ)
+{
+  arm_status status;
+
+  switch (S->numStates)
+  {
+    case 1U:
+      status = arm_kalman_update_kernel_f32(S, pZ, S->pState, S->pP, 1U);
+      break;
+    case 2U:
+      status = arm_kalman_update_kernel_f32(S, pZ, S->pState, S->pP, 2U);
+      break;
+    case 3U:
+      status = arm_kalman_update_kernel_f32(S, pZ, S->pState, S->pP, 3U);
+      break;
+    case 4U:
+      status = arm_kalman_update_kernel_f32(S, pZ, S->pState, S->pP, 4U);
+      break;
+    case 5U:
+      status = arm_kalman_update_kernel_f32(S, pZ, S->pState, S->pP, 5U);
+      break;
+    default:
+      status = arm_kalman_update_kernel_f32(S, pZ, S->pState, S->pP, 6U);
+      break;
+  }
+
+  return status;
+}
+
+/* Fused prediction and update in local arrays, n constant after inlining */
+__STATIC_FORCEINLINE arm_status arm_kalman_step_kernel_f32(
+  const arm_kalman_instance_f32 * S,
+  const float32_t * pZ,
+  const uint32_t n)
+{
+  float32_t x[ARM_MAT_SMALL_MAX_DIM];
+  float32_t P[ARM_MAT_SMALL_MAX_DIM * ARM_MAT_SMALL_MAX_DIM];
+  arm_status status;
+  uint32_t i;
+
+  arm_kalman_predict_kernel_f32(S, x, P, n);
+  status = arm_kalman_update_kernel_f32(S, pZ, x, P, n);
+
+  ARM_MAT_SMALL_UNROLL
+  for (i = 0U; i < n; i++)
+  {
+    S->pState[i] = x[i];
+  }
+  ARM_MAT_SMALL_UNROLL
+  for (i = 0U; i < (n * n); i++)
+  {
+    S->pP[i] = P[i];
+  }
+
+  return status;
+}
+
+/**
+  @brief         Prediction and update steps of the floating-point Kalman filter.
+  @param[in,out] S   points to an instance of the Kalman filter structure
+  @param[in]     pZ  points to the measurement of m values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS  : Operation successful
+                   - \ref ARM_MATH_SINGULAR : Innovation covariance S is not positive definite,
+                                              the state and its covariance are the predicted ones
+
+  @par           Details
+                   Same result as arm_kalman_predict_f32() followed by arm_kalman_update_f32(),
+                   without storing the predicted state and covariance in between.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_kalman_step_f32(
+  const arm_kalman_instance_f32 * S,
+  const float32_t * pZ)
+{
+  arm_status status;
+
+  switch (S->numStates)
+  {
+    case 1U:
+      status = arm_kalman_step_kernel_f32(S, pZ, 1U);
+      break;
+    case 2U:
+      status = arm_kalman_step_kernel_f32(S, pZ, 2U);
+      break;
+    case 3U:
+      status = arm_kalman_step_kernel_f32(S, pZ, 3U);
+      break;
+    case 4U:
+      status = arm_kalman_step_kernel_f32(S, pZ, 4U);
+      break;
+    case 5U:
+      status = arm_kalman_step_kernel_f32(S, pZ, 5U);
+      break;
+    default:
+      status = arm_kalman_step_kernel_f32(S, pZ, 6U);
+      break;
+  }
+
+  return status;
+}
+
+/**
+  @} end of Kalman group
+ */
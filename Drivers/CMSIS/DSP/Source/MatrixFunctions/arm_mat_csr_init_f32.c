@@ -0,0 +1,280 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_csr_init_f32.c
+ * Description:  Floating-point CSR sparse matrix initialization and construction
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixCsr Sparse Matrices (CSR)
+
+  Matrices with mostly zero values, stored in compressed sparse row (CSR) format:
+  only the non-zero values are stored and multiplied.
+
+  @par           Format
+                   The values of row <code>i</code> are <code>pData[pRowPtr[i]]</code> to
+                   <code>pData[pRowPtr[i+1] - 1]</code>, and <code>pColIdx</code> holds the column of
+                   every value. <code>pRowPtr[0]</code> is 0 and <code>pRowPtr[numRows]</code> is the number
+                   of stored values. The builders sort the values of a row by increasing column and
+                   never store a column twice in a row. The multiplications only require the columns
+                   of a row to be distinct.
+  @par
+                   A matrix of <code>numNonZeros</code> values takes <code>6 * numNonZeros + 4 * (numRows + 1)</code>
+                   bytes in f32 and Q31, <code>4 * numNonZeros + 4 * (numRows + 1)</code> bytes in Q15, against
+                   <code>4 * numRows * numCols</code> or <code>2 * numRows * numCols</code> bytes for the dense matrix.
+
+  @par           Construction
+                   arm_mat_csr_init_f32() sets the arrays of the instance, as arm_mat_init_f32() does.
+                   arm_mat_csr_from_dense_f32() and arm_mat_csr_from_triplets_f32() then fill them
+                   from a dense matrix or from a list of (row, column, value) triplets in any order.
+
+  @par           Operations
+                   - y = A * x: arm_mat_csr_vec_mult_f32()
+                   - y = A' * x: arm_mat_csr_trans_vec_mult_f32()
+                   - C = A * B with a dense B: arm_mat_csr_mult_f32()
+                   - C = A' * B with a dense B: arm_mat_csr_trans_mult_f32()
+  @par
+                   The cost is proportional to the number of stored values instead of the size of the matrix.
+                   A row of A times a vector gathers the values of the vector at the columns of the row;
+                   the products with a dense matrix add whole rows of B, so their inner loops run along
+                   contiguous rows. The fixed-point functions have the scaling of the dense functions
+                   arm_mat_vec_mult_q31(), arm_mat_mult_q31() and their Q15 versions, and give the same results.
+ */
+
+/**
+  @addtogroup MatrixCsr
+  @{
+ */
+
+/**
+  @brief         Floating-point CSR matrix initialization.
+  @param[out]    S            points to an instance of the floating-point CSR matrix structure
+  @param[in]     numRows      number of rows of the matrix
+  @param[in]     numCols      number of columns of the matrix
+  @param[in]     numNonZeros  number of stored values
+  @param[in]     pRowPtr      points to the row indexes, numRows + 1 values
+  @param[in]     pColIdx      points to the column indexes
+  @param[in]     pData        points to the stored values
+
+  @par           Details
+                   To build the matrix with arm_mat_csr_from_dense_f32() or arm_mat_csr_from_triplets_f32(),
+                   initialize it with <code>numNonZeros = 0</code> and arrays large enough for the values.
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_csr_init_f32(
+  arm_matrix_csr_instance_f32 * S,
+  uint16_t numRows,
+  uint16_t numCols,
+  uint32_t numNonZeros,
+  uint32_t * pRowPtr,
+  uint16_t * pColIdx,
+  float32_t * pData)
+{
+  S->numRows = numRows;
+  S->numCols = numCols;
+  S->numNonZeros = numNonZeros;
+  S->pRowPtr = pRowPtr;
+  S->pColIdx = pColIdx;
+  S->pData = pData;
+}
+
+/**
+  @brief         Floating-point CSR matrix from a dense matrix.
+  @param[in]     pSrc         points to the dense matrix structure
+  @param[out]    pDst         points to an initialized CSR matrix structure
+  @param[in]     maxNonZeros  number of values that pColIdx and pData of pDst can hold
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : the dimensions differ or the matrix has more than
+                                                   <code>maxNonZeros</code> non-zero values
+
+  @par           Details
+                   The values equal to 0 are not stored. The dimensions of <code>pDst</code> are the ones
+                   given to arm_mat_csr_init_f32().
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_csr_from_dense_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_csr_instance_f32 * pDst,
+        uint32_t maxNonZeros)
+{
+  const float32_t *pIn = pSrc->pData;
+  uint32_t numNonZeros = 0U;
+  uint32_t row;
+  uint32_t col;
+
+  if ((pSrc->numRows != pDst->numRows) || (pSrc->numCols != pDst->numCols))
+  {
+    return ARM_MATH_SIZE_MISMATCH;
+  }
+
+  for (row = 0U; row < pSrc->numRows; row++)
+  {
+    pDst->pRowPtr[row] = numNonZeros;
+    for (col = 0U; col < pSrc->numCols; col++)
+    {
+      if (*pIn != 0.0f)
+      {
+        if (numNonZeros == maxNonZeros)
+        {
+          return ARM_MATH_SIZE_MISMATCH;
+        }
+        pDst->pColIdx[numNonZeros] = (uint16_t)col;
+        pDst->pData[numNonZeros] = *pIn;
+        numNonZeros++;
+      }
+      pIn++;
+    }
+  }
+  pDst->pRowPtr[pSrc->numRows] = numNonZeros;
+  pDst->numNonZeros = numNonZeros;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Floating-point CSR matrix from (row, column, value) triplets.
+  @param[in]     numTriplets  number of triplets
+  @param[in]     pRows        points to the row of every triplet
+  @param[in]     pCols        points to the column of every triplet
+  @param[in]     pValues      points to the value of every triplet
+  @param[out]    pDst         points to an initialized CSR matrix structure
+  @param[in]     maxNonZeros  number of values that pColIdx and pData of pDst can hold
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : a row or a column is outside the matrix
+                   - \ref ARM_MATH_SIZE_MISMATCH  : <code>numTriplets</code> is larger than <code>maxNonZeros</code>
+
+  @par           Details
+                   The triplets can be in any order. The values of the triplets with the same row and
+                   column are added. The triplets are sorted by row in <code>pDst</code> with a counting
+                   sort, then the values of every row by column with an insertion sort, which is fast for
+                   the short rows of sparse matrices.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_csr_from_triplets_f32(
+        uint32_t numTriplets,
+  const uint16_t * pRows,
+  const uint16_t * pCols,
+  const float32_t * pValues,
+        arm_matrix_csr_instance_f32 * pDst,
+        uint32_t maxNonZeros)
+{
+  uint32_t *pRowPtr = pDst->pRowPtr;
+  uint16_t *pColIdx = pDst->pColIdx;
+  float32_t *pData = pDst->pData;
+  const uint32_t numRows = pDst->numRows;
+  uint32_t start;
+  uint32_t end;
+  uint32_t numNonZeros;
+  uint32_t row;
+  uint32_t i;
+  uint32_t j;
+  uint16_t col;
+  float32_t value;
+
+  if (numTriplets > maxNonZeros)
+  {
+    return ARM_MATH_SIZE_MISMATCH;
+  }
+
+  for (i = 0U; i <= numRows; i++)
+  {
+    pRowPtr[i] = 0U;
+  }
+  for (i = 0U; i < numTriplets; i++)
+  {
+    if ((pRows[i] >= pDst->numRows) || (pCols[i] >= pDst->numCols))
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+    pRowPtr[pRows[i] + 1U]++;
+  }
+
+  /* Start of every row, then triplets placed by row */
+  for (row = 0U; row < numRows; row++)
+  {
+    pRowPtr[row + 1U] += pRowPtr[row];
+  }
+  for (i = 0U; i < numTriplets; i++)
+  {
+    j = pRowPtr[pRows[i]]++;
+    pColIdx[j] = pCols[i];
+    pData[j] = pValues[i];
+  }
+  for (row = numRows; row > 0U; row--)
+  {
+    pRowPtr[row] = pRowPtr[row - 1U];
+  }
+  pRowPtr[0] = 0U;
+
+  /* Every row sorted by column, duplicates added, rows packed */
+  numNonZeros = 0U;
+  start = 0U;
+  for (row = 0U; row < numRows; row++)
+  {
+    end = pRowPtr[row + 1U];
+
+    for (i = start + 1U; i < end; i++)
+    {
+      col = pColIdx[i];
+      value = pData[i];
+      for (j = i; (j > start) && (pColIdx[j - 1U] > col); j--)
+      {
+        pColIdx[j] = pColIdx[j - 1U];
+        pData[j] = pData[j - 1U];
+      }
+      pColIdx[j] = col;
+      pData[j] = value;
+    }
+
+    pRowPtr[row] = numNonZeros;
+    for (i = start; i < end; i++)
+    {
+      if ((numNonZeros > pRowPtr[row]) && (pColIdx[numNonZeros - 1U] == pColIdx[i]))
+      {
+        pData[numNonZeros - 1U] += pData[i];
+      }
+      else
+      {
+        pColIdx[numNonZeros] = pColIdx[i];
+        pData[numNonZeros] = pData[i];
+        numNonZeros++;
+      }
+    }
+
+    start = end;
+  }
+  pRowPtr[numRows] = numNonZeros;
+  pDst->numNonZeros = numNonZeros;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of MatrixCsr group
+ */
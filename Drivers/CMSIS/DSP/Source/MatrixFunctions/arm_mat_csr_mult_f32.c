@@ -0,0 +1,220 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_csr_mult_f32.c
+ * Description:  Floating-point CSR sparse matrix and dense matrix multiplication
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/* pY[0..n-1] += a * pX[0..n-1] */
+static void arm_mat_csr_axpy_f32(
+  float32_t a,
+  const float32_t * pX,
+  float32_t * pY,
+  uint32_t n)
+{
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+  f32x4_t vecY;
+  mve_pred16_t p0;
+  int32_t blkCnt = (int32_t)n;
+
+  while (blkCnt > 0)
+  {
+    p0 = vctp32q((uint32_t)blkCnt);
+    vecY = vldrwq_z_f32(pY, p0);
+    vecY = vfmaq(vecY, vldrwq_z_f32(pX, p0), a);
+    vstrwq_p_f32(pY, vecY, p0);
+
+    pX += 4;
+    pY += 4;
+    blkCnt -= 4;
+  }
+#else
+  uint32_t blkCnt;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+  blkCnt = n >> 2U;
+  while (blkCnt > 0U)
+  {
+    pY[0] += a * pX[0];
+    pY[1] += a * pX[1];
+    pY[2] += a * pX[2];
+    pY[3] += a * pX[3];
+
+    pX += 4;
+    pY += 4;
+    blkCnt--;
+  }
+  blkCnt = n & 0x3U;
+#else
+  blkCnt = n;
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (blkCnt > 0U)
+  {
+    *pY++ += a * *pX++;
+    blkCnt--;
+  }
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+}
+
+/**
+  @addtogroup MatrixCsr
+  @{
+ */
+
+/**
+  @brief         Floating-point CSR matrix and dense matrix multiplication.
+  @param[in]     pSrcA  points to the CSR matrix structure
+  @param[in]     pSrcB  points to the dense matrix structure
+  @param[out]    pDst   points to the dense output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Details
+                   Every row of the output is the sum of the rows of B selected by the columns
+                   of the same row of A, scaled by the stored values. The inner loop runs along
+                   contiguous rows of B and of the output.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_csr_mult_f32(
+  const arm_matrix_csr_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  const uint32_t *pRowPtr = pSrcA->pRowPtr;
+  const uint32_t numColsB = pSrcB->numCols;
+  float32_t *pOut = pDst->pData;
+  uint32_t row;
+  uint32_t i;
+  arm_status status;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    for (row = 0U; row < pSrcA->numRows; row++)
+    {
+      for (i = 0U; i < numColsB; i++)
+      {
+        pOut[i] = 0.0f;
+      }
+      for (i = pRowPtr[row]; i < pRowPtr[row + 1U]; i++)
+      {
+        arm_mat_csr_axpy_f32(pSrcA->pData[i], &pSrcB->pData[pSrcA->pColIdx[i] * numColsB], pOut, numColsB);
+      }
+      pOut += numColsB;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @brief         Floating-point transposed CSR matrix and dense matrix multiplication.
+  @param[in]     pSrcA  points to the CSR matrix structure
+  @param[in]     pSrcB  points to the dense matrix structure
+  @param[out]    pDst   points to the dense output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Details
+                   Computes <code>A' * B</code> without transposing A: row <code>i</code> of B,
+                   scaled by every stored value of row <code>i</code> of A, is added to the row of
+                   the output given by the column of the value.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_csr_trans_mult_f32(
+  const arm_matrix_csr_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  const uint32_t *pRowPtr = pSrcA->pRowPtr;
+  const uint32_t numColsB = pSrcB->numCols;
+  const float32_t *pInB = pSrcB->pData;
+  uint32_t row;
+  uint32_t i;
+  arm_status status;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numRows != pSrcB->numRows) ||
+      (pSrcA->numCols != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    for (i = 0U; i < ((uint32_t)pSrcA->numCols * numColsB); i++)
+    {
+      pDst->pData[i] = 0.0f;
+    }
+
+    for (row = 0U; row < pSrcA->numRows; row++)
+    {
+      for (i = pRowPtr[row]; i < pRowPtr[row + 1U]; i++)
+      {
+        arm_mat_csr_axpy_f32(pSrcA->pData[i], pInB, &pDst->pData[pSrcA->pColIdx[i] * numColsB], numColsB);
+      }
+      pInB += numColsB;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixCsr group
+ */
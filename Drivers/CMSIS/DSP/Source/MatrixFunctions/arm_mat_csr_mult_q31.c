@@ -0,0 +1,183 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_csr_mult_q31.c
+ * Description:  Q31 CSR sparse matrix and dense matrix multiplication
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixCsr
+  @{
+ */
+
+/**
+  @brief         Q31 CSR matrix and dense matrix multiplication.
+  @param[in]     pSrcA  points to the CSR matrix structure
+  @param[in]     pSrcB  points to the dense matrix structure
+  @param[out]    pDst   points to the dense output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Scaling and Overflow Behavior
+                   Every output value is computed in a 64-bit accumulator, with the scaling of
+                   arm_mat_mult_q31(), which gives the same result with the dense matrix.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_csr_mult_q31(
+  const arm_matrix_csr_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+        arm_matrix_instance_q31 * pDst)
+{
+  const uint32_t *pRowPtr = pSrcA->pRowPtr;
+  const uint32_t numColsB = pSrcB->numCols;
+  const q31_t *pInB = pSrcB->pData;
+  q31_t *pOut = pDst->pData;
+  q63_t sum;
+  uint32_t row;
+  uint32_t col;
+  uint32_t i;
+  arm_status status;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    for (row = 0U; row < pSrcA->numRows; row++)
+    {
+      for (col = 0U; col < numColsB; col++)
+      {
+        sum = 0;
+        for (i = pRowPtr[row]; i < pRowPtr[row + 1U]; i++)
+        {
+          sum += (q63_t)pSrcA->pData[i] * pInB[(pSrcA->pColIdx[i] * numColsB) + col];
+        }
+        *pOut++ = (q31_t)(sum >> 31);
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @brief         Q31 transposed CSR matrix and dense matrix multiplication.
+  @param[in]     pSrcA     points to the CSR matrix structure
+  @param[in]     pSrcB     points to the dense matrix structure
+  @param[out]    pDst      points to the dense output matrix structure
+  @param[in]     pScratch  points to the 64-bit accumulators, numCols of pSrcA values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Details
+                   Computes <code>A' * B</code> without transposing A, one column of the output at a
+                   time: every row of A, scaled by the value of the column of B for that row, is
+                   added to the accumulators of its columns.
+  @par           Scaling and Overflow Behavior
+                   The result is the one of arm_mat_mult_q31() with the dense transposed matrix.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_csr_trans_mult_q31(
+  const arm_matrix_csr_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+        arm_matrix_instance_q31 * pDst,
+        q63_t * pScratch)
+{
+  const uint32_t *pRowPtr = pSrcA->pRowPtr;
+  const uint32_t numColsB = pSrcB->numCols;
+  q63_t b;
+  uint32_t row;
+  uint32_t col;
+  uint32_t i;
+  arm_status status;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numRows != pSrcB->numRows) ||
+      (pSrcA->numCols != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    for (col = 0U; col < numColsB; col++)
+    {
+      for (i = 0U; i < pSrcA->numCols; i++)
+      {
+        pScratch[i] = 0;
+      }
+
+      for (row = 0U; row < pSrcA->numRows; row++)
+      {
+        b = pSrcB->pData[(row * numColsB) + col];
+        for (i = pRowPtr[row]; i < pRowPtr[row + 1U]; i++)
+        {
+          pScratch[pSrcA->pColIdx[i]] += pSrcA->pData[i] * b;
+        }
+      }
+
+      for (i = 0U; i < pSrcA->numCols; i++)
+      {
+        pDst->pData[(i * numColsB) + col] = (q31_t)(pScratch[i] >> 31);
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixCsr group
+ */
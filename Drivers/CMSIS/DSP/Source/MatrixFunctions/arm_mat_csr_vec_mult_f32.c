@@ -0,0 +1,212 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_csr_vec_mult_f32.c
+ * Description:  Floating-point CSR sparse matrix and vector multiplication
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/matrix_functions.h"
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+#include "arm_helium_utils.h"
+#endif
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixCsr
+  @{
+ */
+
+/**
+  @brief         Floating-point CSR matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the CSR matrix structure
+  @param[in]     pVec     points to the input vector, numCols values
+  @param[out]    pDst     points to the output vector, numRows values
+
+  @par           Details
+                   Every output value is the dot product of the stored values of a row with the
+                   values of <code>pVec</code> at their columns. With Helium, the values of
+                   <code>pVec</code> are read 4 at a time with gather loads.
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+ARM_DSP_ATTRIBUTE void arm_mat_csr_vec_mult_f32(
+  const arm_matrix_csr_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst)
+{
+  const uint32_t *pRowPtr = pSrcMat->pRowPtr;
+  const uint16_t *pCol;
+  const float32_t *pVal;
+  f32x4_t vecSum;
+  f32x4_t vecX;
+  uint32x4_t vecOffs;
+  mve_pred16_t p0;
+  uint32_t row;
+  int32_t blkCnt;
+
+  for (row = 0U; row < pSrcMat->numRows; row++)
+  {
+    pCol = &pSrcMat->pColIdx[pRowPtr[row]];
+    pVal = &pSrcMat->pData[pRowPtr[row]];
+    blkCnt = (int32_t)(pRowPtr[row + 1U] - pRowPtr[row]);
+    vecSum = vdupq_n_f32(0.0f);
+
+    /* Lanes past the end of the row are loaded as 0 */
+    while (blkCnt > 0)
+    {
+      p0 = vctp32q((uint32_t)blkCnt);
+      vecOffs = vldrhq_z_u32(pCol, p0);
+      vecX = vldrwq_gather_shifted_offset_z_f32(pVec, vecOffs, p0);
+      vecSum = vfmaq(vecSum, vldrwq_z_f32(pVal, p0), vecX);
+
+      pCol += 4;
+      pVal += 4;
+      blkCnt -= 4;
+    }
+
+    pDst[row] = vecAddAcrossF32Mve(vecSum);
+  }
+}
+#else
+ARM_DSP_ATTRIBUTE void arm_mat_csr_vec_mult_f32(
+  const arm_matrix_csr_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst)
+{
+  const uint32_t *pRowPtr = pSrcMat->pRowPtr;
+  const uint16_t *pCol;
+  const float32_t *pVal;
+  float32_t sum;
+  uint32_t row;
+  uint32_t blkCnt;
+
+  for (row = 0U; row < pSrcMat->numRows; row++)
+  {
+    pCol = &pSrcMat->pColIdx[pRowPtr[row]];
+    pVal = &pSrcMat->pData[pRowPtr[row]];
+    sum = 0.0f;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+    blkCnt = (pRowPtr[row + 1U] - pRowPtr[row]) >> 2U;
+    while (blkCnt > 0U)
+    {
+      sum += pVal[0] * pVec[pCol[0]];
+      sum += pVal[1] * pVec[pCol[1]];
+      sum += pVal[2] * pVec[pCol[2]];
+      sum += pVal[3] * pVec[pCol[3]];
+
+      pCol += 4;
+      pVal += 4;
+      blkCnt--;
+    }
+    blkCnt = (pRowPtr[row + 1U] - pRowPtr[row]) & 0x3U;
+#else
+    blkCnt = pRowPtr[row + 1U] - pRowPtr[row];
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    while (blkCnt > 0U)
+    {
+      sum += *pVal++ * pVec[*pCol++];
+      blkCnt--;
+    }
+
+    pDst[row] = sum;
+  }
+}
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @brief         Floating-point transposed CSR matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the CSR matrix structure
+  @param[in]     pVec     points to the input vector, numRows values
+  @param[out]    pDst     points to the output vector, numCols values
+
+  @par           Details
+                   Computes <code>A' * x</code> without transposing A: every row of A, scaled by
+                   the value of <code>pVec</code> for that row, is added to the output at its columns.
+                   With Helium, the output values are updated 4 at a time with gather loads and scatter
+                   stores, which relies on the columns of a row being distinct.
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_csr_trans_vec_mult_f32(
+  const arm_matrix_csr_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst)
+{
+  const uint32_t *pRowPtr = pSrcMat->pRowPtr;
+  const uint16_t *pCol;
+  const float32_t *pVal;
+  float32_t x;
+  uint32_t row;
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+  f32x4_t vecY;
+  uint32x4_t vecOffs;
+  mve_pred16_t p0;
+  int32_t blkCnt;
+#else
+  uint32_t blkCnt;
+#endif
+
+  for (row = 0U; row < pSrcMat->numCols; row++)
+  {
+    pDst[row] = 0.0f;
+  }
+
+  for (row = 0U; row < pSrcMat->numRows; row++)
+  {
+    pCol = &pSrcMat->pColIdx[pRowPtr[row]];
+    pVal = &pSrcMat->pData[pRowPtr[row]];
+    x = pVec[row];
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+    blkCnt = (int32_t)(pRowPtr[row + 1U] - pRowPtr[row]);
+    while (blkCnt > 0)
+    {
+      p0 = vctp32q((uint32_t)blkCnt);
+      vecOffs = vldrhq_z_u32(pCol, p0);
+      vecY = vldrwq_gather_shifted_offset_z_f32(pDst, vecOffs, p0);
+      vecY = vfmaq(vecY, vldrwq_z_f32(pVal, p0), x);
+      vstrwq_scatter_shifted_offset_p_f32(pDst, vecOffs, vecY, p0);
+
+      pCol += 4;
+      pVal += 4;
+      blkCnt -= 4;
+    }
+#else
+    blkCnt = pRowPtr[row + 1U] - pRowPtr[row];
+    while (blkCnt > 0U)
+    {
+      pDst[*pCol++] += *pVal++ * x;
+      blkCnt--;
+    }
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+  }
+}
+
+/**
+  @} end of MatrixCsr group
+ */
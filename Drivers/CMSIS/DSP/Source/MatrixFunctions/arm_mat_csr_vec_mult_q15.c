@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_csr_vec_mult_q15.c
+ * Description:  Q15 CSR sparse matrix and vector multiplication
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixCsr
+  @{
+ */
+
+/**
+  @brief         Q15 CSR matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the CSR matrix structure
+  @param[in]     pVec     points to the input vector, numCols values
+  @param[out]    pDst     points to the output vector, numRows values
+
+  @par           Scaling and Overflow Behavior
+                   The products are added in a 64-bit accumulator in 34.30 format,
+                   truncated to 34.15 format by discarding the low 15 bits and saturated to 1.15 format.
+                   The result is the one of arm_mat_vec_mult_q15() with the dense matrix.
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_csr_vec_mult_q15(
+  const arm_matrix_csr_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+        q15_t * pDst)
+{
+  const uint32_t *pRowPtr = pSrcMat->pRowPtr;
+  const uint16_t *pCol;
+  const q15_t *pVal;
+  q63_t sum;
+  uint32_t row;
+  uint32_t blkCnt;
+
+  for (row = 0U; row < pSrcMat->numRows; row++)
+  {
+    pCol = &pSrcMat->pColIdx[pRowPtr[row]];
+    pVal = &pSrcMat->pData[pRowPtr[row]];
+    sum = 0;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+    blkCnt = (pRowPtr[row + 1U] - pRowPtr[row]) >> 2U;
+    while (blkCnt > 0U)
+    {
+      sum += (q63_t)pVal[0] * pVec[pCol[0]];
+      sum += (q63_t)pVal[1] * pVec[pCol[1]];
+      sum += (q63_t)pVal[2] * pVec[pCol[2]];
+      sum += (q63_t)pVal[3] * pVec[pCol[3]];
+
+      pCol += 4;
+      pVal += 4;
+      blkCnt--;
+    }
+    blkCnt = (pRowPtr[row + 1U] - pRowPtr[row]) & 0x3U;
+#else
+    blkCnt = pRowPtr[row + 1U] - pRowPtr[row];
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    while (blkCnt > 0U)
+    {
+      sum += (q63_t)*pVal++ * pVec[*pCol++];
+      blkCnt--;
+    }
+
+    pDst[row] = (q15_t)__SSAT((sum >> 15), 16);
+  }
+}
+
+/**
+  @brief         Q15 transposed CSR matrix and vector multiplication.
+  @param[in]     pSrcMat   points to the CSR matrix structure
+  @param[in]     pVec      points to the input vector, numRows values
+  @param[out]    pDst      points to the output vector, numCols values
+  @param[in]     pScratch  points to the 64-bit accumulators, numCols values
+
+  @par           Details
+                   Computes <code>A' * x</code> without transposing A: every row of A, scaled by
+                   the value of <code>pVec</code> for that row, is added to the accumulators of
+                   its columns, which are then converted to the output.
+  @par           Scaling and Overflow Behavior
+                   Same as arm_mat_csr_vec_mult_q15(): the result is the one of arm_mat_vec_mult_q15()
+                   with the dense transposed matrix.
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_csr_trans_vec_mult_q15(
+  const arm_matrix_csr_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+        q15_t * pDst,
+        q63_t * pScratch)
+{
+  const uint32_t *pRowPtr = pSrcMat->pRowPtr;
+  const uint16_t *pCol;
+  const q15_t *pVal;
+  q63_t x;
+  uint32_t row;
+  uint32_t col;
+  uint32_t blkCnt;
+
+  for (col = 0U; col < pSrcMat->numCols; col++)
+  {
+    pScratch[col] = 0;
+  }
+
+  for (row = 0U; row < pSrcMat->numRows; row++)
+  {
+    pCol = &pSrcMat->pColIdx[pRowPtr[row]];
+    pVal = &pSrcMat->pData[pRowPtr[row]];
+    x = pVec[row];
+
+    blkCnt = pRowPtr[row + 1U] - pRowPtr[row];
+    while (blkCnt > 0U)
+    {
+      pScratch[*pCol++] += *pVal++ * x;
+      blkCnt--;
+    }
+  }
+
+  for (col = 0U; col < pSrcMat->numCols; col++)
+  {
+    pDst[col] = (q15_t)__SSAT((pScratch[col] >> 15), 16);
+  }
+}
+
+/**
+  @} end of MatrixCsr group
+ */
@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_csr_vec_mult_q31.c
+ * Description:  Q31 CSR sparse matrix and vector multiplication
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixCsr
+  @{
+ */
+
+/**
+  @brief         Q31 CSR matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the CSR matrix structure
+  @param[in]     pVec     points to the input vector, numCols values
+  @param[out]    pDst     points to the output vector, numRows values
+
+  @par           Scaling and Overflow Behavior
+                   The products are added in a 64-bit accumulator in 2.62 format,
+                   truncated to 1.31 format by discarding the low 31 bits.
+                   The result is the one of arm_mat_vec_mult_q31() with the dense matrix.
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_csr_vec_mult_q31(
+  const arm_matrix_csr_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+        q31_t * pDst)
+{
+  const uint32_t *pRowPtr = pSrcMat->pRowPtr;
+  const uint16_t *pCol;
+  const q31_t *pVal;
+  q63_t sum;
+  uint32_t row;
+  uint32_t blkCnt;
+
+  for (row = 0U; row < pSrcMat->numRows; row++)
+  {
+    pCol = &pSrcMat->pColIdx[pRowPtr[row]];
+    pVal = &pSrcMat->pData[pRowPtr[row]];
+    sum = 0;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+    blkCnt = (pRowPtr[row + 1U] - pRowPtr[row]) >> 2U;
+    while (blkCnt > 0U)
+    {
+      sum += (q63_t)pVal[0] * pVec[pCol[0]];
+      sum += (q63_t)pVal[1] * pVec[pCol[1]];
+      sum += (q63_t)pVal[2] * pVec[pCol[2]];
+      sum += (q63_t)pVal[3] * pVec[pCol[3]];
+
+      pCol += 4;
+      pVal += 4;
+      blkCnt--;
+    }
+    blkCnt = (pRowPtr[row + 1U] - pRowPtr[row]) & 0x3U;
+#else
+    blkCnt = pRowPtr[row + 1U] - pRowPtr[row];
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    while (blkCnt > 0U)
+    {
+      sum += (q63_t)*pVal++ * pVec[*pCol++];
+      blkCnt--;
+    }
+
+    pDst[row] = (q31_t)(sum >> 31);
+  }
+}
+
+/**
+  @brief         Q31 transposed CSR matrix and vector multiplication.
+  @param[in]     pSrcMat   points to the CSR matrix structure
+  @param[in]     pVec      points to the input vector, numRows values
+  @param[out]    pDst      points to the output vector, numCols values
+  @param[in]     pScratch  points to the 64-bit accumulators, numCols values
+
+  @par           Details
+                   Computes <code>A' * x</code> without transposing A: every row of A, scaled by
+                   the value of <code>pVec</code> for that row, is added to the accumulators of
+                   its columns, which are then converted to the output.
+  @par           Scaling and Overflow Behavior
+                   Same as arm_mat_csr_vec_mult_q31(): the result is the one of arm_mat_vec_mult_q31()
+                   with the dense transposed matrix.
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_csr_trans_vec_mult_q31(
+  const arm_matrix_csr_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+        q31_t * pDst,
+        q63_t * pScratch)
+{
+  const uint32_t *pRowPtr = pSrcMat->pRowPtr;
+  const uint16_t *pCol;
+  const q31_t *pVal;
+  q63_t x;
+  uint32_t row;
+  uint32_t col;
+  uint32_t blkCnt;
+
+  for (col = 0U; col < pSrcMat->numCols; col++)
+  {
+    pScratch[col] = 0;
+  }
+
+  for (row = 0U; row < pSrcMat->numRows; row++)
+  {
+    pCol = &pSrcMat->pColIdx[pRowPtr[row]];
+    pVal = &pSrcMat->pData[pRowPtr[row]];
+    x = pVec[row];
+
+    blkCnt = pRowPtr[row + 1U] - pRowPtr[row];
+    while (blkCnt > 0U)
+    {
+      pScratch[*pCol++] += *pVal++ * x;
+      blkCnt--;
+    }
+  }
+
+  for (col = 0U; col < pSrcMat->numCols; col++)
+  {
+    pDst[col] = (q31_t)(pScratch[col] >> 31);
+  }
+}
+
+/**
+  @} end of MatrixCsr group
+ */
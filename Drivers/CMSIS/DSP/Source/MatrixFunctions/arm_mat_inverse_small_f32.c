@@ -0,0 +1,306 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_inverse_small_f32.c
+ * Description:  Floating-point inverse of small fixed-size matrices
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+#include "arm_mat_small.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixSmall
+  @{
+ */
+
+/* Inverse of a 2 x 2 matrix from its adjugate */
+__STATIC_FORCEINLINE arm_status arm_mat_inverse_2x2_kernel_f32(
+  const float32_t * pA,
+        float32_t * pB)
+{
+  float32_t a00 = pA[0], a01 = pA[1];
+  float32_t a10 = pA[2], a11 = pA[3];
+  float32_t det = (a00 * a11) - (a01 * a10);
+  float32_t invDet;
+
+  if (det == 0.0f)
+  {
+    return ARM_MATH_SINGULAR;
+  }
+  invDet = 1.0f / det;
+
+  pB[0] = a11 * invDet;
+  pB[1] = -a01 * invDet;
+  pB[2] = -a10 * invDet;
+  pB[3] = a00 * invDet;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/* Inverse of a 3 x 3 matrix from its adjugate */
+__STATIC_FORCEINLINE arm_status arm_mat_inverse_3x3_kernel_f32(
+  const float32_t * pA,
+        float32_t * pB)
+{
+  float32_t a00 = pA[0], a01 = pA[1], a02 = pA[2];
+  float32_t a10 = pA[3], a11 = pA[4], a12 = pA[5];
+  float32_t a20 = pA[6], a21 = pA[7], a22 = pA[8];
+  float32_t c00, c01, c02;
+  float32_t det;
+  float32_t invDet;
+
+  /* Cofactors of the first row */
+  c00 = (a11 * a22) - (a12 * a21);
+  c01 = (a12 * a20) - (a10 * a22);
+  c02 = (a10 * a21) - (a11 * a20);
+
+  det = (a00 * c00) + (a01 * c01) + (a02 * c02);
+  if (det == 0.0f)
+  {
+    return ARM_MATH_SINGULAR;
+  }
+  invDet = 1.0f / det;
+
+  pB[0] = c00 * invDet;
+  pB[1] = ((a02 * a21) - (a01 * a22)) * invDet;
+  pB[2] = ((a01 * a12) - (a02 * a11)) * invDet;
+  pB[3] = c01 * invDet;
+  pB[4] = ((a00 * a22) - (a02 * a20)) * invDet;
+  pB[5] = ((a02 * a10) - (a00 * a12)) * invDet;
+  pB[6] = c02 * invDet;
+  pB[7] = ((a01 * a20) - (a00 * a21)) * invDet;
+  pB[8] = ((a00 * a11) - (a01 * a10)) * invDet;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/* Gauss-Jordan inverse with partial pivoting, n constant after inlining */
+__STATIC_FORCEINLINE arm_status arm_mat_inverse_small_kernel_f32(
+  const float32_t * pA,
+        float32_t * pB,
+  const uint32_t n)
+{
+  float32_t a[ARM_MAT_SMALL_MAX_DIM * ARM_MAT_SMALL_MAX_DIM];
+  float32_t inv[ARM_MAT_SMALL_MAX_DIM * ARM_MAT_SMALL_MAX_DIM];
+  float32_t pivot;
+  float32_t factor;
+  float32_t tmp;
+  uint32_t pivotRow;
+  uint32_t col;
+  uint32_t row;
+  uint32_t j;
+
+  ARM_MAT_SMALL_UNROLL
+  for (j = 0U; j < (n * n); j++)
+  {
+    a[j] = pA[j];
+    inv[j] = 0.0f;
+  }
+  ARM_MAT_SMALL_UNROLL
+  for (j = 0U; j < n; j++)
+  {
+    inv[(j * n) + j] = 1.0f;
+  }
+
+  ARM_MAT_SMALL_UNROLL
+  for (col = 0U; col < n; col++)
+  {
+    /* Largest value of the column on or below the diagonal */
+    pivotRow = col;
+    ARM_MAT_SMALL_UNROLL
+    for (row = col + 1U; row < n; row++)
+    {
+      if (fabsf(a[(row * n) + col]) > fabsf(a[(pivotRow * n) + col]))
+      {
+        pivotRow = row;
+      }
+    }
+
+    pivot = a[(pivotRow * n) + col];
+    if (pivot == 0.0f)
+    {
+      return ARM_MATH_SINGULAR;
+    }
+
+    if (pivotRow != col)
+    {
+      ARM_MAT_SMALL_UNROLL
+      for (j = 0U; j < n; j++)
+      {
+        tmp = a[(col * n) + j];
+        a[(col * n) + j] = a[(pivotRow * n) + j];
+        a[(pivotRow * n) + j] = tmp;
+        tmp = inv[(col * n) + j];
+        inv[(col * n) + j] = inv[(pivotRow * n) + j];
+        inv[(pivotRow * n) + j] = tmp;
+      }
+    }
+
+    /* Pivot row normalized, columns left of the pivot are already 0 */
+    pivot = 1.0f / pivot;
+    ARM_MAT_SMALL_UNROLL
+    for (j = col; j < n; j++)
+    {
+      a[(col * n) + j] *= pivot;
+    }
+    ARM_MAT_SMALL_UNROLL
+    for (j = 0U; j < n; j++)
+    {
+      inv[(col * n) + j] *= pivot;
+    }
+
+    ARM_MAT_SMALL_UNROLL
+    for (row = 0U; row < n; row++)
+    {
+      if (row != col)
+      {
+        factor = a[(row * n) + col];
+        ARM_MAT_SMALL_UNROLL
+        for (j = col; j < n; j++)
+        {
+          a[(row * n) + j] -= factor * a[(col * n) + j];
+        }
+        ARM_MAT_SMALL_UNROLL
+        for (j = 0U; j < n; j++)
+        {
+          inv[(row * n) + j] -= factor * inv[(col * n) + j];
+        }
+      }
+    }
+  }
+
+  ARM_MAT_SMALL_UNROLL
+  for (j = 0U; j < (n * n); j++)
+  {
+    pB[j] = inv[j];
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+#ifdef ARM_MATH_MATRIX_CHECK
+#define ARM_MAT_INVERSE_SMALL_CHECK(N)                                     \
+  if ((pSrc->numRows != (N)) || (pSrc->numCols != (N)) ||                  \
+      (pDst->numRows != (N)) || (pDst->numCols != (N)))                    \
+  {                                                                        \
+    return ARM_MATH_SIZE_MISMATCH;                                         \
+  }
+#else
+#define ARM_MAT_INVERSE_SMALL_CHECK(N)
+#endif
+
+/**
+  @brief         Floating-point 2 x 2 matrix inverse.
+  @param[in]     pSrc  points to the input matrix structure
+  @param[out]    pDst  points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : Input matrix is found to be singular (non-invertible)
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_inverse_2x2_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst)
+{
+  ARM_MAT_INVERSE_SMALL_CHECK(2U)
+  return arm_mat_inverse_2x2_kernel_f32(pSrc->pData, pDst->pData);
+}
+
+/**
+  @brief         Floating-point 3 x 3 matrix inverse.
+  @param[in]     pSrc  points to the input matrix structure
+  @param[out]    pDst  points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : Input matrix is found to be singular (non-invertible)
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_inverse_3x3_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst)
+{
+  ARM_MAT_INVERSE_SMALL_CHECK(3U)
+  return arm_mat_inverse_3x3_kernel_f32(pSrc->pData, pDst->pData);
+}
+
+/**
+  @brief         Floating-point 4 x 4 matrix inverse.
+  @param[in]     pSrc  points to the input matrix structure
+  @param[out]    pDst  points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : Input matrix is found to be singular (non-invertible)
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_inverse_4x4_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst)
+{
+  ARM_MAT_INVERSE_SMALL_CHECK(4U)
+  return arm_mat_inverse_small_kernel_f32(pSrc->pData, pDst->pData, 4U);
+}
+
+/**
+  @brief         Floating-point 5 x 5 matrix inverse.
+  @param[in]     pSrc  points to the input matrix structure
+  @param[out]    pDst  points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : Input matrix is found to be singular (non-invertible)
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_inverse_5x5_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst)
+{
+  ARM_MAT_INVERSE_SMALL_CHECK(5U)
+  return arm_mat_inverse_small_kernel_f32(pSrc->pData, pDst->pData, 5U);
+}
+
+/**
+  @brief         Floating-point 6 x 6 matrix inverse.
+  @param[in]     pSrc  points to the input matrix structure
+  @param[out]    pDst  points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : Input matrix is found to be singular (non-invertible)
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_inverse_6x6_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst)
+{
+  ARM_MAT_INVERSE_SMALL_CHECK(6U)
+  return arm_mat_inverse_small_kernel_f32(pSrc->pData, pDst->pData, 6U);
+}
+
+#undef ARM_MAT_INVERSE_SMALL_CHECK
+
+/**
+  @} end of MatrixSmall group
+ */
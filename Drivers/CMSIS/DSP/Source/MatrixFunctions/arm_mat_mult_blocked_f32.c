@@ -0,0 +1,320 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_blocked_f32.c
+ * Description:  Floating-point cache blocked matrix multiplication with packed panels
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixMultBlocked Blocked Matrix Multiplication
+
+  Multiplication of matrices larger than the data cache, for instance
+  in external memory.
+
+  @par           Algorithm
+                   The columns of B are processed by panels. Each panel is copied (packed) in the
+                   workspace in the order it is read by the inner kernel, so that the panel stays in
+                   the cache while all the rows of A are multiplied with it, and the columns of B are
+                   read once per panel instead of once per row of A. The inner kernel computes a
+                   small tile of C with its accumulators in registers: every value loaded from A
+                   and from the panel is used for several multiply-accumulates.
+                   - Floating-point: panels of \ref ARM_MAT_MULT_BLOCKED_KC rows and \ref ARM_MAT_MULT_BLOCKED_NC
+                     columns, tiles of 4 x 4 values.
+                   - Fixed-point: panels of all the rows of B, so that the 64-bit accumulators are
+                     not stored between panels, and at most \ref ARM_MAT_MULT_BLOCKED_KC * \ref ARM_MAT_MULT_BLOCKED_NC
+                     values when the number of rows allows it; tiles of 2 x 2 values.
+
+  @par           Workspace
+                   The caller provides the packing buffer, of the size returned by the
+                   arm_mat_mult_blocked_workspace_size functions.
+
+  @par           Small matrices
+                   When B has at most \ref ARM_MAT_MULT_BLOCKED_MIN_SIZE values, or when A has fewer rows
+                   than a tile, B already stays in the cache and the packing does not pay off:
+                   the functions call arm_mat_mult_f32(), arm_mat_mult_q31() or arm_mat_mult_q15().
+                   arm_mat_mult_blocked_f32() also calls arm_mat_mult_f32() up to
+                   \ref ARM_MAT_MULT_BLOCKED_MIN_MACS_F32 multiply-accumulates, below the size where
+                   the packing pays off against the vectorized direct product.
+
+  @par           Results
+                   The fixed-point functions give the results of arm_mat_mult_q31() and arm_mat_mult_q15().
+                   The floating-point function adds the products in a different order than arm_mat_mult_f32().
+ */
+
+/**
+  @addtogroup MatrixMultBlocked
+  @{
+ */
+
+/* Tile of C computed by the inner kernel */
+#define MR_F32 4U
+#define NR_F32 4U
+
+/**
+  @brief         Size of the workspace of arm_mat_mult_blocked_f32().
+  @param[in]     pSrcA  points to the first input matrix structure
+  @param[in]     pSrcB  points to the second input matrix structure
+  @return        number of float32_t values of the <code>pWorkspace</code> argument
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_mat_mult_blocked_workspace_size_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB)
+{
+  uint32_t kc = pSrcA->numCols;
+  uint32_t nc = pSrcB->numCols;
+
+  kc = (kc > ARM_MAT_MULT_BLOCKED_KC) ? ARM_MAT_MULT_BLOCKED_KC : kc;
+  nc = (nc > ARM_MAT_MULT_BLOCKED_NC) ? ARM_MAT_MULT_BLOCKED_NC : nc;
+
+  /* Panel with its columns rounded up to whole tiles */
+  return kc * (((nc + NR_F32) - 1U) / NR_F32) * NR_F32;
+}
+
+/**
+  @} end of MatrixMultBlocked group
+ */
+
+/* Copy of kc rows and nc columns of B, by groups of NR_F32 columns zero padded */
+static void arm_mat_mult_blocked_pack_f32(
+  const float32_t * pB,
+  uint32_t numColsB,
+  uint32_t kc,
+  uint32_t nc,
+  float32_t * pPanel)
+{
+  const float32_t *pRow;
+  uint32_t col;
+  uint32_t nr;
+  uint32_t k;
+  uint32_t i;
+
+  for (col = 0U; col < nc; col += NR_F32)
+  {
+    nr = ((nc - col) > NR_F32) ? NR_F32 : (nc - col);
+    pRow = &pB[col];
+    for (k = 0U; k < kc; k++)
+    {
+      for (i = 0U; i < nr; i++)
+      {
+        *pPanel++ = pRow[i];
+      }
+      for (; i < NR_F32; i++)
+      {
+        *pPanel++ = 0.0f;
+      }
+      pRow += numColsB;
+    }
+  }
+}
+
+/* 4 x 4 tile: rows pA0 to pA3 times kc rows of a packed group of columns */
+static void arm_mat_mult_blocked_kernel_f32(
+  const float32_t * pA0,
+  const float32_t * pA1,
+  const float32_t * pA2,
+  const float32_t * pA3,
+  const float32_t * pPanel,
+  uint32_t kc,
+  float32_t * pTile)
+{
+  uint32_t k;
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+  f32x4_t vecB;
+  f32x4_t acc0 = vdupq_n_f32(0.0f);
+  f32x4_t acc1 = vdupq_n_f32(0.0f);
+  f32x4_t acc2 = vdupq_n_f32(0.0f);
+  f32x4_t acc3 = vdupq_n_f32(0.0f);
+
+  for (k = 0U; k < kc; k++)
+  {
+    vecB = vld1q(pPanel);
+    pPanel += NR_F32;
+    acc0 = vfmaq(acc0, vecB, pA0[k]);
+    acc1 = vfmaq(acc1, vecB, pA1[k]);
+    acc2 = vfmaq(acc2, vecB, pA2[k]);
+    acc3 = vfmaq(acc3, vecB, pA3[k]);
+  }
+
+  vst1q(&pTile[0], acc0);
+  vst1q(&pTile[4], acc1);
+  vst1q(&pTile[8], acc2);
+  vst1q(&pTile[12], acc3);
+#elif defined(ARM_MATH_NEON) && !defined(ARM_MATH_AUTOVECTORIZE)
+  float32x4_t vecB;
+  float32x4_t acc0 = vdupq_n_f32(0.0f);
+  float32x4_t acc1 = vdupq_n_f32(0.0f);
+  float32x4_t acc2 = vdupq_n_f32(0.0f);
+  float32x4_t acc3 = vdupq_n_f32(0.0f);
+
+  for (k = 0U; k < kc; k++)
+  {
+    vecB = vld1q_f32(pPanel);
+    pPanel += NR_F32;
+    acc0 = vmlaq_n_f32(acc0, vecB, pA0[k]);
+    acc1 = vmlaq_n_f32(acc1, vecB, pA1[k]);
+    acc2 = vmlaq_n_f32(acc2, vecB, pA2[k]);
+    acc3 = vmlaq_n_f32(acc3, vecB, pA3[k]);
+  }
+
+  vst1q_f32(&pTile[0], acc0);
+  vst1q_f32(&pTile[4], acc1);
+  vst1q_f32(&pTile[8], acc2);
+  vst1q_f32(&pTile[12], acc3);
+#else
+  float32_t a0, a1, a2, a3;
+  float32_t b0, b1, b2, b3;
+  float32_t c00 = 0.0f, c01 = 0.0f, c02 = 0.0f, c03 = 0.0f;
+  float32_t c10 = 0.0f, c11 = 0.0f, c12 = 0.0f, c13 = 0.0f;
+  float32_t c20 = 0.0f, c21 = 0.0f, c22 = 0.0f, c23 = 0.0f;
+  float32_t c30 = 0.0f, c31 = 0.0f, c32 = 0.0f, c33 = 0.0f;
+
+  for (k = 0U; k < kc; k++)
+  {
+    b0 = pPanel[0];
+    b1 = pPanel[1];
+    b2 = pPanel[2];
+    b3 = pPanel[3];
+    pPanel += NR_F32;
+
+    a0 = pA0[k];
+    a1 = pA1[k];
+    a2 = pA2[k];
+    a3 = pA3[k];
+
+    c00 += a0 * b0; c01 += a0 * b1; c02 += a0 * b2; c03 += a0 * b3;
+    c10 += a1 * b0; c11 += a1 * b1; c12 += a1 * b2; c13 += a1 * b3;
+    c20 += a2 * b0; c21 += a2 * b1; c22 += a2 * b2; c23 += a2 * b3;
+    c30 += a3 * b0; c31 += a3 * b1; c32 += a3 * b2; c33 += a3 * b3;
+  }
+
+  pTile[0] = c00;  pTile[1] = c01;  pTile[2] = c02;  pTile[3] = c03;
+  pTile[4] = c10;  pTile[5] = c11;  pTile[6] = c12;  pTile[7] = c13;
+  pTile[8] = c20;  pTile[9] = c21;  pTile[10] = c22; pTile[11] = c23;
+  pTile[12] = c30; pTile[13] = c31; pTile[14] = c32; pTile[15] = c33;
+#endif
+}
+
+/**
+  @addtogroup MatrixMultBlocked
+  @{
+ */
+
+/**
+  @brief         Floating-point cache blocked matrix multiplication.
+  @param[in]     pSrcA       points to the first input matrix structure
+  @param[in]     pSrcB       points to the second input matrix structure
+  @param[out]    pDst        points to output matrix structure
+  @param[in]     pWorkspace  points to arm_mat_mult_blocked_workspace_size_f32() values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_mult_blocked_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst,
+        float32_t * pWorkspace)
+{
+  const uint32_t numRowsA = pSrcA->numRows;
+  const uint32_t numColsA = pSrcA->numCols;
+  const uint32_t numColsB = pSrcB->numCols;
+  const float32_t *pA[MR_F32];
+  float32_t tile[MR_F32 * NR_F32];
+  float32_t *pOut;
+  uint32_t jc, pc, ic, jr;
+  uint32_t nc, kc, mr, nr;
+  uint32_t r, c;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return ARM_MATH_SIZE_MISMATCH;
+  }
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  if ((numRowsA < MR_F32) ||
+      ((numColsA * numColsB) <= ARM_MAT_MULT_BLOCKED_MIN_SIZE) ||
+      (((uint64_t)numRowsA * numColsA * numColsB) <= ARM_MAT_MULT_BLOCKED_MIN_MACS_F32))
+  {
+    return arm_mat_mult_f32(pSrcA, pSrcB, pDst);
+  }
+
+  for (jc = 0U; jc < numColsB; jc += nc)
+  {
+    nc = ((numColsB - jc) > ARM_MAT_MULT_BLOCKED_NC) ? ARM_MAT_MULT_BLOCKED_NC : (numColsB - jc);
+
+    for (pc = 0U; pc < numColsA; pc += kc)
+    {
+      kc = ((numColsA - pc) > ARM_MAT_MULT_BLOCKED_KC) ? ARM_MAT_MULT_BLOCKED_KC : (numColsA - pc);
+
+      arm_mat_mult_blocked_pack_f32(&pSrcB->pData[(pc * numColsB) + jc], numColsB, kc, nc, pWorkspace);
+
+      for (ic = 0U; ic < numRowsA; ic += MR_F32)
+      {
+        /* Missing rows of the last tile read the last row, their results are dropped */
+        mr = ((numRowsA - ic) > MR_F32) ? MR_F32 : (numRowsA - ic);
+        for (r = 0U; r < MR_F32; r++)
+        {
+          pA[r] = &pSrcA->pData[((ic + ((r < mr) ? r : (mr - 1U))) * numColsA) + pc];
+        }
+
+        for (jr = 0U; jr < nc; jr += NR_F32)
+        {
+          nr = ((nc - jr) > NR_F32) ? NR_F32 : (nc - jr);
+
+          arm_mat_mult_blocked_kernel_f32(pA[0], pA[1], pA[2], pA[3], &pWorkspace[jr * kc], kc, tile);
+
+          /* First panel of rows of B stores the tile, the next ones accumulate */
+          for (r = 0U; r < mr; r++)
+          {
+            pOut = &pDst->pData[((ic + r) * numColsB) + jc + jr];
+            for (c = 0U; c < nr; c++)
+            {
+              pOut[c] = (pc == 0U) ? tile[(r * NR_F32) + c] : (pOut[c] + tile[(r * NR_F32) + c]);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of MatrixMultBlocked group
+ */
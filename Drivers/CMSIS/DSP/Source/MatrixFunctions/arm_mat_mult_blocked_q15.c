@@ -0,0 +1,289 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_blocked_q15.c
+ * Description:  Q15 cache blocked matrix multiplication with packed panels
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/* Tile of C computed by the inner kernel */
+#define MR_Q15 2U
+#define NR_Q15 2U
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+#define MVE_ASRL_SAT16(acc, shift)          ((sqrshrl_sat48(acc, -(32-shift)) >> 32) & 0xffffffff)
+#endif
+
+/* Columns of B per panel: all the rows of B, about ARM_MAT_MULT_BLOCKED_KC * ARM_MAT_MULT_BLOCKED_NC values */
+static uint32_t arm_mat_mult_blocked_panel_q15(
+  uint32_t numColsA,
+  uint32_t numColsB)
+{
+  uint32_t nc = (ARM_MAT_MULT_BLOCKED_KC * ARM_MAT_MULT_BLOCKED_NC) / numColsA;
+
+  nc = (nc / NR_Q15) * NR_Q15;
+  nc = (nc < NR_Q15) ? NR_Q15 : nc;
+
+  return (nc > numColsB) ? numColsB : nc;
+}
+
+/**
+  @addtogroup MatrixMultBlocked
+  @{
+ */
+
+/**
+  @brief         Size of the workspace of arm_mat_mult_blocked_q15().
+  @param[in]     pSrcA  points to the first input matrix structure
+  @param[in]     pSrcB  points to the second input matrix structure
+  @return        number of q15_t values of the <code>pWorkspace</code> argument
+
+  @par           Details
+                   For small matrices, the workspace is the <code>pState</code> argument of
+                   arm_mat_mult_q15() and holds all the values of B.
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_mat_mult_blocked_workspace_size_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB)
+{
+  uint32_t size = (uint32_t)pSrcB->numRows * pSrcB->numCols;
+  uint32_t nc;
+
+  if ((pSrcA->numRows < MR_Q15) || (size <= ARM_MAT_MULT_BLOCKED_MIN_SIZE))
+  {
+    return size;
+  }
+
+  /* Panel with its columns rounded up to whole tiles */
+  nc = arm_mat_mult_blocked_panel_q15(pSrcA->numCols, pSrcB->numCols);
+  return (uint32_t)pSrcA->numCols * (((nc + NR_Q15) - 1U) / NR_Q15) * NR_Q15;
+}
+
+/**
+  @} end of MatrixMultBlocked group
+ */
+
+/* Copy of nc columns of B, each column contiguous, zero padded to whole tiles */
+static void arm_mat_mult_blocked_pack_q15(
+  const q15_t * pB,
+  uint32_t numRowsB,
+  uint32_t numColsB,
+  uint32_t nc,
+  q15_t * pPanel)
+{
+  const q15_t *pCol;
+  uint32_t col;
+  uint32_t k;
+
+  for (col = 0U; col < nc; col++)
+  {
+    pCol = &pB[col];
+    for (k = 0U; k < numRowsB; k++)
+    {
+      *pPanel++ = *pCol;
+      pCol += numColsB;
+    }
+  }
+
+  if ((nc % NR_Q15) != 0U)
+  {
+    for (k = 0U; k < numRowsB; k++)
+    {
+      *pPanel++ = 0;
+    }
+  }
+}
+
+/* 2 x 2 tile: rows pA0 and pA1 times the columns pB0 and pB1 */
+static void arm_mat_mult_blocked_kernel_q15(
+  const q15_t * pA0,
+  const q15_t * pA1,
+  const q15_t * pB0,
+  const q15_t * pB1,
+  uint32_t numColsA,
+  q15_t * pTile)
+{
+  q63_t c00 = 0;
+  q63_t c01 = 0;
+  q63_t c10 = 0;
+  q63_t c11 = 0;
+  uint32_t k;
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+  q15x8_t vecA0, vecA1, vecB0, vecB1;
+  mve_pred16_t p0;
+
+  for (k = 0U; k < numColsA; k += 8U)
+  {
+    p0 = vctp16q(numColsA - k);
+    vecA0 = vldrhq_z_s16(&pA0[k], p0);
+    vecA1 = vldrhq_z_s16(&pA1[k], p0);
+    vecB0 = vldrhq_z_s16(&pB0[k], p0);
+    vecB1 = vldrhq_z_s16(&pB1[k], p0);
+    c00 = vmlaldavaq(c00, vecA0, vecB0);
+    c01 = vmlaldavaq(c01, vecA0, vecB1);
+    c10 = vmlaldavaq(c10, vecA1, vecB0);
+    c11 = vmlaldavaq(c11, vecA1, vecB1);
+  }
+
+  /* Same conversion as arm_mat_mult_q15() */
+  pTile[0] = (q15_t) MVE_ASRL_SAT16(c00, 15);
+  pTile[1] = (q15_t) MVE_ASRL_SAT16(c01, 15);
+  pTile[2] = (q15_t) MVE_ASRL_SAT16(c10, 15);
+  pTile[3] = (q15_t) MVE_ASRL_SAT16(c11, 15);
+#else
+#if defined (ARM_MATH_DSP)
+  q31_t a0, a1, b0, b1;
+
+  /* 2 products per read, 2 x 2 tile */
+  for (k = 0U; (k + 1U) < numColsA; k += 2U)
+  {
+    a0 = read_q15x2(&pA0[k]);
+    a1 = read_q15x2(&pA1[k]);
+    b0 = read_q15x2(&pB0[k]);
+    b1 = read_q15x2(&pB1[k]);
+    c00 = __SMLALD(a0, b0, c00);
+    c01 = __SMLALD(a0, b1, c01);
+    c10 = __SMLALD(a1, b0, c10);
+    c11 = __SMLALD(a1, b1, c11);
+  }
+#else
+  k = 0U;
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  for (; k < numColsA; k++)
+  {
+    c00 += (q31_t) pA0[k] * pB0[k];
+    c01 += (q31_t) pA0[k] * pB1[k];
+    c10 += (q31_t) pA1[k] * pB0[k];
+    c11 += (q31_t) pA1[k] * pB1[k];
+  }
+
+  /* Convert result from 34.30 to 1.15 format */
+  pTile[0] = (q15_t) __SSAT((c00 >> 15), 16);
+  pTile[1] = (q15_t) __SSAT((c01 >> 15), 16);
+  pTile[2] = (q15_t) __SSAT((c10 >> 15), 16);
+  pTile[3] = (q15_t) __SSAT((c11 >> 15), 16);
+#endif
+}
+
+/**
+  @addtogroup MatrixMultBlocked
+  @{
+ */
+
+/**
+  @brief         Q15 cache blocked matrix multiplication.
+  @param[in]     pSrcA       points to the first input matrix structure
+  @param[in]     pSrcB       points to the second input matrix structure
+  @param[out]    pDst        points to output matrix structure
+  @param[in]     pWorkspace  points to arm_mat_mult_blocked_workspace_size_q15() values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Scaling and Overflow Behavior
+                   Same as arm_mat_mult_q15(): the products are accumulated in a 64-bit accumulator
+                   in 34.30 format, and the result is saturated to 1.15 format.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_mult_blocked_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+        arm_matrix_instance_q15 * pDst,
+        q15_t * pWorkspace)
+{
+  const uint32_t numRowsA = pSrcA->numRows;
+  const uint32_t numColsA = pSrcA->numCols;
+  const uint32_t numColsB = pSrcB->numCols;
+  const uint32_t panel = arm_mat_mult_blocked_panel_q15(numColsA, numColsB);
+  const q15_t *pA0;
+  const q15_t *pA1;
+  q15_t tile[MR_Q15 * NR_Q15];
+  q15_t *pOut;
+  uint32_t jc, ic, jr;
+  uint32_t nc, mr, nr;
+  uint32_t r, c;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return ARM_MATH_SIZE_MISMATCH;
+  }
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  if ((numRowsA < MR_Q15) ||
+      ((numColsA * numColsB) <= ARM_MAT_MULT_BLOCKED_MIN_SIZE))
+  {
+    return arm_mat_mult_q15(pSrcA, pSrcB, pDst, pWorkspace);
+  }
+
+  for (jc = 0U; jc < numColsB; jc += nc)
+  {
+    nc = ((numColsB - jc) > panel) ? panel : (numColsB - jc);
+
+    arm_mat_mult_blocked_pack_q15(&pSrcB->pData[jc], numColsA, numColsB, nc, pWorkspace);
+
+    for (ic = 0U; ic < numRowsA; ic += MR_Q15)
+    {
+      /* A missing row of the last tile reads the last row, its results are dropped */
+      mr = ((numRowsA - ic) > MR_Q15) ? MR_Q15 : (numRowsA - ic);
+      pA0 = &pSrcA->pData[ic * numColsA];
+      pA1 = &pSrcA->pData[(ic + mr - 1U) * numColsA];
+
+      for (jr = 0U; jr < nc; jr += NR_Q15)
+      {
+        nr = ((nc - jr) > NR_Q15) ? NR_Q15 : (nc - jr);
+
+        arm_mat_mult_blocked_kernel_q15(pA0, pA1, &pWorkspace[jr * numColsA],
+                                        &pWorkspace[(jr + 1U) * numColsA], numColsA, tile);
+
+        for (r = 0U; r < mr; r++)
+        {
+          pOut = &pDst->pData[((ic + r) * numColsB) + jc + jr];
+          for (c = 0U; c < nr; c++)
+          {
+            pOut[c] = tile[(r * NR_Q15) + c];
+          }
+        }
+      }
+    }
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of MatrixMultBlocked group
+ */
@@ -0,0 +1,261 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_blocked_q31.c
+ * Description:  Q31 cache blocked matrix multiplication with packed panels
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/* Tile of C computed by the inner kernel */
+#define MR_Q31 2U
+#define NR_Q31 2U
+
+/* Columns of B per panel: all the rows of B, about ARM_MAT_MULT_BLOCKED_KC * ARM_MAT_MULT_BLOCKED_NC values */
+static uint32_t arm_mat_mult_blocked_panel_q31(
+  uint32_t numColsA,
+  uint32_t numColsB)
+{
+  uint32_t nc = (ARM_MAT_MULT_BLOCKED_KC * ARM_MAT_MULT_BLOCKED_NC) / numColsA;
+
+  nc = (nc / NR_Q31) * NR_Q31;
+  nc = (nc < NR_Q31) ? NR_Q31 : nc;
+
+  return (nc > numColsB) ? numColsB : nc;
+}
+
+/**
+  @addtogroup MatrixMultBlocked
+  @{
+ */
+
+/**
+  @brief         Size of the workspace of arm_mat_mult_blocked_q31().
+  @param[in]     pSrcA  points to the first input matrix structure
+  @param[in]     pSrcB  points to the second input matrix structure
+  @return        number of q31_t values of the <code>pWorkspace</code> argument
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_mat_mult_blocked_workspace_size_q31(
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB)
+{
+  uint32_t nc = arm_mat_mult_blocked_panel_q31(pSrcA->numCols, pSrcB->numCols);
+
+  /* Panel with its columns rounded up to whole tiles */
+  return (uint32_t)pSrcA->numCols * (((nc + NR_Q31) - 1U) / NR_Q31) * NR_Q31;
+}
+
+/**
+  @} end of MatrixMultBlocked group
+ */
+
+/* Copy of nc columns of B, each column contiguous, zero padded to whole tiles */
+static void arm_mat_mult_blocked_pack_q31(
+  const q31_t * pB,
+  uint32_t numRowsB,
+  uint32_t numColsB,
+  uint32_t nc,
+  q31_t * pPanel)
+{
+  const q31_t *pCol;
+  uint32_t col;
+  uint32_t k;
+
+  for (col = 0U; col < nc; col++)
+  {
+    pCol = &pB[col];
+    for (k = 0U; k < numRowsB; k++)
+    {
+      *pPanel++ = *pCol;
+      pCol += numColsB;
+    }
+  }
+
+  if ((nc % NR_Q31) != 0U)
+  {
+    for (k = 0U; k < numRowsB; k++)
+    {
+      *pPanel++ = 0;
+    }
+  }
+}
+
+/* 2 x 2 tile: rows pA0 and pA1 times the columns pB0 and pB1 */
+static void arm_mat_mult_blocked_kernel_q31(
+  const q31_t * pA0,
+  const q31_t * pA1,
+  const q31_t * pB0,
+  const q31_t * pB1,
+  uint32_t numColsA,
+  q31_t * pTile)
+{
+  q63_t c00 = 0;
+  q63_t c01 = 0;
+  q63_t c10 = 0;
+  q63_t c11 = 0;
+  uint32_t k;
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+  q31x4_t vecA0, vecA1, vecB0, vecB1;
+  mve_pred16_t p0;
+
+  /* Same accumulation as arm_mat_mult_q31(): 4 products per step, tail predicated */
+  for (k = 0U; k < numColsA; k += 4U)
+  {
+    p0 = vctp32q(numColsA - k);
+    vecA0 = vldrwq_z_s32(&pA0[k], p0);
+    vecA1 = vldrwq_z_s32(&pA1[k], p0);
+    vecB0 = vldrwq_z_s32(&pB0[k], p0);
+    vecB1 = vldrwq_z_s32(&pB1[k], p0);
+    c00 = vrmlaldavhaq(c00, vecA0, vecB0);
+    c01 = vrmlaldavhaq(c01, vecA0, vecB1);
+    c10 = vrmlaldavhaq(c10, vecA1, vecB0);
+    c11 = vrmlaldavhaq(c11, vecA1, vecB1);
+  }
+
+  pTile[0] = (q31_t) asrl(c00, 23);
+  pTile[1] = (q31_t) asrl(c01, 23);
+  pTile[2] = (q31_t) asrl(c10, 23);
+  pTile[3] = (q31_t) asrl(c11, 23);
+#else
+  q31_t a0, a1, b0, b1;
+
+  for (k = 0U; k < numColsA; k++)
+  {
+    a0 = pA0[k];
+    a1 = pA1[k];
+    b0 = pB0[k];
+    b1 = pB1[k];
+    c00 += (q63_t) a0 * b0;
+    c01 += (q63_t) a0 * b1;
+    c10 += (q63_t) a1 * b0;
+    c11 += (q63_t) a1 * b1;
+  }
+
+  /* Convert result from 2.62 to 1.31 format */
+  pTile[0] = (q31_t) (c00 >> 31);
+  pTile[1] = (q31_t) (c01 >> 31);
+  pTile[2] = (q31_t) (c10 >> 31);
+  pTile[3] = (q31_t) (c11 >> 31);
+#endif
+}
+
+/**
+  @addtogroup MatrixMultBlocked
+  @{
+ */
+
+/**
+  @brief         Q31 cache blocked matrix multiplication.
+  @param[in]     pSrcA       points to the first input matrix structure
+  @param[in]     pSrcB       points to the second input matrix structure
+  @param[out]    pDst        points to output matrix structure
+  @param[in]     pWorkspace  points to arm_mat_mult_blocked_workspace_size_q31() values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Scaling and Overflow Behavior
+                   Same as arm_mat_mult_q31(): the products are accumulated in a 64-bit accumulator
+                   in 2.62 format, and the result is truncated to 1.31 format without saturation.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_mult_blocked_q31(
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+        arm_matrix_instance_q31 * pDst,
+        q31_t * pWorkspace)
+{
+  const uint32_t numRowsA = pSrcA->numRows;
+  const uint32_t numColsA = pSrcA->numCols;
+  const uint32_t numColsB = pSrcB->numCols;
+  const uint32_t panel = arm_mat_mult_blocked_panel_q31(numColsA, numColsB);
+  const q31_t *pA0;
+  const q31_t *pA1;
+  q31_t tile[MR_Q31 * NR_Q31];
+  q31_t *pOut;
+  uint32_t jc, ic, jr;
+  uint32_t nc, mr, nr;
+  uint32_t r, c;
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return ARM_MATH_SIZE_MISMATCH;
+  }
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  if ((numRowsA < MR_Q31) ||
+      ((numColsA * numColsB) <= ARM_MAT_MULT_BLOCKED_MIN_SIZE))
+  {
+    return arm_mat_mult_q31(pSrcA, pSrcB, pDst);
+  }
+
+  for (jc = 0U; jc < numColsB; jc += nc)
+  {
+    nc = ((numColsB - jc) > panel) ? panel : (numColsB - jc);
+
+    arm_mat_mult_blocked_pack_q31(&pSrcB->pData[jc], numColsA, numColsB, nc, pWorkspace);
+
+    for (ic = 0U; ic < numRowsA; ic += MR_Q31)
+    {
+      /* A missing row of the last tile reads the last row, its results are dropped */
+      mr = ((numRowsA - ic) > MR_Q31) ? MR_Q31 : (numRowsA - ic);
+      pA0 = &pSrcA->pData[ic * numColsA];
+      pA1 = &pSrcA->pData[(ic + mr - 1U) * numColsA];
+
+      for (jr = 0U; jr < nc; jr += NR_Q31)
+      {
+        nr = ((nc - jr) > NR_Q31) ? NR_Q31 : (nc - jr);
+
+        arm_mat_mult_blocked_kernel_q31(pA0, pA1, &pWorkspace[jr * numColsA],
+                                        &pWorkspace[(jr + 1U) * numColsA], numColsA, tile);
+
+        for (r = 0U; r < mr; r++)
+        {
+          pOut = &pDst->pData[((ic + r) * numColsB) + jc + jr];
+          for (c = 0U; c < nr; c++)
+          {
+            pOut[c] = tile[(r * NR_Q31) + c];
+          }
+        }
+      }
+    }
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of MatrixMultBlocked group
+ */
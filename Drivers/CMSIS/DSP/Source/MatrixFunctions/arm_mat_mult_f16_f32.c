@@ -0,0 +1,287 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_f16_f32.c
+ * Description:  Half-precision matrix multiplication with single-precision accumulation
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/matrix_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+#if defined(ARM_MATH_MVE_FLOAT16) && !defined(ARM_MATH_AUTOVECTORIZE)
+/* A * B into pDst32, or into pDst16 when pDst32 is NULL: tiles of 1 row and 8 columns */
+static void arm_mat_mult_acc32_kernel_f16(
+  const arm_matrix_instance_f16 * pSrcA,
+  const arm_matrix_instance_f16 * pSrcB,
+        float32_t * pDst32,
+        float16_t * pDst16)
+{
+    const uint32_t numColsA = pSrcA->numCols;
+    const uint32_t numColsB = pSrcB->numCols;
+    const float16_t *pInA = pSrcA->pData;
+    const float16_t *pInB;
+    f32x4_t accBottom;
+    f32x4_t accTop;
+    f16x8_t vecB;
+    f16x8_t vecOut;
+    uint32x4_t vecOffs;
+    mve_pred16_t p0;
+    mve_pred16_t p1;
+    float32_t a;
+    uint32_t row;
+    uint32_t col;
+    uint32_t k;
+
+    for (row = 0U; row < pSrcA->numRows; row++)
+    {
+        for (col = 0U; col < numColsB; col += 8U)
+        {
+            p0 = vctp16q(numColsB - col);
+            accBottom = vdupq_n_f32(0.0f);
+            accTop = vdupq_n_f32(0.0f);
+
+            /* 8 values of every row of B widened to the even and odd columns */
+            pInB = &pSrcB->pData[col];
+            for (k = 0U; k < numColsA; k++)
+            {
+                vecB = vldrhq_z_f16(pInB, p0);
+                a = (float32_t)pInA[k];
+                accBottom = vfmaq(accBottom, vcvtbq_f32_f16(vecB), a);
+                accTop = vfmaq(accTop, vcvttq_f32_f16(vecB), a);
+                pInB += numColsB;
+            }
+
+            if (pDst32 != NULL)
+            {
+                /* Even columns, then odd columns */
+                vecOffs = vidupq_n_u32(0U, 2);
+                p1 = vcmphiq_u32(vdupq_n_u32(numColsB - col), vecOffs);
+                vstrwq_scatter_shifted_offset_p_f32(&pDst32[col], vecOffs, accBottom, p1);
+                vecOffs = vaddq_n_u32(vecOffs, 1U);
+                p1 = vcmphiq_u32(vdupq_n_u32(numColsB - col), vecOffs);
+                vstrwq_scatter_shifted_offset_p_f32(&pDst32[col], vecOffs, accTop, p1);
+            }
+            else
+            {
+                vecOut = vcvtbq_f16_f32(vdupq_n_f16(0.0f), accBottom);
+                vecOut = vcvttq_f16_f32(vecOut, accTop);
+                vstrhq_p_f16(&pDst16[col], vecOut, p0);
+            }
+        }
+
+        pInA += numColsA;
+        if (pDst32 != NULL)
+        {
+            pDst32 += numColsB;
+        }
+        else
+        {
+            pDst16 += numColsB;
+        }
+    }
+}
+#else
+/* Stores an output of the kernel */
+__STATIC_FORCEINLINE void arm_mat_mult_acc32_store_f16(
+        float32_t * pDst32,
+        float16_t * pDst16,
+        uint32_t index,
+        float32_t value)
+{
+    if (pDst32 != NULL)
+    {
+        pDst32[index] = value;
+    }
+    else
+    {
+        pDst16[index] = (float16_t)value;
+    }
+}
+
+/* A * B into pDst32, or into pDst16 when pDst32 is NULL: tiles of 1 row and 4 columns */
+static void arm_mat_mult_acc32_kernel_f16(
+  const arm_matrix_instance_f16 * pSrcA,
+  const arm_matrix_instance_f16 * pSrcB,
+        float32_t * pDst32,
+        float16_t * pDst16)
+{
+    const uint32_t numColsA = pSrcA->numCols;
+    const uint32_t numColsB = pSrcB->numCols;
+    const float16_t *pInA = pSrcA->pData;
+    const float16_t *pInB;
+    float32_t sum0, sum1, sum2, sum3;
+    float32_t a;
+    uint32_t index = 0U;
+    uint32_t row;
+    uint32_t col;
+    uint32_t k;
+
+    for (row = 0U; row < pSrcA->numRows; row++)
+    {
+        /* 4 columns at a time, the rows of B read in order */
+        for (col = 0U; (col + 4U) <= numColsB; col += 4U)
+        {
+            sum0 = 0.0f;
+            sum1 = 0.0f;
+            sum2 = 0.0f;
+            sum3 = 0.0f;
+            pInB = &pSrcB->pData[col];
+            for (k = 0U; k < numColsA; k++)
+            {
+                a = (float32_t)pInA[k];
+                sum0 += a * (float32_t)pInB[0];
+                sum1 += a * (float32_t)pInB[1];
+                sum2 += a * (float32_t)pInB[2];
+                sum3 += a * (float32_t)pInB[3];
+                pInB += numColsB;
+            }
+            arm_mat_mult_acc32_store_f16(pDst32, pDst16, index++, sum0);
+            arm_mat_mult_acc32_store_f16(pDst32, pDst16, index++, sum1);
+            arm_mat_mult_acc32_store_f16(pDst32, pDst16, index++, sum2);
+            arm_mat_mult_acc32_store_f16(pDst32, pDst16, index++, sum3);
+        }
+
+        /* Remaining columns */
+        for (; col < numColsB; col++)
+        {
+            sum0 = 0.0f;
+            pInB = &pSrcB->pData[col];
+            for (k = 0U; k < numColsA; k++)
+            {
+                sum0 += (float32_t)pInA[k] * (float32_t)*pInB;
+                pInB += numColsB;
+            }
+            arm_mat_mult_acc32_store_f16(pDst32, pDst16, index++, sum0);
+        }
+
+        pInA += numColsA;
+    }
+}
+#endif /* defined(ARM_MATH_MVE_FLOAT16) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+ * @brief Half-precision matrix multiplication with single-precision accumulation.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @return          The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @par Details
+ * The input matrices are read in half precision, half the memory of
+ * arm_mat_mult_f32(), and every output is accumulated in single precision.
+ * The kernel computes a tile of consecutive outputs of a row at a time: every
+ * value of A is used for the whole tile and the rows of B are read in order.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_mult_f16_f32(
+  const arm_matrix_instance_f16 * pSrcA,
+  const arm_matrix_instance_f16 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  arm_status status;                             /* Status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    arm_mat_mult_acc32_kernel_f16(pSrcA, pSrcB, pDst->pData, NULL);
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @brief Half-precision matrix multiplication with single-precision accumulation, half-precision output.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @return          The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @par Details
+ * Outputs of arm_mat_mult_f16_f32() rounded once to half precision.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_mult_acc32_f16(
+  const arm_matrix_instance_f16 * pSrcA,
+  const arm_matrix_instance_f16 * pSrcB,
+        arm_matrix_instance_f16 * pDst)
+{
+  arm_status status;                             /* Status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    arm_mat_mult_acc32_kernel_f16(pSrcA, pSrcB, NULL, pDst->pData);
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMult group
+ */
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
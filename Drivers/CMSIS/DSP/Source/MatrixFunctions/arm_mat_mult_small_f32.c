@@ -0,0 +1,219 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_small_f32.c
+ * Description:  Floating-point multiplication of small fixed-size matrices
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+#include "arm_mat_small.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixSmall Small Matrix Functions
+
+  Multiplication, transpose and inverse of square matrices of 2 x 2 to 6 x 6
+  values, for control loops and sensor fusion where these sizes are used
+  thousands of times per second.
+
+  @par           Algorithm
+                   There is one function per size. The size is a constant of the kernel, so that
+                   all the loops have a compile-time trip count and are fully unrolled by the
+                   compiler, and the matrices are copied in local arrays held in registers
+                   as much as possible. The functions take the usual matrix instance structures;
+                   their dimensions are only read when ARM_MATH_MATRIX_CHECK is defined.
+
+  @par           In-place operation
+                   The inputs are read before the output is written: <code>pDst</code> may be the
+                   same matrix as a source.
+
+  @par           Results
+                   The inverses use the adjugate for 2 x 2 and 3 x 3 matrices, and a Gauss-Jordan
+                   elimination with partial pivoting, like arm_mat_inverse_f32(), for larger ones.
+ */
+
+/**
+  @addtogroup MatrixSmall
+  @{
+ */
+
+/* C = A * B for n x n matrices, n constant after inlining */
+__STATIC_FORCEINLINE void arm_mat_mult_small_kernel_f32(
+  const float32_t * pA,
+  const float32_t * pB,
+        float32_t * pC,
+  const uint32_t n)
+{
+  float32_t b[ARM_MAT_SMALL_MAX_DIM * ARM_MAT_SMALL_MAX_DIM];
+  float32_t a[ARM_MAT_SMALL_MAX_DIM];
+  float32_t acc;
+  uint32_t i;
+  uint32_t j;
+  uint32_t k;
+
+  ARM_MAT_SMALL_UNROLL
+  for (i = 0U; i < (n * n); i++)
+  {
+    b[i] = pB[i];
+  }
+
+  ARM_MAT_SMALL_UNROLL
+  for (i = 0U; i < n; i++)
+  {
+    /* Row of A read before the row of C is written */
+    ARM_MAT_SMALL_UNROLL
+    for (k = 0U; k < n; k++)
+    {
+      a[k] = pA[(i * n) + k];
+    }
+
+    ARM_MAT_SMALL_UNROLL
+    for (j = 0U; j < n; j++)
+    {
+      acc = a[0] * b[j];
+      ARM_MAT_SMALL_UNROLL
+      for (k = 1U; k < n; k++)
+      {
+        acc += a[k] * b[(k * n) + j];
+      }
+      pC[(i * n) + j] = acc;
+    }
+  }
+}
+
+#ifdef ARM_MATH_MATRIX_CHECK
+#define ARM_MAT_MULT_SMALL_CHECK(N)                                        \
+  if ((pSrcA->numRows != (N)) || (pSrcA->numCols != (N)) ||                \
+      (pSrcB->numRows != (N)) || (pSrcB->numCols != (N)) ||                \
+      (pDst->numRows != (N)) || (pDst->numCols != (N)))                    \
+  {                                                                        \
+    return ARM_MATH_SIZE_MISMATCH;                                         \
+  }
+#else
+#define ARM_MAT_MULT_SMALL_CHECK(N)
+#endif
+
+/**
+  @brief         Floating-point 2 x 2 matrix multiplication.
+  @param[in]     pSrcA  points to the first input matrix structure
+  @param[in]     pSrcB  points to the second input matrix structure
+  @param[out]    pDst   points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_mult_2x2_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  ARM_MAT_MULT_SMALL_CHECK(2U)
+  arm_mat_mult_small_kernel_f32(pSrcA->pData, pSrcB->pData, pDst->pData, 2U);
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Floating-point 3 x 3 matrix multiplication.
+  @param[in]     pSrcA  points to the first input matrix structure
+  @param[in]     pSrcB  points to the second input matrix structure
+  @param[out]    pDst   points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_mult_3x3_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  ARM_MAT_MULT_SMALL_CHECK(3U)
+  arm_mat_mult_small_kernel_f32(pSrcA->pData, pSrcB->pData, pDst->pData, 3U);
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Floating-point 4 x 4 matrix multiplication.
+  @param[in]     pSrcA  points to the first input matrix structure
+  @param[in]     pSrcB  points to the second input matrix structure
+  @param[out]    pDst   points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_mult_4x4_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  ARM_MAT_MULT_SMALL_CHECK(4U)
+  arm_mat_mult_small_kernel_f32(pSrcA->pData, pSrcB->pData, pDst->pData, 4U);
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Floating-point 5 x 5 matrix multiplication.
+  @param[in]     pSrcA  points to the first input matrix structure
+  @param[in]     pSrcB  points to the second input matrix structure
+  @param[out]    pDst   points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_mult_5x5_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  ARM_MAT_MULT_SMALL_CHECK(5U)
+  arm_mat_mult_small_kernel_f32(pSrcA->pData, pSrcB->pData, pDst->pData, 5U);
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Floating-point 6 x 6 matrix multiplication.
+  @param[in]     pSrcA  points to the first input matrix structure
+  @param[in]     pSrcB  points to the second input matrix structure
+  @param[out]    pDst   points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_mult_6x6_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  ARM_MAT_MULT_SMALL_CHECK(6U)
+  arm_mat_mult_small_kernel_f32(pSrcA->pData, pSrcB->pData, pDst->pData, 6U);
+  return ARM_MATH_SUCCESS;
+}
+
+#undef ARM_MAT_MULT_SMALL_CHECK
+
+/**
+  @} end of MatrixSmall group
+ */
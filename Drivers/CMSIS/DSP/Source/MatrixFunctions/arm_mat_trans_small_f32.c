@@ -0,0 +1,168 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_trans_small_f32.c
+ * Description:  Floating-point transpose of small fixed-size matrices
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/matrix_functions.h"
+#include "arm_mat_small.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixSmall
+  @{
+ */
+
+/* B = A^T for n x n matrices, n constant after inlining */
+__STATIC_FORCEINLINE void arm_mat_trans_small_kernel_f32(
+  const float32_t * pA,
+        float32_t * pB,
+  const uint32_t n)
+{
+  float32_t a[ARM_MAT_SMALL_MAX_DIM * ARM_MAT_SMALL_MAX_DIM];
+  uint32_t i;
+  uint32_t j;
+
+  ARM_MAT_SMALL_UNROLL
+  for (i = 0U; i < (n * n); i++)
+  {
+    a[i] = pA[i];
+  }
+
+  ARM_MAT_SMALL_UNROLL
+  for (i = 0U; i < n; i++)
+  {
+    ARM_MAT_SMALL_UNROLL
+    for (j = 0U; j < n; j++)
+    {
+      pB[(i * n) + j] = a[(j * n) + i];
+    }
+  }
+}
+
+#ifdef ARM_MATH_MATRIX_CHECK
+#define ARM_MAT_TRANS_SMALL_CHECK(N)                                       \
+  if ((pSrc->numRows != (N)) || (pSrc->numCols != (N)) ||                  \
+      (pDst->numRows != (N)) || (pDst->numCols != (N)))                    \
+  {                                                                        \
+    return ARM_MATH_SIZE_MISMATCH;                                         \
+  }
+#else
+#define ARM_MAT_TRANS_SMALL_CHECK(N)
+#endif
+
+/**
+  @brief         Floating-point 2 x 2 matrix transpose.
+  @param[in]     pSrc  points to the input matrix structure
+  @param[out]    pDst  points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_trans_2x2_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst)
+{
+  ARM_MAT_TRANS_SMALL_CHECK(2U)
+  arm_mat_trans_small_kernel_f32(pSrc->pData, pDst->pData, 2U);
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Floating-point 3 x 3 matrix transpose.
+  @param[in]     pSrc  points to the input matrix structure
+  @param[out]    pDst  points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_trans_3x3_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst)
+{
+  ARM_MAT_TRANS_SMALL_CHECK(3U)
+  arm_mat_trans_small_kernel_f32(pSrc->pData, pDst->pData, 3U);
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Floating-point 4 x 4 matrix transpose.
+  @param[in]     pSrc  points to the input matrix structure
+  @param[out]    pDst  points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_trans_4x4_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst)
+{
+  ARM_MAT_TRANS_SMALL_CHECK(4U)
+  arm_mat_trans_small_kernel_f32(pSrc->pData, pDst->pData, 4U);
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Floating-point 5 x 5 matrix transpose.
+  @param[in]     pSrc  points to the input matrix structure
+  @param[out]    pDst  points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_trans_5x5_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst)
+{
+  ARM_MAT_TRANS_SMALL_CHECK(5U)
+  arm_mat_trans_small_kernel_f32(pSrc->pData, pDst->pData, 5U);
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Floating-point 6 x 6 matrix transpose.
+  @param[in]     pSrc  points to the input matrix structure
+  @param[out]    pDst  points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_mat_trans_6x6_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst)
+{
+  ARM_MAT_TRANS_SMALL_CHECK(6U)
+  arm_mat_trans_small_kernel_f32(pSrc->pData, pDst->pData, 6U);
+  return ARM_MATH_SUCCESS;
+}
+
+#undef ARM_MAT_TRANS_SMALL_CHECK
+
+/**
+  @} end of MatrixSmall group
+ */
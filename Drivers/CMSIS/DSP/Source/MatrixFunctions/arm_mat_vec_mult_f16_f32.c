@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_f16_f32.c
+ * Description:  Half-precision matrix and vector multiplication with single-precision accumulation
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/matrix_functions_f16.h"
+#include "dsp/basic_math_functions_f16.h"
+
+#if defined(ARM_FLOAT16_SUPPORTED)
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Half-precision matrix and vector multiplication with single-precision accumulation.
+ * @param[in]       *pSrcMat points to the input matrix structure
+ * @param[in]       *pVec points to input vector
+ * @param[out]      *pDst points to output vector
+ *
+ * @par Details
+ * Every row is multiplied with the vector by arm_dot_prod_f16_f32(): the
+ * matrix is read in half precision and the products are added in single
+ * precision.
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_vec_mult_f16_f32(
+  const arm_matrix_instance_f16 *pSrcMat,
+  const float16_t *pVec,
+  float32_t *pDst)
+{
+    const float16_t *pInA = pSrcMat->pData;
+    uint32_t numCols = pSrcMat->numCols;
+    uint32_t row;
+
+    for (row = 0U; row < pSrcMat->numRows; row++)
+    {
+        arm_dot_prod_f16_f32(pInA, pVec, numCols, &pDst[row]);
+        pInA += numCols;
+    }
+}
+
+/**
+ * @brief Half-precision matrix and vector multiplication with single-precision accumulation, half-precision output.
+ * @param[in]       *pSrcMat points to the input matrix structure
+ * @param[in]       *pVec points to input vector
+ * @param[out]      *pDst points to output vector
+ *
+ * @par Details
+ * Outputs of arm_mat_vec_mult_f16_f32() rounded once to half precision.
+ */
+ARM_DSP_ATTRIBUTE void arm_mat_vec_mult_acc32_f16(
+  const arm_matrix_instance_f16 *pSrcMat,
+  const float16_t *pVec,
+  float16_t *pDst)
+{
+    const float16_t *pInA = pSrcMat->pData;
+    uint32_t numCols = pSrcMat->numCols;
+    uint32_t row;
+    float32_t sum;
+
+    for (row = 0U; row < pSrcMat->numRows; row++)
+    {
+        arm_dot_prod_f16_f32(pInA, pVec, numCols, &sum);
+        pDst[row] = (float16_t)sum;
+        pInA += numCols;
+    }
+}
+
+/**
+ * @} end of MatrixVectMult group
+ */
+
+#endif /* #if defined(ARM_FLOAT16_SUPPORTED) */
@@ -0,0 +1,546 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_svm_predict_batch_f32.c
+ * Description:  SVM batch prediction of several input vectors
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/svm_functions.h"
+#include "dsp/basic_math_functions.h"
+#include "dsp/support_functions.h"
+#include "dsp/fast_math_functions.h"
+#include "dsp/matrix_functions.h"
+#include <math.h>
+
+/**
+  @ingroup groupSVM
+ */
+
+/**
+  @defgroup svmbatch SVM Batch Prediction
+
+  Classification of <code>numVectors</code> input vectors in one call, for
+  instance every pixel or every window of a frame.
+
+  @par           Algorithm
+                   The input vectors are processed by blocks of \ref ARM_SVM_BATCH_ROWS rows.
+                   For Helium and Neon, the dot products of a block with all the support vectors are one
+                   matrix product computed by arm_mat_mult_f32(), with the support vectors transposed and
+                   scaled once per call, and the RBF kernel uses <code>|x - s|^2 = |x|^2 + |s|^2 - 2 x.s</code>.
+                   Otherwise, 4 input vectors are compared with one support vector at a time: each support
+                   value is loaded once for the 4 inputs and the 4 sums stay in registers. The sums are done
+                   in the order of the single vector functions, RBF distances included.
+                   The kernel function is then applied to the whole block (arm_vexp_f32() for RBF) and the
+                   decision values are one matrix vector product with the dual coefficients, computed by
+                   arm_mat_vec_mult_f32().
+                   The linear SVM folds the support vectors in one weight vector <code>w = sum(dual[i] * s[i])</code>.
+
+  @par           Scratch memory
+                   <code>pScratch</code> holds
+                   <code>arm_svm_predict_batch_scratch_size_f32(nbOfSupportVectors, vectorDimension)</code> values.
+                   The transposed support vectors are rebuilt on every call: the cost is amortized when
+                   <code>numVectors</code> is large compared to \ref ARM_SVM_BATCH_ROWS.
+
+  @par           Accuracy
+                   The results are those of the single vector functions, except for inputs whose decision
+                   value is within rounding of 0: the decision sums are done in a different order, and for
+                   Helium and Neon the RBF expanded distance loses the relative accuracy of the small distances.
+ */
+
+/**
+  @addtogroup svmbatch
+  @{
+ */
+
+/**
+  @brief         Size of the scratch buffer of the SVM batch prediction functions.
+  @param[in]     nbOfSupportVectors  number of support vectors
+  @param[in]     vectorDimension     dimension of vector space
+  @return        number of float32_t values of the <code>pScratch</code> argument
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_svm_predict_batch_scratch_size_f32(
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension)
+{
+  /* Transposed supports, support norms, kernel block, decision block */
+  return (nbOfSupportVectors * (vectorDimension + 1U + ARM_SVM_BATCH_ROWS)) + ARM_SVM_BATCH_ROWS;
+}
+
+/**
+  @} end of svmbatch group
+ */
+
+#if (defined(ARM_MATH_MVEF) || defined(ARM_MATH_NEON)) && !defined(ARM_MATH_AUTOVECTORIZE)
+/*
+ * Support vectors transposed to vectorDimension x nbOfSupportVectors and
+ * scaled, for the matrix product. Returns the supports to give to
+ * arm_svm_batch_kernel_f32()
+ */
+static const float32_t *arm_svm_batch_supports_f32(
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension,
+  const float32_t * pSupport,
+  float32_t scale,
+  float32_t * pSupportT)
+{
+  arm_matrix_instance_f32 src;
+  arm_matrix_instance_f32 dst;
+
+  arm_mat_init_f32(&src, (uint16_t)nbOfSupportVectors, (uint16_t)vectorDimension, (float32_t *)pSupport);
+  arm_mat_init_f32(&dst, (uint16_t)vectorDimension, (uint16_t)nbOfSupportVectors, pSupportT);
+  (void)arm_mat_trans_f32(&src, &dst);
+
+  if (scale != 1.0f)
+  {
+    arm_scale_f32(pSupportT, scale, pSupportT, nbOfSupportVectors * vectorDimension);
+  }
+
+  return pSupportT;
+}
+
+/* scale * x.s of numRows input vectors with all the support vectors, scale already in pSupports */
+static void arm_svm_batch_kernel_f32(
+  const float32_t * pIn,
+  uint32_t numRows,
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension,
+  const float32_t * pSupports,
+  float32_t scale,
+  float32_t * pKernel)
+{
+  arm_matrix_instance_f32 in;
+  arm_matrix_instance_f32 supportT;
+  arm_matrix_instance_f32 kernel;
+
+  (void)scale;
+
+  arm_mat_init_f32(&in, (uint16_t)numRows, (uint16_t)vectorDimension, (float32_t *)pIn);
+  arm_mat_init_f32(&supportT, (uint16_t)vectorDimension, (uint16_t)nbOfSupportVectors, (float32_t *)pSupports);
+  arm_mat_init_f32(&kernel, (uint16_t)numRows, (uint16_t)nbOfSupportVectors, pKernel);
+  (void)arm_mat_mult_f32(&in, &supportT, &kernel);
+}
+#else
+/* The kernel reads the support vectors in place, scaled on the fly */
+static const float32_t *arm_svm_batch_supports_f32(
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension,
+  const float32_t * pSupport,
+  float32_t scale,
+  float32_t * pSupportT)
+{
+  (void)nbOfSupportVectors;
+  (void)vectorDimension;
+  (void)scale;
+  (void)pSupportT;
+
+  return pSupport;
+}
+
+/*
+ * scale * x.s, or |x - s|^2 when distance is set, of numRows input vectors
+ * with all the support vectors. 4 input vectors against one support vector
+ * at a time: each support value is loaded once for the 4 inputs and the 4
+ * sums stay in registers, summed in the order of the single vector functions
+ */
+static void arm_svm_batch_sums_f32(
+  const float32_t * pIn,
+  uint32_t numRows,
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension,
+  const float32_t * pSupports,
+  float32_t scale,
+  uint32_t distance,
+  float32_t * pKernel)
+{
+  const float32_t *pIn0, *pIn1, *pIn2, *pIn3;
+  const float32_t *pS;
+  float32_t acc0, acc1, acc2, acc3;
+  float32_t s, d0, d1, d2, d3;
+  uint32_t row;
+  uint32_t i;
+  uint32_t j;
+
+  for (row = 0U; (row + 4U) <= numRows; row += 4U)
+  {
+    pIn0 = &pIn[row * vectorDimension];
+    pIn1 = pIn0 + vectorDimension;
+    pIn2 = pIn1 + vectorDimension;
+    pIn3 = pIn2 + vectorDimension;
+    pS = pSupports;
+
+    for (i = 0U; i < nbOfSupportVectors; i++)
+    {
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      if (distance != 0U)
+      {
+        for (j = 0U; j < vectorDimension; j++)
+        {
+          s = pS[j];
+          d0 = pIn0[j] - s;
+          d1 = pIn1[j] - s;
+          d2 = pIn2[j] - s;
+          d3 = pIn3[j] - s;
+          acc0 += d0 * d0;
+          acc1 += d1 * d1;
+          acc2 += d2 * d2;
+          acc3 += d3 * d3;
+        }
+      }
+      else
+      {
+        for (j = 0U; j < vectorDimension; j++)
+        {
+          s = pS[j];
+          acc0 += pIn0[j] * s;
+          acc1 += pIn1[j] * s;
+          acc2 += pIn2[j] * s;
+          acc3 += pIn3[j] * s;
+        }
+      }
+      pS += vectorDimension;
+
+      pKernel[((row + 0U) * nbOfSupportVectors) + i] = scale * acc0;
+      pKernel[((row + 1U) * nbOfSupportVectors) + i] = scale * acc1;
+      pKernel[((row + 2U) * nbOfSupportVectors) + i] = scale * acc2;
+      pKernel[((row + 3U) * nbOfSupportVectors) + i] = scale * acc3;
+    }
+  }
+
+  /* Remaining input vectors */
+  for (; row < numRows; row++)
+  {
+    pIn0 = &pIn[row * vectorDimension];
+    pS = pSupports;
+
+    for (i = 0U; i < nbOfSupportVectors; i++)
+    {
+      acc0 = 0.0f;
+      if (distance != 0U)
+      {
+        for (j = 0U; j < vectorDimension; j++)
+        {
+          d0 = pIn0[j] - pS[j];
+          acc0 += d0 * d0;
+        }
+      }
+      else
+      {
+        for (j = 0U; j < vectorDimension; j++)
+        {
+          acc0 += pIn0[j] * pS[j];
+        }
+      }
+      pS += vectorDimension;
+
+      pKernel[(row * nbOfSupportVectors) + i] = scale * acc0;
+    }
+  }
+}
+
+/* scale * x.s of numRows input vectors with all the support vectors */
+static void arm_svm_batch_kernel_f32(
+  const float32_t * pIn,
+  uint32_t numRows,
+  uint32_t nbOfSupportVectors,
+  uint32_t vectorDimension,
+  const float32_t * pSupports,
+  float32_t scale,
+  float32_t * pKernel)
+{
+  arm_svm_batch_sums_f32(pIn, numRows, nbOfSupportVectors, vectorDimension, pSupports, scale, 0U, pKernel);
+}
+#endif
+
+/* Classes from the kernel values of numRows input vectors */
+static void arm_svm_batch_decision_f32(
+  const float32_t * pKernel,
+  uint32_t numRows,
+  uint32_t nbOfSupportVectors,
+  const float32_t * pDualCoefficients,
+  float32_t intercept,
+  const int32_t * pClasses,
+  float32_t * pSums,
+  int32_t * pResult)
+{
+  arm_matrix_instance_f32 kernel;
+  uint32_t row;
+
+  arm_mat_init_f32(&kernel, (uint16_t)numRows, (uint16_t)nbOfSupportVectors, (float32_t *)pKernel);
+  arm_mat_vec_mult_f32(&kernel, pDualCoefficients, pSums);
+
+  for (row = 0U; row < numRows; row++)
+  {
+    pResult[row] = pClasses[STEP(intercept + pSums[row])];
+  }
+}
+
+/**
+  @addtogroup linearsvm
+  @{
+ */
+
+/**
+  @brief         SVM linear prediction of several input vectors
+  @param[in]     S           points to an instance of the linear SVM structure
+  @param[in]     in          points to <code>numVectors</code> input vectors of <code>vectorDimension</code> values
+  @param[in]     numVectors  number of input vectors
+  @param[in]     pScratch    points to arm_svm_predict_batch_scratch_size_f32() values
+  @param[out]    pResult     points to <code>numVectors</code> decisions
+ */
+ARM_DSP_ATTRIBUTE void arm_svm_linear_predict_batch_f32(
+  const arm_svm_linear_instance_f32 *S,
+  const float32_t * in,
+  uint32_t numVectors,
+  float32_t * pScratch,
+  int32_t * pResult)
+{
+  const uint32_t dim = S->vectorDimension;
+  float32_t *pWeights = pScratch;
+  float32_t *pSums = &pScratch[dim];
+  arm_matrix_instance_f32 block;
+  uint32_t numRows;
+  uint32_t row;
+  uint32_t i;
+  uint32_t j;
+
+  /* w = sum(dual[i] * s[i]) */
+  arm_fill_f32(0.0f, pWeights, dim);
+  for (i = 0U; i < S->nbOfSupportVectors; i++)
+  {
+    const float32_t *pSupport = &S->supportVectors[i * dim];
+    const float32_t dual = S->dualCoefficients[i];
+
+    for (j = 0U; j < dim; j++)
+    {
+      pWeights[j] += dual * pSupport[j];
+    }
+  }
+
+  while (numVectors > 0U)
+  {
+    numRows = (numVectors > ARM_SVM_BATCH_ROWS) ? ARM_SVM_BATCH_ROWS : numVectors;
+
+    arm_mat_init_f32(&block, (uint16_t)numRows, (uint16_t)dim, (float32_t *)in);
+    arm_mat_vec_mult_f32(&block, pWeights, pSums);
+    for (row = 0U; row < numRows; row++)
+    {
+      pResult[row] = S->classes[STEP(S->intercept + pSums[row])];
+    }
+
+    in += numRows * dim;
+    pResult += numRows;
+    numVectors -= numRows;
+  }
+}
+
+/**
+  @} end of linearsvm group
+ */
+
+/**
+  @addtogroup polysvm
+  @{
+ */
+
+/**
+  @brief         SVM polynomial prediction of several input vectors
+  @param[in]     S           points to an instance of the polynomial SVM structure
+  @param[in]     in          points to <code>numVectors</code> input vectors of <code>vectorDimension</code> values
+  @param[in]     numVectors  number of input vectors
+  @param[in]     pScratch    points to arm_svm_predict_batch_scratch_size_f32() values
+  @param[out]    pResult     points to <code>numVectors</code> decisions
+ */
+ARM_DSP_ATTRIBUTE void arm_svm_polynomial_predict_batch_f32(
+  const arm_svm_polynomial_instance_f32 *S,
+  const float32_t * in,
+  uint32_t numVectors,
+  float32_t * pScratch,
+  int32_t * pResult)
+{
+  const uint32_t nbSV = S->nbOfSupportVectors;
+  const uint32_t dim = S->vectorDimension;
+  float32_t *pSupportT = pScratch;
+  float32_t *pKernel = &pSupportT[(dim + 1U) * nbSV];
+  float32_t *pSums = &pKernel[ARM_SVM_BATCH_ROWS * nbSV];
+  const float32_t *pSupports;
+  uint32_t numRows;
+  uint32_t i;
+
+  pSupports = arm_svm_batch_supports_f32(nbSV, dim, S->supportVectors, S->gamma, pSupportT);
+
+  while (numVectors > 0U)
+  {
+    numRows = (numVectors > ARM_SVM_BATCH_ROWS) ? ARM_SVM_BATCH_ROWS : numVectors;
+
+    arm_svm_batch_kernel_f32(in, numRows, nbSV, dim, pSupports, S->gamma, pKernel);
+    for (i = 0U; i < (numRows * nbSV); i++)
+    {
+      pKernel[i] = arm_exponent_f32(pKernel[i] + S->coef0, S->degree);
+    }
+    arm_svm_batch_decision_f32(pKernel, numRows, nbSV, S->dualCoefficients, S->intercept, S->classes, pSums, pResult);
+
+    in += numRows * dim;
+    pResult += numRows;
+    numVectors -= numRows;
+  }
+}
+
+/**
+  @} end of polysvm group
+ */
+
+/**
+  @addtogroup rbfsvm
+  @{
+ */
+
+/**
+  @brief         SVM rbf prediction of several input vectors
+  @param[in]     S           points to an instance of the rbf SVM structure
+  @param[in]     in          points to <code>numVectors</code> input vectors of <code>vectorDimension</code> values
+  @param[in]     numVectors  number of input vectors
+  @param[in]     pScratch    points to arm_svm_predict_batch_scratch_size_f32() values
+  @param[out]    pResult     points to <code>numVectors</code> decisions
+ */
+ARM_DSP_ATTRIBUTE void arm_svm_rbf_predict_batch_f32(
+  const arm_svm_rbf_instance_f32 *S,
+  const float32_t * in,
+  uint32_t numVectors,
+  float32_t * pScratch,
+  int32_t * pResult)
+{
+  const uint32_t nbSV = S->nbOfSupportVectors;
+  const uint32_t dim = S->vectorDimension;
+  float32_t *pSupportT = pScratch;
+  float32_t *pNorms = &pSupportT[dim * nbSV];
+  float32_t *pKernel = &pNorms[nbSV];
+  float32_t *pSums = &pKernel[ARM_SVM_BATCH_ROWS * nbSV];
+  uint32_t numRows;
+#if (defined(ARM_MATH_MVEF) || defined(ARM_MATH_NEON)) && !defined(ARM_MATH_AUTOVECTORIZE)
+  const float32_t *pSupports;
+  float32_t norm;
+  uint32_t row;
+  uint32_t i;
+
+  /*
+   * -gamma * |x - s|^2 = 2 * gamma * x.s - gamma * |s|^2 - gamma * |x|^2
+   * the first term from the matrix product with 2 * gamma * s
+   */
+  pSupports = arm_svm_batch_supports_f32(nbSV, dim, S->supportVectors, 2.0f * S->gamma, pSupportT);
+  for (i = 0U; i < nbSV; i++)
+  {
+    arm_dot_prod_f32(&S->supportVectors[i * dim], &S->supportVectors[i * dim], dim, &norm);
+    pNorms[i] = S->gamma * norm;
+  }
+#else
+  (void)pNorms;
+#endif
+
+  while (numVectors > 0U)
+  {
+    numRows = (numVectors > ARM_SVM_BATCH_ROWS) ? ARM_SVM_BATCH_ROWS : numVectors;
+
+#if (defined(ARM_MATH_MVEF) || defined(ARM_MATH_NEON)) && !defined(ARM_MATH_AUTOVECTORIZE)
+    arm_svm_batch_kernel_f32(in, numRows, nbSV, dim, pSupports, 2.0f * S->gamma, pKernel);
+    for (row = 0U; row < numRows; row++)
+    {
+      arm_dot_prod_f32(&in[row * dim], &in[row * dim], dim, &norm);
+      arm_sub_f32(&pKernel[row * nbSV], pNorms, &pKernel[row * nbSV], nbSV);
+      arm_offset_f32(&pKernel[row * nbSV], -S->gamma * norm, &pKernel[row * nbSV], nbSV);
+    }
+
+    /* Rounding of the expanded form can give a small negative distance */
+    arm_clip_f32(pKernel, pKernel, F32_MIN, 0.0f, numRows * nbSV);
+#else
+    /* -gamma * |x - s|^2 summed as in arm_svm_rbf_predict_f32() */
+    arm_svm_batch_sums_f32(in, numRows, nbSV, dim, S->supportVectors, -S->gamma, 1U, pKernel);
+#endif
+    arm_vexp_f32(pKernel, pKernel, numRows * nbSV);
+    arm_svm_batch_decision_f32(pKernel, numRows, nbSV, S->dualCoefficients, S->intercept, S->classes, pSums, pResult);
+
+    in += numRows * dim;
+    pResult += numRows;
+    numVectors -= numRows;
+  }
+}
+
+/**
+  @} end of rbfsvm group
+ */
+
+/**
+  @addtogroup sigmoidsvm
+  @{
+ */
+
+/**
+  @brief         SVM sigmoid prediction of several input vectors
+  @param[in]     S           points to an instance of the sigmoid SVM structure
+  @param[in]     in          points to <code>numVectors</code> input vectors of <code>vectorDimension</code> values
+  @param[in]     numVectors  number of input vectors
+  @param[in]     pScratch    points to arm_svm_predict_batch_scratch_size_f32() values
+  @param[out]    pResult     points to <code>numVectors</code> decisions
+ */
+ARM_DSP_ATTRIBUTE void arm_svm_sigmoid_predict_batch_f32(
+  const arm_svm_sigmoid_instance_f32 *S,
+  const float32_t * in,
+  uint32_t numVectors,
+  float32_t * pScratch,
+  int32_t * pResult)
+{
+  const uint32_t nbSV = S->nbOfSupportVectors;
+  const uint32_t dim = S->vectorDimension;
+  float32_t *pSupportT = pScratch;
+  float32_t *pKernel = &pSupportT[(dim + 1U) * nbSV];
+  float32_t *pSums = &pKernel[ARM_SVM_BATCH_ROWS * nbSV];
+  const float32_t *pSupports;
+  uint32_t numRows;
+  uint32_t i;
+
+  pSupports = arm_svm_batch_supports_f32(nbSV, dim, S->supportVectors, S->gamma, pSupportT);
+
+  while (numVectors > 0U)
+  {
+    numRows = (numVectors > ARM_SVM_BATCH_ROWS) ? ARM_SVM_BATCH_ROWS : numVectors;
+
+    arm_svm_batch_kernel_f32(in, numRows, nbSV, dim, pSupports, S->gamma, pKernel);
+    for (i = 0U; i < (numRows * nbSV); i++)
+    {
+      pKernel[i] = tanhf(pKernel[i] + S->coef0);
+    }
+    arm_svm_batch_decision_f32(pKernel, numRows, nbSV, S->dualCoefficients, S->intercept, S->classes, pSums, pResult);
+
+    in += numRows * dim;
+    pResult += numRows;
+    numVectors -= numRows;
+  }
+}
+
+/**
+  @} end of sigmoidsvm group
+ */
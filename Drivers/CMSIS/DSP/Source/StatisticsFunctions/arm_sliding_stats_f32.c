@@ -0,0 +1,243 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_f32.c
+ * Description:  Floating-point sliding window mean, variance, RMS, minimum and maximum
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+#include "arm_sliding_stats.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup SlidingStats
+  @{
+ */
+
+/* Kahan compensated sum += value */
+__STATIC_FORCEINLINE void arm_sliding_kahan_add_f32(
+  float32_t * pSum,
+  float32_t * pComp,
+  float32_t value)
+{
+  float32_t y = value - *pComp;
+  float32_t t = *pSum + y;
+
+  *pComp = (t - *pSum) - y;
+  *pSum = t;
+}
+
+/**
+  @brief         Adds samples to the window of the floating-point sliding window statistics.
+  @param[in,out] S          points to an instance of the sliding window statistics structure
+  @param[in]     pSrc       points to the new samples
+  @param[in]     blockSize  number of new samples
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_stats_f32(
+        arm_sliding_stats_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+  const uint32_t windowSize = S->windowSize;
+  const float32_t invWindow = 1.0f / (float32_t)windowSize;
+  float32_t *pState = S->pState;
+  uint32_t index = S->index;
+  float32_t mean = S->mean;
+  float32_t m2 = S->m2;
+  float32_t meanComp = S->meanComp;
+  float32_t m2Comp = S->m2Comp;
+  float32_t in;
+  float32_t out;
+  float32_t delta;
+  float32_t prevMean;
+
+  while (blockSize > 0U)
+  {
+    in = *pSrc++;
+
+    if (S->count == windowSize)
+    {
+      /* The oldest sample, at the position of the new one, leaves the window */
+      out = pState[index];
+      arm_sliding_queue_expire(&S->maxQueue, index, windowSize);
+      arm_sliding_queue_expire(&S->minQueue, index, windowSize);
+
+      delta = in - out;
+      prevMean = mean;
+      arm_sliding_kahan_add_f32(&mean, &meanComp, delta * invWindow);
+      arm_sliding_kahan_add_f32(&m2, &m2Comp, delta * ((in - mean) + (out - prevMean)));
+    }
+    else
+    {
+      S->count++;
+
+      delta = in - mean;
+      arm_sliding_kahan_add_f32(&mean, &meanComp, delta / (float32_t)S->count);
+      arm_sliding_kahan_add_f32(&m2, &m2Comp, delta * (in - mean));
+    }
+
+    /* Smaller maxima and larger minima can no longer be the extrema */
+    while ((S->maxQueue.count > 0U) && (pState[arm_sliding_queue_back(&S->maxQueue, windowSize)] < in))
+    {
+      S->maxQueue.count--;
+    }
+    arm_sliding_queue_push(&S->maxQueue, index, windowSize);
+
+    while ((S->minQueue.count > 0U) && (pState[arm_sliding_queue_back(&S->minQueue, windowSize)] > in))
+    {
+      S->minQueue.count--;
+    }
+    arm_sliding_queue_push(&S->minQueue, index, windowSize);
+
+    pState[index] = in;
+    index = (index + 1U == windowSize) ? 0U : (index + 1U);
+
+    /* Once per window, the sums restart from the samples of the window */
+    if ((index == 0U) && (S->count == windowSize))
+    {
+      arm_mean_f32(pState, windowSize, &mean);
+      arm_var_f32(pState, windowSize, &m2);
+      m2 = m2 * (float32_t)(windowSize - 1U);
+      meanComp = 0.0f;
+      m2Comp = 0.0f;
+    }
+
+    blockSize--;
+  }
+
+  S->index = index;
+  S->mean = mean;
+  S->m2 = m2;
+  S->meanComp = meanComp;
+  S->m2Comp = m2Comp;
+}
+
+/**
+  @brief         Mean of the window of the floating-point sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  mean value, 0 for an empty window
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_mean_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        float32_t * pResult)
+{
+  *pResult = S->mean;
+}
+
+/**
+  @brief         Variance of the window of the floating-point sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  variance, 0 for less than 2 samples
+
+  @par           Details
+                   Sum of the squared deviations divided by the number of samples minus 1,
+                   as arm_var_f32().
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_var_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        float32_t * pResult)
+{
+  /* The rounding errors can leave a small negative sum for a constant signal */
+  if ((S->count <= 1U) || (S->m2 <= 0.0f))
+  {
+    *pResult = 0.0f;
+    return;
+  }
+
+  *pResult = S->m2 / (float32_t)(S->count - 1U);
+}
+
+/**
+  @brief         Root mean square of the window of the floating-point sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  root mean square value, 0 for an empty window
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_rms_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        float32_t * pResult)
+{
+  float32_t power;
+
+  if (S->count == 0U)
+  {
+    *pResult = 0.0f;
+    return;
+  }
+
+  /* Mean of the squares from the variance and the mean */
+  power = (S->m2 > 0.0f) ? (S->m2 / (float32_t)S->count) : 0.0f;
+  power += S->mean * S->mean;
+  (void)arm_sqrt_f32(power, pResult);
+}
+
+/**
+  @brief         Maximum of the window of the floating-point sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  maximum value, 0 for an empty window
+  @param[out]    pIndex   index of the maximum in the window, 0 for the oldest sample
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_max_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        float32_t * pResult,
+        uint32_t * pIndex)
+{
+  if (S->count == 0U)
+  {
+    *pResult = 0.0f;
+    *pIndex = 0U;
+    return;
+  }
+
+  *pResult = S->pState[S->maxQueue.pPos[S->maxQueue.head]];
+  *pIndex = arm_sliding_queue_front_index(&S->maxQueue, S->count, S->index, S->windowSize);
+}
+
+/**
+  @brief         Minimum of the window of the floating-point sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  minimum value, 0 for an empty window
+  @param[out]    pIndex   index of the minimum in the window, 0 for the oldest sample
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_min_f32(
+  const arm_sliding_stats_instance_f32 * S,
+        float32_t * pResult,
+        uint32_t * pIndex)
+{
+  if (S->count == 0U)
+  {
+    *pResult = 0.0f;
+    *pIndex = 0U;
+    return;
+  }
+
+  *pResult = S->pState[S->minQueue.pPos[S->minQueue.head]];
+  *pIndex = arm_sliding_queue_front_index(&S->minQueue, S->count, S->index, S->windowSize);
+}
+
+/**
+  @} end of SlidingStats group
+ */
@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_init_f32.c
+ * Description:  Floating-point sliding window statistics initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup SlidingStats Sliding Window Statistics
+
+  Mean, variance, root mean square, minimum and maximum of the last
+  <code>windowSize</code> samples of a stream, updated for each new sample
+  without going through the whole window again as arm_mean_f32(), arm_var_f32(),
+  arm_rms_f32(), arm_min_f32() and arm_max_f32() would.
+
+  @par           Usage
+                   The samples are added by blocks of any size with arm_sliding_stats_f32(), and the
+                   statistics of the window are read at any time, for instance after every sample.
+                   Until <code>windowSize</code> samples have been received, the statistics are those
+                   of the samples received so far.
+
+  @par           Mean, variance and RMS
+                   Constant time per sample, amortized for the floating-point version.
+                   - Floating-point: the mean and the sum of the squared deviations are updated with
+                     Welford's method, adding the new sample and removing the oldest one, and the rounding
+                     errors of both sums are carried over (Kahan compensation). Every <code>windowSize</code>
+                     samples, both sums are computed again from the window with arm_mean_f32() and arm_var_f32(),
+                     so that the errors do not build up over a long stream, and the error after a large signal
+                     does not last longer than the window. The compensation only works if the compiler keeps the
+                     order of the floating-point operations, without -ffast-math or equivalent options.
+                   - Fixed-point: the sums of the samples and of their squares are kept in 64-bit integers,
+                     so they are exact and the results are those of arm_mean_q31(), arm_var_q31(),
+                     arm_mean_q15(), arm_var_q15() and arm_rms_q15() on the window. The Q31 RMS uses the
+                     squares of the 1.23 samples of arm_var_q31(). The Q31 variance and RMS are exact for
+                     windows up to 2^17 samples.
+
+  @par           Minimum and maximum
+                   Amortized constant time per sample. A queue holds the positions of the samples that can
+                   still become the maximum: each of them is larger than all the samples received after it.
+                   The first one is the maximum. A new sample removes from the end of the queue the smaller
+                   ones. Same for the minimum with the smaller samples. The index is the one of the oldest
+                   sample when the extremum appears several times, as with arm_max_f32().
+
+  @par           Memory
+                   The caller provides the window buffer of <code>windowSize</code> samples and a buffer
+                   of <code>2 * windowSize</code> positions for the queues.
+ */
+
+/**
+  @addtogroup SlidingStats
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point sliding window statistics.
+  @param[out]    S           points to an instance of the sliding window statistics structure
+  @param[in]     windowSize  number of samples of the window
+  @param[in]     pState      points to the window buffer of <code>windowSize</code> samples
+  @param[in]     pQueue      points to the buffer of <code>2 * windowSize</code> positions
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>windowSize</code> is 0
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_sliding_stats_init_f32(
+  arm_sliding_stats_instance_f32 * S,
+  uint32_t windowSize,
+  float32_t * pState,
+  uint32_t * pQueue)
+{
+  if (windowSize == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->windowSize = windowSize;
+  S->pState = pState;
+  S->maxQueue.pPos = pQueue;
+  S->minQueue.pPos = &pQueue[windowSize];
+
+  arm_sliding_stats_reset_f32(S);
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Empties the window of the floating-point sliding window statistics.
+  @param[in,out] S  points to an instance of the sliding window statistics structure
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_stats_reset_f32(
+  arm_sliding_stats_instance_f32 * S)
+{
+  S->count = 0U;
+  S->index = 0U;
+  S->mean = 0.0f;
+  S->m2 = 0.0f;
+  S->meanComp = 0.0f;
+  S->m2Comp = 0.0f;
+  S->maxQueue.head = 0U;
+  S->maxQueue.count = 0U;
+  S->minQueue.head = 0U;
+  S->minQueue.count = 0U;
+}
+
+/**
+  @} end of SlidingStats group
+ */
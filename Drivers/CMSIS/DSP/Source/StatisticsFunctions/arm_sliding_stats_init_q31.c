@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_init_q31.c
+ * Description:  Q31 sliding window statistics initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup SlidingStats
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 sliding window statistics.
+  @param[out]    S           points to an instance of the sliding window statistics structure
+  @param[in]     windowSize  number of samples of the window
+  @param[in]     pState      points to the window buffer of <code>windowSize</code> samples
+  @param[in]     pQueue      points to the buffer of <code>2 * windowSize</code> positions
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>windowSize</code> is 0
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_sliding_stats_init_q31(
+  arm_sliding_stats_instance_q31 * S,
+  uint32_t windowSize,
+  q31_t * pState,
+  uint32_t * pQueue)
+{
+  if (windowSize == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->windowSize = windowSize;
+  S->pState = pState;
+  S->maxQueue.pPos = pQueue;
+  S->minQueue.pPos = &pQueue[windowSize];
+
+  arm_sliding_stats_reset_q31(S);
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Empties the window of the Q31 sliding window statistics.
+  @param[in,out] S  points to an instance of the sliding window statistics structure
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_stats_reset_q31(
+  arm_sliding_stats_instance_q31 * S)
+{
+  S->count = 0U;
+  S->index = 0U;
+  S->sum = 0;
+  S->sumShifted = 0;
+  S->sumOfSquares = 0;
+  S->maxQueue.head = 0U;
+  S->maxQueue.count = 0U;
+  S->minQueue.head = 0U;
+  S->minQueue.count = 0U;
+}
+
+/**
+  @} end of SlidingStats group
+ */
@@ -0,0 +1,213 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_q15.c
+ * Description:  Q15 sliding window mean, variance, RMS, minimum and maximum
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+#include "arm_sliding_stats.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup SlidingStats
+  @{
+ */
+
+/**
+  @brief         Adds samples to the window of the Q15 sliding window statistics.
+  @param[in,out] S          points to an instance of the sliding window statistics structure
+  @param[in]     pSrc       points to the new samples
+  @param[in]     blockSize  number of new samples
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_stats_q15(
+        arm_sliding_stats_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize)
+{
+  const uint32_t windowSize = S->windowSize;
+  q15_t *pState = S->pState;
+  uint32_t index = S->index;
+  q31_t sum = S->sum;
+  q63_t sumOfSquares = S->sumOfSquares;
+  q15_t in;
+  q15_t out;
+
+  while (blockSize > 0U)
+  {
+    in = *pSrc++;
+
+    if (S->count == windowSize)
+    {
+      /* The oldest sample, at the position of the new one, leaves the window */
+      out = pState[index];
+      arm_sliding_queue_expire(&S->maxQueue, index, windowSize);
+      arm_sliding_queue_expire(&S->minQueue, index, windowSize);
+
+      sum -= out;
+      sumOfSquares -= (q31_t)out * out;
+    }
+    else
+    {
+      S->count++;
+    }
+
+    sum += in;
+    sumOfSquares += (q31_t)in * in;
+
+    /* Smaller maxima and larger minima can no longer be the extrema */
+    while ((S->maxQueue.count > 0U) && (pState[arm_sliding_queue_back(&S->maxQueue, windowSize)] < in))
+    {
+      S->maxQueue.count--;
+    }
+    arm_sliding_queue_push(&S->maxQueue, index, windowSize);
+
+    while ((S->minQueue.count > 0U) && (pState[arm_sliding_queue_back(&S->minQueue, windowSize)] > in))
+    {
+      S->minQueue.count--;
+    }
+    arm_sliding_queue_push(&S->minQueue, index, windowSize);
+
+    pState[index] = in;
+    index = (index + 1U == windowSize) ? 0U : (index + 1U);
+
+    blockSize--;
+  }
+
+  S->index = index;
+  S->sum = sum;
+  S->sumOfSquares = sumOfSquares;
+}
+
+/**
+  @brief         Mean of the window of the Q15 sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  mean value, 0 for an empty window
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_mean_q15(
+  const arm_sliding_stats_instance_q15 * S,
+        q15_t * pResult)
+{
+  *pResult = (S->count == 0U) ? 0 : (q15_t)(S->sum / (int32_t)S->count);
+}
+
+/**
+  @brief         Variance of the window of the Q15 sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  variance, 0 for less than 2 samples
+
+  @par           Details
+                   Same computation as arm_var_q15().
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_var_q15(
+  const arm_sliding_stats_instance_q15 * S,
+        q15_t * pResult)
+{
+  const uint32_t count = S->count;
+  q31_t meanOfSquares;
+  q31_t squareOfMean;
+
+  if (count <= 1U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  meanOfSquares = (q31_t)(S->sumOfSquares / (q63_t)(count - 1U));
+  squareOfMean = (q31_t)((q63_t)S->sum * S->sum / (q63_t)(count * (count - 1U)));
+
+  *pResult = (q15_t)((meanOfSquares - squareOfMean) >> 15U);
+}
+
+/**
+  @brief         Root mean square of the window of the Q15 sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  root mean square value, 0 for an empty window
+
+  @par           Details
+                   Same computation as arm_rms_q15().
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_rms_q15(
+  const arm_sliding_stats_instance_q15 * S,
+        q15_t * pResult)
+{
+  if (S->count == 0U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  (void)arm_sqrt_q15((q15_t)__SSAT((S->sumOfSquares / (q63_t)S->count) >> 15, 16), pResult);
+}
+
+/**
+  @brief         Maximum of the window of the Q15 sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  maximum value, 0 for an empty window
+  @param[out]    pIndex   index of the maximum in the window, 0 for the oldest sample
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_max_q15(
+  const arm_sliding_stats_instance_q15 * S,
+        q15_t * pResult,
+        uint32_t * pIndex)
+{
+  if (S->count == 0U)
+  {
+    *pResult = 0;
+    *pIndex = 0U;
+    return;
+  }
+
+  *pResult = S->pState[S->maxQueue.pPos[S->maxQueue.head]];
+  *pIndex = arm_sliding_queue_front_index(&S->maxQueue, S->count, S->index, S->windowSize);
+}
+
+/**
+  @brief         Minimum of the window of the Q15 sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  minimum value, 0 for an empty window
+  @param[out]    pIndex   index of the minimum in the window, 0 for the oldest sample
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_min_q15(
+  const arm_sliding_stats_instance_q15 * S,
+        q15_t * pResult,
+        uint32_t * pIndex)
+{
+  if (S->count == 0U)
+  {
+    *pResult = 0;
+    *pIndex = 0U;
+    return;
+  }
+
+  *pResult = S->pState[S->minQueue.pPos[S->minQueue.head]];
+  *pIndex = arm_sliding_queue_front_index(&S->minQueue, S->count, S->index, S->windowSize);
+}
+
+/**
+  @} end of SlidingStats group
+ */
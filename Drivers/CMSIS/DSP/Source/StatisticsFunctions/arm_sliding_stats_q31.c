@@ -0,0 +1,227 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_stats_q31.c
+ * Description:  Q31 sliding window mean, variance, RMS, minimum and maximum
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/statistics_functions.h"
+#include "arm_sliding_stats.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup SlidingStats
+  @{
+ */
+
+/**
+  @brief         Adds samples to the window of the Q31 sliding window statistics.
+  @param[in,out] S          points to an instance of the sliding window statistics structure
+  @param[in]     pSrc       points to the new samples
+  @param[in]     blockSize  number of new samples
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_stats_q31(
+        arm_sliding_stats_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize)
+{
+  const uint32_t windowSize = S->windowSize;
+  q31_t *pState = S->pState;
+  uint32_t index = S->index;
+  q63_t sum = S->sum;
+  q63_t sumShifted = S->sumShifted;
+  q63_t sumOfSquares = S->sumOfSquares;
+  q31_t in;
+  q31_t out;
+
+  while (blockSize > 0U)
+  {
+    in = *pSrc++;
+
+    if (S->count == windowSize)
+    {
+      /* The oldest sample, at the position of the new one, leaves the window */
+      out = pState[index];
+      arm_sliding_queue_expire(&S->maxQueue, index, windowSize);
+      arm_sliding_queue_expire(&S->minQueue, index, windowSize);
+
+      sum -= out;
+      out = out >> 8U;
+      sumShifted -= out;
+      sumOfSquares -= (q63_t)out * out;
+    }
+    else
+    {
+      S->count++;
+    }
+
+    sum += in;
+    sumShifted += (in >> 8U);
+    sumOfSquares += (q63_t)(in >> 8U) * (in >> 8U);
+
+    /* Smaller maxima and larger minima can no longer be the extrema */
+    while ((S->maxQueue.count > 0U) && (pState[arm_sliding_queue_back(&S->maxQueue, windowSize)] < in))
+    {
+      S->maxQueue.count--;
+    }
+    arm_sliding_queue_push(&S->maxQueue, index, windowSize);
+
+    while ((S->minQueue.count > 0U) && (pState[arm_sliding_queue_back(&S->minQueue, windowSize)] > in))
+    {
+      S->minQueue.count--;
+    }
+    arm_sliding_queue_push(&S->minQueue, index, windowSize);
+
+    pState[index] = in;
+    index = (index + 1U == windowSize) ? 0U : (index + 1U);
+
+    blockSize--;
+  }
+
+  S->index = index;
+  S->sum = sum;
+  S->sumShifted = sumShifted;
+  S->sumOfSquares = sumOfSquares;
+}
+
+/**
+  @brief         Mean of the window of the Q31 sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  mean value, 0 for an empty window
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_mean_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        q31_t * pResult)
+{
+  *pResult = (S->count == 0U) ? 0 : (q31_t)(S->sum / (q63_t)S->count);
+}
+
+/**
+  @brief         Variance of the window of the Q31 sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  variance, 0 for less than 2 samples
+
+  @par           Details
+                   Computed from the 1.23 samples as arm_var_q31(), but with the square of the sum
+                   divided by the number of samples before the subtraction, so that it does not
+                   overflow for windows longer than a few hundred samples. The result can differ
+                   from arm_var_q31() by one LSB.
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_var_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        q31_t * pResult)
+{
+  const q63_t count = (q63_t)S->count;
+  q63_t quotient;
+  q63_t remainder;
+  q63_t squareOfSum;
+
+  if (S->count <= 1U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  /* sum * sum / count with sum = quotient * count + remainder */
+  quotient = S->sumShifted / count;
+  remainder = S->sumShifted % count;
+  squareOfSum = (quotient * quotient * count) + (2 * quotient * remainder) + ((remainder * remainder) / count);
+
+  *pResult = (q31_t)(((S->sumOfSquares - squareOfSum) / (count - 1)) >> 15U);
+}
+
+/**
+  @brief         Root mean square of the window of the Q31 sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  root mean square value, 0 for an empty window
+
+  @par           Details
+                   Computed from the 1.23 samples used for the variance, so that the sum of
+                   the squares cannot overflow; arm_rms_q31() uses the 1.31 samples and
+                   overflows for windows longer than a few samples of large amplitude.
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_rms_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        q31_t * pResult)
+{
+  if (S->count == 0U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  /* Mean of the squares in 2.46 format converted to 1.31 */
+  (void)arm_sqrt_q31(clip_q63_to_q31((S->sumOfSquares / (q63_t)S->count) >> 15U), pResult);
+}
+
+/**
+  @brief         Maximum of the window of the Q31 sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  maximum value, 0 for an empty window
+  @param[out]    pIndex   index of the maximum in the window, 0 for the oldest sample
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_max_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        q31_t * pResult,
+        uint32_t * pIndex)
+{
+  if (S->count == 0U)
+  {
+    *pResult = 0;
+    *pIndex = 0U;
+    return;
+  }
+
+  *pResult = S->pState[S->maxQueue.pPos[S->maxQueue.head]];
+  *pIndex = arm_sliding_queue_front_index(&S->maxQueue, S->count, S->index, S->windowSize);
+}
+
+/**
+  @brief         Minimum of the window of the Q31 sliding window statistics.
+  @param[in]     S        points to an instance of the sliding window statistics structure
+  @param[out]    pResult  minimum value, 0 for an empty window
+  @param[out]    pIndex   index of the minimum in the window, 0 for the oldest sample
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_min_q31(
+  const arm_sliding_stats_instance_q31 * S,
+        q31_t * pResult,
+        uint32_t * pIndex)
+{
+  if (S->count == 0U)
+  {
+    *pResult = 0;
+    *pIndex = 0U;
+    return;
+  }
+
+  *pResult = S->pState[S->minQueue.pPos[S->minQueue.head]];
+  *pIndex = arm_sliding_queue_front_index(&S->minQueue, S->count, S->index, S->windowSize);
+}
+
+/**
+  @} end of SlidingStats group
+ */
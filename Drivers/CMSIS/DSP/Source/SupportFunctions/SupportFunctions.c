@@ -26,6 +26,7 @@
  * limitations under the License.
  */
 
+#include "arm_argsort_f32.c"
 #include "arm_barycenter_f32.c"
 #include "arm_bitonic_sort_f32.c"
 #include "arm_bubble_sort_f32.c"
@@ -41,9 +42,15 @@
 #include "arm_fill_q7.c"
 #include "arm_heap_sort_f32.c"
 #include "arm_insertion_sort_f32.c"
+#include "arm_merge_argsort_f32.c"
 #include "arm_merge_sort_f32.c"
 #include "arm_merge_sort_init_f32.c"
 #include "arm_quick_sort_f32.c"
+#include "arm_radix_sort_f32.c"
+#include "arm_radix_sort_init_q15.c"
+#include "arm_radix_sort_init_q31.c"
+#include "arm_radix_sort_q15.c"
+#include "arm_radix_sort_q31.c"
 #include "arm_selection_sort_f32.c"
 #include "arm_sort_f32.c"
 #include "arm_sort_init_f32.c"
@@ -0,0 +1,312 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_argsort_f32.c
+ * Description:  Floating point argsort
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+#include "arm_sorting.h"
+
+/* Below this length, the quick argsort uses the insertion argsort */
+#define ARM_ARGSORT_QUICK_MIN 16
+
+#define ARM_ARGSORT_SWAP(a, b) \
+do {                           \
+    uint32_t swap_tmp = (a);   \
+    (a) = (b);                 \
+    (b) = swap_tmp;            \
+} while (0)
+
+static void arm_argsort_bubble_f32(const float32_t * pSrc, uint32_t * pIndex, uint32_t blockSize, uint8_t dir)
+{
+    uint32_t i, j;
+    uint8_t swapped = 1U;
+
+    for (i = blockSize; (i > 1U) && (swapped != 0U); i--)
+    {
+        swapped = 0U;
+        for (j = 0U; j < (i - 1U); j++)
+        {
+            if (arm_argsort_before_f32(pSrc, pIndex[j + 1U], pIndex[j], dir))
+            {
+                ARM_ARGSORT_SWAP(pIndex[j], pIndex[j + 1U]);
+                swapped = 1U;
+            }
+        }
+    }
+}
+
+static void arm_argsort_insertion_f32(const float32_t * pSrc, uint32_t * pIndex, uint32_t blockSize, uint8_t dir)
+{
+    uint32_t i, j;
+    uint32_t idx;
+
+    for (i = 1U; i < blockSize; i++)
+    {
+        idx = pIndex[i];
+        for (j = i; (j > 0U) && arm_argsort_before_f32(pSrc, idx, pIndex[j - 1U], dir); j--)
+        {
+            pIndex[j] = pIndex[j - 1U];
+        }
+        pIndex[j] = idx;
+    }
+}
+
+static void arm_argsort_selection_f32(const float32_t * pSrc, uint32_t * pIndex, uint32_t blockSize, uint8_t dir)
+{
+    uint32_t i, j, sel;
+
+    for (i = 0U; (i + 1U) < blockSize; i++)
+    {
+        sel = i;
+        for (j = i + 1U; j < blockSize; j++)
+        {
+            if (arm_argsort_before_f32(pSrc, pIndex[j], pIndex[sel], dir))
+            {
+                sel = j;
+            }
+        }
+        ARM_ARGSORT_SWAP(pIndex[i], pIndex[sel]);
+    }
+}
+
+static void arm_argsort_sift_f32(const float32_t * pSrc, uint32_t * pIndex, uint32_t root, uint32_t end, uint8_t dir)
+{
+    uint32_t child;
+
+    /* The root of the heap is the element placed last */
+    for (child = (2U * root) + 1U; child < end; child = (2U * root) + 1U)
+    {
+        if (((child + 1U) < end) && arm_argsort_before_f32(pSrc, pIndex[child], pIndex[child + 1U], dir))
+        {
+            child++;
+        }
+        if (!arm_argsort_before_f32(pSrc, pIndex[root], pIndex[child], dir))
+        {
+            break;
+        }
+        ARM_ARGSORT_SWAP(pIndex[root], pIndex[child]);
+        root = child;
+    }
+}
+
+static void arm_argsort_heap_f32(const float32_t * pSrc, uint32_t * pIndex, uint32_t blockSize, uint8_t dir)
+{
+    uint32_t i;
+
+    for (i = blockSize / 2U; i > 0U; i--)
+    {
+        arm_argsort_sift_f32(pSrc, pIndex, i - 1U, blockSize, dir);
+    }
+    for (i = blockSize; i > 1U; i--)
+    {
+        ARM_ARGSORT_SWAP(pIndex[0], pIndex[i - 1U]);
+        arm_argsort_sift_f32(pSrc, pIndex, 0U, i - 1U, dir);
+    }
+}
+
+static void arm_argsort_quick_f32(const float32_t * pSrc, uint32_t * pIndex, int32_t first, int32_t last, uint8_t dir)
+{
+    int32_t i, j, mid;
+    uint32_t pivot;
+
+    while ((last - first) >= ARM_ARGSORT_QUICK_MIN)
+    {
+        /* Median of three as pivot */
+        mid = first + ((last - first) / 2);
+        if (arm_argsort_before_f32(pSrc, pIndex[mid], pIndex[first], dir))
+        {
+            ARM_ARGSORT_SWAP(pIndex[mid], pIndex[first]);
+        }
+        if (arm_argsort_before_f32(pSrc, pIndex[last], pIndex[first], dir))
+        {
+            ARM_ARGSORT_SWAP(pIndex[last], pIndex[first]);
+        }
+        if (arm_argsort_before_f32(pSrc, pIndex[last], pIndex[mid], dir))
+        {
+            ARM_ARGSORT_SWAP(pIndex[last], pIndex[mid]);
+        }
+        pivot = pIndex[mid];
+
+        i = first;
+        j = last;
+        while (i <= j)
+        {
+            while (arm_argsort_before_f32(pSrc, pIndex[i], pivot, dir))
+            {
+                i++;
+            }
+            while (arm_argsort_before_f32(pSrc, pivot, pIndex[j], dir))
+            {
+                j--;
+            }
+            if (i <= j)
+            {
+                ARM_ARGSORT_SWAP(pIndex[i], pIndex[j]);
+                i++;
+                j--;
+            }
+        }
+
+        /* Recursion on the shorter part bounds the stack depth */
+        if ((j - first) < (last - i))
+        {
+            arm_argsort_quick_f32(pSrc, pIndex, first, j, dir);
+            first = i;
+        }
+        else
+        {
+            arm_argsort_quick_f32(pSrc, pIndex, i, last, dir);
+            last = j;
+        }
+    }
+
+    if (last > first)
+    {
+        arm_argsort_insertion_f32(pSrc, &pIndex[first], (uint32_t)(last - first) + 1U, dir);
+    }
+}
+
+static void arm_argsort_bitonic_f32(const float32_t * pSrc, uint32_t * pIndex, uint32_t blockSize, uint8_t dir)
+{
+    uint32_t i, j, k, l;
+    int32_t swap;
+
+    /* Powers of 2 only */
+    if ((blockSize & (blockSize - 1U)) != 0U)
+    {
+        return;
+    }
+
+    for (k = 2U; k <= blockSize; k <<= 1U)
+    {
+        for (j = k >> 1U; j > 0U; j >>= 1U)
+        {
+            for (i = 0U; i < blockSize; i++)
+            {
+                l = i ^ j;
+                if (l > i)
+                {
+                    /* Sequences of length k alternately in the order and in the reverse order */
+                    swap = ((i & k) == 0U) ? arm_argsort_before_f32(pSrc, pIndex[l], pIndex[i], dir)
+                                           : arm_argsort_before_f32(pSrc, pIndex[i], pIndex[l], dir);
+                    if (swap)
+                    {
+                        ARM_ARGSORT_SWAP(pIndex[i], pIndex[l]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+/**
+ * @brief Generic argsort function
+ *
+ * @param[in]  S          points to an instance of the sorting structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[out] pIndex     points to the indices of the sorted data.
+ * @param[in]  blockSize  number of samples to process.
+ *
+ * @par          Computes the permutation that sorts the input with the algorithm
+ *               of the instance: <code>pSrc[pIndex[0]], pSrc[pIndex[1]], ...</code>
+ *               is sorted and <code>pSrc</code> is not modified.
+ *
+ * @par          Equal values are placed in the order of their indices for all the
+ *               algorithms, so that they all return the same permutation, which is
+ *               also the one of arm_merge_argsort_f32(). For \ref ARM_SORT_RADIX,
+ *               -0.0 is placed before +0.0. NaN are not supported.
+ *
+ * @par          \ref ARM_SORT_BITONIC only sorts blocks whose size is a power of 2,
+ *               as arm_bitonic_sort_f32(): for other sizes the identity is returned.
+ *               \ref ARM_SORT_RADIX needs a working buffer of <code>3 * blockSize</code>
+ *               words linked with arm_sort_init_buffer_f32(), and uses the quick sort
+ *               without it. The quick sort uses a median of three pivot and a stack
+ *               depth logarithmic in <code>blockSize</code>.
+ */
+ARM_DSP_ATTRIBUTE void arm_argsort_f32(
+  const arm_sort_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t * pIndex,
+        uint32_t blockSize)
+{
+    uint8_t dir = (uint8_t)S->dir;
+    uint32_t i;
+
+    if ((S->alg == ARM_SORT_RADIX) && (S->buffer != NULL))
+    {
+        arm_radix_argsort_f32(S, pSrc, pIndex, blockSize);
+        return;
+    }
+
+    for (i = 0U; i < blockSize; i++)
+    {
+        pIndex[i] = i;
+    }
+
+    switch(S->alg)
+    {
+        case ARM_SORT_BITONIC:
+        arm_argsort_bitonic_f32(pSrc, pIndex, blockSize, dir);
+        break;
+
+        case ARM_SORT_BUBBLE:
+        arm_argsort_bubble_f32(pSrc, pIndex, blockSize, dir);
+        break;
+
+        case ARM_SORT_HEAP:
+        arm_argsort_heap_f32(pSrc, pIndex, blockSize, dir);
+        break;
+
+        case ARM_SORT_INSERTION:
+        arm_argsort_insertion_f32(pSrc, pIndex, blockSize, dir);
+        break;
+
+        case ARM_SORT_SELECTION:
+        arm_argsort_selection_f32(pSrc, pIndex, blockSize, dir);
+        break;
+
+        case ARM_SORT_QUICK:
+        case ARM_SORT_RADIX:
+        if (blockSize > 1U)
+        {
+            arm_argsort_quick_f32(pSrc, pIndex, 0, (int32_t)blockSize - 1, dir);
+        }
+        break;
+    }
+}
+
+/**
+  @} end of Sorting group
+ */
@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_merge_argsort_f32.c
+ * Description:  Floating point merge argsort
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+#include "arm_sorting.h"
+
+static void arm_merge_argsort_runs_f32(
+  const float32_t * pSrc,
+  const uint32_t * pA,
+        uint32_t * pB,
+        uint32_t begin,
+        uint32_t middle,
+        uint32_t end,
+        uint8_t dir)
+{
+    uint32_t i = begin;
+    uint32_t j = middle;
+    uint32_t k;
+
+    /* Left run pA[begin:middle-1] and right run pA[middle:end-1] merged in pB */
+    for (k = begin; k < end; k++)
+    {
+        if ((i < middle) && ((j >= end) || !arm_argsort_before_f32(pSrc, pA[j], pA[i], dir)))
+        {
+            pB[k] = pA[i];
+            i++;
+        }
+        else
+        {
+            pB[k] = pA[j];
+            j++;
+        }
+    }
+}
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+/**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pIndex     points to the indices of the sorted data.
+   * @param[in]  blockSize  number of samples to process.
+   *
+   * @par        Algorithm
+   *               Bottom-up merge sort of the indices: runs of length 1, 2, 4, ...
+   *               are merged alternately from <code>pIndex</code> into the working
+   *               buffer and back. The sort is stable.
+   *
+   * @par          The working buffer of the instance, of <code>blockSize</code> values,
+   *               holds the indices during the merges. <code>pSrc</code> is not modified.
+   */
+ARM_DSP_ATTRIBUTE void arm_merge_argsort_f32(
+  const arm_merge_sort_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t * pIndex,
+        uint32_t blockSize)
+{
+    uint32_t *pA = pIndex;
+    uint32_t *pB = (uint32_t *)S->buffer;
+    uint32_t *pTmp;
+    uint32_t width;
+    uint32_t begin;
+    uint32_t middle;
+    uint32_t end;
+    uint8_t dir = (uint8_t)S->dir;
+
+    for (begin = 0U; begin < blockSize; begin++)
+    {
+        pIndex[begin] = begin;
+    }
+
+    for (width = 1U; width < blockSize; width *= 2U)
+    {
+        for (begin = 0U; begin < blockSize; begin += 2U * width)
+        {
+            middle = ((blockSize - begin) > width) ? (begin + width) : blockSize;
+            end = ((blockSize - middle) > width) ? (middle + width) : blockSize;
+            arm_merge_argsort_runs_f32(pSrc, pA, pB, begin, middle, end, dir);
+        }
+        pTmp = pA;
+        pA = pB;
+        pB = pTmp;
+    }
+
+    if (pA != pIndex)
+    {
+        memcpy(pIndex, pA, blockSize * sizeof(uint32_t));
+    }
+}
+
+/**
+  @} end of Sorting group
+ */
@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_radix_sort_f32.c
+ * Description:  Floating point radix sort and argsort
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+#include "arm_sorting.h"
+
+/* Unsigned key with the order of the float: sign bit set for positive values, all bits inverted for negative ones */
+__STATIC_FORCEINLINE uint32_t arm_radix_key_f32(float32_t value, uint32_t flip)
+{
+    uint32_t bits;
+
+    memcpy(&bits, &value, sizeof(uint32_t));
+    bits = ((bits & 0x80000000U) != 0U) ? ~bits : (bits | 0x80000000U);
+
+    return bits ^ flip;
+}
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+/**
+   * @private
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of samples to process.
+   *
+   * @par        Algorithm
+   *               The least significant digit radix sort distributes the values
+   *               in 256 buckets by bytes of their binary representation, from the
+   *               least significant to the most significant byte, keeping the order
+   *               of the previous pass in every bucket. The float values are mapped
+   *               to unsigned integers with the same order: the sign bit is set for
+   *               positive values, all the bits are inverted for negative values.
+   *               The time is linear in <code>blockSize</code>, with at most 4 passes.
+   *
+   * @par          A work array of <code>blockSize</code> words is needed. It must be
+   *               linked to the instance with arm_sort_init_buffer_f32(). Without it,
+   *               the quick sort is used.
+   *
+   * @par          -0.0 is sorted before +0.0. NaN are not supported.
+   */
+ARM_DSP_ATTRIBUTE void arm_radix_sort_f32(
+  const arm_sort_instance_f32 * S,
+        float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+    const uint32_t flip = (S->dir == ARM_SORT_ASCENDING) ? 0U : 0xFFFFFFFFU;
+    uint32_t *pKey = (uint32_t *)pDst;
+    uint32_t bits;
+    uint32_t i;
+
+    if (S->buffer == NULL)
+    {
+        arm_quick_sort_f32(S, pSrc, pDst, blockSize);
+        return;
+    }
+
+    /* The keys are sorted in the output buffer */
+    for (i = 0U; i < blockSize; i++)
+    {
+        pKey[i] = arm_radix_key_f32(pSrc[i], flip);
+    }
+
+    arm_radix_sort_u32(pKey, S->buffer, NULL, NULL, blockSize);
+
+    for (i = 0U; i < blockSize; i++)
+    {
+        bits = pKey[i] ^ flip;
+        pKey[i] = ((bits & 0x80000000U) != 0U) ? (bits & 0x7FFFFFFFU) : ~bits;
+    }
+}
+
+/**
+   * @private
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pIndex     points to the indices of the sorted data.
+   * @param[in]  blockSize  number of samples to process.
+   *
+   * @par          A work array of <code>3 * blockSize</code> words is needed: without it,
+   *               arm_argsort_f32() uses the quick sort. The sort is stable: equal values
+   *               keep the order of their indices.
+   */
+ARM_DSP_ATTRIBUTE void arm_radix_argsort_f32(
+  const arm_sort_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t * pIndex,
+        uint32_t blockSize)
+{
+    const uint32_t flip = (S->dir == ARM_SORT_ASCENDING) ? 0U : 0xFFFFFFFFU;
+    uint32_t *pKey = S->buffer;
+    uint32_t i;
+
+    for (i = 0U; i < blockSize; i++)
+    {
+        pKey[i] = arm_radix_key_f32(pSrc[i], flip);
+        pIndex[i] = i;
+    }
+
+    arm_radix_sort_u32(pKey, &pKey[blockSize], pIndex, &pKey[2U * blockSize], blockSize);
+}
+
+/**
+  @} end of Sorting group
+ */
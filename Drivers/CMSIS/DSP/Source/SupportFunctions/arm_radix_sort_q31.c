@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_radix_sort_q31.c
+ * Description:  Q31 radix sort and argsort
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/support_functions.h"
+#include "arm_sorting.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+/**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   *
+   * @par        Algorithm
+   *               Least significant digit radix sort on bytes, as for \ref ARM_SORT_RADIX
+   *               in arm_sort_f32(), of the values with the sign bit inverted. The time
+   *               is linear in <code>blockSize</code>, with at most 4 passes.
+   *
+   * @par          The working buffer of the instance holds <code>blockSize</code> words.
+   *               <code>pSrc</code> and <code>pDst</code> can be the same buffer.
+   */
+ARM_DSP_ATTRIBUTE void arm_radix_sort_q31(
+  const arm_radix_sort_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+    const uint32_t flip = (S->dir == ARM_SORT_ASCENDING) ? 0x80000000U : 0x7FFFFFFFU;
+    uint32_t *pKey = (uint32_t *)pDst;
+    uint32_t i;
+
+    for (i = 0U; i < blockSize; i++)
+    {
+        pKey[i] = (uint32_t)pSrc[i] ^ flip;
+    }
+
+    arm_radix_sort_u32(pKey, S->buffer, NULL, NULL, blockSize);
+
+    for (i = 0U; i < blockSize; i++)
+    {
+        pKey[i] = pKey[i] ^ flip;
+    }
+}
+
+/**
+   * @param[in]  S          points to an instance of the sorting structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pIndex     points to the indices of the sorted data.
+   * @param[in]  blockSize  number of samples to process.
+   *
+   * @par          <code>pSrc[pIndex[0]], pSrc[pIndex[1]], ...</code> is sorted. The sort
+   *               is stable: equal values keep the order of their indices.
+   *
+   * @par          The working buffer of the instance holds <code>3 * blockSize</code> words.
+   */
+ARM_DSP_ATTRIBUTE void arm_radix_argsort_q31(
+  const arm_radix_sort_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t * pIndex,
+        uint32_t blockSize)
+{
+    const uint32_t flip = (S->dir == ARM_SORT_ASCENDING) ? 0x80000000U : 0x7FFFFFFFU;
+    uint32_t *pKey = S->buffer;
+    uint32_t i;
+
+    for (i = 0U; i < blockSize; i++)
+    {
+        pKey[i] = (uint32_t)pSrc[i] ^ flip;
+        pIndex[i] = i;
+    }
+
+    arm_radix_sort_u32(pKey, &pKey[blockSize], pIndex, &pKey[2U * blockSize], blockSize);
+}
+
+/**
+  @} end of Sorting group
+ */
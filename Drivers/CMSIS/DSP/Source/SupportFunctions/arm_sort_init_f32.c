@@ -47,6 +47,23 @@ ARM_DSP_ATTRIBUTE void arm_sort_init_f32(arm_sort_instance_f32 * S, arm_sort_alg
 {
     S->alg         = alg;
     S->dir         = dir;
+    S->buffer      = NULL;
+}
+
+  /**
+   * @param[in,out]  S            points to an instance of the sorting structure.
+   * @param[in]      alg          Selected algorithm.
+   * @param[in]      dir          Sorting order.
+   * @param[in]      buffer       Working buffer of the radix sort.
+   *
+   * @par          The buffer is only used by \ref ARM_SORT_RADIX: <code>blockSize</code> words
+   *               for arm_sort_f32() and <code>3 * blockSize</code> words for arm_argsort_f32().
+   */
+ARM_DSP_ATTRIBUTE void arm_sort_init_buffer_f32(arm_sort_instance_f32 * S, arm_sort_alg alg, arm_sort_dir dir, uint32_t * buffer)
+{
+    S->alg         = alg;
+    S->dir         = dir;
+    S->buffer      = buffer;
 }
 
 /**
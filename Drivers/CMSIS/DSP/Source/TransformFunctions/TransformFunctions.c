@@ -32,7 +32,10 @@
 #include "arm_cfft_f64.c"
 #include "arm_cfft_q15.c"
 #include "arm_cfft_q31.c"
+#include "arm_cfft_bfp_q15.c"
+#include "arm_cfft_bfp_q31.c"
 #include "arm_cfft_init_f32.c"
+#include "arm_cfft_init_dynamic_f32.c"
 #include "arm_cfft_init_f64.c"
 #include "arm_cfft_init_q15.c"
 #include "arm_cfft_init_q31.c"
@@ -46,10 +49,13 @@
 #include "arm_rfft_fast_f32.c"
 #include "arm_rfft_fast_f64.c"
 #include "arm_rfft_fast_init_f32.c"
+#include "arm_rfft_fast_init_dynamic_f32.c"
 #include "arm_rfft_fast_init_f64.c"
 
 #include "arm_mfcc_init_f32.c"
 #include "arm_mfcc_f32.c"
+#include "arm_stft_init_f32.c"
+#include "arm_stft_f32.c"
 
 #include "arm_mfcc_init_q31.c"
 #include "arm_mfcc_q31.c"
@@ -69,6 +75,17 @@
 #include "arm_rfft_f32.c"
 #include "arm_rfft_q15.c"
 #include "arm_rfft_q31.c"
+#include "arm_rfft_bfp_q15.c"
+#include "arm_rfft_bfp_q31.c"
+
+#include "arm_goertzel_init_f32.c"
+#include "arm_goertzel_f32.c"
+#include "arm_goertzel_init_q31.c"
+#include "arm_goertzel_q31.c"
+#include "arm_sliding_dft_init_f32.c"
+#include "arm_sliding_dft_f32.c"
+#include "arm_sliding_dft_init_q31.c"
+#include "arm_sliding_dft_q31.c"
 
 #include "arm_rfft_init_f32.c"
 #include "arm_rfft_init_q15.c"
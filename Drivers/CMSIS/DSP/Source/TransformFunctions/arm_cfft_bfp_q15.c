@@ -0,0 +1,398 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_bfp_q15.c
+ * Description:  Block floating-point Q15 complex FFT
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+
+extern void arm_bitreversal_16(
+        uint16_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTable);
+
+/* Significant bits of the magnitudes at the input of a stage */
+#define ARM_CFFT_BFP_RADIX2_BITS_Q15       13
+#define ARM_CFFT_BFP_RADIX4_BITS_Q15       12
+#define ARM_CFFT_BFP_RADIX4_LAST_BITS_Q15  13
+
+/**
+  @brief         Number of significant bits of the magnitudes of a block.
+  @param[in]     pSrc       points to the block
+  @param[in]     blockSize  number of values
+  @return        number of bits of the largest magnitude, 0 for a zero block
+ */
+static uint32_t arm_cfft_bfp_bits_q15(
+  const q15_t * pSrc,
+        uint32_t blockSize)
+{
+  q31_t acc = 0;
+  q31_t in;
+
+  while (blockSize > 0U)
+  {
+    in = *pSrc++;
+    acc |= in ^ (in >> 31);
+    blockSize--;
+  }
+
+  return 32U - __CLZ((uint32_t)acc);
+}
+
+/**
+  @brief         Conjugates a complex block, saturating -1.
+  @param[in,out] pSrc    points to the block
+  @param[in]     fftLen  number of complex values
+ */
+static void arm_cfft_bfp_conj_q15(
+  q15_t * pSrc,
+  uint32_t fftLen)
+{
+  uint32_t i;
+
+  for (i = 0U; i < fftLen; i++)
+  {
+    pSrc[(2U * i) + 1U] = (q15_t)__SSAT(-(q31_t)pSrc[(2U * i) + 1U], 16);
+  }
+}
+
+/**
+  @brief         Radix-2 decimation in frequency stage on the whole block.
+  @param[in,out] pSrc     points to the complex block
+  @param[in]     fftLen   length of the FFT
+  @param[in]     pCoef    points to the twiddle factors of the FFT length
+  @param[in]     lShift   left shift of the inputs
+  @param[in]     rShift   rounded right shift of the inputs
+  @return        number of significant bits of the outputs
+ */
+static uint32_t arm_cfft_bfp_radix2_q15(
+        q15_t * pSrc,
+        uint32_t fftLen,
+  const q15_t * pCoef,
+        uint32_t lShift,
+        uint32_t rShift)
+{
+  const uint32_t half = fftLen / 2U;
+  const q31_t rnd = (q31_t)((1UL << rShift) >> 1U);
+  q15_t *pA = pSrc;
+  q15_t *pB = &pSrc[2U * half];
+  q31_t ar, ai, br, bi;
+  q31_t dr, di;
+  q31_t cosVal, sinVal;
+  q31_t out;
+  q31_t acc = 0;
+  uint32_t j;
+
+  for (j = 0U; j < half; j++)
+  {
+    cosVal = pCoef[2U * j];
+    sinVal = pCoef[(2U * j) + 1U];
+
+    ar = (((q31_t)pA[0] << lShift) + rnd) >> rShift;
+    ai = (((q31_t)pA[1] << lShift) + rnd) >> rShift;
+    br = (((q31_t)pB[0] << lShift) + rnd) >> rShift;
+    bi = (((q31_t)pB[1] << lShift) + rnd) >> rShift;
+
+    out = ar + br;
+    acc |= out ^ (out >> 31);
+    pA[0] = (q15_t)out;
+    out = ai + bi;
+    acc |= out ^ (out >> 31);
+    pA[1] = (q15_t)out;
+
+    /* (a - b) * W^j */
+    dr = ar - br;
+    di = ai - bi;
+    out = ((dr * cosVal) + (di * sinVal) + 0x4000) >> 15;
+    acc |= out ^ (out >> 31);
+    pB[0] = (q15_t)out;
+    out = ((di * cosVal) - (dr * sinVal) + 0x4000) >> 15;
+    acc |= out ^ (out >> 31);
+    pB[1] = (q15_t)out;
+
+    pA += 2;
+    pB += 2;
+  }
+
+  return 32U - __CLZ((uint32_t)acc);
+}
+
+/**
+  @brief         Radix-4 decimation in frequency stage.
+  @param[in,out] pSrc     points to the complex block
+  @param[in]     fftLen   length of the FFT
+  @param[in]     quarter  distance between the inputs of a butterfly
+  @param[in]     pCoef    points to the twiddle factors of the FFT length
+  @param[in]     lShift   left shift of the inputs
+  @param[in]     rShift   rounded right shift of the inputs
+  @return        number of significant bits of the outputs
+
+  @par           Details
+                   The outputs of a butterfly are stored in the order 0, 2, 1, 3 of the
+                   frequencies, as two radix-2 stages would: the FFT output is in bit
+                   reversed order.
+ */
+static uint32_t arm_cfft_bfp_radix4_q15(
+        q15_t * pSrc,
+        uint32_t fftLen,
+        uint32_t quarter,
+  const q15_t * pCoef,
+        uint32_t lShift,
+        uint32_t rShift)
+{
+  const uint32_t step = 2U * (fftLen / (4U * quarter));
+  const uint32_t span = 2U * quarter;
+  const q31_t rnd = (q31_t)((1UL << rShift) >> 1U);
+  q15_t *pA;
+  q31_t ar, ai, br, bi, cr, ci, dr, di;
+  q31_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+  q31_t yr, yi;
+  q31_t c1, s1, c2, s2, c3, s3;
+  q31_t out;
+  q31_t acc = 0;
+  uint32_t i;
+  uint32_t j;
+
+  for (j = 0U; j < quarter; j++)
+  {
+    c1 = pCoef[j * step];
+    s1 = pCoef[(j * step) + 1U];
+    c2 = pCoef[2U * j * step];
+    s2 = pCoef[(2U * j * step) + 1U];
+    c3 = pCoef[3U * j * step];
+    s3 = pCoef[(3U * j * step) + 1U];
+
+    for (i = j; i < fftLen; i += 4U * quarter)
+    {
+      pA = &pSrc[2U * i];
+
+      ar = (((q31_t)pA[0] << lShift) + rnd) >> rShift;
+      ai = (((q31_t)pA[1] << lShift) + rnd) >> rShift;
+      br = (((q31_t)pA[span] << lShift) + rnd) >> rShift;
+      bi = (((q31_t)pA[span + 1U] << lShift) + rnd) >> rShift;
+      cr = (((q31_t)pA[2U * span] << lShift) + rnd) >> rShift;
+      ci = (((q31_t)pA[(2U * span) + 1U] << lShift) + rnd) >> rShift;
+      dr = (((q31_t)pA[3U * span] << lShift) + rnd) >> rShift;
+      di = (((q31_t)pA[(3U * span) + 1U] << lShift) + rnd) >> rShift;
+
+      t0r = ar + cr;
+      t0i = ai + ci;
+      t1r = ar - cr;
+      t1i = ai - ci;
+      t2r = br + dr;
+      t2i = bi + di;
+      t3r = br - dr;
+      t3i = bi - di;
+
+      /* a + b + c + d */
+      out = t0r + t2r;
+      acc |= out ^ (out >> 31);
+      pA[0] = (q15_t)out;
+      out = t0i + t2i;
+      acc |= out ^ (out >> 31);
+      pA[1] = (q15_t)out;
+
+      /* (a - b + c - d) * W^2j */
+      yr = t0r - t2r;
+      yi = t0i - t2i;
+      out = ((yr * c2) + (yi * s2) + 0x4000) >> 15;
+      acc |= out ^ (out >> 31);
+      pA[span] = (q15_t)out;
+      out = ((yi * c2) - (yr * s2) + 0x4000) >> 15;
+      acc |= out ^ (out >> 31);
+      pA[span + 1U] = (q15_t)out;
+
+      /* (a - jb - c + jd) * W^j */
+      yr = t1r + t3i;
+      yi = t1i - t3r;
+      out = ((yr * c1) + (yi * s1) + 0x4000) >> 15;
+      acc |= out ^ (out >> 31);
+      pA[2U * span] = (q15_t)out;
+      out = ((yi * c1) - (yr * s1) + 0x4000) >> 15;
+      acc |= out ^ (out >> 31);
+      pA[(2U * span) + 1U] = (q15_t)out;
+
+      /* (a + jb - c - jd) * W^3j */
+      yr = t1r - t3i;
+      yi = t1i + t3r;
+      out = ((yr * c3) + (yi * s3) + 0x4000) >> 15;
+      acc |= out ^ (out >> 31);
+      pA[3U * span] = (q15_t)out;
+      out = ((yi * c3) - (yr * s3) + 0x4000) >> 15;
+      acc |= out ^ (out >> 31);
+      pA[(3U * span) + 1U] = (q15_t)out;
+    }
+  }
+
+  return 32U - __CLZ((uint32_t)acc);
+}
+
+/**
+  @brief         Last radix-4 stage: butterflies without twiddle factors.
+  @param[in,out] pSrc     points to the complex block
+  @param[in]     fftLen   length of the FFT
+  @param[in]     lShift   left shift of the inputs
+  @param[in]     rShift   rounded right shift of the inputs
+ */
+static void arm_cfft_bfp_radix4_last_q15(
+        q15_t * pSrc,
+        uint32_t fftLen,
+        uint32_t lShift,
+        uint32_t rShift)
+{
+  const q31_t rnd = (q31_t)((1UL << rShift) >> 1U);
+  q15_t *pA = pSrc;
+  q31_t ar, ai, br, bi, cr, ci, dr, di;
+  q31_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+  uint32_t i;
+
+  for (i = 0U; i < fftLen; i += 4U)
+  {
+    ar = (((q31_t)pA[0] << lShift) + rnd) >> rShift;
+    ai = (((q31_t)pA[1] << lShift) + rnd) >> rShift;
+    br = (((q31_t)pA[2] << lShift) + rnd) >> rShift;
+    bi = (((q31_t)pA[3] << lShift) + rnd) >> rShift;
+    cr = (((q31_t)pA[4] << lShift) + rnd) >> rShift;
+    ci = (((q31_t)pA[5] << lShift) + rnd) >> rShift;
+    dr = (((q31_t)pA[6] << lShift) + rnd) >> rShift;
+    di = (((q31_t)pA[7] << lShift) + rnd) >> rShift;
+
+    t0r = ar + cr;
+    t0i = ai + ci;
+    t1r = ar - cr;
+    t1i = ai - ci;
+    t2r = br + dr;
+    t2i = bi + di;
+    t3r = br - dr;
+    t3i = bi - di;
+
+    /* Only 4 * 2^(ARM_CFFT_BFP_RADIX4_LAST_BITS_Q15 - 1) reaches 1 */
+    pA[0] = (q15_t)__SSAT(t0r + t2r, 16);
+    pA[1] = (q15_t)__SSAT(t0i + t2i, 16);
+    pA[2] = (q15_t)__SSAT(t0r - t2r, 16);
+    pA[3] = (q15_t)__SSAT(t0i - t2i, 16);
+    pA[4] = (q15_t)__SSAT(t1r + t3i, 16);
+    pA[5] = (q15_t)__SSAT(t1i - t3r, 16);
+    pA[6] = (q15_t)__SSAT(t1r - t3i, 16);
+    pA[7] = (q15_t)__SSAT(t1i + t3r, 16);
+
+    pA += 8;
+  }
+}
+
+/**
+  @addtogroup ComplexFFTQ15
+  @{
+ */
+
+/**
+  @brief         Processing function for the block floating-point Q15 complex FFT.
+  @param[in]     S               points to an instance of Q15 CFFT structure
+  @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place
+  @param[in]     ifftFlag        flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @param[in]     bitReverseFlag  flag that enables / disables bit reversal of output
+                   - value = 0: disables bit reversal of output
+                   - value = 1: enables bit reversal of output
+  @param[out]    pExponent       exponent of the result
+
+  @par           Scaling
+                   arm_cfft_q15() shifts the data right by 2 bits at every radix-4 stage, so the
+                   result is the transform divided by <code>fftLen</code> whatever the input
+                   amplitude. This function measures the magnitude of the block before every stage
+                   and only shifts it, right or left, by the amount needed to leave the headroom
+                   of the stage: a low amplitude input keeps its resolution.
+  @par
+                   The transform of the input is <code>p1[k] * 2^(*pExponent)</code>: the sum
+                   over the input samples for the forward transform, and the inverse transform
+                   including the division by <code>fftLen</code> for the inverse transform.
+                   The exponent of the same data processed by arm_cfft_q15() would be
+                   <code>log2(fftLen)</code> for the forward transform and 0 for the inverse
+                   transform.
+ */
+ARM_DSP_ATTRIBUTE void arm_cfft_bfp_q15(
+  const arm_cfft_instance_q15 * S,
+        q15_t * p1,
+        uint8_t ifftFlag,
+        uint8_t bitReverseFlag,
+        int16_t * pExponent)
+{
+  const uint32_t fftLen = S->fftLen;
+  const uint32_t log2Len = 31U - __CLZ(fftLen);
+  int32_t exponent = 0;
+  int32_t shift;
+  uint32_t bits;
+  uint32_t quarter;
+
+  /* The inverse transform is the conjugate of the transform of the conjugate */
+  if (ifftFlag == 1U)
+  {
+    arm_cfft_bfp_conj_q15(p1, fftLen);
+  }
+
+  bits = arm_cfft_bfp_bits_q15(p1, 2U * fftLen);
+
+  if ((log2Len & 1U) != 0U)
+  {
+    shift = (bits == 0U) ? 0 : ((int32_t)bits - ARM_CFFT_BFP_RADIX2_BITS_Q15);
+    bits = arm_cfft_bfp_radix2_q15(p1, fftLen, S->pTwiddle,
+                                   (shift < 0) ? (uint32_t)-shift : 0U,
+                                   (shift > 0) ? (uint32_t)shift : 0U);
+    exponent += shift;
+  }
+
+  for (quarter = (1U << (log2Len & ~1U)) / 4U; quarter > 1U; quarter >>= 2U)
+  {
+    shift = (bits == 0U) ? 0 : ((int32_t)bits - ARM_CFFT_BFP_RADIX4_BITS_Q15);
+    bits = arm_cfft_bfp_radix4_q15(p1, fftLen, quarter, S->pTwiddle,
+                                   (shift < 0) ? (uint32_t)-shift : 0U,
+                                   (shift > 0) ? (uint32_t)shift : 0U);
+    exponent += shift;
+  }
+
+  shift = (bits == 0U) ? 0 : ((int32_t)bits - ARM_CFFT_BFP_RADIX4_LAST_BITS_Q15);
+  arm_cfft_bfp_radix4_last_q15(p1, fftLen,
+                               (shift < 0) ? (uint32_t)-shift : 0U,
+                               (shift > 0) ? (uint32_t)shift : 0U);
+  exponent += shift;
+
+  if (ifftFlag == 1U)
+  {
+    arm_cfft_bfp_conj_q15(p1, fftLen);
+    exponent -= (int32_t)log2Len;
+  }
+
+  if (bitReverseFlag)
+  {
+    arm_bitreversal_16((uint16_t *)p1, S->bitRevLength, S->pBitRevTable);
+  }
+
+  *pExponent = (int16_t)exponent;
+}
+
+/**
+  @} end of ComplexFFTQ15 group
+ */
@@ -0,0 +1,373 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_init_dynamic_f32.c
+ * Description:  Initialization of the cfft f32 instance with tables generated at run time
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "arm_dynamic_tables.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup ComplexFFTF32
+  @{
+ */
+
+/**
+  @brief         Checks a length of the cfft f32 function.
+  @param[in]     fftLen  length of the FFT
+  @return        log2 of fftLen, or 0 if it is not a power of 2 from 16 to 4096
+ */
+static uint32_t arm_cfft_dynamic_log2_f32(
+  uint32_t fftLen)
+{
+  uint32_t log2Len;
+
+  for (log2Len = 4U; log2Len <= 12U; log2Len++)
+  {
+    if (fftLen == (1UL << log2Len))
+    {
+      return log2Len;
+    }
+  }
+
+  return 0U;
+}
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+/**
+  @brief         Length of the radix-4 stages: fftLen, or fftLen / 2 after the radix-4 by 2 stage.
+  @param[in]     log2Len  log2 of the FFT length
+  @return        length of the first radix-4 stage
+ */
+static uint32_t arm_cfft_dynamic_radix4_len_f32(
+  uint32_t log2Len)
+{
+  return ((log2Len & 1U) == 0U) ? (1UL << log2Len) : (1UL << (log2Len - 1U));
+}
+
+/**
+  @brief         Number of values of each reordered twiddle table.
+  @param[in]     log2Len  log2 of the FFT length
+  @return        number of float32_t values
+ */
+static uint32_t arm_cfft_dynamic_mve_len_f32(
+  uint32_t log2Len)
+{
+  uint32_t stageLen;
+  uint32_t numValues = 0U;
+
+  for (stageLen = arm_cfft_dynamic_radix4_len_f32(log2Len); stageLen >= 16U; stageLen >>= 2U)
+  {
+    numValues += stageLen / 2U;
+  }
+
+  return numValues;
+}
+
+/**
+  @brief         Bit reversal table length: one pair per index smaller than its bit reverse.
+  @param[in]     log2Len  log2 of the FFT length
+  @return        number of uint16_t values
+ */
+static uint32_t arm_cfft_dynamic_bitrev_len_f32(
+  uint32_t log2Len)
+{
+  /* Indexes equal to their bit reverse: the first half of the bits sets the others */
+  return (1UL << log2Len) - (1UL << ((log2Len + 1U) / 2U));
+}
+
+/**
+  @brief         Bit reversal swaps of the radix-4 FFT.
+  @param[in]     log2Len  log2 of the FFT length
+  @param[out]    pTable   points to the table of byte offsets of the complex values to swap
+ */
+static void arm_cfft_dynamic_bitrev_f32(
+  uint32_t log2Len,
+  uint16_t * pTable)
+{
+  const uint32_t fftLen = 1UL << log2Len;
+  uint32_t i;
+  uint32_t rev;
+  uint32_t bit;
+
+  for (i = 0U; i < fftLen; i++)
+  {
+    rev = 0U;
+    for (bit = 0U; bit < log2Len; bit++)
+    {
+      rev |= ((i >> bit) & 1U) << (log2Len - 1U - bit);
+    }
+
+    if (i < rev)
+    {
+      *pTable++ = (uint16_t)(i * 8U);
+      *pTable++ = (uint16_t)(rev * 8U);
+    }
+  }
+}
+
+/**
+  @brief         Twiddle factors of the radix-4 stages, reordered for the MVE butterflies.
+  @param[in]     log2Len  log2 of the FFT length
+  @param[in]     stride   power of the twiddle factors (1, 2 or 3)
+  @param[out]    pCoef    points to the twiddle factors of every stage
+  @param[out]    pOffset  points to the offset of every stage in pCoef, followed by 0
+ */
+static void arm_cfft_dynamic_mve_twiddle_f32(
+  uint32_t log2Len,
+  uint32_t stride,
+  float32_t * pCoef,
+  uint32_t * pOffset)
+{
+  const uint32_t radix4Len = arm_cfft_dynamic_radix4_len_f32(log2Len);
+  uint32_t stageLen;
+  uint32_t numValues = 0U;
+  uint32_t k;
+  float64_t angle;
+
+  for (stageLen = radix4Len; stageLen >= 16U; stageLen >>= 2U)
+  {
+    *pOffset++ = numValues;
+
+    /* W^(stride * k) of the stage, as index of the table of the first stage */
+    for (k = 0U; k < (stageLen / 4U); k++)
+    {
+      angle = arm_dynamic_tables_angle(stride * k * (radix4Len / stageLen), radix4Len);
+      pCoef[numValues++] = arm_dynamic_tables_mve_value_f32(cos(angle));
+      pCoef[numValues++] = arm_dynamic_tables_mve_value_f32(sin(angle));
+    }
+  }
+  *pOffset = 0U;
+}
+
+#else
+
+/**
+  @brief         Output position of the radix-8 FFT.
+  @param[in]     m        position of a value at the output of the butterflies
+  @param[in]     log2Len  log2 of the FFT length
+  @return        frequency of the value
+
+  @par           Details
+                   The first radix-2 or radix-4 stage splits the FFT in R interleaved FFTs
+                   of 8^s values, whose radix-8 stages give their output in digit-reversed
+                   order: the value at <code>m = b * 8^s + j</code> is the frequency
+                   <code>R * digitrev8(j) + b</code>.
+ */
+static uint32_t arm_cfft_dynamic_position_f32(
+  uint32_t m,
+  uint32_t log2Len)
+{
+  const uint32_t log2Radix8 = (log2Len / 3U) * 3U;
+  uint32_t j = m & ((1UL << log2Radix8) - 1U);
+  uint32_t rev = 0U;
+  uint32_t digit;
+
+  for (digit = 0U; digit < log2Radix8; digit += 3U)
+  {
+    rev = (rev << 3U) | (j & 7U);
+    j >>= 3U;
+  }
+
+  return (rev << (log2Len - log2Radix8)) + (m >> log2Radix8);
+}
+
+/**
+  @brief         Walks the permutation of the radix-8 FFT cycle by cycle.
+  @param[in]     log2Len  log2 of the FFT length
+  @param[out]    pTable   points to the table of byte offsets of the complex values to swap,
+                          or NULL to only count them
+  @return        number of uint16_t values of the table
+
+  @par           Details
+                   A cycle is visited from its smallest position <code>a</code>: swapping
+                   <code>a</code> with each following position of the cycle puts every value
+                   in place, so a cycle of c positions takes c - 1 swaps.
+ */
+static uint32_t arm_cfft_dynamic_bitrev_f32(
+  uint32_t log2Len,
+  uint16_t * pTable)
+{
+  const uint32_t fftLen = 1UL << log2Len;
+  uint32_t tableLen = 0U;
+  uint32_t a;
+  uint32_t m;
+
+  for (a = 0U; a < fftLen; a++)
+  {
+    /* Smallest position of its cycle */
+    m = arm_cfft_dynamic_position_f32(a, log2Len);
+    while (m > a)
+    {
+      m = arm_cfft_dynamic_position_f32(m, log2Len);
+    }
+
+    if (m == a)
+    {
+      for (m = arm_cfft_dynamic_position_f32(a, log2Len); m != a; m = arm_cfft_dynamic_position_f32(m, log2Len))
+      {
+        if (pTable != NULL)
+        {
+          pTable[tableLen] = (uint16_t)(a * 8U);
+          pTable[tableLen + 1U] = (uint16_t)(m * 8U);
+        }
+        tableLen += 2U;
+      }
+    }
+  }
+
+  return tableLen;
+}
+
+/**
+  @brief         Bit reversal table length.
+  @param[in]     log2Len  log2 of the FFT length
+  @return        number of uint16_t values
+ */
+static uint32_t arm_cfft_dynamic_bitrev_len_f32(
+  uint32_t log2Len)
+{
+  return arm_cfft_dynamic_bitrev_f32(log2Len, NULL);
+}
+
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @brief         Size of the buffer of the cfft f32 function with tables generated at run time.
+  @param[in]     fftLen  length of the FFT
+  @return        number of float32_t values of the <code>pBuffer</code> argument of
+                 arm_cfft_init_dynamic_f32(), or 0 if the length is not supported
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_cfft_dynamic_buffer_size_f32(
+  uint16_t fftLen)
+{
+  const uint32_t log2Len = arm_cfft_dynamic_log2_f32(fftLen);
+  uint32_t bufferSize;
+
+  if (log2Len == 0U)
+  {
+    return 0U;
+  }
+
+  /* Twiddle factors, then bit reversal table */
+  bufferSize = (2U * (uint32_t)fftLen) + ((arm_cfft_dynamic_bitrev_len_f32(log2Len) + 1U) / 2U);
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+  /* Reordered twiddle factors and stage offsets for the strides 1, 2 and 3 */
+  bufferSize += 3U * (arm_cfft_dynamic_mve_len_f32(log2Len) + (log2Len / 2U));
+#endif
+
+  return bufferSize;
+}
+
+/**
+  @brief         Initialization function for the cfft f32 function with tables generated at run time.
+  @param[in,out] S        points to an instance of the floating-point CFFT structure
+  @param[in]     fftLen   length of the FFT
+  @param[in]     pBuffer  points to the buffer of <code>arm_cfft_dynamic_buffer_size_f32(fftLen)</code>
+                          values receiving the tables
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not a supported length
+
+  @par           Details
+                   Same instance as arm_cfft_init_f32(), with the twiddle factors and the bit
+                   reversal table of the requested length computed in <code>pBuffer</code>
+                   (RAM, for example external or AXI SRAM) instead of pointing to the constant
+                   tables. An application that only uses this function does not link the tables
+                   of the other lengths.
+  @par
+                   The twiddle factors are bit identical to the constant tables: they are computed
+                   in double precision and rounded as in the table sources. The bit reversal table
+                   has the same length and gives the same permutation. The FFT results are then
+                   identical to those of arm_cfft_init_f32().
+  @par
+                   The buffer must stay allocated while the instance is used. Initialization
+                   computes one sine and one cosine in double precision per twiddle factor.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_cfft_init_dynamic_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pBuffer)
+{
+  const uint32_t log2Len = arm_cfft_dynamic_log2_f32(fftLen);
+  float32_t *pTwiddle = pBuffer;
+  float32_t *pNext;
+  float64_t angle;
+  uint32_t i;
+
+  if (log2Len == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  /* Twiddle factors W^i for i < fftLen, as twiddleCoef_<fftLen> */
+  for (i = 0U; i < fftLen; i++)
+  {
+    angle = arm_dynamic_tables_angle(i, fftLen);
+    pTwiddle[2U * i] = arm_dynamic_tables_value_f32(cos(angle));
+    pTwiddle[(2U * i) + 1U] = arm_dynamic_tables_value_f32(sin(angle));
+  }
+  pNext = &pTwiddle[2U * (uint32_t)fftLen];
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+  {
+    const uint32_t mveLen = arm_cfft_dynamic_mve_len_f32(log2Len);
+    const uint32_t numStages = log2Len / 2U;
+    uint32_t *pOffset = (uint32_t *)&pNext[3U * mveLen];
+
+    arm_cfft_dynamic_mve_twiddle_f32(log2Len, 1U, pNext, pOffset);
+    arm_cfft_dynamic_mve_twiddle_f32(log2Len, 2U, &pNext[mveLen], &pOffset[numStages]);
+    arm_cfft_dynamic_mve_twiddle_f32(log2Len, 3U, &pNext[2U * mveLen], &pOffset[2U * numStages]);
+
+    S->rearranged_twiddle_stride1 = pNext;
+    S->rearranged_twiddle_stride2 = &pNext[mveLen];
+    S->rearranged_twiddle_stride3 = &pNext[2U * mveLen];
+    S->rearranged_twiddle_tab_stride1_arr = pOffset;
+    S->rearranged_twiddle_tab_stride2_arr = &pOffset[numStages];
+    S->rearranged_twiddle_tab_stride3_arr = &pOffset[2U * numStages];
+
+    pNext = (float32_t *)&pOffset[3U * numStages];
+  }
+#endif
+
+  arm_cfft_dynamic_bitrev_f32(log2Len, (uint16_t *)pNext);
+
+  S->fftLen = fftLen;
+  S->pTwiddle = pTwiddle;
+  S->pBitRevTable = (const uint16_t *)pNext;
+  S->bitRevLength = (uint16_t)arm_cfft_dynamic_bitrev_len_f32(log2Len);
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of ComplexFFTF32 group
+ */
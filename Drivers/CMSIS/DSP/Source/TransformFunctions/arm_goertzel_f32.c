@@ -0,0 +1,204 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_f32.c
+ * Description:  Floating-point Goertzel bank
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point Goertzel bank.
+  @param[in]     S     points to an instance of the floating-point Goertzel bank structure
+  @param[in]     pSrc  points to the block of blockSize input samples
+  @param[out]    pDst  points to the output bins, numBins complex values {real, imag}
+
+  @par           Details
+                   The bins are independent of the previous blocks: for overlapping blocks,
+                   call the function on every block start.
+ */
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+ARM_DSP_ATTRIBUTE void arm_goertzel_f32(
+  const arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst)
+{
+  const uint32_t numBins = S->numBins;
+  const uint32_t blockSize = S->blockSize;
+  const float32_t *pCoeffs = S->pCoeffs;
+  f32x4_t vecLambda, vecSign;
+  f32x4_t vecS, vecD, vecT;
+  f32x4_t vecIn;
+  f32x4_t vecRe, vecIm;
+  mve_pred16_t p0;
+  float32_t re[4], im[4];
+  uint32_t bin;
+  uint32_t binCnt;
+  uint32_t sample;
+  uint32_t i;
+
+  /* 4 bins per vector, all the samples for every vector */
+  for (bin = 0U; bin < numBins; bin += 4U)
+  {
+    binCnt = ((numBins - bin) < 4U) ? (numBins - bin) : 4U;
+    p0 = vctp32q(binCnt);
+
+    vecLambda = vldrwq_z_f32(&pCoeffs[bin], p0);
+    vecSign = vldrwq_z_f32(&pCoeffs[numBins + bin], p0);
+    vecLambda = vmulq_f32(vecLambda, vecSign);
+    vecS = vdupq_n_f32(0.0f);
+    vecD = vdupq_n_f32(0.0f);
+
+    for (sample = 0U; sample < blockSize; sample++)
+    {
+      /* s = x + sign * (d + s - lambda * s), d = x + sign * (d - lambda * s) */
+      vecIn = vdupq_n_f32(pSrc[sample]);
+      vecT = vfmsq_f32(vfmaq_f32(vecIn, vecSign, vaddq_f32(vecD, vecS)), vecLambda, vecS);
+      vecD = vfmsq_f32(vfmaq_f32(vecIn, vecSign, vecD), vecLambda, vecS);
+      vecS = vecT;
+    }
+
+    /* X = P * s[N-1] + Q * d[N-1] */
+    vecRe = vmulq_f32(vldrwq_z_f32(&pCoeffs[(2U * numBins) + bin], p0), vecS);
+    vecRe = vfmaq_f32(vecRe, vldrwq_z_f32(&pCoeffs[(4U * numBins) + bin], p0), vecD);
+    vecIm = vmulq_f32(vldrwq_z_f32(&pCoeffs[(3U * numBins) + bin], p0), vecS);
+    vecIm = vfmaq_f32(vecIm, vldrwq_z_f32(&pCoeffs[(5U * numBins) + bin], p0), vecD);
+
+    vst1q_f32(re, vecRe);
+    vst1q_f32(im, vecIm);
+    for (i = 0U; i < binCnt; i++)
+    {
+      *pDst++ = re[i];
+      *pDst++ = im[i];
+    }
+  }
+}
+
+#else
+
+ARM_DSP_ATTRIBUTE void arm_goertzel_f32(
+  const arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst)
+{
+  const uint32_t numBins = S->numBins;
+  const uint32_t blockSize = S->blockSize;
+  const float32_t *pCoeffs = S->pCoeffs;
+  float32_t l0, l1, l2, l3;                      /* sign * lambda */
+  float32_t g0, g1, g2, g3;                      /* sign */
+  float32_t s0, s1, s2, s3;                      /* s[n] */
+  float32_t d0, d1, d2, d3;                      /* s[n] - sign * s[n-1] */
+  float32_t m0, m1, m2, m3;
+  float32_t t0, t1, t2, t3;
+  float32_t in;
+  float32_t state[8];
+  uint32_t bin;
+  uint32_t binCnt;
+  uint32_t sample;
+  uint32_t i;
+
+  /* 4 bins at a time, all the samples for every group */
+  for (bin = 0U; bin < numBins; bin += 4U)
+  {
+    binCnt = ((numBins - bin) < 4U) ? (numBins - bin) : 4U;
+
+    /* Missing bins of the last group run with null coefficients */
+    l0 = pCoeffs[bin];
+    l1 = (binCnt > 1U) ? pCoeffs[bin + 1U] : 0.0f;
+    l2 = (binCnt > 2U) ? pCoeffs[bin + 2U] : 0.0f;
+    l3 = (binCnt > 3U) ? pCoeffs[bin + 3U] : 0.0f;
+    g0 = pCoeffs[numBins + bin];
+    g1 = (binCnt > 1U) ? pCoeffs[numBins + bin + 1U] : 0.0f;
+    g2 = (binCnt > 2U) ? pCoeffs[numBins + bin + 2U] : 0.0f;
+    g3 = (binCnt > 3U) ? pCoeffs[numBins + bin + 3U] : 0.0f;
+
+    l0 *= g0;
+    l1 *= g1;
+    l2 *= g2;
+    l3 *= g3;
+
+    s0 = s1 = s2 = s3 = 0.0f;
+    d0 = d1 = d2 = d3 = 0.0f;
+
+    for (sample = 0U; sample < blockSize; sample++)
+    {
+      in = pSrc[sample];
+
+      /* Both updates from the previous states, to shorten the dependency chain:
+         s = x + sign * (d + s - lambda * s), d = x + sign * (d - lambda * s) */
+      m0 = l0 * s0;
+      m1 = l1 * s1;
+      m2 = l2 * s2;
+      m3 = l3 * s3;
+
+      t0 = (in + (g0 * (d0 + s0))) - m0;
+      t1 = (in + (g1 * (d1 + s1))) - m1;
+      t2 = (in + (g2 * (d2 + s2))) - m2;
+      t3 = (in + (g3 * (d3 + s3))) - m3;
+
+      d0 = (in + (g0 * d0)) - m0;
+      d1 = (in + (g1 * d1)) - m1;
+      d2 = (in + (g2 * d2)) - m2;
+      d3 = (in + (g3 * d3)) - m3;
+
+      s0 = t0;
+      s1 = t1;
+      s2 = t2;
+      s3 = t3;
+    }
+
+    state[0] = s0;
+    state[1] = s1;
+    state[2] = s2;
+    state[3] = s3;
+    state[4] = d0;
+    state[5] = d1;
+    state[6] = d2;
+    state[7] = d3;
+
+    /* X = P * s[N-1] + Q * d[N-1] */
+    for (i = 0U; i < binCnt; i++)
+    {
+      *pDst++ = (pCoeffs[(2U * numBins) + bin + i] * state[i]) + (pCoeffs[(4U * numBins) + bin + i] * state[4U + i]);
+      *pDst++ = (pCoeffs[(3U * numBins) + bin + i] * state[i]) + (pCoeffs[(5U * numBins) + bin + i] * state[4U + i]);
+    }
+  }
+}
+
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_f32.c
+ * Description:  Floating-point Goertzel bank initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+#include "arm_dynamic_tables.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup Goertzel Goertzel Bank and Sliding DFT
+
+  A few bins of the DFT, computed directly from the input: cheaper than a full
+  FFT when only some frequencies are needed, as for tone detection or the
+  monitoring of known vibration frequencies.
+
+  @par           Goertzel bank
+                   arm_goertzel_f32() and arm_goertzel_q31() compute the bins
+  <pre>
+      X(f) = sum(n = 0 .. blockSize-1) x[n] * exp(-j * 2 * pi * f * n / blockSize)
+  </pre>
+                   for <code>numBins</code> frequencies <code>f</code> given in cycles per block.
+                   The frequencies need not be integers: the block size is not restricted to a power
+                   of 2 and a bin can be centered on the expected tone.
+                   Every bin runs the Goertzel recursion <code>s[n] = x[n] + 2 * cos(w) * s[n-1] - s[n-2]</code>,
+                   <code>w = 2 * pi * f / blockSize</code>, in the Reinsch form: a rounded <code>cos(w)</code>
+                   moves the frequency of the plain recursion by up to <code>eps / sin(w)</code>, which ruins
+                   the bins close to 0 and to the Nyquist frequency of long blocks. The Reinsch form runs on
+                   <code>s[n]</code> and on <code>d[n] = s[n] - sign * s[n-1]</code>
+  <pre>
+      d[n] = x[n] + sign * (d[n-1] - lambda * s[n-1])
+      s[n] = d[n] + sign * s[n-1]
+  </pre>
+                   where <code>sign = 1</code> and <code>lambda = 4 * sin(w/2)^2</code> when
+                   <code>cos(w) >= 0</code>, <code>sign = -1</code> and <code>lambda = 4 * cos(w/2)^2</code>
+                   otherwise: <code>lambda</code> is small, with a small absolute error, where the precision
+                   matters. The bin is <code>X(f) = P * s[N-1] + Q * d[N-1]</code>, where the complex
+                   <code>P</code> and <code>Q</code> are computed by the initialization functions.
+                   The bins are processed 4 at a time in one pass over the input, one bin per vector
+                   lane with Helium, so the cost is about <code>numBins * blockSize</code> recursion steps.
+
+  @par           Sliding DFT
+                   arm_sliding_dft_f32() and arm_sliding_dft_q31() update integer bins
+                   <code>k < fftLen</code> of the DFT of the last <code>fftLen</code> samples for
+                   every new sample, with two complex multiply-accumulates per bin and per sample.
+                   The modulated form is used: the state of a bin is
+                   <code>y += (x[n] - x[n-fftLen]) * exp(-j * 2 * pi * k * n / fftLen)</code>
+                   and the bin is demodulated when it is read. Without a feedback coefficient the
+                   recursion is stable, but its rounding errors would add up for ever: in Q31 the term
+                   added for a sample is subtracted exactly <code>fftLen</code> samples later, and in
+                   floating-point the state is replaced every <code>fftLen</code> samples by the DFT of
+                   the window accumulated in parallel. The bins do not drift on long streams.
+
+  @par           Choice
+                   A real FFT of length N costs in the order of <code>2.5 * N * log2(N)</code> operations
+                   per block, the Goertzel bank about <code>3 * numBins * N</code>: the bank is faster
+                   for a few bins only, up to about <code>numBins = log2(N) / 2</code>. The sliding DFT
+                   is the cheaper option when the bins are needed for every sample or every few samples.
+                   The example arm_goertzel_example measures the crossover.
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point Goertzel bank.
+  @param[out]    S          points to an instance of the floating-point Goertzel bank structure
+  @param[in]     numBins    number of frequency bins
+  @param[in]     pBins      points to the frequencies in cycles per block, numBins values
+  @param[in]     blockSize  number of samples of a block
+  @param[out]    pCoeffs    points to the coefficients, 6 * numBins values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numBins</code> or <code>blockSize</code> is 0
+
+  @par           Details
+                   The coefficients are computed in double precision and stored by kind,
+                   <code>numBins</code> values each: <code>lambda</code>, the sign, then the real and
+                   imaginary parts of <code>P</code> and <code>Q</code>.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_goertzel_init_f32(
+        arm_goertzel_instance_f32 * S,
+        uint16_t numBins,
+  const float32_t * pBins,
+        uint32_t blockSize,
+        float32_t * pCoeffs)
+{
+  float64_t w;
+  float64_t sign;
+  float64_t lambda;
+  float64_t ar, ai, br, bi;
+  uint32_t i;
+
+  if ((numBins == 0U) || (blockSize == 0U))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  for (i = 0U; i < numBins; i++)
+  {
+    w = (ARM_DYNAMIC_TABLES_2PI * (float64_t)pBins[i]) / (float64_t)blockSize;
+
+    if (cos(w) >= 0.0)
+    {
+      sign = 1.0;
+      lambda = 4.0 * sin(w / 2.0) * sin(w / 2.0);
+    }
+    else
+    {
+      sign = -1.0;
+      lambda = 4.0 * cos(w / 2.0) * cos(w / 2.0);
+    }
+
+    /* A = exp(-j * w * (N-1)), B = -exp(-j * w * N), P = A + sign * B, Q = -sign * B */
+    ar = cos(w * (float64_t)(blockSize - 1U));
+    ai = -sin(w * (float64_t)(blockSize - 1U));
+    br = -cos(w * (float64_t)blockSize);
+    bi = sin(w * (float64_t)blockSize);
+
+    pCoeffs[i] = (float32_t)lambda;
+    pCoeffs[numBins + i] = (float32_t)sign;
+    pCoeffs[(2U * numBins) + i] = (float32_t)(ar + (sign * br));
+    pCoeffs[(3U * numBins) + i] = (float32_t)(ai + (sign * bi));
+    pCoeffs[(4U * numBins) + i] = (float32_t)(-sign * br);
+    pCoeffs[(5U * numBins) + i] = (float32_t)(-sign * bi);
+  }
+
+  S->numBins = numBins;
+  S->blockSize = blockSize;
+  S->pCoeffs = pCoeffs;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_q31.c
+ * Description:  Q31 Goertzel bank initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+#include "arm_dynamic_tables.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Conversion of a coefficient computed in double precision.
+  @param[in]     x  value in [-1, 1]
+  @return        x in Q31, rounded and saturated
+ */
+static q31_t arm_goertzel_coef_q31(
+  float64_t x)
+{
+  float64_t y = round(x * 2147483648.0);
+
+  y = (y > 2147483647.0) ? 2147483647.0 : y;
+  y = (y < -2147483648.0) ? -2147483648.0 : y;
+
+  return (q31_t)y;
+}
+
+/**
+  @brief         Initialization function for the Q31 Goertzel bank.
+  @param[out]    S          points to an instance of the Q31 Goertzel bank structure
+  @param[in]     numBins    number of frequency bins
+  @param[in]     pBins      points to the frequencies in cycles per block, numBins values
+  @param[in]     blockSize  number of samples of a block
+  @param[out]    pCoeffs    points to the coefficients, 7 * numBins values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numBins</code> is 0 or <code>blockSize</code>
+                                                    is not in [2, ARM_GOERTZEL_MAX_BLOCKSIZE_Q31]
+
+  @par           Details
+                   The Q31 bank runs the same Reinsch form of the recursion as the floating-point bank,
+                   with <code>lambda</code> stored as a normalized mantissa and a shift to keep its
+                   relative precision.
+  @par
+                   The coefficients are stored by kind, <code>numBins</code> values each: the mantissa and the
+                   shift of <code>lambda</code>, the sign, then the real and imaginary parts of
+                   <code>P / 2</code> and <code>Q / 2</code>, where <code>X = P * s[N-1] + Q * d[N-1]</code>.
+  @par
+                   The bins are returned scaled by <code>2^-postShift</code>, where
+                   <code>postShift = ceil(log2(blockSize))</code>, so that they cannot overflow.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_goertzel_init_q31(
+        arm_goertzel_instance_q31 * S,
+        uint16_t numBins,
+  const float32_t * pBins,
+        uint32_t blockSize,
+        q31_t * pCoeffs)
+{
+  float64_t w;
+  float64_t lambda;
+  float64_t mant;
+  float64_t sign;
+  float64_t ar, ai, br, bi;
+  int exp2;
+  int32_t shift;
+  uint32_t i;
+
+  if ((numBins == 0U) || (blockSize < 2U) || (blockSize > ARM_GOERTZEL_MAX_BLOCKSIZE_Q31))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  for (i = 0U; i < numBins; i++)
+  {
+    w = (ARM_DYNAMIC_TABLES_2PI * (float64_t)pBins[i]) / (float64_t)blockSize;
+
+    if (cos(w) >= 0.0)
+    {
+      sign = 1.0;
+      lambda = 4.0 * sin(w / 2.0) * sin(w / 2.0);
+    }
+    else
+    {
+      sign = -1.0;
+      lambda = 4.0 * cos(w / 2.0) * cos(w / 2.0);
+    }
+
+    /* lambda = mant * 2^(2 - shift), mant in [0.5, 1) */
+    mant = frexp(lambda, &exp2);
+    shift = 2 - (int32_t)exp2;
+    if ((lambda == 0.0) || (shift > 63))
+    {
+      mant = 0.0;
+      shift = 0;
+    }
+    shift = (shift < 0) ? 0 : shift;
+
+    /* A = exp(-j * w * (N-1)), B = -exp(-j * w * N), P = A + sign * B, Q = -sign * B */
+    ar = cos(w * (float64_t)(blockSize - 1U));
+    ai = -sin(w * (float64_t)(blockSize - 1U));
+    br = -cos(w * (float64_t)blockSize);
+    bi = sin(w * (float64_t)blockSize);
+
+    pCoeffs[i] = arm_goertzel_coef_q31(mant);
+    pCoeffs[numBins + i] = shift;
+    pCoeffs[(2U * numBins) + i] = (q31_t)sign;
+    pCoeffs[(3U * numBins) + i] = arm_goertzel_coef_q31((ar + (sign * br)) / 2.0);
+    pCoeffs[(4U * numBins) + i] = arm_goertzel_coef_q31((ai + (sign * bi)) / 2.0);
+    pCoeffs[(5U * numBins) + i] = arm_goertzel_coef_q31((-sign * br) / 2.0);
+    pCoeffs[(6U * numBins) + i] = arm_goertzel_coef_q31((-sign * bi) / 2.0);
+  }
+
+  S->numBins = numBins;
+  S->blockSize = blockSize;
+  S->postShift = (uint8_t)(32U - __CLZ(blockSize - 1U));
+  S->pCoeffs = pCoeffs;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of Goertzel group
+ */
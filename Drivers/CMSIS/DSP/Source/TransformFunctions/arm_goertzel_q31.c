@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q31.c
+ * Description:  Q31 Goertzel bank
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 Goertzel bank.
+  @param[in]     S     points to an instance of the Q31 Goertzel bank structure
+  @param[in]     pSrc  points to the block of blockSize input samples
+  @param[out]    pDst  points to the output bins, numBins complex values {real, imag}
+
+  @par           Scaling and Overflow Behavior
+                   The bins are returned in Q31 scaled by <code>2^-postShift</code>, where
+                   <code>postShift = ceil(log2(blockSize))</code> is set by arm_goertzel_init_q31().
+                   The states are kept in 64 bits and cannot overflow.
+ */
+ARM_DSP_ATTRIBUTE void arm_goertzel_q31(
+  const arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst)
+{
+  const uint32_t numBins = S->numBins;
+  const uint32_t blockSize = S->blockSize;
+  const uint32_t postShift = S->postShift;
+  const q31_t *pCoeffs = S->pCoeffs;
+  const q31_t *pIn;
+  q63_t s;                                       /* s[n] */
+  q63_t d;                                       /* s[n] - sign * s[n-1] */
+  q63_t acc;
+  q31_t mant;
+  int32_t shift;
+  uint32_t bin;
+  uint32_t sample;
+
+  for (bin = 0U; bin < numBins; bin++)
+  {
+    mant = pCoeffs[bin];
+    shift = pCoeffs[numBins + bin];
+    s = 0;
+    d = 0;
+    pIn = pSrc;
+
+    if (pCoeffs[(2U * numBins) + bin] > 0)
+    {
+      for (sample = 0U; sample < blockSize; sample++)
+      {
+        d = (d + (q63_t)*pIn++) - ((mult32x64(s, mant) << 3) >> shift);
+        s = s + d;
+      }
+    }
+    else
+    {
+      for (sample = 0U; sample < blockSize; sample++)
+      {
+        d = ((q63_t)*pIn++ - d) + ((mult32x64(s, mant) << 3) >> shift);
+        s = d - s;
+      }
+    }
+
+    /* X / 4 = (P / 2) * s / 2 + (Q / 2) * d / 2 */
+    acc = mult32x64(s, pCoeffs[(3U * numBins) + bin]) + mult32x64(d, pCoeffs[(5U * numBins) + bin]);
+    *pDst++ = clip_q63_to_q31((acc << 2) >> postShift);
+    acc = mult32x64(s, pCoeffs[(4U * numBins) + bin]) + mult32x64(d, pCoeffs[(6U * numBins) + bin]);
+    *pDst++ = clip_q63_to_q31((acc << 2) >> postShift);
+  }
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_bfp_q31.c
+ * Description:  Block floating-point Q31 real FFT
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/statistics_functions.h"
+
+/* Significant bits of the magnitudes at the input of the split stage */
+#define ARM_RFFT_BFP_SPLIT_BITS_Q31  30
+
+ARM_DSP_ATTRIBUTE void arm_split_rfft_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+  const q31_t * pATable,
+  const q31_t * pBTable,
+        q31_t * pDst,
+        uint32_t modifier);
+
+ARM_DSP_ATTRIBUTE void arm_split_rifft_q31(
+        q31_t * pSrc,
+        uint32_t fftLen,
+  const q31_t * pATable,
+  const q31_t * pBTable,
+        q31_t * pDst,
+        uint32_t modifier);
+
+/**
+  @brief         Normalizes a block before the split stage.
+  @param[in,out] pSrc       points to the block
+  @param[in]     blockSize  number of values
+  @return        right shift applied to the block (negative for a left shift)
+ */
+static int32_t arm_rfft_bfp_normalize_q31(
+  q31_t * pSrc,
+  uint32_t blockSize)
+{
+  q31_t absMax;
+  int32_t shift;
+
+  arm_absmax_no_idx_q31(pSrc, blockSize, &absMax);
+  if (absMax == 0)
+  {
+    return 0;
+  }
+
+  shift = (int32_t)(32U - __CLZ((uint32_t)absMax)) - ARM_RFFT_BFP_SPLIT_BITS_Q31;
+  if (shift != 0)
+  {
+    arm_shift_q31(pSrc, (int8_t)-shift, pSrc, blockSize);
+  }
+
+  return shift;
+}
+
+/**
+  @addtogroup RealFFTQ31
+  @{
+ */
+
+/**
+  @brief         Processing function for the block floating-point Q31 RFFT/RIFFT.
+  @param[in]     S          points to an instance of the Q31 RFFT/RIFFT structure
+  @param[in]     pSrc       points to input buffer (Source buffer is modified by this function.)
+  @param[out]    pDst       points to output buffer
+  @param[out]    pExponent  exponent of the result
+
+  @par           Scaling
+                   Same buffers and output layout as arm_rfft_q31(), with the complex FFT computed
+                   by arm_cfft_bfp_q31(): the data is only shifted when a stage needs headroom.
+                   The transform of the input is <code>pDst[k] * 2^(*pExponent)</code>: the sum
+                   over the input samples for the RFFT, and the inverse transform including the
+                   division by <code>fftLenReal</code> for the RIFFT.
+  @par
+                   The exponent of the RFFT of the same data computed by arm_rfft_q31() would be
+                   <code>log2(fftLenReal)</code>.
+ */
+ARM_DSP_ATTRIBUTE void arm_rfft_bfp_q31(
+  const arm_rfft_instance_q31 * S,
+        q31_t * pSrc,
+        q31_t * pDst,
+        int16_t * pExponent)
+{
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+  const arm_cfft_instance_q31 *S_CFFT = &(S->cfftInst);
+#else
+  const arm_cfft_instance_q31 *S_CFFT = S->pCfft;
+#endif
+  const uint32_t L2 = S->fftLenReal >> 1U;
+  int32_t exponent;
+  int16_t cfftExponent;
+
+  if (S->ifftFlagR == 1U)
+  {
+    /* Spectrum up to the Nyquist frequency, halved by the split stage */
+    exponent = arm_rfft_bfp_normalize_q31(pSrc, S->fftLenReal + 2U) + 1;
+    arm_split_rifft_q31(pSrc, L2, S->pTwiddleAReal, S->pTwiddleBReal, pDst, S->twidCoefRModifier);
+
+    arm_cfft_bfp_q31(S_CFFT, pDst, S->ifftFlagR, S->bitReverseFlagR, &cfftExponent);
+    exponent += (int32_t)cfftExponent;
+  }
+  else
+  {
+    arm_cfft_bfp_q31(S_CFFT, pSrc, S->ifftFlagR, S->bitReverseFlagR, &cfftExponent);
+
+    /* Halved by the split stage */
+    exponent = (int32_t)cfftExponent + arm_rfft_bfp_normalize_q31(pSrc, S->fftLenReal) + 1;
+    arm_split_rfft_q31(pSrc, L2, S->pTwiddleAReal, S->pTwiddleBReal, pDst, S->twidCoefRModifier);
+  }
+
+  *pExponent = (int16_t)exponent;
+}
+
+/**
+  @} end of RealFFTQ31 group
+ */
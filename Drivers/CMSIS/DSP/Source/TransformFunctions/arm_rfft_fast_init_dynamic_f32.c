@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_init_dynamic_f32.c
+ * Description:  Initialization of the rfft fast f32 instance with tables generated at run time
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "arm_dynamic_tables.h"
+
+/**
+  @ingroup RealFFT
+ */
+
+/**
+  @addtogroup RealFFTF32
+  @{
+ */
+
+/**
+  @brief         Size of the buffer of the rfft fast f32 function with tables generated at run time.
+  @param[in]     fftLen  length of the real FFT
+  @return        number of float32_t values of the <code>pBuffer</code> argument of
+                 arm_rfft_fast_init_dynamic_f32(), or 0 if the length is not supported
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_rfft_fast_dynamic_buffer_size_f32(
+  uint16_t fftLen)
+{
+  uint32_t cfftSize = arm_cfft_dynamic_buffer_size_f32(fftLen / 2U);
+
+  /* Tables of the complex FFT of half length, then real stage twiddle factors */
+  return (cfftSize == 0U) ? 0U : (cfftSize + (uint32_t)fftLen);
+}
+
+/**
+  @brief         Initialization function for the rfft fast f32 function with tables generated at run time.
+  @param[in,out] S        points to an arm_rfft_fast_instance_f32 structure
+  @param[in]     fftLen   length of the real FFT
+  @param[in]     pBuffer  points to the buffer of <code>arm_rfft_fast_dynamic_buffer_size_f32(fftLen)</code>
+                          values receiving the tables
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not a power of 2 from 32 to 4096
+
+  @par           Details
+                   Same instance as arm_rfft_fast_init_f32(), with the tables of the requested length
+                   computed in <code>pBuffer</code> by arm_cfft_init_dynamic_f32() and bit identical
+                   to the constant tables. The buffer must stay allocated while the instance is used.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_rfft_fast_init_dynamic_f32(
+  arm_rfft_fast_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pBuffer)
+{
+  uint32_t cfftSize;
+  float32_t *pTwiddle;
+  float64_t angle;
+  uint32_t i;
+  arm_status status;
+
+  if (S == NULL)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  cfftSize = arm_cfft_dynamic_buffer_size_f32(fftLen / 2U);
+  if ((cfftSize == 0U) || ((fftLen & 1U) != 0U))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  status = arm_cfft_init_dynamic_f32(&S->Sint, fftLen / 2U, pBuffer);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  /* Real stage twiddle factors, as twiddleCoef_rfft_<fftLen>: sine first */
+  pTwiddle = &pBuffer[cfftSize];
+  for (i = 0U; i < ((uint32_t)fftLen / 2U); i++)
+  {
+    angle = arm_dynamic_tables_angle(i, fftLen);
+    pTwiddle[2U * i] = arm_dynamic_tables_value_f32(sin(angle));
+    pTwiddle[(2U * i) + 1U] = arm_dynamic_tables_value_f32(cos(angle));
+  }
+
+  S->fftLenRFFT = fftLen;
+  S->pTwiddleRFFT = pTwiddle;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of RealFFTF32 group
+ */
@@ -0,0 +1,267 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_dft_f32.c
+ * Description:  Floating-point sliding DFT
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+#include "arm_helium_utils.h"
+#endif
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+
+/**
+  @brief         Accumulates a run of samples in one bin.
+  @param[in]     S        points to an instance of the floating-point sliding DFT structure
+  @param[in]     pSrc     points to the new samples x[n]
+  @param[in]     pDiff    points to the differences x[n] - x[n-fftLen]
+  @param[in]     blkCnt   number of samples
+  @param[in]     bin      bin index
+  @param[in]     index    table index of the first sample, (bin * n) modulo fftLen
+  @param[in,out] pState   points to the state of the bin: the modulated bin {real, imag},
+                          then the sum {real, imag} of the samples since the start of the window buffer
+ */
+static void arm_sliding_dft_bin_f32(
+  const arm_sliding_dft_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pDiff,
+        uint32_t blkCnt,
+        uint32_t bin,
+        uint32_t index,
+        float32_t * pState)
+{
+  const uint32_t fftLen = S->fftLen;
+  const uint32_t step = (4U * bin) % fftLen;
+  uint32_t offsets[4];
+  uint32x4_t vecIdx;
+  f32x4_t vecIn, vecDiff;
+  f32x4_t vecCos, vecSin;
+  f32x4_t vecRe = vdupq_n_f32(0.0f);
+  f32x4_t vecIm = vdupq_n_f32(0.0f);
+  f32x4_t vecSumRe = vdupq_n_f32(0.0f);
+  f32x4_t vecSumIm = vdupq_n_f32(0.0f);
+  mve_pred16_t p0;
+  uint32_t i;
+
+  /* Table indexes of 4 consecutive samples */
+  for (i = 0U; i < 4U; i++)
+  {
+    offsets[i] = index;
+    index += bin;
+    index = (index >= fftLen) ? (index - fftLen) : index;
+  }
+  vecIdx = vld1q_u32(offsets);
+
+  while (blkCnt > 0U)
+  {
+    /* Missing samples of the last vector are read as 0 */
+    p0 = vctp32q(blkCnt);
+    vecIn = vldrwq_z_f32(pSrc, p0);
+    vecDiff = vldrwq_z_f32(pDiff, p0);
+    vecCos = vldrwq_gather_shifted_offset_f32(S->pCos, vecIdx);
+    vecSin = vldrwq_gather_shifted_offset_f32(S->pSin, vecIdx);
+
+    vecRe = vfmaq_f32(vecRe, vecDiff, vecCos);
+    vecIm = vfmsq_f32(vecIm, vecDiff, vecSin);
+    vecSumRe = vfmaq_f32(vecSumRe, vecIn, vecCos);
+    vecSumIm = vfmsq_f32(vecSumIm, vecIn, vecSin);
+
+    vecIdx = vaddq_n_u32(vecIdx, step);
+    vecIdx = vpselq_u32(vsubq_n_u32(vecIdx, fftLen), vecIdx, vcmpcsq_n_u32(vecIdx, fftLen));
+
+    pSrc += 4;
+    pDiff += 4;
+    blkCnt = (blkCnt > 4U) ? (blkCnt - 4U) : 0U;
+  }
+
+  pState[0] += vecAddAcrossF32Mve(vecRe);
+  pState[1] += vecAddAcrossF32Mve(vecIm);
+  pState[2] += vecAddAcrossF32Mve(vecSumRe);
+  pState[3] += vecAddAcrossF32Mve(vecSumIm);
+}
+
+#else
+
+/**
+  @brief         Accumulates a run of samples in one bin.
+  @param[in]     S        points to an instance of the floating-point sliding DFT structure
+  @param[in]     pSrc     points to the new samples x[n]
+  @param[in]     pDiff    points to the differences x[n] - x[n-fftLen]
+  @param[in]     blkCnt   number of samples
+  @param[in]     bin      bin index
+  @param[in]     index    table index of the first sample, (bin * n) modulo fftLen
+  @param[in,out] pState   points to the state of the bin: the modulated bin {real, imag},
+                          then the sum {real, imag} of the samples since the start of the window buffer
+ */
+static void arm_sliding_dft_bin_f32(
+  const arm_sliding_dft_instance_f32 * S,
+  const float32_t * pSrc,
+  const float32_t * pDiff,
+        uint32_t blkCnt,
+        uint32_t bin,
+        uint32_t index,
+        float32_t * pState)
+{
+  const uint32_t fftLen = S->fftLen;
+  const float32_t *pCos = S->pCos;
+  const float32_t *pSin = S->pSin;
+  float32_t re = pState[0];
+  float32_t im = pState[1];
+  float32_t sumRe = pState[2];
+  float32_t sumIm = pState[3];
+  float32_t in;
+  float32_t diff;
+
+  while (blkCnt > 0U)
+  {
+    /* y += (x[n] - x[n-fftLen]) * exp(-j * 2 * pi * bin * n / fftLen) */
+    in = *pSrc++;
+    diff = *pDiff++;
+    re += diff * pCos[index];
+    im -= diff * pSin[index];
+    sumRe += in * pCos[index];
+    sumIm -= in * pSin[index];
+
+    index += bin;
+    index = (index >= fftLen) ? (index - fftLen) : index;
+
+    blkCnt--;
+  }
+
+  pState[0] = re;
+  pState[1] = im;
+  pState[2] = sumRe;
+  pState[3] = sumIm;
+}
+
+#endif /* defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE) */
+
+/**
+  @brief         Processing function for the floating-point sliding DFT.
+  @param[in,out] S          points to an instance of the floating-point sliding DFT structure
+  @param[in]     pSrc       points to the new input samples
+  @param[in]     blockSize  number of new input samples
+  @param[out]    pDst       points to the output bins, numBins complex values {real, imag}
+
+  @par           Details
+                   The output bins are the DFT of the last <code>fftLen</code> samples, oldest sample first:
+                   the same values as arm_rfft_fast_f32() on these samples. Any number of samples can be
+                   processed per call: with <code>blockSize = 1</code> the bins are updated for every sample.
+                   The cost is two complex multiply-accumulates per bin and per sample, plus one complex
+                   multiply per bin and per call.
+  @par
+                   The rounding errors of the recursive update would add up for ever in floating-point.
+                   The samples are also summed since the start of the window buffer, and this sum,
+                   that is the DFT of the whole window, replaces the recursive state every
+                   <code>fftLen</code> samples: the error does not grow with the length of the stream.
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_dft_f32(
+        arm_sliding_dft_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pDst)
+{
+  const uint32_t fftLen = S->fftLen;
+  const uint32_t numBins = S->numBins;
+  const uint16_t *pBins = S->pBins;
+  float32_t *pState = S->pState;
+  float32_t *pWindow = S->pWindow;
+  uint32_t pos = S->writeIndex;
+  uint32_t blkCnt;
+  uint32_t bin;
+  uint32_t index;
+  uint32_t i;
+  float32_t re;
+  float32_t im;
+
+  while (blockSize > 0U)
+  {
+    /* Run of samples up to the end of the window buffer */
+    blkCnt = fftLen - pos;
+    blkCnt = (blkCnt > blockSize) ? blockSize : blkCnt;
+
+    /* Differences with the samples leaving the window, computed in place */
+    for (i = 0U; i < blkCnt; i++)
+    {
+      pWindow[pos + i] = pSrc[i] - pWindow[pos + i];
+    }
+
+    for (bin = 0U; bin < numBins; bin++)
+    {
+      index = ((uint32_t)pBins[bin] * pos) % fftLen;
+      arm_sliding_dft_bin_f32(S, pSrc, &pWindow[pos], blkCnt, pBins[bin], index, &pState[4U * bin]);
+    }
+
+    for (i = 0U; i < blkCnt; i++)
+    {
+      pWindow[pos + i] = pSrc[i];
+    }
+
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+    pos += blkCnt;
+    if (pos == fftLen)
+    {
+      /* Recursive states replaced by the sums over the whole window */
+      for (bin = 0U; bin < numBins; bin++)
+      {
+        pState[4U * bin] = pState[(4U * bin) + 2U];
+        pState[(4U * bin) + 1U] = pState[(4U * bin) + 3U];
+        pState[(4U * bin) + 2U] = 0.0f;
+        pState[(4U * bin) + 3U] = 0.0f;
+      }
+      pos = 0U;
+    }
+  }
+
+  S->writeIndex = (uint16_t)pos;
+
+  /* X = exp(j * 2 * pi * bin * (n+1) / fftLen) * y */
+  for (bin = 0U; bin < numBins; bin++)
+  {
+    index = ((uint32_t)pBins[bin] * pos) % fftLen;
+    re = pState[4U * bin];
+    im = pState[(4U * bin) + 1U];
+
+    *pDst++ = (S->pCos[index] * re) - (S->pSin[index] * im);
+    *pDst++ = (S->pCos[index] * im) + (S->pSin[index] * re);
+  }
+}
+
+/**
+  @} end of Goertzel group
+ */
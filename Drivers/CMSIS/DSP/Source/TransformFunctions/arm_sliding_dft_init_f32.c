@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_dft_init_f32.c
+ * Description:  Floating-point sliding DFT initialization function
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+#include "arm_dynamic_tables.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Size of the buffer needed by a floating-point sliding DFT.
+  @param[in]     numBins  number of frequency bins
+  @param[in]     fftLen   length of the sliding window
+  @return        number of float32_t values of the <code>pBuffer</code> argument of arm_sliding_dft_init_f32()
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_sliding_dft_buffer_size_f32(
+        uint16_t numBins,
+        uint16_t fftLen)
+{
+  /* cos and sin tables, window, then states */
+  return (3U * (uint32_t)fftLen) + (4U * (uint32_t)numBins);
+}
+
+/**
+  @brief         Initialization function for the floating-point sliding DFT.
+  @param[out]    S        points to an instance of the floating-point sliding DFT structure
+  @param[in]     numBins  number of frequency bins
+  @param[in]     pBins    points to the bin indexes, numBins values smaller than fftLen
+  @param[in]     fftLen   length of the sliding window
+  @param[in]     pBuffer  points to the buffer of arm_sliding_dft_buffer_size_f32() values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numBins</code> or <code>fftLen</code> is 0,
+                                                    or a bin index is not smaller than <code>fftLen</code>
+
+  @par           Details
+                   The bin indexes are not copied: <code>pBins</code> must stay valid while the instance
+                   is used. The window is cleared, as if the signal was 0 before the first sample.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_sliding_dft_init_f32(
+        arm_sliding_dft_instance_f32 * S,
+        uint16_t numBins,
+  const uint16_t * pBins,
+        uint16_t fftLen,
+        float32_t * pBuffer)
+{
+  float64_t angle;
+  uint32_t i;
+
+  if ((numBins == 0U) || (fftLen == 0U))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  for (i = 0U; i < numBins; i++)
+  {
+    if (pBins[i] >= fftLen)
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+  }
+
+  S->numBins = numBins;
+  S->fftLen = fftLen;
+  S->pBins = pBins;
+  S->pCos = pBuffer;
+  S->pSin = &S->pCos[fftLen];
+  S->pWindow = &S->pSin[fftLen];
+  S->pState = &S->pWindow[fftLen];
+
+  for (i = 0U; i < fftLen; i++)
+  {
+    angle = arm_dynamic_tables_angle(i, fftLen);
+    S->pCos[i] = (float32_t)cos(angle);
+    S->pSin[i] = (float32_t)sin(angle);
+  }
+
+  arm_sliding_dft_reset_f32(S);
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Clears the window of the floating-point sliding DFT.
+  @param[in,out] S  points to an instance of the floating-point sliding DFT structure
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_dft_reset_f32(
+        arm_sliding_dft_instance_f32 * S)
+{
+  uint32_t i;
+
+  for (i = 0U; i < S->fftLen; i++)
+  {
+    S->pWindow[i] = 0.0f;
+  }
+  for (i = 0U; i < (4U * (uint32_t)S->numBins); i++)
+  {
+    S->pState[i] = 0.0f;
+  }
+
+  S->writeIndex = 0U;
+}
+
+/**
+  @} end of Goertzel group
+ */
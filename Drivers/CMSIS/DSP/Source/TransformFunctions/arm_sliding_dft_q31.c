@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sliding_dft_q31.c
+ * Description:  Q31 sliding DFT
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "dsp/transform_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 sliding DFT.
+  @param[in,out] S          points to an instance of the Q31 sliding DFT structure
+  @param[in]     pSrc       points to the new input samples
+  @param[in]     blockSize  number of new input samples
+  @param[out]    pDst       points to the output bins, numBins complex values {real, imag}
+
+  @par           Scaling and Overflow Behavior
+                   The bins are returned in Q31 scaled by <code>2^-postShift</code>, where
+                   <code>postShift = ceil(log2(fftLen))</code> is set by arm_sliding_dft_init_q31().
+                   Every sample adds the rounded <code>(x[n] * w) >> (31 + postShift)</code> to a bin and removes the
+                   same term, computed again from the sample leaving the window, <code>fftLen</code> samples
+                   later. The rounding errors of a sample cancel when it leaves the window: the bins do
+                   not drift, however long the stream. The modulated bins cannot overflow because the
+                   window holds at most <code>2^postShift</code> terms in
+                   <code>[-2^(31 - postShift), 2^(31 - postShift))</code>.
+ */
+ARM_DSP_ATTRIBUTE void arm_sliding_dft_q31(
+        arm_sliding_dft_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize,
+        q31_t * pDst)
+{
+  const uint32_t fftLen = S->fftLen;
+  const uint32_t numBins = S->numBins;
+  const uint32_t shift = 31U + (uint32_t)S->postShift;
+  const q63_t round = (q63_t)1 << (shift - 1U);
+  const uint16_t *pBins = S->pBins;
+  const q31_t *pCos = S->pCos;
+  const q31_t *pSin = S->pSin;
+  q31_t *pState = S->pState;
+  q31_t *pWindow = S->pWindow;
+  uint32_t pos = S->writeIndex;
+  uint32_t blkCnt;
+  uint32_t bin;
+  uint32_t step;
+  uint32_t index;
+  uint32_t i;
+  uint32_t re;                                   /* modulo 2^32 sums */
+  uint32_t im;
+  q31_t in;
+  q31_t out;
+  q63_t acc;
+
+  while (blockSize > 0U)
+  {
+    /* Run of samples up to the end of the window buffer */
+    blkCnt = fftLen - pos;
+    blkCnt = (blkCnt > blockSize) ? blockSize : blkCnt;
+
+    for (bin = 0U; bin < numBins; bin++)
+    {
+      step = pBins[bin];
+      index = (step * pos) % fftLen;
+      re = (uint32_t)pState[2U * bin];
+      im = (uint32_t)pState[(2U * bin) + 1U];
+
+      for (i = 0U; i < blkCnt; i++)
+      {
+        in = pSrc[i];
+        out = pWindow[pos + i];
+
+        /* y += (x[n] - x[n-fftLen]) * exp(-j * 2 * pi * bin * n / fftLen) */
+        re += (uint32_t)(q31_t)((((q63_t)in * pCos[index]) + round) >> shift);
+        re -= (uint32_t)(q31_t)((((q63_t)out * pCos[index]) + round) >> shift);
+        im -= (uint32_t)(q31_t)((((q63_t)in * pSin[index]) + round) >> shift);
+        im += (uint32_t)(q31_t)((((q63_t)out * pSin[index]) + round) >> shift);
+
+        index += step;
+        index = (index >= fftLen) ? (index - fftLen) : index;
+      }
+
+      pState[2U * bin] = (q31_t)re;
+      pState[(2U * bin) + 1U] = (q31_t)im;
+    }
+
+    for (i = 0U; i < blkCnt; i++)
+    {
+      pWindow[pos + i] = pSrc[i];
+    }
+
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+    pos += blkCnt;
+    pos = (pos == fftLen) ? 0U : pos;
+  }
+
+  S->writeIndex = (uint16_t)pos;
+
+  /* X = exp(j * 2 * pi * bin * (n+1) / fftLen) * y */
+  for (bin = 0U; bin < numBins; bin++)
+  {
+    index = ((uint32_t)pBins[bin] * pos) % fftLen;
+
+    acc = ((q63_t)pCos[index] * pState[2U * bin]) - ((q63_t)pSin[index] * pState[(2U * bin) + 1U]);
+    *pDst++ = clip_q63_to_q31(acc >> 31);
+    acc = ((q63_t)pCos[index] * pState[(2U * bin) + 1U]) + ((q63_t)pSin[index] * pState[2U * bin]);
+    *pDst++ = clip_q63_to_q31(acc >> 31);
+  }
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,206 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_f32.c
+ * Description:  Floating-point streaming STFT, spectrum and MFCC frames
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/support_functions.h"
+#include "dsp/fast_math_functions.h"
+#include "dsp/matrix_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup STFT Streaming STFT
+
+  Short-time Fourier transform of a stream, producing one feature frame
+  (magnitude spectrum, power spectrum or MFCC) every <code>hopLen</code> samples.
+
+  @par           Algorithm
+                   The last <code>fftLen</code> input samples are kept in a ring: input blocks of
+                   any length are copied once, and overlapping frames are never copied again.
+                   When a frame is complete, the ring is multiplied by the window directly into the
+                   FFT input buffer, oldest sample first, then transformed with arm_rfft_fast_f32().
+                   For MFCC frames the Mel filters, logarithm and DCT of the MFCC instance are
+                   applied to the magnitude spectrum.
+  @par
+                   The instance works in a single arena of <code>arm_stft_arena_size_f32(fftLen)</code>
+                   values provided at initialization: there is no allocation and no other scratch
+                   buffer per frame.
+
+  @par           MFCC
+                   The result is the one of arm_mfcc_f32() on the same frame, without the
+                   normalization by the maximum value which has no effect in floating point.
+ */
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/**
+  @brief         Computes the feature of the frame ending with the last sample written in the ring.
+  @param[in,out] S     points to the STFT instance structure
+  @param[out]    pDst  points to the output frame
+ */
+static void arm_stft_frame_f32(
+  arm_stft_instance_f32 * S,
+  float32_t *pDst)
+{
+  const uint32_t fftLen = S->fftLen;
+  const uint32_t half = fftLen >> 1U;
+  const uint32_t oldest = S->writeIndex;
+  float32_t *pSpectrum = S->pSpectrum;
+  float32_t *pBins;
+  float32_t dc, nyquist;
+
+  /* Windowed copy of the ring in time order */
+  arm_mult_f32(&S->pRing[oldest], S->pWindow, S->pFrame, fftLen - oldest);
+  arm_mult_f32(S->pRing, &S->pWindow[fftLen - oldest], &S->pFrame[fftLen - oldest], oldest);
+
+  arm_rfft_fast_f32(&S->rfft, S->pFrame, pSpectrum, 0);
+
+  /* Bins 0 to fftLen/2: the packed DC and Nyquist values are real */
+  pBins = (S->feature == ARM_STFT_MFCC) ? S->pFrame : pDst;
+  dc = pSpectrum[0];
+  nyquist = pSpectrum[1];
+
+  if (S->feature == ARM_STFT_POWER)
+  {
+    arm_cmplx_mag_squared_f32(&pSpectrum[2], &pBins[1], half - 1U);
+    pBins[0] = dc * dc;
+    pBins[half] = nyquist * nyquist;
+  }
+  else
+  {
+    arm_cmplx_mag_f32(&pSpectrum[2], &pBins[1], half - 1U);
+    pBins[0] = fabsf(dc);
+    pBins[half] = fabsf(nyquist);
+  }
+
+  if (S->feature == ARM_STFT_MFCC)
+  {
+    const arm_mfcc_instance_f32 *pMfcc = S->pMfcc;
+    const float32_t *coefs = pMfcc->filterCoefs;
+    arm_matrix_instance_f32 dctMat;
+    uint32_t i;
+
+    /* Mel filters */
+    for (i = 0U; i < pMfcc->nbMelFilters; i++)
+    {
+      arm_dot_prod_f32(&pBins[pMfcc->filterPos[i]], coefs, pMfcc->filterLengths[i], &pSpectrum[i]);
+      coefs += pMfcc->filterLengths[i];
+    }
+
+    /* Log and DCT */
+    arm_offset_f32(pSpectrum, 1.0e-6f, pSpectrum, pMfcc->nbMelFilters);
+    arm_vlog_f32(pSpectrum, pSpectrum, pMfcc->nbMelFilters);
+
+    dctMat.numRows = (uint16_t)pMfcc->nbDctOutputs;
+    dctMat.numCols = (uint16_t)pMfcc->nbMelFilters;
+    dctMat.pData = (float32_t *)pMfcc->dctCoefs;
+    arm_mat_vec_mult_f32(&dctMat, pSpectrum, pDst);
+  }
+}
+
+/**
+  @brief         Streaming STFT.
+  @param[in,out] S          points to the STFT instance structure
+  @param[in]     pSrc       points to the input samples
+  @param[in]     blockSize  number of input samples
+  @param[out]    pDst       points to the output frames
+  @param[in]     maxFrames  maximum number of frames written to pDst
+  @param[out]    pNbFrames  number of frames written to pDst
+  @return        number of input samples consumed
+
+  @par           Description
+                   Frames of <code>frameSize</code> values are written one after the other to
+                   <code>pDst</code>. The first frame is produced when <code>fftLen</code> samples
+                   have been received, then one frame every <code>hopLen</code> samples.
+  @par
+                   All the input is consumed unless <code>maxFrames</code> frames have been written:
+                   the function then returns the number of samples consumed and the caller pushes the
+                   remaining samples in a next call. A frame completed by the last consumed sample is
+                   kept and written first by the next call.
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_stft_f32(
+  arm_stft_instance_f32 * S,
+  const float32_t *pSrc,
+  uint32_t blockSize,
+  float32_t *pDst,
+  uint32_t maxFrames,
+  uint32_t *pNbFrames)
+{
+  uint32_t consumed = 0U;
+  uint32_t frames = 0U;
+  uint32_t blkCnt;
+
+  for (;;)
+  {
+    if (S->hopCount == 0U)
+    {
+      if (frames == maxFrames)
+      {
+        break;
+      }
+
+      arm_stft_frame_f32(S, pDst);
+      pDst += S->frameSize;
+      frames++;
+      S->hopCount = S->hopLen;
+    }
+
+    if (consumed == blockSize)
+    {
+      break;
+    }
+
+    /* Up to the end of the hop, the end of the input or the end of the ring */
+    blkCnt = blockSize - consumed;
+    blkCnt = (blkCnt > S->hopCount) ? S->hopCount : blkCnt;
+    blkCnt = (blkCnt > ((uint32_t)S->fftLen - S->writeIndex)) ? ((uint32_t)S->fftLen - S->writeIndex) : blkCnt;
+
+    arm_copy_f32(pSrc, &S->pRing[S->writeIndex], blkCnt);
+    pSrc += blkCnt;
+    consumed += blkCnt;
+    S->hopCount -= blkCnt;
+    S->writeIndex += (uint16_t)blkCnt;
+    if (S->writeIndex == S->fftLen)
+    {
+      S->writeIndex = 0U;
+    }
+  }
+
+  *pNbFrames = frames;
+
+  return consumed;
+}
+
+/**
+  @} end of STFT group
+ */
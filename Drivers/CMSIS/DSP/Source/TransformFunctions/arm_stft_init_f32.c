@@ -0,0 +1,177 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_init_f32.c
+ * Description:  Initialization of the floating-point streaming STFT
+ *
+ * $Date:        18 October 2026
+ * $Revision:    V1.0.0
+ *
+ * Target Processor: Cortex-M and Cortex-A cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2026 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dsp/transform_functions.h"
+#include "dsp/support_functions.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/**
+  @brief         Size of the arena of a streaming STFT.
+  @param[in]     fftLen  frame and FFT length
+  @return        number of float32_t values of the arena
+
+  @par           Description
+                   The arena holds the input ring, the windowed frame and the spectrum:
+                   <code>3 * fftLen + 2</code> values.
+ */
+ARM_DSP_ATTRIBUTE uint32_t arm_stft_arena_size_f32(
+  uint16_t fftLen)
+{
+  return (3U * (uint32_t)fftLen) + 2U;
+}
+
+/**
+  @brief         Assigns the arena and the frame parameters of the instance.
+  @param[out]    S       points to the STFT instance structure
+  @param[in]     fftLen  frame and FFT length
+  @param[in]     hopLen  number of samples between two frames
+  @param[in]     pArena  points to the arena
+  @return        execution status
+ */
+static arm_status arm_stft_setup_f32(
+  arm_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopLen,
+  float32_t *pArena)
+{
+  if ((hopLen == 0U) || (hopLen > fftLen))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->fftLen = fftLen;
+  S->hopLen = hopLen;
+  S->pRing = pArena;
+  S->pFrame = &pArena[fftLen];
+  S->pSpectrum = &pArena[2U * (uint32_t)fftLen];
+
+  arm_stft_reset_f32(S);
+
+  return arm_rfft_fast_init_f32(&S->rfft, fftLen);
+}
+
+/**
+  @brief         Initialization of a streaming STFT computing a spectrum per frame.
+  @param[out]    S        points to the STFT instance structure
+  @param[in]     fftLen   frame and FFT length
+  @param[in]     hopLen   number of samples between two frames
+  @param[in]     feature  ARM_STFT_MAGNITUDE or ARM_STFT_POWER
+  @param[in]     pWindow  points to the window, fftLen values
+  @param[in]     pArena   points to the arena of arm_stft_arena_size_f32() values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : hopLen is 0 or larger than fftLen, or unsupported feature or FFT length
+
+  @par           Description
+                   The window is typically filled once with a function of the
+                   \ref groupWindow group, for instance arm_hanning_f32().
+                   Every frame produces <code>fftLen / 2 + 1</code> values, bins 0 to
+                   <code>fftLen / 2</code>.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_stft_init_f32(
+  arm_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopLen,
+  arm_stft_feature feature,
+  const float32_t *pWindow,
+  float32_t *pArena)
+{
+  if ((feature != ARM_STFT_MAGNITUDE) && (feature != ARM_STFT_POWER))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->feature = feature;
+  S->frameSize = (fftLen >> 1U) + 1U;
+  S->pWindow = pWindow;
+  S->pMfcc = NULL;
+
+  return arm_stft_setup_f32(S, fftLen, hopLen, pArena);
+}
+
+/**
+  @brief         Initialization of a streaming STFT computing the MFCC of every frame.
+  @param[out]    S       points to the STFT instance structure
+  @param[in]     pMfcc   points to an initialized MFCC instance
+  @param[in]     hopLen  number of samples between two frames
+  @param[in]     pArena  points to the arena of arm_stft_arena_size_f32() values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : hopLen is 0 or larger than the FFT length, or too many Mel filters
+
+  @par           Description
+                   The frame length, window, Mel filters and DCT are the ones of the MFCC instance,
+                   which must stay valid while the STFT is used.
+                   Every frame produces <code>nbDctOutputs</code> values.
+ */
+ARM_DSP_ATTRIBUTE arm_status arm_stft_mfcc_init_f32(
+  arm_stft_instance_f32 * S,
+  const arm_mfcc_instance_f32 * pMfcc,
+  uint16_t hopLen,
+  float32_t *pArena)
+{
+  /* The Mel energies are stored in the spectrum buffer */
+  if ((pMfcc->fftLen > 4096U) || (pMfcc->nbMelFilters > (pMfcc->fftLen + 2U)))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->feature = ARM_STFT_MFCC;
+  S->frameSize = (uint16_t)pMfcc->nbDctOutputs;
+  S->pWindow = pMfcc->windowCoefs;
+  S->pMfcc = pMfcc;
+
+  return arm_stft_setup_f32(S, (uint16_t)pMfcc->fftLen, hopLen, pArena);
+}
+
+/**
+  @brief         Clears the input ring of a streaming STFT.
+  @param[in,out] S  points to the STFT instance structure
+
+  @par           Description
+                   The next frame is produced after <code>fftLen</code> new samples.
+ */
+ARM_DSP_ATTRIBUTE void arm_stft_reset_f32(
+  arm_stft_instance_f32 * S)
+{
+  arm_fill_f32(0.0f, S->pRing, S->fftLen);
+  S->writeIndex = 0U;
+  S->hopCount = S->fftLen;
+}
+
+/**
+  @} end of STFT group
+ */
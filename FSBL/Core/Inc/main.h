@@ -39,8 +39,8 @@ extern "C" {
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
-/* Define board type */
-#define DK_BOARD 1 // 0 for custom board, 1 for DK board
+/* Define board type (DK_BOARD), shared with the Appli */
+#include "board_config.h"
 /* USER CODE END Includes */
 
 /* Exported types ------------------------------------------------------------*/
@@ -43,6 +43,12 @@
 #define EXTMEM_SAL_XSPI   1
 #define EXTMEM_SAL_SD     0
 
+/*
+  @brief management of the binary trace recorder (EXTMEM_RECORDER_DEPTH must be a power of 2)
+*/
+#define EXTMEM_RECORDER_ENABLE   1
+#define EXTMEM_RECORDER_DEPTH    256u
+
 /* Includes ------------------------------------------------------------------*/
 #include "stm32n6xx_hal.h"
 #include "stm32_extmem.h"
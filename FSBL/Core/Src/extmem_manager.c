@@ -23,6 +23,7 @@
 #include <string.h>
 
 /* USER CODE BEGIN Includes */
+#include "stm32_extmem_recorder.h"
 
 /* USER CODE END Includes */
 
@@ -58,6 +59,10 @@ void MX_EXTMEM_MANAGER_Init(void)
 {
 
   /* USER CODE BEGIN MX_EXTMEM_Init_PreTreatment */
+#if defined(EXTMEM_RECORDER_ENABLE) && (EXTMEM_RECORDER_ENABLE == 1)
+  /* Start the binary trace recorder before the first EXTMEM operation */
+  EXTMEM_REC_Init(SystemCoreClock);
+#endif /* EXTMEM_RECORDER_ENABLE */
 
   /* USER CODE END MX_EXTMEM_Init_PreTreatment */
 
@@ -22,6 +22,7 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "psram_shutdown.h"
 
 /* USER CODE END Includes */
 
@@ -46,6 +47,8 @@ XSPI_HandleTypeDef hxspi1;
 XSPI_HandleTypeDef hxspi2;
 
 /* USER CODE BEGIN PV */
+static uint32_t psram_warm;      /* Boot after PSRAM_RetainAndReset()      */
+static uint32_t psram_retained;  /* Valid regions in the retention header */
 
 /* USER CODE END PV */
 
@@ -108,9 +111,22 @@ int main(void)
   MX_GPDMA1_Init();
   MX_XSPI2_Init();
   MX_XSPI1_Init();
-  PSRAM_GlobalReset();  /* Reset PSRAM to known power-up state */
+  psram_warm = PSRAM_IsWarmBoot();
+  if (psram_warm == 0U)
+  {
+    PSRAM_GlobalReset();  /* Reset PSRAM to known power-up state */
+  }
   MX_EXTMEM_MANAGER_Init();
   /* USER CODE BEGIN 2 */
+  if (psram_warm != 0U)
+  {
+    /* Warm reset: check the retained regions, invalid ones are dropped */
+    if (EXTMEM_MemoryMappedMode(EXTMEMORY_2, EXTMEM_ENABLE) == EXTMEM_OK)
+    {
+      psram_retained = PSRAM_RETENTION_Validate(PSRAM_RETENTION_HEADER,
+                                                (const uint8_t *)PSRAM_BASE_ADDRESS, PSRAM_MEMORY_SIZE);
+    }
+  }
   for(int i = 0; i < 5; i++)
   {
     HAL_GPIO_WritePin(RED_LED_GPIO_Port, RED_LED_Pin, GPIO_PIN_RESET);
@@ -487,8 +503,12 @@ uint32_t BOOT_GetApplicationVectorTable(void)
   /* Disable PSRAM memory-mapped mode (XSPI1 goes back to indirect mode) */
   EXTMEM_MemoryMappedMode(EXTMEMORY_2, EXTMEM_DISABLE);
 
-  /* Send Global Reset to PSRAM - resets all internal registers */
-  PSRAM_GlobalReset();
+  /* Send Global Reset to PSRAM - resets all internal registers.
+     Skipped when retained regions are handed over to the Application. */
+  if (psram_retained == 0U)
+  {
+    PSRAM_GlobalReset();
+  }
 
   /* Return the application vector table address (same logic as default weak) */
   return EXTMEM_LRUN_DESTINATION_ADDRESS + EXTMEM_HEADER_OFFSET;
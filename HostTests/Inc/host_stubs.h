@@ -0,0 +1,20 @@
+/**
+  ******************************************************************************
+  * @file    host_stubs.h
+  * @brief   Target hooks replaced for the host unit tests.
+  *
+  *          Included ahead of every source of the host build (-include in
+  *          Makefile/Host/Makefile); the stubs are defined by the tests.
+  ******************************************************************************
+  */
+
+#ifndef HOST_STUBS_H
+#define HOST_STUBS_H
+
+#include <stddef.h>
+
+/* secure_gateway.c: non-secure range check, see test_secure_gateway.c */
+void *HostTest_CheckRange(void *Addr, size_t Size);
+#define SECURE_GATEWAY_CHECK_RANGE(__ADDR__, __SIZE__)  HostTest_CheckRange((__ADDR__), (__SIZE__))
+
+#endif /* HOST_STUBS_H */
@@ -0,0 +1,56 @@
+/**
+  ******************************************************************************
+  * @file    host_test.h
+  * @brief   Minimal checks for the host unit tests.
+  *
+  *          The tests build the target independent parts of Appli, FSBL and
+  *          Shared with the host gcc (see Makefile/Host/Makefile). Each test
+  *          is a program that prints the failed checks and returns non-zero
+  *          if any.
+  ******************************************************************************
+  */
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+
+static unsigned int HostTest_Checks;
+static unsigned int HostTest_Failures;
+
+/* Counts a check, prints it with its location when it fails */
+#define HT_CHECK(cond)                                                        \
+  do                                                                          \
+  {                                                                           \
+    HostTest_Checks++;                                                        \
+    if (!(cond))                                                              \
+    {                                                                         \
+      HostTest_Failures++;                                                    \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);         \
+    }                                                                         \
+  } while (0)
+
+/* Same with the two compared values printed */
+#define HT_CHECK_EQ(a, b)                                                     \
+  do                                                                          \
+  {                                                                           \
+    unsigned long long ht_a = (unsigned long long)(a);                        \
+    unsigned long long ht_b = (unsigned long long)(b);                        \
+    HostTest_Checks++;                                                        \
+    if (ht_a != ht_b)                                                         \
+    {                                                                         \
+      HostTest_Failures++;                                                    \
+      printf("%s:%d: check failed: %s == %s (%llu != %llu)\n",                \
+             __FILE__, __LINE__, #a, #b, ht_a, ht_b);                         \
+    }                                                                         \
+  } while (0)
+
+/* Prints the summary, returns the process exit code */
+static inline int HostTest_Report(const char *Name)
+{
+  printf("%s: %u checks, %u failed: %s\n", Name, HostTest_Checks, HostTest_Failures,
+         (HostTest_Failures == 0U) ? "PASS" : "FAIL");
+  return (HostTest_Failures == 0U) ? 0 : 1;
+}
+
+#endif /* HOST_TEST_H */
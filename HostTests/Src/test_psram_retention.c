@@ -0,0 +1,212 @@
+/**
+  ******************************************************************************
+  * @file    test_psram_retention.c
+  * @brief   Host test of the PSRAM warm retention header.
+  *
+  *          A host buffer stands for the PSRAM, the header at its start as
+  *          on the target (PSRAM_RETENTION_HEADER).
+  ******************************************************************************
+  */
+
+#include "psram_retention.h"
+#include "host_test.h"
+#include <stddef.h>
+#include <string.h>
+
+#define MEMORY_SIZE  0x10000UL
+
+static uint32_t memory_words[MEMORY_SIZE / sizeof(uint32_t)];
+static uint8_t *const memory = (uint8_t *)memory_words;
+static PSRAM_RetentionHeaderTypeDef *const header = (PSRAM_RetentionHeaderTypeDef *)memory_words;
+
+/* Header CRC recomputed after a field is changed on purpose */
+static void Reseal(void)
+{
+  header->HeaderCrc = PSRAM_RETENTION_Crc32(0U, header, offsetof(PSRAM_RetentionHeaderTypeDef, HeaderCrc));
+}
+
+static void Fill(uint32_t Offset, uint32_t Size, uint8_t Seed)
+{
+  uint32_t index;
+
+  for (index = 0U; index < Size; index++)
+  {
+    memory[Offset + index] = (uint8_t)(Seed + (index * 7U));
+  }
+}
+
+static void TestCrc(void)
+{
+  static const char check[] = "123456789";
+
+  /* Standard CRC-32 check value */
+  HT_CHECK_EQ(PSRAM_RETENTION_Crc32(0U, check, 9U), 0xCBF43926UL);
+  HT_CHECK_EQ(PSRAM_RETENTION_Crc32(0U, check, 0U), 0U);
+
+  /* Update in pieces gives the same CRC */
+  HT_CHECK_EQ(PSRAM_RETENTION_Crc32(PSRAM_RETENTION_Crc32(0U, check, 4U), &check[4], 5U), 0xCBF43926UL);
+}
+
+static void TestHeaderChecks(void)
+{
+  /* The header fits in the space reserved at the start of the PSRAM */
+  HT_CHECK(sizeof(PSRAM_RetentionHeaderTypeDef) <= PSRAM_RETENTION_HEADER_RESERVED);
+
+  /* Power-up content is not a header */
+  (void)memset(memory, 0xA5, MEMORY_SIZE);
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, MEMORY_SIZE), 0U);
+
+  PSRAM_RETENTION_Clear(header);
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, MEMORY_SIZE), 1U);
+  HT_CHECK_EQ(header->Count, 0U);
+
+  /* Signature */
+  header->Magic ^= 1U;
+  Reseal();
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, MEMORY_SIZE), 0U);
+  header->Magic ^= 1U;
+  Reseal();
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, MEMORY_SIZE), 1U);
+
+  /* Version written by another layout */
+  header->Version = PSRAM_RETENTION_VERSION + 1U;
+  Reseal();
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, MEMORY_SIZE), 0U);
+  header->Version = 0U;
+  Reseal();
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, MEMORY_SIZE), 0U);
+  header->Version = PSRAM_RETENTION_VERSION;
+  Reseal();
+
+  /* Too many regions */
+  header->Count = PSRAM_RETENTION_MAX_REGIONS + 1U;
+  Reseal();
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, MEMORY_SIZE), 0U);
+  header->Count = 0U;
+  Reseal();
+
+  /* Any field changed without a new CRC, and the CRC itself */
+  header->Generation++;
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, MEMORY_SIZE), 0U);
+  header->Generation--;
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, MEMORY_SIZE), 1U);
+  header->Region[PSRAM_RETENTION_MAX_REGIONS - 1U].Tag = 1U;
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, MEMORY_SIZE), 0U);
+  header->Region[PSRAM_RETENTION_MAX_REGIONS - 1U].Tag = 0U;
+  header->HeaderCrc ^= 0x80000000UL;
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, MEMORY_SIZE), 0U);
+  header->HeaderCrc ^= 0x80000000UL;
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, MEMORY_SIZE), 1U);
+
+  /* Region outside of a smaller memory */
+  HT_CHECK_EQ(PSRAM_RETENTION_AddRegion(header, 0x8000U, 0x1000U, 1U, MEMORY_SIZE), PSRAM_RETENTION_OK);
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, MEMORY_SIZE), 1U);
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, 0x8800U), 0U);
+}
+
+static void TestAddRegion(void)
+{
+  uint32_t index;
+
+  PSRAM_RETENTION_Clear(header);
+
+  /* Over the header, empty, past the end, wrapping */
+  HT_CHECK_EQ(PSRAM_RETENTION_AddRegion(header, 0U, 16U, 1U, MEMORY_SIZE), PSRAM_RETENTION_ERROR_PARAM);
+  HT_CHECK_EQ(PSRAM_RETENTION_AddRegion(header, PSRAM_RETENTION_HEADER_RESERVED - 4U, 16U, 1U, MEMORY_SIZE),
+              PSRAM_RETENTION_ERROR_PARAM);
+  HT_CHECK_EQ(PSRAM_RETENTION_AddRegion(header, 0x1000U, 0U, 1U, MEMORY_SIZE), PSRAM_RETENTION_ERROR_PARAM);
+  HT_CHECK_EQ(PSRAM_RETENTION_AddRegion(header, MEMORY_SIZE - 8U, 16U, 1U, MEMORY_SIZE), PSRAM_RETENTION_ERROR_PARAM);
+  HT_CHECK_EQ(PSRAM_RETENTION_AddRegion(header, 0xFFFFFFF0UL, 0x20U, 1U, MEMORY_SIZE), PSRAM_RETENTION_ERROR_PARAM);
+  HT_CHECK_EQ(header->Count, 0U);
+
+  /* First byte above the header up to the last byte of the memory */
+  HT_CHECK_EQ(PSRAM_RETENTION_AddRegion(header, PSRAM_RETENTION_HEADER_RESERVED,
+                                        MEMORY_SIZE - PSRAM_RETENTION_HEADER_RESERVED, 1U, MEMORY_SIZE),
+              PSRAM_RETENTION_OK);
+  HT_CHECK_EQ(header->Count, 1U);
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, MEMORY_SIZE), 1U);
+
+  /* Table full */
+  for (index = 1U; index < PSRAM_RETENTION_MAX_REGIONS; index++)
+  {
+    HT_CHECK_EQ(PSRAM_RETENTION_AddRegion(header, 0x1000U * index, 0x100U, index + 1U, MEMORY_SIZE),
+                PSRAM_RETENTION_OK);
+  }
+  HT_CHECK_EQ(PSRAM_RETENTION_AddRegion(header, 0x9000U, 0x100U, 99U, MEMORY_SIZE), PSRAM_RETENTION_ERROR_FULL);
+  HT_CHECK_EQ(header->Count, PSRAM_RETENTION_MAX_REGIONS);
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, MEMORY_SIZE), 1U);
+
+  /* An invalid header is cleared before the region is added */
+  header->Magic = 0U;
+  HT_CHECK_EQ(PSRAM_RETENTION_AddRegion(header, 0x9000U, 0x100U, 99U, MEMORY_SIZE), PSRAM_RETENTION_OK);
+  HT_CHECK_EQ(header->Magic, PSRAM_RETENTION_MAGIC);
+  HT_CHECK_EQ(header->Count, 1U);
+  HT_CHECK_EQ(header->Region[0].Tag, 99U);
+}
+
+static void TestSealValidate(void)
+{
+  uint32_t generation;
+
+  PSRAM_RETENTION_Clear(header);
+  HT_CHECK_EQ(PSRAM_RETENTION_AddRegion(header, 0x1000U, 0x800U, 0x10U, MEMORY_SIZE), PSRAM_RETENTION_OK);
+  HT_CHECK_EQ(PSRAM_RETENTION_AddRegion(header, 0x2000U, 0x40U, 0x20U, MEMORY_SIZE), PSRAM_RETENTION_OK);
+  HT_CHECK_EQ(PSRAM_RETENTION_AddRegion(header, MEMORY_SIZE - 1U, 1U, 0x30U, MEMORY_SIZE), PSRAM_RETENTION_OK);
+  Fill(0x1000U, 0x800U, 1U);
+  Fill(0x2000U, 0x40U, 2U);
+  Fill(MEMORY_SIZE - 1U, 1U, 3U);
+
+  generation = header->Generation;
+  PSRAM_RETENTION_Seal(header, memory);
+  HT_CHECK_EQ(header->Generation, generation + 1U);
+  HT_CHECK_EQ(header->Region[0].Crc, PSRAM_RETENTION_Crc32(0U, &memory[0x1000U], 0x800U));
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, MEMORY_SIZE), 1U);
+
+  /* Untouched content: every region kept, header unchanged */
+  HT_CHECK_EQ(PSRAM_RETENTION_Validate(header, memory, MEMORY_SIZE), 3U);
+  HT_CHECK_EQ(header->Count, 3U);
+  HT_CHECK(PSRAM_RETENTION_Find(header, 0x20U) != NULL);
+  HT_CHECK(PSRAM_RETENTION_Find(header, 0x40U) == NULL);
+
+  /* Changes outside of the regions do not matter */
+  Fill(0x3000U, 0x100U, 9U);
+  HT_CHECK_EQ(PSRAM_RETENTION_Validate(header, memory, MEMORY_SIZE), 3U);
+
+  /* A single bit flip in the middle region drops it, the others move down */
+  memory[0x2000U + 0x20U] ^= 0x08U;
+  HT_CHECK_EQ(PSRAM_RETENTION_Validate(header, memory, MEMORY_SIZE), 2U);
+  HT_CHECK_EQ(header->Count, 2U);
+  HT_CHECK_EQ(header->Region[0].Tag, 0x10U);
+  HT_CHECK_EQ(header->Region[1].Tag, 0x30U);
+  HT_CHECK_EQ(header->Region[2].Tag, 0U);
+  HT_CHECK(PSRAM_RETENTION_Find(header, 0x20U) == NULL);
+  HT_CHECK_EQ(PSRAM_RETENTION_Find(header, 0x30U)->Offset, MEMORY_SIZE - 1U);
+  /* Header sealed again after the removal */
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, MEMORY_SIZE), 1U);
+  HT_CHECK_EQ(header->Generation, generation + 1U);
+
+  /* Header of another version: nothing retained, header cleared */
+  header->Version = PSRAM_RETENTION_VERSION + 1U;
+  Reseal();
+  HT_CHECK_EQ(PSRAM_RETENTION_Validate(header, memory, MEMORY_SIZE), 0U);
+  HT_CHECK_EQ(header->Count, 0U);
+  HT_CHECK_EQ(header->Version, PSRAM_RETENTION_VERSION);
+  HT_CHECK_EQ(PSRAM_RETENTION_IsValid(header, MEMORY_SIZE), 1U);
+
+  /* Corrupted header CRC: same */
+  HT_CHECK_EQ(PSRAM_RETENTION_AddRegion(header, 0x1000U, 0x800U, 0x10U, MEMORY_SIZE), PSRAM_RETENTION_OK);
+  PSRAM_RETENTION_Seal(header, memory);
+  header->HeaderCrc++;
+  HT_CHECK_EQ(PSRAM_RETENTION_Validate(header, memory, MEMORY_SIZE), 0U);
+  HT_CHECK(PSRAM_RETENTION_Find(header, 0x10U) == NULL);
+}
+
+int main(void)
+{
+  TestCrc();
+  TestHeaderChecks();
+  TestAddRegion();
+  TestSealValidate();
+
+  return HostTest_Report("psram_retention");
+}
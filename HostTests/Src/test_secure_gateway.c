@@ -0,0 +1,286 @@
+/**
+  ******************************************************************************
+  * @file    test_secure_gateway.c
+  * @brief   Host test of the batched secure gateway dispatcher.
+  *
+  *          SECURE_GATEWAY_CHECK_RANGE() is redefined by the host Makefile to
+  *          HostTest_CheckRange(), which accepts the ranges inside ns_memory
+  *          only, standing for the non-secure memory.
+  ******************************************************************************
+  */
+
+#include "secure_gateway.h"
+#include "host_test.h"
+#include <string.h>
+
+/* "Non-secure" memory holding the batch buffers */
+static uint32_t ns_memory[256];
+
+/* Memory the range check refuses */
+static uint32_t s_memory[64];
+
+/* Calls of the test services */
+static uint32_t service_calls;
+
+void *HostTest_CheckRange(void *Addr, size_t Size)
+{
+  const uintptr_t start = (uintptr_t)ns_memory;
+  const uintptr_t end = start + sizeof(ns_memory);
+  const uintptr_t addr = (uintptr_t)Addr;
+
+  return ((addr >= start) && (addr <= end) && (Size <= (end - addr))) ? Addr : NULL;
+}
+
+/* SECURE_REQ_CRYPTO: output is the input bytes complemented, Param[0] added */
+static int32_t CryptoService(const uint32_t *Param, const uint8_t *In, uint32_t InSize,
+                             uint8_t *Out, uint32_t *OutSize)
+{
+  uint32_t index;
+
+  service_calls++;
+  if (*OutSize < InSize)
+  {
+    *OutSize = 0U;
+    return SECURE_ERROR_PARAM;
+  }
+  for (index = 0U; index < InSize; index++)
+  {
+    Out[index] = (uint8_t)(~In[index] + Param[0]);
+  }
+  *OutSize = InSize;
+  return SECURE_OK;
+}
+
+/* SECURE_REQ_KEY_READ: claims more output than the capacity */
+static int32_t KeyReadService(const uint32_t *Param, const uint8_t *In, uint32_t InSize,
+                              uint8_t *Out, uint32_t *OutSize)
+{
+  (void)In;
+  (void)InSize;
+
+  service_calls++;
+  if (Out != NULL)
+  {
+    (void)memset(Out, (int)Param[0], *OutSize);
+  }
+  *OutSize += 16U;
+  return SECURE_OK;
+}
+
+/* Clears the batch buffer and sets up a header of Count requests */
+static SECURE_RequestTypeDef *NewBatch(uint32_t Count)
+{
+  SECURE_BatchTypeDef *batch = (SECURE_BatchTypeDef *)ns_memory;
+  SECURE_RequestTypeDef *requests = SECURE_BATCH_REQUESTS(batch);
+  uint32_t index;
+
+  (void)memset(ns_memory, 0, sizeof(ns_memory));
+  batch->Count = Count;
+  batch->Processed = 0xFFFFFFFFU;
+  for (index = 0U; index < Count; index++)
+  {
+    requests[index].Status = SECURE_ERROR_PENDING;
+  }
+  service_calls = 0U;
+  return requests;
+}
+
+static void SetRequest(SECURE_RequestTypeDef *Request, uint32_t Type, uint32_t InOffset, uint32_t InSize,
+                       uint32_t OutOffset, uint32_t OutSize)
+{
+  Request->Type      = Type;
+  Request->Param[0]  = 1U;
+  Request->Param[1]  = 0U;
+  Request->InOffset  = InOffset;
+  Request->InSize    = InSize;
+  Request->OutOffset = OutOffset;
+  Request->OutSize   = OutSize;
+}
+
+static uint32_t Processed(void)
+{
+  return ((SECURE_BatchTypeDef *)ns_memory)->Processed;
+}
+
+static void TestRegister(void)
+{
+  HT_CHECK_EQ(SECURE_GATEWAY_RegisterService(SECURE_REQ_NONE, CryptoService), SECURE_ERROR_PARAM);
+  HT_CHECK_EQ(SECURE_GATEWAY_RegisterService(SECURE_REQ_COUNT, CryptoService), SECURE_ERROR_PARAM);
+  HT_CHECK_EQ(SECURE_GATEWAY_RegisterService(SECURE_REQ_CRYPTO, CryptoService), SECURE_OK);
+  HT_CHECK_EQ(SECURE_GATEWAY_RegisterService(SECURE_REQ_KEY_READ, KeyReadService), SECURE_OK);
+}
+
+static void TestValidBatch(void)
+{
+  SECURE_RequestTypeDef *requests = NewBatch(3U);
+  const uint32_t data = SECURE_BATCH_DATA_OFFSET(3U);
+  uint8_t *base = (uint8_t *)ns_memory;
+  uint32_t index;
+
+  /* Crypto of 32 bytes, output right after the input */
+  SetRequest(&requests[0], SECURE_REQ_CRYPTO, data, 32U, data + 32U, 32U);
+  for (index = 0U; index < 32U; index++)
+  {
+    base[data + index] = (uint8_t)index;
+  }
+  /* Empty slot */
+  SetRequest(&requests[1], SECURE_REQ_NONE, 0U, 0U, 0U, 0U);
+  /* Key read of 8 bytes at the end of the buffer, the service overstates its size */
+  SetRequest(&requests[2], SECURE_REQ_KEY_READ, 0U, 0U, sizeof(ns_memory) - 8U, 8U);
+  requests[2].Param[0] = 0x5AU;
+
+  HT_CHECK_EQ(SECURE_GATEWAY_Process(ns_memory, sizeof(ns_memory)), SECURE_OK);
+  HT_CHECK_EQ(Processed(), 3U);
+  HT_CHECK_EQ(service_calls, 2U);
+
+  HT_CHECK_EQ(requests[0].Status, SECURE_OK);
+  HT_CHECK_EQ(requests[0].OutSize, 32U);
+  for (index = 0U; index < 32U; index++)
+  {
+    HT_CHECK_EQ(base[data + 32U + index], (uint8_t)(~index + 1U));
+  }
+
+  HT_CHECK_EQ(requests[1].Status, SECURE_OK);
+  HT_CHECK_EQ(requests[1].OutSize, 0U);
+
+  /* Output size clamped to the capacity */
+  HT_CHECK_EQ(requests[2].Status, SECURE_OK);
+  HT_CHECK_EQ(requests[2].OutSize, 8U);
+  HT_CHECK_EQ(base[sizeof(ns_memory) - 1U], 0x5AU);
+  /* Descriptors not touched besides Status and OutSize */
+  HT_CHECK_EQ(requests[0].InOffset, data);
+  HT_CHECK_EQ(requests[2].Param[0], 0x5AU);
+}
+
+static void TestOutOfRange(void)
+{
+  SECURE_RequestTypeDef *requests;
+  const uint32_t data = SECURE_BATCH_DATA_OFFSET(4U);
+
+  /* Buffer in memory refused by the range check */
+  (void)memset(s_memory, 0, sizeof(s_memory));
+  HT_CHECK_EQ(SECURE_GATEWAY_Process(s_memory, sizeof(s_memory)), SECURE_ERROR_ACCESS);
+
+  /* Buffer starting in range but ending past it */
+  requests = NewBatch(0U);
+  HT_CHECK_EQ(SECURE_GATEWAY_Process(&ns_memory[250], 64U), SECURE_ERROR_ACCESS);
+  HT_CHECK_EQ(SECURE_GATEWAY_Process(ns_memory, sizeof(ns_memory) + 4U), SECURE_ERROR_ACCESS);
+  HT_CHECK_EQ(Processed(), 0xFFFFFFFFU);
+
+  /* Buffer above the largest batch size, refused before the range check */
+  HT_CHECK_EQ(SECURE_GATEWAY_Process(ns_memory, SECURE_GATEWAY_MAX_BATCH_SIZE + 4U), SECURE_ERROR_PARAM);
+
+  /* Unaligned buffer */
+  HT_CHECK_EQ(SECURE_GATEWAY_Process((uint8_t *)ns_memory + 2, 64U), SECURE_ERROR_PARAM);
+
+  /* More requests than the buffer holds: nothing processed */
+  requests = NewBatch(0U);
+  ((SECURE_BatchTypeDef *)ns_memory)->Count = 3U;
+  HT_CHECK_EQ(SECURE_GATEWAY_Process(ns_memory, SECURE_BATCH_DATA_OFFSET(2U)), SECURE_ERROR_PARAM);
+  HT_CHECK_EQ(Processed(), 0xFFFFFFFFU);
+  ((SECURE_BatchTypeDef *)ns_memory)->Count = 0xFFFFFFFFU;
+  HT_CHECK_EQ(SECURE_GATEWAY_Process(ns_memory, sizeof(ns_memory)), SECURE_ERROR_PARAM);
+  HT_CHECK_EQ(Processed(), 0xFFFFFFFFU);
+
+  /* Data past the end of the buffer: the request fails, the others run */
+  requests = NewBatch(4U);
+  SetRequest(&requests[0], SECURE_REQ_CRYPTO, data, 16U, sizeof(ns_memory) - 8U, 16U);
+  SetRequest(&requests[1], SECURE_REQ_CRYPTO, sizeof(ns_memory), 1U, data, 16U);
+  /* Offset + size wrapping around 32 bits */
+  SetRequest(&requests[2], SECURE_REQ_CRYPTO, 0xFFFFFFF0U, 0x20U, data, 16U);
+  SetRequest(&requests[3], SECURE_REQ_CRYPTO, data, 16U, data + 16U, 16U);
+
+  HT_CHECK_EQ(SECURE_GATEWAY_Process(ns_memory, sizeof(ns_memory)), SECURE_OK);
+  HT_CHECK_EQ(Processed(), 4U);
+  HT_CHECK_EQ(requests[0].Status, SECURE_ERROR_PARAM);
+  HT_CHECK_EQ(requests[0].OutSize, 0U);
+  HT_CHECK_EQ(requests[1].Status, SECURE_ERROR_PARAM);
+  HT_CHECK_EQ(requests[2].Status, SECURE_ERROR_PARAM);
+  HT_CHECK_EQ(requests[3].Status, SECURE_OK);
+  HT_CHECK_EQ(service_calls, 1U);
+
+  /* Data in range of the buffer given by the caller, not of the memory */
+  requests = NewBatch(1U);
+  SetRequest(&requests[0], SECURE_REQ_CRYPTO, 64U, 16U, 80U, 16U);
+  HT_CHECK_EQ(SECURE_GATEWAY_Process(ns_memory, 88U), SECURE_OK);
+  HT_CHECK_EQ(requests[0].Status, SECURE_ERROR_PARAM);
+  HT_CHECK_EQ(service_calls, 0U);
+}
+
+static void TestOverlap(void)
+{
+  SECURE_RequestTypeDef *requests = NewBatch(6U);
+  const uint32_t data = SECURE_BATCH_DATA_OFFSET(6U);
+
+  /* Output overlapping the input, partly and fully */
+  SetRequest(&requests[0], SECURE_REQ_CRYPTO, data, 32U, data + 16U, 32U);
+  SetRequest(&requests[1], SECURE_REQ_CRYPTO, data + 16U, 32U, data, 32U);
+  SetRequest(&requests[2], SECURE_REQ_CRYPTO, data, 32U, data, 32U);
+  /* Input over the descriptors, output over the header */
+  SetRequest(&requests[3], SECURE_REQ_CRYPTO, data - 8U, 16U, data + 64U, 16U);
+  SetRequest(&requests[4], SECURE_REQ_KEY_READ, 0U, 0U, 0U, 8U);
+  /* Adjacent regions and an empty input at offset 0 are accepted */
+  SetRequest(&requests[5], SECURE_REQ_KEY_READ, 0U, 0U, data, 8U);
+
+  HT_CHECK_EQ(SECURE_GATEWAY_Process(ns_memory, sizeof(ns_memory)), SECURE_OK);
+  HT_CHECK_EQ(Processed(), 6U);
+  HT_CHECK_EQ(requests[0].Status, SECURE_ERROR_PARAM);
+  HT_CHECK_EQ(requests[1].Status, SECURE_ERROR_PARAM);
+  HT_CHECK_EQ(requests[2].Status, SECURE_ERROR_PARAM);
+  HT_CHECK_EQ(requests[3].Status, SECURE_ERROR_PARAM);
+  HT_CHECK_EQ(requests[4].Status, SECURE_ERROR_PARAM);
+  HT_CHECK_EQ(requests[4].OutSize, 0U);
+  HT_CHECK_EQ(requests[5].Status, SECURE_OK);
+  HT_CHECK_EQ(service_calls, 1U);
+
+  /* Header and descriptors left intact by the accepted request */
+  HT_CHECK_EQ(((SECURE_BatchTypeDef *)ns_memory)->Count, 6U);
+  HT_CHECK_EQ(requests[4].OutOffset, 0U);
+}
+
+static void TestUnknownType(void)
+{
+  SECURE_RequestTypeDef *requests = NewBatch(3U);
+  const uint32_t data = SECURE_BATCH_DATA_OFFSET(3U);
+
+  SetRequest(&requests[0], SECURE_REQ_COUNT, data, 8U, data + 8U, 8U);
+  SetRequest(&requests[1], 0xFFFFFFFFU, 0U, 0U, 0U, 0U);
+  /* Known type without a registered service */
+  SetRequest(&requests[2], SECURE_REQ_FLASH_WRITE, data, 8U, 0U, 0U);
+
+  HT_CHECK_EQ(SECURE_GATEWAY_Process(ns_memory, sizeof(ns_memory)), SECURE_OK);
+  HT_CHECK_EQ(Processed(), 3U);
+  HT_CHECK_EQ(requests[0].Status, SECURE_ERROR_UNSUPPORTED);
+  HT_CHECK_EQ(requests[0].OutSize, 0U);
+  HT_CHECK_EQ(requests[1].Status, SECURE_ERROR_UNSUPPORTED);
+  HT_CHECK_EQ(requests[2].Status, SECURE_ERROR_UNSUPPORTED);
+  HT_CHECK_EQ(service_calls, 0U);
+}
+
+static void TestEmptyBatch(void)
+{
+  (void)NewBatch(0U);
+
+  /* No room for the header */
+  HT_CHECK_EQ(SECURE_GATEWAY_Process(NULL, sizeof(ns_memory)), SECURE_ERROR_PARAM);
+  HT_CHECK_EQ(SECURE_GATEWAY_Process(ns_memory, 0U), SECURE_ERROR_PARAM);
+  HT_CHECK_EQ(SECURE_GATEWAY_Process(ns_memory, sizeof(SECURE_BatchTypeDef) - 1U), SECURE_ERROR_PARAM);
+  HT_CHECK_EQ(Processed(), 0xFFFFFFFFU);
+
+  /* Header alone, no request */
+  HT_CHECK_EQ(SECURE_GATEWAY_Process(ns_memory, sizeof(SECURE_BatchTypeDef)), SECURE_OK);
+  HT_CHECK_EQ(Processed(), 0U);
+  HT_CHECK_EQ(service_calls, 0U);
+}
+
+int main(void)
+{
+  TestRegister();
+  TestValidBatch();
+  TestOutOfRange();
+  TestOverlap();
+  TestUnknownType();
+  TestEmptyBatch();
+
+  return HostTest_Report("secure_gateway");
+}
@@ -0,0 +1,159 @@
+/**
+  ******************************************************************************
+  * @file    test_tickless_lptim.c
+  * @brief   Host test of the tickless idle conversion helpers.
+  *
+  *          Core at 400 MHz, 1 kHz tick, LPTIM1 on LSE: one tick is 400000
+  *          core cycles and 32.768 LPTIM counts.
+  ******************************************************************************
+  */
+
+#include "tickless_lptim.h"
+#include "host_test.h"
+#include <stdlib.h>
+
+#define CYCLE_HZ   400000000UL
+#define TICK_HZ    1000UL
+#define COUNT_HZ   TICKLESS_LPTIM_CLOCK_HZ
+#define RELOAD     (CYCLE_HZ / TICK_HZ)
+
+/* Core cycles spanned by a number of LPTIM counts, rounded down */
+static uint64_t CountsToCycles(uint32_t Counts)
+{
+  return ((uint64_t)Counts * CYCLE_HZ) / COUNT_HZ;
+}
+
+static void TestClamp(void)
+{
+  /* 10 s of idle time is far beyond the 16-bit counter */
+  HT_CHECK_EQ(TICKLESS_IdleCounts(10000U, RELOAD, RELOAD, CYCLE_HZ, COUNT_HZ), TICKLESS_LPTIM_MAX_COUNTS);
+
+  /* Largest idle time below the clamp: still converted exactly */
+  {
+    uint32_t ticks = (uint32_t)((TICKLESS_LPTIM_MAX_COUNTS * TICK_HZ) / COUNT_HZ) - 1U;
+    uint32_t counts = TICKLESS_IdleCounts(ticks, RELOAD, RELOAD, CYCLE_HZ, COUNT_HZ);
+
+    HT_CHECK(counts < TICKLESS_LPTIM_MAX_COUNTS);
+    HT_CHECK_EQ(counts, ((uint64_t)ticks * RELOAD * COUNT_HZ) / CYCLE_HZ);
+  }
+
+  /* No 64-bit overflow with the widest arguments */
+  HT_CHECK_EQ(TICKLESS_IdleCounts(0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 1U, 0xFFFFFFFFU),
+              TICKLESS_LPTIM_MAX_COUNTS);
+}
+
+static void TestShortIdle(void)
+{
+  uint32_t next = 0U;
+
+  /* Zero ticks: nothing to program, the caller aborts the sleep */
+  HT_CHECK_EQ(TICKLESS_IdleCounts(0U, RELOAD, RELOAD / 2U, CYCLE_HZ, COUNT_HZ), 0U);
+  HT_CHECK(TICKLESS_IdleCounts(0U, RELOAD, RELOAD / 2U, CYCLE_HZ, COUNT_HZ) < TICKLESS_LPTIM_MIN_COUNTS);
+
+  /* One tick: only the rest of the current tick */
+  HT_CHECK_EQ(TICKLESS_IdleCounts(1U, RELOAD, RELOAD, CYCLE_HZ, COUNT_HZ), 32U);
+  HT_CHECK_EQ(TICKLESS_IdleCounts(1U, RELOAD, RELOAD / 2U, CYCLE_HZ, COUNT_HZ), 16U);
+
+  /* Less than one count left in the tick rounds down to 0 */
+  HT_CHECK_EQ(TICKLESS_IdleCounts(1U, RELOAD, 12000U, CYCLE_HZ, COUNT_HZ), 0U);
+
+  /* Sleeping the programmed counts of a one-tick idle never crosses the tick */
+  HT_CHECK_EQ(TICKLESS_Compensate(32U, 1U, RELOAD, RELOAD, CYCLE_HZ, COUNT_HZ, &next), 0U);
+  HT_CHECK(next >= 1U);
+  HT_CHECK(next <= RELOAD);
+
+  /* Zero ticks expected: nothing stepped even after a long sleep */
+  HT_CHECK_EQ(TICKLESS_Compensate(1000U, 0U, RELOAD, RELOAD, CYCLE_HZ, COUNT_HZ, &next), 0U);
+}
+
+static void TestEarlyWake(void)
+{
+  uint32_t next = 0U;
+  uint32_t remaining = 300000U;
+  uint32_t ticks;
+
+  /* Interrupt before the pending tick: no tick, the phase moves on */
+  ticks = TICKLESS_Compensate(5U, 10U, RELOAD, remaining, CYCLE_HZ, COUNT_HZ, &next);
+  HT_CHECK_EQ(ticks, 0U);
+  HT_CHECK_EQ(next, remaining - CountsToCycles(5U));
+
+  /* Interrupt in the middle of the fourth tick of a 10-tick idle */
+  {
+    uint64_t slept = remaining + (2U * (uint64_t)RELOAD) + (RELOAD / 2U);
+    uint32_t counts = (uint32_t)((slept * COUNT_HZ) / CYCLE_HZ);
+    uint64_t measured = CountsToCycles(counts);
+
+    ticks = TICKLESS_Compensate(counts, 10U, RELOAD, remaining, CYCLE_HZ, COUNT_HZ, &next);
+    HT_CHECK_EQ(ticks, 3U);
+    HT_CHECK_EQ(next, RELOAD - ((measured - remaining) % RELOAD));
+    HT_CHECK(next > (RELOAD / 2U) - (CYCLE_HZ / COUNT_HZ));
+    HT_CHECK(next <= (RELOAD / 2U) + (CYCLE_HZ / COUNT_HZ));
+  }
+
+  /* Exactly on a tick boundary: that tick is counted, a full period follows */
+  ticks = TICKLESS_Compensate(32U, 10U, 400000U, 390625U, CYCLE_HZ, COUNT_HZ, &next);
+  HT_CHECK_EQ(ticks, 1U);
+  HT_CHECK_EQ(next, 400000U);
+
+  /* Late wake-up: never more than the kernel expected */
+  ticks = TICKLESS_Compensate(TICKLESS_LPTIM_MAX_COUNTS, 10U, RELOAD, remaining, CYCLE_HZ, COUNT_HZ, &next);
+  HT_CHECK_EQ(ticks, 10U);
+  HT_CHECK(next >= 1U);
+  HT_CHECK(next <= RELOAD);
+}
+
+static void TestCounterWrap(void)
+{
+  uint32_t start;
+
+  HT_CHECK_EQ(TICKLESS_Elapsed(0x1000U, 0x1000U), 0U);
+  HT_CHECK_EQ(TICKLESS_Elapsed(0x1000U, 0x1234U), 0x234U);
+  HT_CHECK_EQ(TICKLESS_Elapsed(0xFFF0U, 0x0010U), 0x20U);
+  HT_CHECK_EQ(TICKLESS_Elapsed(0xFFFFU, 0x0000U), 1U);
+
+  /* The longest sleep from any start value, compare and readback included */
+  for (start = 0U; start <= 0xFFFFU; start += 0x0FFFU)
+  {
+    uint32_t compare = (start + TICKLESS_LPTIM_MAX_COUNTS) & 0xFFFFU;
+
+    HT_CHECK_EQ(TICKLESS_Elapsed(start, compare), TICKLESS_LPTIM_MAX_COUNTS);
+  }
+
+  /* A late wake-up within the margin is still measured correctly */
+  HT_CHECK_EQ(TICKLESS_Elapsed(0x8000U, (0x8000U + TICKLESS_LPTIM_MAX_COUNTS + 0x0FFFU) & 0xFFFFU),
+              TICKLESS_LPTIM_MAX_COUNTS + 0x0FFFU);
+}
+
+/* Programmed sleep followed by the compensation, random phases and lengths:
+   the wake-up never passes the deadline and at most one tick is lost to the
+   count truncation */
+static void TestRoundTrip(void)
+{
+  uint32_t i;
+
+  srand(1U);
+  for (i = 0U; i < 100000U; i++)
+  {
+    uint32_t expected = 1U + ((uint32_t)rand() % 1800U);
+    uint32_t remaining = 1U + ((uint32_t)rand() % RELOAD);
+    uint32_t counts = TICKLESS_IdleCounts(expected, RELOAD, remaining, CYCLE_HZ, COUNT_HZ);
+    uint32_t next = 0U;
+    uint32_t ticks = TICKLESS_Compensate(counts, expected, RELOAD, remaining, CYCLE_HZ, COUNT_HZ, &next);
+
+    HT_CHECK(CountsToCycles(counts) <= remaining + ((uint64_t)(expected - 1U) * RELOAD));
+    HT_CHECK(ticks <= expected);
+    HT_CHECK(ticks + 1U >= expected);
+    HT_CHECK((next >= 1U) && (next <= RELOAD));
+  }
+}
+
+int main(void)
+{
+  TestClamp();
+  TestShortIdle();
+  TestEarlyWake();
+  TestCounterWrap();
+  TestRoundTrip();
+
+  return HostTest_Report("tickless_lptim");
+}
@@ -0,0 +1,186 @@
+/**
+  ******************************************************************************
+  * @file    test_workqueue_ring.c
+  * @brief   Host test of the SPSC work item ring.
+  *
+  *          Single thread: empty/full boundaries, FIFO order and the wrap of
+  *          the free-running Head/Tail indexes. Two threads: a producer and
+  *          a consumer run millions of items through a ring whose indexes
+  *          wrap during the run; every item must arrive once, in order and
+  *          untorn. The threads yield on a full or empty ring so the test
+  *          also progresses on a single core.
+  ******************************************************************************
+  */
+
+#define _POSIX_C_SOURCE 200809L
+
+/* Full fence between the item copy and the index update on the host */
+#define WQ_RING_BARRIER()   __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+#include "workqueue_ring.h"
+#include "host_test.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+
+#ifndef ITEMS_UNDER_LOAD
+#define ITEMS_UNDER_LOAD    4000000U
+#endif
+
+static void Handler(uint32_t Arg, void *Context)
+{
+  (void)Arg;
+  (void)Context;
+}
+
+/* Item contents derived from a sequence number, checked field by field */
+static void MakeItem(WQ_ItemTypeDef *Item, uint32_t Seq)
+{
+  Item->Handler   = Handler;
+  Item->Context   = (void *)(uintptr_t)(Seq * 2654435761U);
+  Item->Arg       = Seq;
+  Item->Timestamp = ~Seq;
+}
+
+static int ItemMatches(const WQ_ItemTypeDef *Item, uint32_t Seq)
+{
+  return (Item->Handler == Handler) &&
+         (Item->Context == (void *)(uintptr_t)(Seq * 2654435761U)) &&
+         (Item->Arg == Seq) &&
+         (Item->Timestamp == ~Seq);
+}
+
+static void TestBoundaries(uint32_t Start)
+{
+  static WQ_RingTypeDef ring;
+  WQ_ItemTypeDef item;
+  uint32_t seq;
+  uint32_t i;
+  uint32_t round;
+
+  ring.Head = Start;
+  ring.Tail = Start;
+
+  /* Empty */
+  HT_CHECK_EQ(WQ_RingPop(&ring, &item), 0U);
+
+  seq = 0U;
+  for (round = 0U; round < 3U; round++)
+  {
+    /* Fill: the returned depth counts up, then full */
+    for (i = 0U; i < WQ_RING_DEPTH; i++)
+    {
+      MakeItem(&item, seq + i);
+      HT_CHECK_EQ(WQ_RingPush(&ring, &item), i + 1U);
+    }
+    MakeItem(&item, 0xDEADU);
+    HT_CHECK_EQ(WQ_RingPush(&ring, &item), 0U);
+    HT_CHECK_EQ(ring.Head - ring.Tail, WQ_RING_DEPTH);
+
+    /* One slot freed: one push accepted, the next refused */
+    HT_CHECK_EQ(WQ_RingPop(&ring, &item), 1U);
+    HT_CHECK(ItemMatches(&item, seq));
+    MakeItem(&item, seq + WQ_RING_DEPTH);
+    HT_CHECK_EQ(WQ_RingPush(&ring, &item), WQ_RING_DEPTH);
+    HT_CHECK_EQ(WQ_RingPush(&ring, &item), 0U);
+
+    /* Drain in FIFO order, then empty */
+    for (i = 1U; i <= WQ_RING_DEPTH; i++)
+    {
+      HT_CHECK_EQ(WQ_RingPop(&ring, &item), 1U);
+      HT_CHECK(ItemMatches(&item, seq + i));
+    }
+    HT_CHECK_EQ(WQ_RingPop(&ring, &item), 0U);
+    HT_CHECK_EQ(ring.Head, ring.Tail);
+
+    seq += WQ_RING_DEPTH + 1U;
+  }
+}
+
+typedef struct
+{
+  WQ_RingTypeDef Ring;
+  uint32_t       FullCount;   /* Pushes refused, producer side  */
+  uint32_t       EmptyCount;  /* Pops on an empty ring          */
+  uint32_t       Errors;      /* Items out of order or torn     */
+  uint32_t       MaxDepth;    /* Highest depth seen by a push   */
+} LoadTypeDef;
+
+static void *Producer(void *Arg)
+{
+  LoadTypeDef *load = (LoadTypeDef *)Arg;
+  WQ_ItemTypeDef item;
+  uint32_t seq;
+  uint32_t depth;
+
+  for (seq = 0U; seq < ITEMS_UNDER_LOAD; seq++)
+  {
+    MakeItem(&item, seq);
+    while ((depth = WQ_RingPush(&load->Ring, &item)) == 0U)
+    {
+      load->FullCount++;
+      (void)sched_yield();
+    }
+    load->MaxDepth = (depth > load->MaxDepth) ? depth : load->MaxDepth;
+  }
+
+  return NULL;
+}
+
+static void *Consumer(void *Arg)
+{
+  LoadTypeDef *load = (LoadTypeDef *)Arg;
+  WQ_ItemTypeDef item;
+  uint32_t seq = 0U;
+
+  while (seq < ITEMS_UNDER_LOAD)
+  {
+    if (WQ_RingPop(&load->Ring, &item) == 0U)
+    {
+      load->EmptyCount++;
+      (void)sched_yield();
+      continue;
+    }
+    if (!ItemMatches(&item, seq))
+    {
+      load->Errors++;
+    }
+    seq++;
+  }
+
+  return NULL;
+}
+
+static void TestUnderLoad(void)
+{
+  static LoadTypeDef load;
+  pthread_t producer;
+  pthread_t consumer;
+
+  /* Indexes wrap after about a thousand items */
+  load.Ring.Head = 0xFFFFFC00U;
+  load.Ring.Tail = 0xFFFFFC00U;
+
+  HT_CHECK_EQ(pthread_create(&consumer, NULL, Consumer, &load), 0);
+  HT_CHECK_EQ(pthread_create(&producer, NULL, Producer, &load), 0);
+  HT_CHECK_EQ(pthread_join(producer, NULL), 0);
+  HT_CHECK_EQ(pthread_join(consumer, NULL), 0);
+
+  HT_CHECK_EQ(load.Errors, 0U);
+  HT_CHECK_EQ(load.Ring.Head, load.Ring.Tail);
+  HT_CHECK_EQ(load.Ring.Head, 0xFFFFFC00U + ITEMS_UNDER_LOAD);
+  HT_CHECK(load.MaxDepth <= WQ_RING_DEPTH);
+
+  printf("workqueue_ring: %u items, %u full pushes, %u empty pops, max depth %u\n",
+         ITEMS_UNDER_LOAD, load.FullCount, load.EmptyCount, load.MaxDepth);
+}
+
+int main(void)
+{
+  TestBoundaries(0U);
+  TestBoundaries(0xFFFFFFF8U);
+  TestBoundaries(0x7FFFFFFFU);
+  TestUnderLoad();
+
+  return HostTest_Report("workqueue_ring");
+}
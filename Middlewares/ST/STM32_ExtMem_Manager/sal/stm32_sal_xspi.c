@@ -27,6 +27,7 @@
 
 #include "stm32_sal_xspi_type.h"
 #include "stm32_sal_xspi_api.h"
+#include "stm32_extmem_recorder.h"
 
 /** @defgroup SAL_XSPI SAL_XSPI : Software adaptation layer for XSPI
   * @ingroup EXTMEM_SAL
@@ -157,6 +158,9 @@ HAL_StatusTypeDef XSPI_Receive(SAL_XSPI_ObjectTypeDef *SalXspi,  uint8_t *Data);
 void SAL_XSPI_ErrorCallback(struct __XSPI_HandleTypeDef *hxspi);
 void SAL_XSPI_CompleteCallback(struct __XSPI_HandleTypeDef *hxspi);
 #endif /* USE_HAL_XSPI_REGISTER_CALLBACKS */
+#if defined(EXTMEM_RECORDER_ENABLE) && (EXTMEM_RECORDER_ENABLE == 1)
+static uint8_t SAL_XSPI_RecorderId(const XSPI_HandleTypeDef *hxspi);
+#endif /* EXTMEM_RECORDER_ENABLE == 1 */
 
 /**
   * @}
@@ -467,6 +471,8 @@ HAL_StatusTypeDef SAL_XSPI_GetSFDP(SAL_XSPI_ObjectTypeDef *SalXspi, uint32_t Add
 {
   HAL_StatusTypeDef retr;
   XSPI_RegularCmdTypeDef s_command = SalXspi->Commandbase;
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_SAL_GET_SFDP, SAL_XSPI_RecorderId(SalXspi->hxspi),
+                   EXTMEM_READ_SFDP_COMMAND, Address, DataSize);
 
   /* Initialize the read ID command */
   s_command.Instruction = XSPI_FormatCommand(SalXspi->CommandExtension, s_command.InstructionWidth,
@@ -506,6 +512,8 @@ error:
     /* Abort any ongoing transaction for the next action */
     (void)HAL_XSPI_Abort(SalXspi->hxspi);
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_SAL_GET_SFDP, SAL_XSPI_RecorderId(SalXspi->hxspi),
+                  EXTMEM_READ_SFDP_COMMAND, Address, DataSize, retr);
   return retr;
 }
 
@@ -520,6 +528,8 @@ HAL_StatusTypeDef SAL_XSPI_GetId(SAL_XSPI_ObjectTypeDef *SalXspi, uint8_t *Data,
 {
   HAL_StatusTypeDef retr;
   XSPI_RegularCmdTypeDef s_command = SalXspi->Commandbase;
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_SAL_GET_ID, SAL_XSPI_RecorderId(SalXspi->hxspi),
+                   EXTMEM_READ_JEDEC_ID_SPI_COMMAND, 0u, DataSize);
 
   /* Initialize the Read ID command */
   s_command.Instruction = XSPI_FormatCommand(SalXspi->CommandExtension, s_command.InstructionWidth,
@@ -585,6 +595,8 @@ error:
     /* Abort any ongoing transaction for the next action */
     (void)HAL_XSPI_Abort(SalXspi->hxspi);
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_SAL_GET_ID, SAL_XSPI_RecorderId(SalXspi->hxspi),
+                  EXTMEM_READ_JEDEC_ID_SPI_COMMAND, 0u, DataSize, retr);
   return retr;
 }
 
@@ -602,6 +614,7 @@ HAL_StatusTypeDef SAL_XSPI_Read(SAL_XSPI_ObjectTypeDef *SalXspi, uint8_t Command
 {
   HAL_StatusTypeDef retr;
   XSPI_RegularCmdTypeDef s_command = SalXspi->Commandbase;
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_SAL_READ, SAL_XSPI_RecorderId(SalXspi->hxspi), Command, Address, DataSize);
 
   /* Initialize the read ID command */
   s_command.Instruction = XSPI_FormatCommand(SalXspi->CommandExtension, s_command.InstructionWidth, Command);
@@ -648,6 +661,7 @@ error:
     /* Abort any ongoing transaction for the next action */
     (void)HAL_XSPI_Abort(SalXspi->hxspi);
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_SAL_READ, SAL_XSPI_RecorderId(SalXspi->hxspi), Command, Address, DataSize, retr);
   return retr;
 }
 
@@ -665,6 +679,7 @@ HAL_StatusTypeDef SAL_XSPI_Write(SAL_XSPI_ObjectTypeDef *SalXspi, uint8_t Comman
 {
   HAL_StatusTypeDef retr;
   XSPI_RegularCmdTypeDef s_command = SalXspi->Commandbase;
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_SAL_WRITE, SAL_XSPI_RecorderId(SalXspi->hxspi), Command, Address, DataSize);
 
   /* Initialize the read ID command */
   s_command.Instruction = XSPI_FormatCommand(SalXspi->CommandExtension, s_command.InstructionWidth, Command);
@@ -690,6 +705,7 @@ error:
     /* Abort any ongoing transaction for the next action */
     (void)HAL_XSPI_Abort(SalXspi->hxspi);
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_SAL_WRITE, SAL_XSPI_RecorderId(SalXspi->hxspi), Command, Address, DataSize, retr);
   return retr;
 }
 
@@ -705,6 +721,7 @@ HAL_StatusTypeDef SAL_XSPI_CommandSendAddress(SAL_XSPI_ObjectTypeDef *SalXspi, u
 {
   HAL_StatusTypeDef retr;
   XSPI_RegularCmdTypeDef s_command = SalXspi->Commandbase;
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_SAL_SEND_ADDRESS, SAL_XSPI_RecorderId(SalXspi->hxspi), Command, Address, 0u);
 
   /* Initialize the writing of status register */
   s_command.Instruction = XSPI_FormatCommand(SalXspi->CommandExtension, s_command.InstructionWidth, Command);
@@ -726,6 +743,7 @@ HAL_StatusTypeDef SAL_XSPI_CommandSendAddress(SAL_XSPI_ObjectTypeDef *SalXspi, u
     /* Abort any ongoing transaction for the next action */
     (void)HAL_XSPI_Abort(SalXspi->hxspi);
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_SAL_SEND_ADDRESS, SAL_XSPI_RecorderId(SalXspi->hxspi), Command, Address, 0u, retr);
   return retr;
 }
 
@@ -742,6 +760,7 @@ HAL_StatusTypeDef SAL_XSPI_CommandSendData(SAL_XSPI_ObjectTypeDef *SalXspi, uint
 {
   XSPI_RegularCmdTypeDef   s_command = SalXspi->Commandbase;
   HAL_StatusTypeDef retr;
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_SAL_SEND_DATA, SAL_XSPI_RecorderId(SalXspi->hxspi), Command, 0u, DataSize);
 
   /* Initialize the writing of status register */
   s_command.Instruction = XSPI_FormatCommand(SalXspi->CommandExtension, s_command.InstructionWidth, Command);
@@ -769,6 +788,7 @@ HAL_StatusTypeDef SAL_XSPI_CommandSendData(SAL_XSPI_ObjectTypeDef *SalXspi, uint
     /* Abort any ongoing transaction for the next action */
     (void)HAL_XSPI_Abort(SalXspi->hxspi);
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_SAL_SEND_DATA, SAL_XSPI_RecorderId(SalXspi->hxspi), Command, 0u, DataSize, retr);
   return retr;
 }
 
@@ -785,6 +805,7 @@ HAL_StatusTypeDef SAL_XSPI_SendReadCommand(SAL_XSPI_ObjectTypeDef *SalXspi, uint
 {
   XSPI_RegularCmdTypeDef   s_command = SalXspi->Commandbase;
   HAL_StatusTypeDef retr;
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_SAL_SEND_READ, SAL_XSPI_RecorderId(SalXspi->hxspi), Command, 0u, DataSize);
 
   /* Initialize the reading of status register */
   s_command.Instruction = XSPI_FormatCommand(SalXspi->CommandExtension, s_command.InstructionWidth, Command);
@@ -813,6 +834,7 @@ HAL_StatusTypeDef SAL_XSPI_SendReadCommand(SAL_XSPI_ObjectTypeDef *SalXspi, uint
     /* Abort any ongoing transaction for the next action */
     (void)HAL_XSPI_Abort(SalXspi->hxspi);
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_SAL_SEND_READ, SAL_XSPI_RecorderId(SalXspi->hxspi), Command, 0u, DataSize, retr);
   return retr;
 }
 
@@ -832,6 +854,7 @@ HAL_StatusTypeDef SAL_XSPI_CommandSendReadAddress(SAL_XSPI_ObjectTypeDef *SalXsp
 {
   XSPI_RegularCmdTypeDef   s_command = SalXspi->Commandbase;
   HAL_StatusTypeDef retr;
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_SAL_SEND_READ_ADDR, SAL_XSPI_RecorderId(SalXspi->hxspi), Command, Address, DataSize);
 
   /* Initialize the reading of status register */
   s_command.Instruction = XSPI_FormatCommand(SalXspi->CommandExtension, s_command.InstructionWidth, Command);
@@ -869,6 +892,8 @@ HAL_StatusTypeDef SAL_XSPI_CommandSendReadAddress(SAL_XSPI_ObjectTypeDef *SalXsp
     /* Abort any ongoing transaction for the next action */
     (void)HAL_XSPI_Abort(SalXspi->hxspi);
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_SAL_SEND_READ_ADDR, SAL_XSPI_RecorderId(SalXspi->hxspi),
+                  Command, Address, DataSize, retr);
   return retr;
 }
 
@@ -897,6 +922,7 @@ HAL_StatusTypeDef SAL_XSPI_CheckStatusRegister(SAL_XSPI_ObjectTypeDef *SalXspi,
     .IntervalTime  = 0x10
   };
   HAL_StatusTypeDef retr;
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_SAL_CHECK_STATUS, SAL_XSPI_RecorderId(SalXspi->hxspi), Command, Address, Timeout);
 
   /* Initialize the reading of status register */
   s_command.Instruction = XSPI_FormatCommand(SalXspi->CommandExtension, s_command.InstructionWidth, Command);
@@ -939,6 +965,7 @@ HAL_StatusTypeDef SAL_XSPI_CheckStatusRegister(SAL_XSPI_ObjectTypeDef *SalXspi,
     /* Abort any ongoing transaction for the next action */
     (void)HAL_XSPI_Abort(SalXspi->hxspi);
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_SAL_CHECK_STATUS, SAL_XSPI_RecorderId(SalXspi->hxspi), Command, Address, Timeout, retr);
   return retr;
 }
 
@@ -953,6 +980,7 @@ HAL_StatusTypeDef SAL_XSPI_ConfigureWrappMode(SAL_XSPI_ObjectTypeDef *SalXspi, u
 {
   HAL_StatusTypeDef retr;
   XSPI_RegularCmdTypeDef s_command = SalXspi->Commandbase;
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_SAL_WRAP_MODE, SAL_XSPI_RecorderId(SalXspi->hxspi), WrapCommand, 0u, 0u);
 
   /* Initialize the read ID command */
   s_command.OperationType = HAL_XSPI_OPTYPE_WRAP_CFG;
@@ -971,6 +999,7 @@ error:
     /* Abort any ongoing transaction for the next action */
     (void)HAL_XSPI_Abort(SalXspi->hxspi);
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_SAL_WRAP_MODE, SAL_XSPI_RecorderId(SalXspi->hxspi), WrapCommand, 0u, 0u, retr);
   return retr;
 }
 
@@ -989,6 +1018,7 @@ HAL_StatusTypeDef SAL_XSPI_EnableMapMode(SAL_XSPI_ObjectTypeDef *SalXspi, uint8_
   HAL_StatusTypeDef retr;
   XSPI_RegularCmdTypeDef s_command = SalXspi->Commandbase;
   XSPI_MemoryMappedTypeDef sMemMappedCfg = {0};
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_SAL_ENABLE_MAP, SAL_XSPI_RecorderId(SalXspi->hxspi), CommandRead, 0u, 0u);
 
   /* Initialize the read ID command */
   s_command.OperationType = HAL_XSPI_OPTYPE_READ_CFG;
@@ -1023,6 +1053,7 @@ error:
     /* Abort any ongoing transaction for the next action */
     (void)HAL_XSPI_Abort(SalXspi->hxspi);
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_SAL_ENABLE_MAP, SAL_XSPI_RecorderId(SalXspi->hxspi), CommandRead, 0u, 0u, retr);
   return retr;
 }
 
@@ -1033,8 +1064,13 @@ error:
   **/
 HAL_StatusTypeDef SAL_XSPI_DisableMapMode(SAL_XSPI_ObjectTypeDef *SalXspi)
 {
+  HAL_StatusTypeDef retr;
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_SAL_DISABLE_MAP, SAL_XSPI_RecorderId(SalXspi->hxspi), 0u, 0u, 0u);
+
   __DSB();
-  return HAL_XSPI_Abort(SalXspi->hxspi);
+  retr = HAL_XSPI_Abort(SalXspi->hxspi);
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_SAL_DISABLE_MAP, SAL_XSPI_RecorderId(SalXspi->hxspi), 0u, 0u, 0u, retr);
+  return retr;
 }
 
 /**
@@ -1081,7 +1117,12 @@ HAL_StatusTypeDef SAL_XSPI_UpdateMemoryType(SAL_XSPI_ObjectTypeDef *SalXspi, SAL
 
 HAL_StatusTypeDef SAL_XSPI_Abort(SAL_XSPI_ObjectTypeDef *SalXspi)
 {
-  return HAL_XSPI_Abort(SalXspi->hxspi);
+  HAL_StatusTypeDef retr;
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_SAL_ABORT, SAL_XSPI_RecorderId(SalXspi->hxspi), 0u, 0u, 0u);
+
+  retr = HAL_XSPI_Abort(SalXspi->hxspi);
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_SAL_ABORT, SAL_XSPI_RecorderId(SalXspi->hxspi), 0u, 0u, 0u, retr);
+  return retr;
 }
 
 /**
@@ -1210,6 +1251,42 @@ HAL_StatusTypeDef XSPI_Receive(SAL_XSPI_ObjectTypeDef *SalXspi,  uint8_t *Data)
   return retr;
 }
 
+#if defined(EXTMEM_RECORDER_ENABLE) && (EXTMEM_RECORDER_ENABLE == 1)
+/**
+  * @brief This function returns the XSPI instance number used as memory identifier in the recorder
+  *
+  * @param hxspi Handle on the XSPI peripheral
+  * @return Instance number (1 for XSPI1, ...), 0 if the instance is unknown
+  */
+static uint8_t SAL_XSPI_RecorderId(const XSPI_HandleTypeDef *hxspi)
+{
+  uint8_t retr = 0u;
+#if defined(XSPI1)
+  if (hxspi->Instance == XSPI1)
+  {
+    retr = 1u;
+  }
+#if defined(XSPI2)
+  else if (hxspi->Instance == XSPI2)
+  {
+    retr = 2u;
+  }
+#endif /* XSPI2 */
+#if defined(XSPI3)
+  else if (hxspi->Instance == XSPI3)
+  {
+    retr = 3u;
+  }
+#endif /* XSPI3 */
+  else
+  {
+    /* Unknown instance */
+  }
+#endif /* XSPI1 */
+  return retr;
+}
+#endif /* EXTMEM_RECORDER_ENABLE == 1 */
+
 #if defined (USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
 /**
   * @brief This callback is executed when a DMA transfer error occurs
@@ -23,6 +23,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm32_extmem.h"
 #include "stm32_extmem_conf.h"
+#include "stm32_extmem_recorder.h"
 
 #if EXTMEM_DRIVER_NOR_SFDP == 1
 #include "nor_sfdp/stm32_sfdp_driver_api.h"
@@ -134,6 +135,7 @@ EXTMEM_StatusTypeDef EXTMEM_Init(uint32_t MemId, uint32_t ClockInput)
 {
   EXTMEM_StatusTypeDef retr = EXTMEM_ERROR_INVALID_ID;
   EXTMEM_FUNC_CALL();
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_INIT, MemId, 0u, 0u, ClockInput);
 
   /* Check the memory ID */
   if (MemId < (sizeof(extmem_list_config) / sizeof(EXTMEM_DefinitionTypeDef)))
@@ -234,6 +236,7 @@ EXTMEM_StatusTypeDef EXTMEM_Init(uint32_t MemId, uint32_t ClockInput)
       }
     }
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_INIT, MemId, 0u, 0u, ClockInput, retr);
   return retr;
 }
 
@@ -246,6 +249,7 @@ EXTMEM_StatusTypeDef EXTMEM_DeInit(uint32_t MemId)
 {
   EXTMEM_StatusTypeDef retr = EXTMEM_ERROR_INVALID_ID;
   EXTMEM_FUNC_CALL();
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_DEINIT, MemId, 0u, 0u, 0u);
 
   /* Check the memory ID */
   if (MemId < (sizeof(extmem_list_config) / sizeof(EXTMEM_DefinitionTypeDef)))
@@ -324,6 +328,7 @@ EXTMEM_StatusTypeDef EXTMEM_DeInit(uint32_t MemId)
       }
     }
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_DEINIT, MemId, 0u, 0u, 0u, retr);
   return retr;
 }
 
@@ -339,6 +344,7 @@ EXTMEM_StatusTypeDef EXTMEM_Read(uint32_t MemId, uint32_t Address, uint8_t *Data
 {
   EXTMEM_StatusTypeDef retr = EXTMEM_ERROR_INVALID_ID;
   EXTMEM_FUNC_CALL()
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_READ, MemId, 0u, Address, Size);
 
   /* Check the memory ID */
   if (MemId < (sizeof(extmem_list_config) / sizeof(EXTMEM_DefinitionTypeDef)))
@@ -421,6 +427,7 @@ EXTMEM_StatusTypeDef EXTMEM_Read(uint32_t MemId, uint32_t Address, uint8_t *Data
       }
     }
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_READ, MemId, 0u, Address, Size, retr);
   return retr;
 }
 
@@ -436,6 +443,7 @@ EXTMEM_StatusTypeDef EXTMEM_Write(uint32_t MemId, uint32_t Address, const uint8_
 {
   EXTMEM_StatusTypeDef retr = EXTMEM_ERROR_INVALID_ID;
   EXTMEM_FUNC_CALL()
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_WRITE, MemId, 0u, Address, Size);
 
   /* Check the memory ID */
   if (MemId < (sizeof(extmem_list_config) / sizeof(EXTMEM_DefinitionTypeDef)))
@@ -517,6 +525,7 @@ EXTMEM_StatusTypeDef EXTMEM_Write(uint32_t MemId, uint32_t Address, const uint8_
       }
     }
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_WRITE, MemId, 0u, Address, Size, retr);
   return retr;
 }
 
@@ -540,6 +549,7 @@ EXTMEM_StatusTypeDef EXTMEM_WriteInMappedMode(uint32_t MemId, uint32_t Address,
 {
   EXTMEM_StatusTypeDef retr = EXTMEM_ERROR_INVALID_ID;
   EXTMEM_FUNC_CALL()
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_WRITE_MAPPED, MemId, 0u, Address, Size);
 
   /* Check the memory ID */
   if (MemId < (sizeof(extmem_list_config) / sizeof(EXTMEM_DefinitionTypeDef)))
@@ -595,6 +605,7 @@ EXTMEM_StatusTypeDef EXTMEM_WriteInMappedMode(uint32_t MemId, uint32_t Address,
       }
     }
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_WRITE_MAPPED, MemId, 0u, Address, Size, retr);
   return retr;
 }
 
@@ -609,6 +620,7 @@ EXTMEM_StatusTypeDef EXTMEM_EraseSector(uint32_t MemId, uint32_t Address, uint32
 {
   EXTMEM_StatusTypeDef retr = EXTMEM_ERROR_INVALID_ID;
   EXTMEM_FUNC_CALL()
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_ERASE_SECTOR, MemId, 0u, Address, Size);
 
   /* Check the memory ID */
   if (MemId < (sizeof(extmem_list_config) / sizeof(EXTMEM_DefinitionTypeDef)))
@@ -762,6 +774,7 @@ EXTMEM_StatusTypeDef EXTMEM_EraseSector(uint32_t MemId, uint32_t Address, uint32
       }
     }
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_ERASE_SECTOR, MemId, 0u, Address, Size, retr);
   return retr;
 }
 
@@ -774,6 +787,7 @@ EXTMEM_StatusTypeDef EXTMEM_EraseAll(uint32_t MemId)
 {
   EXTMEM_StatusTypeDef retr = EXTMEM_ERROR_INVALID_ID;
   EXTMEM_FUNC_CALL()
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_ERASE_ALL, MemId, 0u, 0u, 0u);
 
   /* Check the memory ID */
   if (MemId < (sizeof(extmem_list_config) / sizeof(EXTMEM_DefinitionTypeDef)))
@@ -851,6 +865,7 @@ EXTMEM_StatusTypeDef EXTMEM_EraseAll(uint32_t MemId)
       }
     }
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_ERASE_ALL, MemId, 0u, 0u, 0u, retr);
   return retr;
 }
 
@@ -864,6 +879,7 @@ EXTMEM_StatusTypeDef EXTMEM_GetInfo(uint32_t MemId, void *Info)
 {
   EXTMEM_StatusTypeDef retr = EXTMEM_ERROR_INVALID_ID;
   EXTMEM_FUNC_CALL()
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_GET_INFO, MemId, 0u, 0u, 0u);
 
   /* Check the memory ID */
   if (MemId < (sizeof(extmem_list_config) / sizeof(EXTMEM_DefinitionTypeDef)))
@@ -933,6 +949,7 @@ EXTMEM_StatusTypeDef EXTMEM_GetInfo(uint32_t MemId, void *Info)
       }
     }
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_GET_INFO, MemId, 0u, 0u, 0u, retr);
   return retr;
 }
 
@@ -946,6 +963,7 @@ EXTMEM_StatusTypeDef EXTMEM_MemoryMappedMode(uint32_t MemId, EXTMEM_StateTypeDef
 {
   EXTMEM_StatusTypeDef retr = EXTMEM_ERROR_INVALID_ID;
   EXTMEM_FUNC_CALL();
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_MAPPED_MODE, MemId, 0u, 0u, State);
 
   /* Check the memory ID */
   if (MemId < (sizeof(extmem_list_config) / sizeof(EXTMEM_DefinitionTypeDef)))
@@ -965,7 +983,7 @@ EXTMEM_StatusTypeDef EXTMEM_MemoryMappedMode(uint32_t MemId, EXTMEM_StateTypeDef
           if (EXTMEM_DRIVER_NOR_SFDP_OK !=
               EXTMEM_DRIVER_NOR_SFDP_Enable_MemoryMappedMode(&extmem_list_config[MemId].NorSfdpObject))
           {
-            return EXTMEM_ERROR_DRIVER;
+            retr = EXTMEM_ERROR_DRIVER;
           }
         }
         else
@@ -974,7 +992,7 @@ EXTMEM_StatusTypeDef EXTMEM_MemoryMappedMode(uint32_t MemId, EXTMEM_StateTypeDef
           if (EXTMEM_DRIVER_NOR_SFDP_OK !=
               EXTMEM_DRIVER_NOR_SFDP_Disable_MemoryMappedMode(&extmem_list_config[MemId].NorSfdpObject))
           {
-            return EXTMEM_ERROR_DRIVER;
+            retr = EXTMEM_ERROR_DRIVER;
           }
         }
         break;
@@ -990,7 +1008,7 @@ EXTMEM_StatusTypeDef EXTMEM_MemoryMappedMode(uint32_t MemId, EXTMEM_StateTypeDef
           if (EXTMEM_DRIVER_PSRAM_OK !=
               EXTMEM_DRIVER_PSRAM_Enable_MemoryMappedMode(&extmem_list_config[MemId].PsramObject))
           {
-            return EXTMEM_ERROR_DRIVER;
+            retr = EXTMEM_ERROR_DRIVER;
           }
         }
         else
@@ -999,7 +1017,7 @@ EXTMEM_StatusTypeDef EXTMEM_MemoryMappedMode(uint32_t MemId, EXTMEM_StateTypeDef
           if (EXTMEM_DRIVER_PSRAM_OK !=
               EXTMEM_DRIVER_PSRAM_Disable_MemoryMappedMode(&extmem_list_config[MemId].PsramObject))
           {
-            return EXTMEM_ERROR_DRIVER;
+            retr = EXTMEM_ERROR_DRIVER;
           }
         }
         break;
@@ -1015,7 +1033,7 @@ EXTMEM_StatusTypeDef EXTMEM_MemoryMappedMode(uint32_t MemId, EXTMEM_StateTypeDef
           if (EXTMEM_DRV_CUSTOM_OK !=
               EXTMEM_DRIVER_CUSTOM_Enable_MemoryMappedMode(&extmem_list_config[MemId].CustomObject))
           {
-            return EXTMEM_ERROR_DRIVER;
+            retr = EXTMEM_ERROR_DRIVER;
           }
         }
         else
@@ -1024,7 +1042,7 @@ EXTMEM_StatusTypeDef EXTMEM_MemoryMappedMode(uint32_t MemId, EXTMEM_StateTypeDef
           if (EXTMEM_DRV_CUSTOM_OK !=
               EXTMEM_DRIVER_CUSTOM_Disable_MemoryMappedMode(&extmem_list_config[MemId].CustomObject))
           {
-            return EXTMEM_ERROR_DRIVER;
+            retr = EXTMEM_ERROR_DRIVER;
           }
         }
         break;
@@ -1074,6 +1092,7 @@ EXTMEM_StatusTypeDef EXTMEM_MemoryMappedMode(uint32_t MemId, EXTMEM_StateTypeDef
       }
     }
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_MAPPED_MODE, MemId, 0u, 0u, State, retr);
   return retr;
 }
 
@@ -1087,6 +1106,7 @@ EXTMEM_StatusTypeDef EXTMEM_GetMapAddress(uint32_t MemId, uint32_t *BaseAddress)
 {
   EXTMEM_StatusTypeDef retr = EXTMEM_ERROR_INVALID_ID;
   EXTMEM_FUNC_CALL();
+  EXTMEM_REC_ENTER(EXTMEM_REC_OP_GET_MAP_ADDRESS, MemId, 0u, 0u, 0u);
 
   /* Check the memory ID */
   if (MemId < (sizeof(extmem_list_config) / sizeof(EXTMEM_DefinitionTypeDef)))
@@ -1178,6 +1198,7 @@ EXTMEM_StatusTypeDef EXTMEM_GetMapAddress(uint32_t MemId, uint32_t *BaseAddress)
       }
     }
   }
+  EXTMEM_REC_EXIT(EXTMEM_REC_OP_GET_MAP_ADDRESS, MemId, 0u, 0u, 0u, retr);
   return retr;
 }
 /**
@@ -209,6 +209,20 @@ extern void EXTMEM_TRACE(uint8_t *Message);
   * @}
   */
 
+/** @defgroup EXTMEM_CONF_Exported_recorder EXTMEM_CONF exported binary trace recorder definition
+  * The recorder writes a fixed-size binary record in a RAM ring at the entry and exit of each
+  * EXTMEM function and SAL command. EXTMEM_REC_Init must be called before the first operation.\n
+  *              #define EXTMEM_RECORDER_ENABLE   0\n
+  *              #define EXTMEM_RECORDER_DEPTH    256u (power of 2, at most 0x8000)\n
+  *              #define EXTMEM_RECORDER_SECTION  ".noinit" (optional placement of the ring)
+  * @{
+  */
+#define EXTMEM_RECORDER_ENABLE               0
+#define EXTMEM_RECORDER_DEPTH                256u
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -0,0 +1,170 @@
+/**
+  ******************************************************************************
+  * @file    stm32_extmem_recorder.c
+  * @author  MCD Application Team
+  * @brief   This file implements the binary trace recorder of the EXTMEM module.
+  *
+  *          Each EXTMEM entry point and SAL command writes a fixed-size record
+  *          in a RAM ring. A slot is reserved with an exclusive access on the
+  *          ring head, so the recorder can be used from thread and interrupt
+  *          context without lock. The record is committed by writing its
+  *          sequence number last; the host decoder drops any record whose
+  *          sequence does not match its slot.
+  *
+  *          Timestamps come from the DWT cycle counter.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32_extmem.h"
+#include "stm32_extmem_conf.h"
+
+#if defined(EXTMEM_RECORDER_ENABLE) && (EXTMEM_RECORDER_ENABLE == 1)
+#include "stm32_extmem_recorder.h"
+
+/** @defgroup EXTMEM_RECORDER EXTMEM_RECORDER : Binary trace recorder
+  * @ingroup EXTMEM
+  * @{
+  */
+
+/* Exported variables ---------------------------------------------------------*/
+/**
+  * @brief Ring of records, located with the EXTMEM_RECORDER_SECTION attribute when defined
+  */
+#if defined(EXTMEM_RECORDER_SECTION)
+EXTMEM_REC_RingTypeDef extmem_recorder __attribute__((section(EXTMEM_RECORDER_SECTION)));
+#else
+EXTMEM_REC_RingTypeDef extmem_recorder;
+#endif /* EXTMEM_RECORDER_SECTION */
+
+/* Private functions ---------------------------------------------------------*/
+/** @defgroup EXTMEM_RECORDER_Private_Functions External Memory Recorder Private Functions
+  * @{
+  */
+
+/**
+  * @brief Reserves a slot in the ring and writes the record.
+  * @param OpId Operation identifier.
+  * @param MemId Memory identifier.
+  * @param Command Memory command.
+  * @param Address Memory address.
+  * @param Size Size in bytes.
+  * @param Status Returned status.
+  * @param Timestamp Current cycle counter value.
+  * @param Duration Cycles elapsed since the entry.
+  */
+static void EXTMEM_REC_Write(uint8_t OpId, uint8_t MemId, uint8_t Command, uint32_t Address, uint32_t Size,
+                             int8_t Status, uint32_t Timestamp, uint32_t Duration)
+{
+  EXTMEM_REC_RecordTypeDef *record;
+  uint32_t index;
+
+  /* Reserve the slot, safe against preemption by an interrupt recording its own operation */
+  do
+  {
+    index = __LDREXW(&extmem_recorder.Head);
+  } while (__STREXW(index + 1u, &extmem_recorder.Head) != 0u);
+
+  record = &extmem_recorder.Record[index & (EXTMEM_RECORDER_DEPTH - 1u)];
+
+  /* Invalidate the slot while it is filled */
+  record->Sequence  = 0u;
+  record->Timestamp = Timestamp;
+  record->OpId      = OpId;
+  record->MemId     = MemId;
+  record->Command   = Command;
+  record->Status    = Status;
+  record->Address   = Address;
+  record->Size      = Size;
+  record->Duration  = Duration;
+
+  /* Commit the record */
+  __DMB();
+  record->Sequence  = index + 1u;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup EXTMEM_RECORDER_Exported_Functions External Memory Recorder Exported Functions
+  * @{
+  */
+
+/**
+  * @brief Initializes the ring and starts the DWT cycle counter.
+  * @param CycleFrequency Frequency of the cycle counter in Hz (CPU clock), stored for the host decoder.
+  */
+void EXTMEM_REC_Init(uint32_t CycleFrequency)
+{
+  /* Start the cycle counter */
+  DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+  DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+
+  extmem_recorder.Head           = 0u;
+  extmem_recorder.RecordSize     = (uint16_t)sizeof(EXTMEM_REC_RecordTypeDef);
+  extmem_recorder.Depth          = (uint16_t)EXTMEM_RECORDER_DEPTH;
+  extmem_recorder.CycleFrequency = CycleFrequency;
+  for (uint32_t index = 0u; index < EXTMEM_RECORDER_DEPTH; index++)
+  {
+    extmem_recorder.Record[index].Sequence = 0u;
+  }
+  __DMB();
+  extmem_recorder.Magic          = EXTMEM_RECORDER_MAGIC;
+}
+
+/**
+  * @brief Records the entry of an operation.
+  * @param OpId Operation identifier (@ref EXTMEM_REC_OpTypeDef).
+  * @param MemId Memory identifier.
+  * @param Command Memory command.
+  * @param Address Memory address.
+  * @param Size Size in bytes.
+  * @retval Cycle counter value at the entry, to be passed to EXTMEM_REC_Exit.
+  */
+uint32_t EXTMEM_REC_Enter(uint8_t OpId, uint8_t MemId, uint8_t Command, uint32_t Address, uint32_t Size)
+{
+  const uint32_t start = DWT->CYCCNT;
+
+  EXTMEM_REC_Write(OpId, MemId, Command, Address, Size, 0, start, 0u);
+  return start;
+}
+
+/**
+  * @brief Records the exit of an operation.
+  * @param OpId Operation identifier (@ref EXTMEM_REC_OpTypeDef).
+  * @param MemId Memory identifier.
+  * @param Command Memory command.
+  * @param Address Memory address.
+  * @param Size Size in bytes.
+  * @param Status Returned status of the operation.
+  * @param Start Cycle counter value returned by EXTMEM_REC_Enter.
+  */
+void EXTMEM_REC_Exit(uint8_t OpId, uint8_t MemId, uint8_t Command, uint32_t Address, uint32_t Size,
+                     int8_t Status, uint32_t Start)
+{
+  const uint32_t now = DWT->CYCCNT;
+
+  EXTMEM_REC_Write((uint8_t)(OpId | EXTMEM_RECORDER_EXIT_FLAG), MemId, Command, Address, Size, Status,
+                   now, now - Start);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* EXTMEM_RECORDER_ENABLE == 1 */
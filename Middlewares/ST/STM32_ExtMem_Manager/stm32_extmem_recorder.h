@@ -0,0 +1,199 @@
+/**
+  ******************************************************************************
+  * @file    stm32_extmem_recorder.h
+  * @author  MCD Application Team
+  * @brief   This file contains the binary trace recorder of the EXTMEM module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32_EXTMEM_RECORDER_H_
+#define __STM32_EXTMEM_RECORDER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @addtogroup EXTMEM_RECORDER
+  * @{
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup EXTMEM_RECORDER_Exported_Constants External Memory Recorder Exported Constants
+  * @{
+  */
+
+/**
+  * @brief Default number of records of the ring (must be a power of 2, at most 0x8000 so that
+  *        it fits in the 16-bit Depth field of the header)
+  */
+#if !defined(EXTMEM_RECORDER_DEPTH)
+#define EXTMEM_RECORDER_DEPTH        256u
+#endif /* EXTMEM_RECORDER_DEPTH */
+
+#if (EXTMEM_RECORDER_DEPTH & (EXTMEM_RECORDER_DEPTH - 1u)) != 0u
+#error "EXTMEM_RECORDER_DEPTH must be a power of 2"
+#endif /* EXTMEM_RECORDER_DEPTH */
+
+#if (EXTMEM_RECORDER_DEPTH == 0u) || (EXTMEM_RECORDER_DEPTH > 0xFFFFu)
+#error "EXTMEM_RECORDER_DEPTH must be between 1 and 0xFFFF"
+#endif /* EXTMEM_RECORDER_DEPTH */
+
+/**
+  * @brief Signature of the ring header ("EXRC"), used by the host decoder to find the ring in a RAM dump
+  */
+#define EXTMEM_RECORDER_MAGIC        0x43525845u
+
+/**
+  * @brief Flag set in the record operation identifier for the exit records
+  */
+#define EXTMEM_RECORDER_EXIT_FLAG    0x80u
+
+/**
+  * @}
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup EXTMEM_RECORDER_Exported_Types External Memory Recorder Exported Types
+  * @{
+  */
+
+/**
+  * @brief Operation identifiers of the records
+  */
+typedef enum
+{
+  EXTMEM_REC_OP_INIT                 = 0x01u, /*!< EXTMEM_Init                     */
+  EXTMEM_REC_OP_DEINIT               = 0x02u, /*!< EXTMEM_DeInit                   */
+  EXTMEM_REC_OP_READ                 = 0x03u, /*!< EXTMEM_Read                     */
+  EXTMEM_REC_OP_WRITE                = 0x04u, /*!< EXTMEM_Write                    */
+  EXTMEM_REC_OP_WRITE_MAPPED         = 0x05u, /*!< EXTMEM_WriteInMappedMode        */
+  EXTMEM_REC_OP_ERASE_SECTOR         = 0x06u, /*!< EXTMEM_EraseSector              */
+  EXTMEM_REC_OP_ERASE_ALL            = 0x07u, /*!< EXTMEM_EraseAll                 */
+  EXTMEM_REC_OP_GET_INFO             = 0x08u, /*!< EXTMEM_GetInfo                  */
+  EXTMEM_REC_OP_MAPPED_MODE          = 0x09u, /*!< EXTMEM_MemoryMappedMode         */
+  EXTMEM_REC_OP_GET_MAP_ADDRESS      = 0x0Au, /*!< EXTMEM_GetMapAddress            */
+  EXTMEM_REC_OP_SAL_GET_SFDP         = 0x20u, /*!< SAL_XSPI_GetSFDP                */
+  EXTMEM_REC_OP_SAL_GET_ID           = 0x21u, /*!< SAL_XSPI_GetId                  */
+  EXTMEM_REC_OP_SAL_READ             = 0x22u, /*!< SAL_XSPI_Read                   */
+  EXTMEM_REC_OP_SAL_WRITE            = 0x23u, /*!< SAL_XSPI_Write                  */
+  EXTMEM_REC_OP_SAL_SEND_ADDRESS     = 0x24u, /*!< SAL_XSPI_CommandSendAddress     */
+  EXTMEM_REC_OP_SAL_SEND_DATA        = 0x25u, /*!< SAL_XSPI_CommandSendData        */
+  EXTMEM_REC_OP_SAL_SEND_READ        = 0x26u, /*!< SAL_XSPI_SendReadCommand        */
+  EXTMEM_REC_OP_SAL_SEND_READ_ADDR   = 0x27u, /*!< SAL_XSPI_CommandSendReadAddress */
+  EXTMEM_REC_OP_SAL_CHECK_STATUS     = 0x28u, /*!< SAL_XSPI_CheckStatusRegister    */
+  EXTMEM_REC_OP_SAL_WRAP_MODE        = 0x29u, /*!< SAL_XSPI_ConfigureWrappMode     */
+  EXTMEM_REC_OP_SAL_ENABLE_MAP       = 0x2Au, /*!< SAL_XSPI_EnableMapMode          */
+  EXTMEM_REC_OP_SAL_DISABLE_MAP      = 0x2Bu, /*!< SAL_XSPI_DisableMapMode         */
+  EXTMEM_REC_OP_SAL_ABORT            = 0x2Cu, /*!< SAL_XSPI_Abort                  */
+} EXTMEM_REC_OpTypeDef;
+
+/**
+  * @brief Record of the ring (24 bytes, layout shared with the host decoder)
+  */
+typedef struct
+{
+  uint32_t Sequence;   /*!< Write index + 1, written last to commit the record (0 : never written)   */
+  uint32_t Timestamp;  /*!< DWT cycle counter when the record is written                             */
+  uint8_t  OpId;       /*!< @ref EXTMEM_REC_OpTypeDef, ored with EXTMEM_RECORDER_EXIT_FLAG on exit    */
+  uint8_t  MemId;      /*!< EXTMEM memory identifier, XSPI instance number for the SAL records         */
+  uint8_t  Command;    /*!< Memory command for the SAL records, 0 otherwise                           */
+  int8_t   Status;     /*!< Returned status on exit (EXTMEM or HAL status), 0 on entry                */
+  uint32_t Address;    /*!< Memory address of the operation                                          */
+  uint32_t Size;       /*!< Size of the operation in bytes                                           */
+  uint32_t Duration;   /*!< Cycles elapsed between the entry and the exit, 0 on entry                */
+} EXTMEM_REC_RecordTypeDef;
+
+/**
+  * @brief Ring of records
+  */
+typedef struct
+{
+  uint32_t Magic;                                       /*!< EXTMEM_RECORDER_MAGIC once initialized       */
+  uint16_t RecordSize;                                  /*!< sizeof(EXTMEM_REC_RecordTypeDef)             */
+  uint16_t Depth;                                       /*!< Number of records in the ring                */
+  uint32_t CycleFrequency;                              /*!< Timestamp frequency in Hz                    */
+  volatile uint32_t Head;                               /*!< Number of records reserved since the init    */
+  EXTMEM_REC_RecordTypeDef Record[EXTMEM_RECORDER_DEPTH]; /*!< Records, index is Head modulo Depth      */
+} EXTMEM_REC_RingTypeDef;
+
+/**
+  * @}
+  */
+
+/* Exported macros -----------------------------------------------------------*/
+/** @defgroup EXTMEM_RECORDER_Exported_Macros External Memory Recorder Exported Macros
+  * @{
+  */
+#if defined(EXTMEM_RECORDER_ENABLE) && (EXTMEM_RECORDER_ENABLE == 1)
+/**
+  * @brief Macro used to record the entry of an operation, must be placed after the declarations
+  */
+#define EXTMEM_REC_ENTER(_OP_, _ID_, _CMD_, _ADDR_, _SIZE_)                                         \
+  const uint32_t rec_start = EXTMEM_REC_Enter((uint8_t)(_OP_), (uint8_t)(_ID_), (uint8_t)(_CMD_),   \
+                                              (uint32_t)(_ADDR_), (uint32_t)(_SIZE_))
+
+/**
+  * @brief Macro used to record the exit of an operation started with EXTMEM_REC_ENTER
+  */
+#define EXTMEM_REC_EXIT(_OP_, _ID_, _CMD_, _ADDR_, _SIZE_, _STATUS_)                                \
+  EXTMEM_REC_Exit((uint8_t)(_OP_), (uint8_t)(_ID_), (uint8_t)(_CMD_),                               \
+                  (uint32_t)(_ADDR_), (uint32_t)(_SIZE_), (int8_t)(_STATUS_), rec_start)
+#else
+#define EXTMEM_REC_ENTER(_OP_, _ID_, _CMD_, _ADDR_, _SIZE_)
+#define EXTMEM_REC_EXIT(_OP_, _ID_, _CMD_, _ADDR_, _SIZE_, _STATUS_)
+#endif /* EXTMEM_RECORDER_ENABLE == 1 */
+
+/**
+  * @}
+  */
+
+/* Exported variables --------------------------------------------------------*/
+/** @defgroup EXTMEM_RECORDER_Exported_Variables External Memory Recorder Exported Variables
+  * @{
+  */
+#if defined(EXTMEM_RECORDER_ENABLE) && (EXTMEM_RECORDER_ENABLE == 1)
+extern EXTMEM_REC_RingTypeDef extmem_recorder;
+#endif /* EXTMEM_RECORDER_ENABLE == 1 */
+
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup EXTMEM_RECORDER_Exported_Functions External Memory Recorder Exported Functions
+  * @{
+  */
+#if defined(EXTMEM_RECORDER_ENABLE) && (EXTMEM_RECORDER_ENABLE == 1)
+void     EXTMEM_REC_Init(uint32_t CycleFrequency);
+uint32_t EXTMEM_REC_Enter(uint8_t OpId, uint8_t MemId, uint8_t Command, uint32_t Address, uint32_t Size);
+void     EXTMEM_REC_Exit(uint8_t OpId, uint8_t MemId, uint8_t Command, uint32_t Address, uint32_t Size,
+                         int8_t Status, uint32_t Start);
+#endif /* EXTMEM_RECORDER_ENABLE == 1 */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32_EXTMEM_RECORDER_H_ */
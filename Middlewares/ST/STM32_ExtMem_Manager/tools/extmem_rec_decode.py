@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+# Decoder of the EXTMEM binary trace recorder (stm32_extmem_recorder.h)
+#
+# Usage: extmem_rec_decode.py <ram_dump.bin> [--base 0x341C0000] [--list]
+#
+# The dump is searched for the ring signature, the committed records are
+# sorted by sequence and the entry/exit pairs are reported as per-operation
+# latency histograms. Records overwritten or not committed when the dump was
+# taken are dropped.
+
+import argparse
+import struct
+import sys
+
+MAGIC = 0x43525845
+EXIT_FLAG = 0x80
+HEADER = struct.Struct("<IHHII")
+RECORD = struct.Struct("<IIBBBbIII")
+
+OPS = {
+    0x01: "EXTMEM_Init",
+    0x02: "EXTMEM_DeInit",
+    0x03: "EXTMEM_Read",
+    0x04: "EXTMEM_Write",
+    0x05: "EXTMEM_WriteInMappedMode",
+    0x06: "EXTMEM_EraseSector",
+    0x07: "EXTMEM_EraseAll",
+    0x08: "EXTMEM_GetInfo",
+    0x09: "EXTMEM_MemoryMappedMode",
+    0x0A: "EXTMEM_GetMapAddress",
+    0x20: "SAL_XSPI_GetSFDP",
+    0x21: "SAL_XSPI_GetId",
+    0x22: "SAL_XSPI_Read",
+    0x23: "SAL_XSPI_Write",
+    0x24: "SAL_XSPI_CommandSendAddress",
+    0x25: "SAL_XSPI_CommandSendData",
+    0x26: "SAL_XSPI_SendReadCommand",
+    0x27: "SAL_XSPI_CommandSendReadAddress",
+    0x28: "SAL_XSPI_CheckStatusRegister",
+    0x29: "SAL_XSPI_ConfigureWrappMode",
+    0x2A: "SAL_XSPI_EnableMapMode",
+    0x2B: "SAL_XSPI_DisableMapMode",
+    0x2C: "SAL_XSPI_Abort",
+}
+
+# Upper bounds of the histogram buckets in microseconds
+BUCKETS_US = [1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000, 100000]
+
+
+def find_ring(data):
+    """Returns the offset and header of the first valid ring in the dump."""
+    pattern = struct.pack("<I", MAGIC)
+    offset = data.find(pattern)
+    while offset >= 0:
+        if offset + HEADER.size <= len(data):
+            magic, rec_size, depth, freq, head = HEADER.unpack_from(data, offset)
+            if (rec_size == RECORD.size and depth != 0 and (depth & (depth - 1)) == 0
+                    and offset + HEADER.size + depth * rec_size <= len(data)):
+                return offset, rec_size, depth, freq, head
+        offset = data.find(pattern, offset + 1)
+    return None
+
+
+def read_records(data, offset, depth, head):
+    """Returns the committed records of the ring, ordered by sequence."""
+    records = []
+    first = max(0, head - depth)
+    for slot in range(depth):
+        seq, ts, op, mem, cmd, status, addr, size, duration = RECORD.unpack_from(
+            data, offset + HEADER.size + slot * RECORD.size)
+        # The sequence is written last, it must match both the slot and the live window of the ring
+        if seq == 0 or ((seq - 1) % depth) != slot or not (first < seq <= head):
+            continue
+        records.append((seq, ts, op, mem, cmd, status, addr, size, duration))
+    records.sort()
+    return records
+
+
+def op_name(op):
+    return OPS.get(op & ~EXIT_FLAG, "OP_0x%02X" % (op & ~EXIT_FLAG))
+
+
+def print_list(records, freq):
+    for seq, ts, op, mem, cmd, status, addr, size, duration in records:
+        if op & EXIT_FLAG:
+            print("%8u %10u  < %-32s mem=%u cmd=0x%02X addr=0x%08X size=%-8u status=%d %.2fus"
+                  % (seq, ts, op_name(op), mem, cmd, addr, size, status, duration * 1e6 / freq))
+        else:
+            print("%8u %10u  > %-32s mem=%u cmd=0x%02X addr=0x%08X size=%u"
+                  % (seq, ts, op_name(op), mem, cmd, addr, size))
+
+
+def print_histograms(records, freq):
+    latencies = {}
+    errors = {}
+    for _, _, op, _, _, status, _, _, duration in records:
+        if not op & EXIT_FLAG:
+            continue
+        key = op & ~EXIT_FLAG
+        latencies.setdefault(key, []).append(duration * 1e6 / freq)
+        if status != 0:
+            errors[key] = errors.get(key, 0) + 1
+
+    for key in sorted(latencies):
+        values = sorted(latencies[key])
+        count = len(values)
+        print("%s: count=%u errors=%u min=%.2fus p50=%.2fus p99=%.2fus max=%.2fus"
+              % (op_name(key), count, errors.get(key, 0), values[0], values[count // 2],
+                 values[min(count - 1, (count * 99) // 100)], values[-1]))
+        low = 0
+        for high in BUCKETS_US + [float("inf")]:
+            hits = sum(1 for value in values if low <= value < high)
+            if hits:
+                label = ">= %gus" % low if high == float("inf") else "< %gus" % high
+                print("  %-10s %6u %s" % (label, hits, "#" * max(1, (hits * 50) // count)))
+            low = high
+
+
+def main():
+    parser = argparse.ArgumentParser(description="EXTMEM binary trace decoder")
+    parser.add_argument("dump", help="binary RAM dump containing the extmem_recorder ring")
+    parser.add_argument("--base", type=lambda x: int(x, 0), default=0, help="address of the dump start")
+    parser.add_argument("--list", action="store_true", help="print every record")
+    args = parser.parse_args()
+
+    with open(args.dump, "rb") as file:
+        data = file.read()
+
+    ring = find_ring(data)
+    if ring is None:
+        sys.exit("extmem_recorder ring not found")
+    offset, _, depth, freq, head = ring
+    if freq == 0:
+        sys.exit("invalid cycle frequency in ring header")
+
+    records = read_records(data, offset, depth, head)
+    print("ring at 0x%08X: depth=%u head=%u freq=%uHz records=%u dropped=%u"
+          % (args.base + offset, depth, head, freq, len(records), max(0, head - depth)))
+    if args.list:
+        print_list(records, freq)
+    print_histograms(records, freq)
+
+
+if __name__ == "__main__":
+    main()
@@ -35,10 +35,78 @@ typedef enum
 SECURE_FAULT_CB_ID     = 0x00U, /*!< System secure fault callback ID */
   IAC_ERROR_CB_ID       = 0x01U  /*!< Illegal access secure error callback ID */
 } SECURE_CallbackIDTypeDef;
+
+/**
+  * @brief  Secure gateway request type enumeration definition
+  */
+typedef enum
+{
+  SECURE_REQ_NONE              = 0x00U, /*!< Empty slot, skipped                                                 */
+  SECURE_REQ_REGISTER_CALLBACK = 0x01U, /*!< Param[0]: SECURE_CallbackIDTypeDef, Param[1]: non-secure function */
+  SECURE_REQ_CRYPTO            = 0x02U, /*!< Param[0]: algorithm, input data processed into output data        */
+  SECURE_REQ_FLASH_WRITE       = 0x03U, /*!< Param[0]: flash offset, input data programmed                     */
+  SECURE_REQ_KEY_READ          = 0x04U, /*!< Param[0]: key slot, key copied into output data                   */
+  SECURE_REQ_COUNT             = 0x05U  /*!< Number of request types                                           */
+} SECURE_RequestTypeTypeDef;
+
+/**
+  * @brief  Secure gateway status enumeration definition
+  */
+typedef enum
+{
+  SECURE_OK                 =  0, /*!< Request done                                             */
+  SECURE_ERROR              = -1, /*!< Service failure                                          */
+  SECURE_ERROR_ACCESS       = -2, /*!< Batch buffer not fully readable/writable by non-secure   */
+  SECURE_ERROR_PARAM        = -3, /*!< Invalid batch header, data outside of the data area or
+                                       output overlapping input                                 */
+  SECURE_ERROR_UNSUPPORTED  = -4, /*!< No secure service for the request type                   */
+  SECURE_ERROR_PENDING      = -5  /*!< Request not processed yet                                */
+} SECURE_StatusTypeDef;
+
+/**
+  * @brief  Secure gateway request (32 bytes)
+  *         Input and output data are given as offsets in the batch buffer,
+  *         so that the single range check of the buffer covers them. They
+  *         start at or after SECURE_BATCH_DATA_OFFSET(Count) and must not
+  *         overlap each other (empty regions are ignored).
+  */
+typedef struct
+{
+  uint32_t Type;       /*!< SECURE_RequestTypeTypeDef                                        */
+  int32_t  Status;     /*!< SECURE_StatusTypeDef, written back by the secure side             */
+  uint32_t Param[2];   /*!< Request parameters                                               */
+  uint32_t InOffset;   /*!< Input data offset from the batch buffer start                    */
+  uint32_t InSize;     /*!< Input data size in bytes                                         */
+  uint32_t OutOffset;  /*!< Output data offset from the batch buffer start                   */
+  uint32_t OutSize;    /*!< Output capacity in bytes, written back with the produced size    */
+} SECURE_RequestTypeDef;
+
+/**
+  * @brief  Secure gateway batch buffer header, followed by Count requests
+  *         then by the input/output data
+  */
+typedef struct
+{
+  uint32_t Count;      /*!< Number of requests following the header                          */
+  uint32_t Processed;  /*!< Number of requests processed, written back by the secure side    */
+} SECURE_BatchTypeDef;
+
 /* Exported constants --------------------------------------------------------*/
 /* Exported macro ------------------------------------------------------------*/
+/**
+  * @brief  Address of the request array of a batch buffer
+  */
+#define SECURE_BATCH_REQUESTS(__BATCH__)  ((SECURE_RequestTypeDef *)((SECURE_BatchTypeDef *)(__BATCH__) + 1))
+
+/**
+  * @brief  Size of the batch header and of __COUNT__ requests, data offsets start there
+  */
+#define SECURE_BATCH_DATA_OFFSET(__COUNT__) \
+  (sizeof(SECURE_BatchTypeDef) + ((uint32_t)(__COUNT__) * sizeof(SECURE_RequestTypeDef)))
+
 /* Exported functions ------------------------------------------------------- */
 void SECURE_RegisterCallback(SECURE_CallbackIDTypeDef CallbackId, void *func);
+int32_t SECURE_Gateway(void *Batch, uint32_t Size);
 
 #endif /* SECURE_NSC_H */
 /* USER CODE END Non_Secure_CallLib_h */
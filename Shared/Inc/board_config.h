@@ -0,0 +1,19 @@
+/**
+  ******************************************************************************
+  * @file    board_config.h
+  * @brief   Board selection shared by the FSBL and the Appli.
+  *
+  *          Both images must agree on the board (PSRAM size, retention
+  *          header bounds), so the selection is made here only.
+  ******************************************************************************
+  */
+
+#ifndef BOARD_CONFIG_H
+#define BOARD_CONFIG_H
+
+/* Define board type: 0 for custom board, 1 for DK board */
+#ifndef DK_BOARD
+#define DK_BOARD 1
+#endif
+
+#endif /* BOARD_CONFIG_H */
@@ -0,0 +1,120 @@
+/**
+  ******************************************************************************
+  * @file    psram_retention.h
+  * @brief   PSRAM warm retention header.
+  *
+  *          A small header at the start of the PSRAM lists the regions whose
+  *          content must survive a software reset, each with a CRC-32 of its
+  *          content. The Appli adds regions then seals the header before a
+  *          warm reset (PSRAM_RetainAndReset()); on the next boot the FSBL
+  *          checks the header and every region, and drops the regions that
+  *          do not match so the Appli only reuses valid content.
+  *
+  *          Pure functions on memory buffers: no HAL, no register access.
+  ******************************************************************************
+  */
+
+#ifndef PSRAM_RETENTION_H
+#define PSRAM_RETENTION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define PSRAM_RETENTION_MAGIC          0x4E544552UL  /* "RETN" */
+#define PSRAM_RETENTION_VERSION        1U
+#define PSRAM_RETENTION_MAX_REGIONS    8U
+
+/* PSRAM bytes reserved for the header, regions start above */
+#define PSRAM_RETENTION_HEADER_RESERVED 0x100UL
+
+/* Return codes */
+#define PSRAM_RETENTION_OK             0
+#define PSRAM_RETENTION_ERROR_PARAM    -1
+#define PSRAM_RETENTION_ERROR_FULL     -2
+
+typedef struct
+{
+  uint32_t Offset;   /* Region offset from the PSRAM base       */
+  uint32_t Size;     /* Region size in bytes                    */
+  uint32_t Tag;      /* Region identifier chosen by the Appli   */
+  uint32_t Crc;      /* CRC-32 of the region content when sealed */
+} PSRAM_RetentionRegionTypeDef;
+
+typedef struct
+{
+  uint32_t Magic;                                              /* PSRAM_RETENTION_MAGIC              */
+  uint16_t Version;                                            /* PSRAM_RETENTION_VERSION            */
+  uint16_t Count;                                              /* Used entries of Region[]           */
+  uint32_t Generation;                                         /* Incremented on each seal           */
+  uint32_t Reserved;
+  PSRAM_RetentionRegionTypeDef Region[PSRAM_RETENTION_MAX_REGIONS];
+  uint32_t HeaderCrc;                                          /* CRC-32 of all the fields above     */
+} PSRAM_RetentionHeaderTypeDef;
+
+/**
+  * @brief  CRC-32 (IEEE 802.3, reflected) update.
+  * @param  Crc   Previous value, 0 to start
+  * @param  Data  Bytes to add
+  * @param  Size  Number of bytes
+  * @retval Updated CRC
+  */
+uint32_t PSRAM_RETENTION_Crc32(uint32_t Crc, const void *Data, uint32_t Size);
+
+/**
+  * @brief  Resets the header to an empty, sealed table.
+  */
+void PSRAM_RETENTION_Clear(PSRAM_RetentionHeaderTypeDef *Header);
+
+/**
+  * @brief  Checks the header alone: signature, version, CRC and region bounds.
+  * @param  Header      Header
+  * @param  MemorySize  PSRAM size in bytes
+  * @retval 1 if valid, 0 otherwise
+  */
+uint32_t PSRAM_RETENTION_IsValid(const PSRAM_RetentionHeaderTypeDef *Header, uint32_t MemorySize);
+
+/**
+  * @brief  Adds a region to retain. An invalid header is cleared first.
+  *         The region CRC is computed by PSRAM_RETENTION_Seal().
+  * @param  Header      Header
+  * @param  Offset      Region offset from the PSRAM base (>= PSRAM_RETENTION_HEADER_RESERVED)
+  * @param  Size        Region size in bytes (> 0)
+  * @param  Tag         Region identifier
+  * @param  MemorySize  PSRAM size in bytes
+  * @retval PSRAM_RETENTION_OK, PSRAM_RETENTION_ERROR_PARAM or PSRAM_RETENTION_ERROR_FULL
+  */
+int32_t PSRAM_RETENTION_AddRegion(PSRAM_RetentionHeaderTypeDef *Header, uint32_t Offset, uint32_t Size,
+                                  uint32_t Tag, uint32_t MemorySize);
+
+/**
+  * @brief  Computes the CRC of every region then seals the header.
+  * @param  Header  Header
+  * @param  Base    PSRAM base address (memory-mapped)
+  */
+void PSRAM_RETENTION_Seal(PSRAM_RetentionHeaderTypeDef *Header, const uint8_t *Base);
+
+/**
+  * @brief  Checks the header and the content of every region. Regions whose
+  *         CRC does not match are removed and the header is sealed again;
+  *         an invalid header is cleared.
+  * @param  Header      Header
+  * @param  Base        PSRAM base address (memory-mapped)
+  * @param  MemorySize  PSRAM size in bytes
+  * @retval Number of valid regions kept
+  */
+uint32_t PSRAM_RETENTION_Validate(PSRAM_RetentionHeaderTypeDef *Header, const uint8_t *Base, uint32_t MemorySize);
+
+/**
+  * @brief  Looks a region up by tag.
+  * @retval Region, NULL if the tag is not retained
+  */
+const PSRAM_RetentionRegionTypeDef *PSRAM_RETENTION_Find(const PSRAM_RetentionHeaderTypeDef *Header, uint32_t Tag);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PSRAM_RETENTION_H */
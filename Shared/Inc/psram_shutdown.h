@@ -5,6 +5,11 @@
   *
   *          Uses direct XSPI1 register access + HAL RCC/GPIO macros.
   *          Does NOT require HAL_XSPI_MODULE_ENABLED.
+  *
+  *          Optional warm retention: the PSRAM content is kept across the
+  *          reset (no Global Reset sent), the regions listed in the
+  *          retention header (psram_retention.h) are re-validated by the
+  *          FSBL on the next boot.
   ******************************************************************************
   */
 
@@ -16,6 +21,30 @@ extern "C" {
 #endif
 
 #include "stm32n6xx_hal.h"
+#include "board_config.h"
+#include "psram_retention.h"
+
+/* 1: the Appli resets with PSRAM_RetainAndReset(), 0: PSRAM_ShutdownAndReset() */
+#ifndef PSRAM_WARM_RETENTION
+#define PSRAM_WARM_RETENTION      0
+#endif
+
+/* PSRAM memory-mapped base (XSPI1) and size, used by the FSBL and the Appli */
+#define PSRAM_BASE_ADDRESS        0x90000000UL
+#if DK_BOARD == 1
+#define PSRAM_MEMORY_SIZE         0x02000000UL  /* 256 Mbits */
+#else
+#define PSRAM_MEMORY_SIZE         0x04000000UL  /* 512 Mbits */
+#endif
+
+/* Retention header, at the start of the PSRAM. The linker scripts mapping
+   data to XSPI1 keep the first PSRAM_RETENTION_HEADER_RESERVED bytes out of
+   their PSRAM region */
+#define PSRAM_RETENTION_HEADER    ((PSRAM_RetentionHeaderTypeDef *)PSRAM_BASE_ADDRESS)
+
+/* Warm reset request, kept in a TAMP backup register across the reset */
+#define PSRAM_WARM_BKP_REGISTER   (TAMP->BKP31R)
+#define PSRAM_WARM_MAGIC          0x5753524DUL
 
 /**
   * @brief  Complete PSRAM + XSPI1 teardown:
@@ -35,6 +64,24 @@ void PSRAM_Shutdown(void);
   */
 void PSRAM_ShutdownAndReset(void);
 
+/**
+  * @brief  Warm reset keeping the PSRAM content:
+  *         1. Seals the retention header (region CRCs) through the mapping
+  *         2. Records the warm reset request in a TAMP backup register
+  *         3. Same teardown as PSRAM_Shutdown() without the Global Reset
+  *         4. NVIC_SystemReset()
+  *         Falls back to PSRAM_ShutdownAndReset() when XSPI1 is not in
+  *         memory-mapped mode (header not reachable).
+  */
+void PSRAM_RetainAndReset(void);
+
+/**
+  * @brief  Tells whether this boot follows PSRAM_RetainAndReset(): software
+  *         reset and warm request recorded. The request is consumed.
+  * @retval 1 for a warm boot, 0 otherwise
+  */
+uint32_t PSRAM_IsWarmBoot(void);
+
 #ifdef __cplusplus
 }
 #endif
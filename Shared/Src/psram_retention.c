@@ -0,0 +1,179 @@
+/**
+  ******************************************************************************
+  * @file    psram_retention.c
+  * @brief   PSRAM warm retention header.
+  *
+  *          Header layout, CRC-32 and region checks. Used by the Appli to
+  *          describe the regions to keep across a warm reset, and by the
+  *          FSBL to re-validate them instead of reloading their content.
+  ******************************************************************************
+  */
+
+#include "psram_retention.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Bytes covered by the header CRC */
+#define PSRAM_RETENTION_CRC_SIZE  ((uint32_t)offsetof(PSRAM_RetentionHeaderTypeDef, HeaderCrc))
+
+/* CRC-32 (polynomial 0xEDB88320) of the 16 nibble values */
+static const uint32_t psram_crc32_nibble[16] =
+{
+  0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL,
+  0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+  0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL,
+  0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+};
+
+uint32_t PSRAM_RETENTION_Crc32(uint32_t Crc, const void *Data, uint32_t Size)
+{
+  const uint8_t *data = (const uint8_t *)Data;
+  uint32_t crc = ~Crc;
+
+  while (Size-- != 0U)
+  {
+    crc ^= *data++;
+    crc = (crc >> 4) ^ psram_crc32_nibble[crc & 0x0FU];
+    crc = (crc >> 4) ^ psram_crc32_nibble[crc & 0x0FU];
+  }
+
+  return ~crc;
+}
+
+/**
+  * @brief  Checks that a region lies in the PSRAM, above the header.
+  */
+static uint32_t PSRAM_RETENTION_RegionInRange(const PSRAM_RetentionRegionTypeDef *Region, uint32_t MemorySize)
+{
+  return ((Region->Size != 0U) && (Region->Offset >= PSRAM_RETENTION_HEADER_RESERVED) &&
+          (Region->Offset < MemorySize) && (Region->Size <= (MemorySize - Region->Offset))) ? 1U : 0U;
+}
+
+/**
+  * @brief  Updates the header CRC.
+  */
+static void PSRAM_RETENTION_SealHeader(PSRAM_RetentionHeaderTypeDef *Header)
+{
+  Header->HeaderCrc = PSRAM_RETENTION_Crc32(0U, Header, PSRAM_RETENTION_CRC_SIZE);
+}
+
+void PSRAM_RETENTION_Clear(PSRAM_RetentionHeaderTypeDef *Header)
+{
+  (void)memset(Header, 0, sizeof(*Header));
+  Header->Magic   = PSRAM_RETENTION_MAGIC;
+  Header->Version = PSRAM_RETENTION_VERSION;
+  PSRAM_RETENTION_SealHeader(Header);
+}
+
+uint32_t PSRAM_RETENTION_IsValid(const PSRAM_RetentionHeaderTypeDef *Header, uint32_t MemorySize)
+{
+  uint32_t index;
+
+  if ((Header->Magic != PSRAM_RETENTION_MAGIC) || (Header->Version != PSRAM_RETENTION_VERSION) ||
+      (Header->Count > PSRAM_RETENTION_MAX_REGIONS) ||
+      (Header->HeaderCrc != PSRAM_RETENTION_Crc32(0U, Header, PSRAM_RETENTION_CRC_SIZE)))
+  {
+    return 0U;
+  }
+
+  for (index = 0U; index < Header->Count; index++)
+  {
+    if (PSRAM_RETENTION_RegionInRange(&Header->Region[index], MemorySize) == 0U)
+    {
+      return 0U;
+    }
+  }
+
+  return 1U;
+}
+
+int32_t PSRAM_RETENTION_AddRegion(PSRAM_RetentionHeaderTypeDef *Header, uint32_t Offset, uint32_t Size,
+                                  uint32_t Tag, uint32_t MemorySize)
+{
+  PSRAM_RetentionRegionTypeDef region;
+
+  region.Offset = Offset;
+  region.Size   = Size;
+  region.Tag    = Tag;
+  region.Crc    = 0U;
+
+  if (PSRAM_RETENTION_RegionInRange(&region, MemorySize) == 0U)
+  {
+    return PSRAM_RETENTION_ERROR_PARAM;
+  }
+
+  if (PSRAM_RETENTION_IsValid(Header, MemorySize) == 0U)
+  {
+    PSRAM_RETENTION_Clear(Header);
+  }
+
+  if (Header->Count >= PSRAM_RETENTION_MAX_REGIONS)
+  {
+    return PSRAM_RETENTION_ERROR_FULL;
+  }
+
+  Header->Region[Header->Count] = region;
+  Header->Count++;
+  PSRAM_RETENTION_SealHeader(Header);
+
+  return PSRAM_RETENTION_OK;
+}
+
+void PSRAM_RETENTION_Seal(PSRAM_RetentionHeaderTypeDef *Header, const uint8_t *Base)
+{
+  uint32_t index;
+
+  for (index = 0U; index < Header->Count; index++)
+  {
+    Header->Region[index].Crc = PSRAM_RETENTION_Crc32(0U, &Base[Header->Region[index].Offset],
+                                                      Header->Region[index].Size);
+  }
+  Header->Generation++;
+  PSRAM_RETENTION_SealHeader(Header);
+}
+
+uint32_t PSRAM_RETENTION_Validate(PSRAM_RetentionHeaderTypeDef *Header, const uint8_t *Base, uint32_t MemorySize)
+{
+  uint32_t index;
+  uint32_t kept = 0U;
+
+  if (PSRAM_RETENTION_IsValid(Header, MemorySize) == 0U)
+  {
+    PSRAM_RETENTION_Clear(Header);
+    return 0U;
+  }
+
+  for (index = 0U; index < Header->Count; index++)
+  {
+    if (PSRAM_RETENTION_Crc32(0U, &Base[Header->Region[index].Offset], Header->Region[index].Size) ==
+        Header->Region[index].Crc)
+    {
+      Header->Region[kept] = Header->Region[index];
+      kept++;
+    }
+  }
+
+  if (kept != Header->Count)
+  {
+    (void)memset(&Header->Region[kept], 0, (Header->Count - kept) * sizeof(PSRAM_RetentionRegionTypeDef));
+    Header->Count = (uint16_t)kept;
+    PSRAM_RETENTION_SealHeader(Header);
+  }
+
+  return kept;
+}
+
+const PSRAM_RetentionRegionTypeDef *PSRAM_RETENTION_Find(const PSRAM_RetentionHeaderTypeDef *Header, uint32_t Tag)
+{
+  uint32_t index;
+
+  for (index = 0U; index < Header->Count; index++)
+  {
+    if (Header->Region[index].Tag == Tag)
+    {
+      return &Header->Region[index];
+    }
+  }
+
+  return NULL;
+}
@@ -35,7 +35,16 @@
 
 #define XSPI1_GPIOO_PINS  (GPIO_PIN_0 | GPIO_PIN_2 | GPIO_PIN_3 | GPIO_PIN_4)
 
+static void PSRAM_Teardown(uint32_t GlobalReset);
+static void PSRAM_BackupAccess(void);
+
 void PSRAM_Shutdown(void)
+{
+  PSRAM_Teardown(1U);
+}
+
+/* GlobalReset = 0 keeps the PSRAM content (warm retention) */
+static void PSRAM_Teardown(uint32_t GlobalReset)
 {
   /* ===== PHASE 1: Ensure XSPI1 is alive and can talk to PSRAM ========= */
 
@@ -55,17 +64,21 @@ void PSRAM_Shutdown(void)
   while (READ_BIT(XSPI1->SR, XSPI_SR_BUSY)) {}
 
   /* ===== PHASE 3: Send Global Reset (0xFF) to PSRAM chip ============== */
+  /*       Skipped for warm retention: the array and mode registers stay. */
 
-  WRITE_REG(XSPI1->CCR, PSRAM_GRESET_CCR);
-  WRITE_REG(XSPI1->TCR, 0U);
-  WRITE_REG(XSPI1->DLR, 0U);
-  WRITE_REG(XSPI1->IR,  0xFFU);                    /* triggers command */
+  if (GlobalReset != 0U)
+  {
+    WRITE_REG(XSPI1->CCR, PSRAM_GRESET_CCR);
+    WRITE_REG(XSPI1->TCR, 0U);
+    WRITE_REG(XSPI1->DLR, 0U);
+    WRITE_REG(XSPI1->IR,  0xFFU);                  /* triggers command */
 
-  while (!READ_BIT(XSPI1->SR, XSPI_SR_TCF)) {}
-  WRITE_REG(XSPI1->FCR, XSPI_FCR_CTCF);
+    while (!READ_BIT(XSPI1->SR, XSPI_SR_TCF)) {}
+    WRITE_REG(XSPI1->FCR, XSPI_FCR_CTCF);
 
-  /* tRST >= 2 us  (generous margin) */
-  for (volatile uint32_t d = 0; d < 2000U; d++) {}
+    /* tRST >= 2 us  (generous margin) */
+    for (volatile uint32_t d = 0; d < 2000U; d++) {}
+  }
 
   /* ===== PHASE 4: Tear down XSPI1 peripheral completely =============== */
 
@@ -93,3 +106,62 @@ void PSRAM_ShutdownAndReset(void)
   PSRAM_Shutdown();
   NVIC_SystemReset();
 }
+
+void PSRAM_RetainAndReset(void)
+{
+  PSRAM_RetentionHeaderTypeDef *header = PSRAM_RETENTION_HEADER;
+
+  __disable_irq();
+
+  /* The header is only reachable through the memory-mapped PSRAM */
+  if ((__HAL_RCC_XSPI1_IS_CLK_ENABLED() == 0U) || (READ_BIT(XSPI1->CR, XSPI_CR_EN) == 0U) ||
+      (READ_BIT(XSPI1->CR, XSPI_CR_FMODE) != XSPI_CR_FMODE))
+  {
+    PSRAM_Shutdown();
+    NVIC_SystemReset();
+  }
+
+  /* ===== Seal the retention header ==================================== */
+
+  if (PSRAM_RETENTION_IsValid(header, PSRAM_MEMORY_SIZE) == 0U)
+  {
+    PSRAM_RETENTION_Clear(header);
+  }
+  PSRAM_RETENTION_Seal(header, (const uint8_t *)PSRAM_BASE_ADDRESS);
+
+  /* Push pending writes to the PSRAM before the mapping is aborted */
+  if (READ_BIT(SCB->CCR, SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_CleanDCache();
+  }
+  __DSB();
+
+  /* ===== Record the warm reset request ================================ */
+
+  PSRAM_BackupAccess();
+  PSRAM_WARM_BKP_REGISTER = PSRAM_WARM_MAGIC;
+
+  PSRAM_Teardown(0U);
+  NVIC_SystemReset();
+}
+
+uint32_t PSRAM_IsWarmBoot(void)
+{
+  uint32_t warm;
+
+  PSRAM_BackupAccess();
+  warm = ((PSRAM_WARM_BKP_REGISTER == PSRAM_WARM_MAGIC) &&
+          (__HAL_RCC_GET_FLAG(RCC_FLAG_SFTRST) != 0U)) ? 1U : 0U;
+
+  /* One-shot request: a later reset is cold unless requested again */
+  PSRAM_WARM_BKP_REGISTER = 0U;
+
+  return warm;
+}
+
+/* TAMP backup registers: backup domain write access + RTC APB clock */
+static void PSRAM_BackupAccess(void)
+{
+  HAL_PWR_EnableBkUpAccess();
+  __HAL_RCC_RTCAPB_CLK_ENABLE();
+}